@@ -13,6 +13,7 @@
 
 TEMPLATE = app
 CONFIG += console
+CONFIG += c++11
 
 TARGET = blank
 
@@ -756,7 +756,47 @@ Vector<double> ConditionsLayer::calculate_outputs(const Vector<double>& external
    const Vector<double> particular_solution = calculate_particular_solution(external_inputs);
    const Vector<double> homogeneous_solution = calculate_homogeneous_solution(external_inputs);
 
-   return(particular_solution + homogeneous_solution*inputs);
+   return(particular_solution.lazy() + homogeneous_solution.lazy()*inputs.lazy());
+}
+
+
+// Matrix<double> calculate_particular_solution(const Matrix<double>&) const method
+
+/// Returns the particular solution values for a batch of instances.
+/// @param external_inputs Matrix of external inputs, with one instance per row.
+
+Matrix<double> ConditionsLayer::calculate_particular_solution(const Matrix<double>& external_inputs) const
+{
+   const size_t instances_number = external_inputs.get_rows_number();
+
+   Matrix<double> particular_solution(instances_number, conditions_neurons_number);
+
+   for(size_t i = 0; i < instances_number; i++)
+   {
+      particular_solution.set_row(i, calculate_particular_solution(external_inputs.arrange_row(i)));
+   }
+
+   return(particular_solution);
+}
+
+
+// Matrix<double> calculate_homogeneous_solution(const Matrix<double>&) const method
+
+/// Returns the homogeneous solution values for a batch of instances.
+/// @param external_inputs Matrix of external inputs, with one instance per row.
+
+Matrix<double> ConditionsLayer::calculate_homogeneous_solution(const Matrix<double>& external_inputs) const
+{
+   const size_t instances_number = external_inputs.get_rows_number();
+
+   Matrix<double> homogeneous_solution(instances_number, conditions_neurons_number);
+
+   for(size_t i = 0; i < instances_number; i++)
+   {
+      homogeneous_solution.set_row(i, calculate_homogeneous_solution(external_inputs.arrange_row(i)));
+   }
+
+   return(homogeneous_solution);
 }
 
 
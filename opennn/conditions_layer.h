@@ -144,6 +144,11 @@ public:
 
    Vector<double> calculate_outputs(const Vector<double>&, const Vector<double>&) const;
 
+   // Batch methods
+
+   Matrix<double> calculate_particular_solution(const Matrix<double>&) const;
+   Matrix<double> calculate_homogeneous_solution(const Matrix<double>&) const;
+
    Matrix<double> calculate_Jacobian(const Vector<double>&, const Vector<double>&, const Matrix<double>&) const;
 
    Vector< Matrix<double> > calculate_Hessian_form(const Vector<double>&, const Vector<double>&) const;
@@ -1809,6 +1809,8 @@ ConjugateGradient::ConjugateGradientResults* ConjugateGradient::perform_training
    double performance_increase = 0.0;
       
    Vector<double> gradient(parameters_number);
+
+   PerformanceFunctional::FirstOrderperformance first_order_performance;
    double gradient_norm;
 
    double generalization_performance = 0.0; 
@@ -1868,19 +1870,20 @@ ConjugateGradient::ConjugateGradientResults* ConjugateGradient::perform_training
 
       // Performance functional stuff
     
+      first_order_performance = performance_functional_pointer->calculate_performance_and_gradient();
+
+      performance = first_order_performance.performance;
+      gradient = first_order_performance.gradient;
+
       if(iteration == 0)
-      {      
-         performance = performance_functional_pointer->calculate_performance();
-         performance_increase = 0.0; 
+      {
+         performance_increase = 0.0;
       }
       else
       {
-         performance = directional_point[1];
          performance_increase = old_performance - performance; 
       }
 
-      gradient = performance_functional_pointer->calculate_gradient();
-
       gradient_norm = gradient.calculate_norm();
 
       if(display && gradient_norm >= warning_gradient_norm)
@@ -273,81 +273,15 @@ double CrossEntropyError::calculate_performance(void) const
 
    #endif
 
-   // Neural network stuff
-
-   const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
-
-   const size_t inputs_number = multilayer_perceptron_pointer->get_inputs_number();
-   const size_t outputs_number = multilayer_perceptron_pointer->get_outputs_number();
-
-   // Data set stuff 
+   // Data set stuff
 
    const Instances& instances = data_set_pointer->get_instances();
 
-   const size_t training_instances_number = instances.count_training_instances_number();
-
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
-   const MissingValues& missing_values = data_set_pointer->get_missing_values();
+   const Vector<size_t>& training_indices = instances.arrange_training_indices();
 
    // Cross entropy error
 
-   Vector<double> inputs(inputs_number);
-   Vector<double> outputs(outputs_number);
-   Vector<double> targets(outputs_number);
-
-   double cross_entropy_error = 0.0;
-
-   int i = 0;
-
-   #pragma omp parallel for private(i, training_index, inputs, outputs, targets) reduction(+ : cross_entropy_error)
-
-   for(i = 0; i < (int)training_instances_number; i++)
-   {
-       training_index = training_indices[i];
-
-       if(missing_values.has_missing_values(training_index))
-       {
-           continue;
-       }
-
-      // Input vector
-
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
-
-      // Output vector
-
-      outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
-
-      // Target vector
-
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
-
-      // Cross entropy error
-
-      for(size_t j = 0; j < outputs_number; j++)
-      {
-          if(outputs[j] == 0.0)
-          {
-              outputs[j] = 1.0e-6;
-          }
-          else if(outputs[j] == 1.0)
-          {
-              outputs[j] = 0.999999;
-          }
-
-          cross_entropy_error -= targets[j]*log(outputs[j]) + (1.0 - targets[j])*log(1.0 - outputs[j]);
-      }
-   }
-
-   return(cross_entropy_error);
+   return(calculate_error_sum(training_indices));
 }
 
 
@@ -397,20 +331,7 @@ double CrossEntropyError::calculate_performance(const Vector<double>& parameters
 
     // Data set stuff
 
-    const Instances& instances = data_set_pointer->get_instances();
-
-    const size_t training_instances_number = instances.count_training_instances_number();
-
-    const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-    size_t training_index;
-
-    const Variables& variables = data_set_pointer->get_variables();
-
-    const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-    const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
-    const MissingValues& missing_values = data_set_pointer->get_missing_values();
+    const size_t training_instances_number = data_set_pointer->count_training_rows_number();
 
     // Cross-entropy error stuff
 
@@ -422,29 +343,18 @@ double CrossEntropyError::calculate_performance(const Vector<double>& parameters
 
     int i = 0;
 
-    #pragma omp parallel for private(i, training_index, inputs, outputs, targets) reduction(+ : cross_entropy_error)
+    #pragma omp parallel for private(i, inputs, outputs, targets) reduction(+ : cross_entropy_error)
 
     for(i = 0; i < (int)training_instances_number; i++)
     {
-        training_index = training_indices[i];
+       // Input and target vectors
 
-        if(missing_values.has_missing_values(training_index))
-        {
-            continue;
-        }
-
-       // Input vector
-
-       inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+       data_set_pointer->arrange_training_row(i, inputs, targets);
 
        // Output vector
 
        outputs = multilayer_perceptron_pointer->calculate_outputs(inputs, parameters);
 
-       // Target vector
-
-       targets = data_set_pointer->get_instance(training_index, targets_indices);
-
        // Cross-entropy error
 
        for(size_t j = 0; j < outputs_number; j++)
@@ -490,20 +400,7 @@ double CrossEntropyError::calculate_minimum_performance(void) const
 
     // Data set stuff
 
-    const Instances& instances = data_set_pointer->get_instances();
-
-    const size_t training_instances_number = instances.count_training_instances_number();
-
-    const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-    size_t training_index;
-
-    const Variables& variables = data_set_pointer->get_variables();
-
-    const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-    const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
-    const MissingValues& missing_values = data_set_pointer->get_missing_values();
+    const size_t training_instances_number = data_set_pointer->count_training_rows_number();
 
     // Cross-entropy error stuff
 
@@ -515,29 +412,18 @@ double CrossEntropyError::calculate_minimum_performance(void) const
 
     int i = 0;
 
-    #pragma omp parallel for private(i, training_index, inputs, outputs, targets) reduction(+ : minimum_cross_entropy_error)
+    #pragma omp parallel for private(i, inputs, outputs, targets) reduction(+ : minimum_cross_entropy_error)
 
     for(i = 0; i < (int)training_instances_number; i++)
     {
-        training_index = training_indices[i];
+       // Input and target vectors
 
-        if(missing_values.has_missing_values(training_index))
-        {
-            continue;
-        }
-
-       // Input vector
-
-       inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+       data_set_pointer->arrange_training_row(i, inputs, targets);
 
        // Output vector
 
        outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
 
-       // Target vector
-
-       targets = data_set_pointer->get_instance(training_index, targets_indices);
-
        // Cross-entropy error
 
        for(size_t j = 0; j < outputs_number; j++)
@@ -573,81 +459,15 @@ double CrossEntropyError::calculate_generalization_performance(void) const
 
    #endif
 
-   // Neural network stuff
-
-   const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
-
-   const size_t inputs_number = multilayer_perceptron_pointer->get_inputs_number();
-   const size_t outputs_number = multilayer_perceptron_pointer->get_outputs_number();
-
    // Data set stuff
 
    const Instances& instances = data_set_pointer->get_instances();
 
-   const size_t generalization_instances_number = instances.count_generalization_instances_number();
-
-   const Vector<size_t> generalization_indices = instances.arrange_generalization_indices();
-
-   size_t generalization_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
-   const MissingValues& missing_values = data_set_pointer->get_missing_values();
-
-   // Performance functional
-
-   Vector<double> inputs(inputs_number);
-   Vector<double> outputs(outputs_number);
-   Vector<double> targets(outputs_number);
-
-   double generalization_performance = 0.0;
-
-   int i = 0;
-
-   #pragma omp parallel for private(i, generalization_index, inputs, outputs, targets) reduction(- : generalization_performance)
-
-   for(i = 0; i < (int)generalization_instances_number; i++)
-   {
-       generalization_index = generalization_indices[i];
-
-       if(missing_values.has_missing_values(generalization_index))
-       {
-           continue;
-       }
-
-      // Input vector
-
-      inputs = data_set_pointer->get_instance(generalization_index, inputs_indices);
-
-      // Output vector
-
-      outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
+   const Vector<size_t>& generalization_indices = instances.arrange_generalization_indices();
 
-      // Target vector
-
-      targets = data_set_pointer->get_instance(generalization_index, targets_indices);
-
-      // Cross entropy error
-
-      for(size_t j = 0; j < outputs_number; j++)
-      {
-          if(outputs[j] == 0.0)
-          {
-              outputs[j] = 1.0e-6;
-          }
-          else if(outputs[j] == 1.0)
-          {
-              outputs[j] = 0.999999;
-          }
-
-          generalization_performance -= targets[j]*log(outputs[j]) + (1.0 - targets[j])*log(1.0 - outputs[j]);
-      }
-   }
+   // Cross entropy error
 
-   return(generalization_performance);
+   return(calculate_error_sum(generalization_indices));
 }
 
 
@@ -675,20 +495,16 @@ double CrossEntropyError::calculate_minimum_generalization_performance(void) con
 
     // Data set stuff
 
-    const Instances& instances = data_set_pointer->get_instances();
-
-    const size_t generalization_instances_number = instances.count_generalization_instances_number();
+    const Vector<size_t> generalization_indices = data_set_pointer->arrange_complete_generalization_indices();
 
-    const Vector<size_t> generalization_indices = instances.arrange_generalization_indices();
+    const size_t generalization_instances_number = generalization_indices.size();
 
     size_t generalization_index;
 
     const Variables& variables = data_set_pointer->get_variables();
 
-    const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-    const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
-    const MissingValues& missing_values = data_set_pointer->get_missing_values();
+    const Vector<size_t>& inputs_indices = variables.arrange_inputs_indices();
+    const Vector<size_t>& targets_indices = variables.arrange_targets_indices();
 
     // Performance functional
 
@@ -706,11 +522,6 @@ double CrossEntropyError::calculate_minimum_generalization_performance(void) con
     {
         generalization_index = generalization_indices[i];
 
-        if(missing_values.has_missing_values(generalization_index))
-        {
-            continue;
-        }
-
        // Input vector
 
        inputs = data_set_pointer->get_instance(generalization_index, inputs_indices);
@@ -744,170 +555,133 @@ double CrossEntropyError::calculate_minimum_generalization_performance(void) con
 }
 
 
-// Vector<double> calculate_gradient(void) const
+// double calculate_batch_error(const Matrix<double>&, const Matrix<double>&) const method
 
-/// Returns the cross entropy error gradient of a neural network on a data set. 
-/// It uses the error back-propagation method.
-/// @todo
+/// Returns the cross entropy error of a batch of instances.
+/// Outputs equal to 0 or 1 are moved slightly inside that interval, so that the logarithms are defined.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
 
-Vector<double> CrossEntropyError::calculate_gradient(void) const
+double CrossEntropyError::calculate_batch_error(const Matrix<double>& outputs, const Matrix<double>& targets) const
 {
-   #ifdef __OPENNN_DEBUG__ 
+   const size_t size = outputs.size();
 
-   check();
+   double cross_entropy_error = 0.0;
 
-   #endif
+   double output;
 
-   // Neural network stuff
+   for(size_t i = 0; i < size; i++)
+   {
+      output = outputs[i];
 
-   const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
+      if(output == 0.0)
+      {
+          output = 1.0e-6;
+      }
+      else if(output == 1.0)
+      {
+          output = 0.999999;
+      }
 
-   const size_t inputs_number = multilayer_perceptron_pointer->get_inputs_number();
-   const size_t outputs_number = multilayer_perceptron_pointer->get_outputs_number();
+      cross_entropy_error -= targets[i]*log(output) + (1.0 - targets[i])*log(1.0 - output);
+   }
 
-   const size_t layers_number = multilayer_perceptron_pointer->get_layers_number();
+   return(cross_entropy_error);
+}
 
-   const size_t neural_parameters_number = multilayer_perceptron_pointer->count_parameters_number();
 
-   const bool has_conditions_layer = neural_network_pointer->has_conditions_layer();
+// Matrix<double> calculate_batch_output_gradient(const Matrix<double>&, const Matrix<double>&) const method
 
-   const ConditionsLayer* conditions_layer_pointer = has_conditions_layer ? neural_network_pointer->get_conditions_layer_pointer() : NULL;
+/// Returns the derivatives of the cross entropy error of each instance in a batch with respect to its outputs.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
 
-   #ifdef __OPENNN_DEBUG__ 
+Matrix<double> CrossEntropyError::calculate_batch_output_gradient(const Matrix<double>& outputs, const Matrix<double>& targets) const
+{
+   const size_t size = outputs.size();
 
-   std::ostringstream buffer;
+   Matrix<double> output_gradient(outputs.get_rows_number(), outputs.get_columns_number());
 
-   const Matrix<double> target_data = data_set_pointer->arrange_target_data();
+   double output;
 
-   if(target_data < 0.0)
+   for(size_t i = 0; i < size; i++)
    {
-      buffer << "OpenNN Exception: CrossEntropyError class.\n"
-             << "Vector<double> calculate_gradient(void) const method.\n"
-             << "Target data must be equal or greater than zero.\n";
+      output = outputs[i];
 
-      throw std::logic_error(buffer.str());
-   }
-
-   if(target_data > 1.0)
-   {
-      buffer << "OpenNN Exception: CrossEntropyError class.\n"
-             << "Vector<double> calculate_gradient(void) const method.\n"
-             << "Target data must be less or equal or than one.\n";
+      if(output == 0.0)
+      {
+          output = 1.0e-6;
+      }
+      else if(output == 1.0)
+      {
+          output = 0.999999;
+      }
 
-      throw std::logic_error(buffer.str());
+      output_gradient[i] = -targets[i]/output + (1.0 - targets[i])/(1.0 - output);
    }
 
-   #endif
-
-   // Neural network stuff    
+   return(output_gradient);
+}
 
-   Vector< Vector< Vector<double> > > first_order_forward_propagation(2); 
 
-   Vector<double> particular_solution;
-   Vector<double> homogeneous_solution;
+// Vector<double> calculate_gradient(void) const
 
-   // Data set stuff
+/// Returns the cross entropy error gradient of a neural network on a data set. 
+/// It uses the error back-propagation method.
+/// @todo
 
-   const Instances& instances = data_set_pointer->get_instances();
+Vector<double> CrossEntropyError::calculate_gradient(void) const
+{
+   #ifdef __OPENNN_DEBUG__ 
 
-   const size_t training_instances_number = instances.count_training_instances_number();
+   check();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
+   #endif
 
-   size_t training_index;
+   // Data set stuff
 
-   const Variables& variables = data_set_pointer->get_variables();
+   const Instances& instances = data_set_pointer->get_instances();
 
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
+   const Vector<size_t>& training_indices = instances.arrange_training_indices();
 
-   const MissingValues& missing_values = data_set_pointer->get_missing_values();
+   // Cross entropy error stuff
 
-   Vector<double> inputs(inputs_number);
-   Vector<double> targets(outputs_number);
+   return(calculate_error_gradient_sum(training_indices));
+}
 
-   // Cross-entropy error stuff
 
-   Vector<double> output_gradient(outputs_number);
+// FirstOrderPerformance calculate_performance_and_gradient(void) const method
 
-   Vector< Vector<double> > layers_delta; 
+/// Returns the cross entropy error and its gradient, computed from a single forward propagation of the training instances.
 
-   Vector<double> point_gradient(neural_parameters_number, 0.0);
+PerformanceTerm::FirstOrderPerformance CrossEntropyError::calculate_performance_and_gradient(void) const
+{
+   #ifdef __OPENNN_DEBUG__ 
 
-   Vector<double> gradient(neural_parameters_number, 0.0);
+   check();
 
-   for(size_t i = 0; i < training_instances_number; i++)
-   {
-       training_index = training_indices[i];
+   #endif
 
-       if(missing_values.has_missing_values(training_index))
-       {
-           continue;
-       }
+   // Data set stuff
 
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+   const Instances& instances = data_set_pointer->get_instances();
 
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
+   const Vector<size_t>& training_indices = instances.arrange_training_indices();
 
-      first_order_forward_propagation = multilayer_perceptron_pointer->calculate_first_order_forward_propagation(inputs);
+   // Cross entropy error stuff
 
-      const Vector< Vector<double> >& layers_activation = first_order_forward_propagation[0];
-      const Vector< Vector<double> >& layers_activation_derivative = first_order_forward_propagation[1];
+   return(calculate_error_sum_and_gradient_sum(training_indices));
+}
 
-      if(!has_conditions_layer)
-      {
-         const Vector<double>& outputs = layers_activation[layers_number-1];
-
-         for(size_t j = 0; j < outputs_number; j++)
-         {
-             if(outputs[j] == 0.0)
-             {
-                 output_gradient[j] = -targets[j]/1.e-6 + (1.0 - targets[j])/(1.0 - 1.e-6);
-             }
-             else if(outputs[j] == 1.0)
-             {
-                 output_gradient[j] = -targets[j]/0.999999 + (1.0 - targets[j])/(1.0 - 0.999999);
-             }
-             else
-             {
-                output_gradient[j] = -targets[j]/outputs[j] + (1.0 - targets[j])/(1.0 - outputs[j]);
-             }
-         }
-
-         layers_delta = calculate_layers_delta(layers_activation_derivative, output_gradient);
-      }
-      else
-      {
-         particular_solution = conditions_layer_pointer->calculate_particular_solution(inputs);
-         homogeneous_solution = conditions_layer_pointer->calculate_homogeneous_solution(inputs);
-
-         const Vector<double>& outputs = particular_solution + homogeneous_solution*layers_activation[layers_number-1];
-
-         for(size_t j = 0; j < outputs_number; j++)
-         {
-             if(outputs[j] == 0.0)
-             {
-                 output_gradient[j] = -targets[j]/1.e-6 + (1.0 - targets[j])/(1.0 - 1.e-6);
-             }
-             else if(outputs[j] == 1.0)
-             {
-                 output_gradient[j] = -targets[j]/0.999999 + (1.0 - targets[j])/(1.0 - 0.999999);
-             }
-             else
-             {
-                output_gradient[j] = -targets[j]/outputs[j] + (1.0 - targets[j])/(1.0 - outputs[j]);
-             }
-         }
-
-		 layers_delta = calculate_layers_delta(layers_activation_derivative, homogeneous_solution, output_gradient);
-      }
 
-      point_gradient = calculate_point_gradient(inputs, layers_activation, layers_delta);
+// double calculate_error_normalization_coefficient(void) const method
 
-      gradient += point_gradient;
-   }
+/// Returns the coefficient which divides the sum of the training errors to give the cross entropy error.
+/// It is one, because that error is the plain sum of the errors of the training instances.
 
-   return(gradient);
+double CrossEntropyError::calculate_error_normalization_coefficient(void) const
+{
+   return(1.0);
 }
 
 
@@ -0,0 +1,526 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.artelnics.com/opennn                                                                                   */
+/*                                                                                                              */
+/*   D A T A   B L O C K S   C L A S S                                                                          */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   Artelnics - Making intelligent use of data                                                                 */
+/*   robertolopez@artelnics.com                                                                                 */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// OpenNN includes
+
+#include "data_blocks.h"
+
+namespace OpenNN
+{
+
+// DEFAULT CONSTRUCTOR
+
+/// Default constructor.
+/// It creates a data blocks object which is not associated to any file.
+
+DataBlocks::DataBlocks(void)
+   : instances_number(0),
+     variables_number(0),
+     variables_information_position(0),
+     variables_information_size(0),
+     data_position(0),
+     column_stride(0),
+     bitmap_position(0),
+     bitmap_bytes_number(0),
+     block_instances_number(65536)
+{
+}
+
+
+// FILE CONSTRUCTOR
+
+/// File constructor.
+/// It creates a data blocks object and maps a binary data file.
+/// @param file_name Name of the binary data file.
+
+DataBlocks::DataBlocks(const std::string& file_name)
+   : instances_number(0),
+     variables_number(0),
+     variables_information_position(0),
+     variables_information_size(0),
+     data_position(0),
+     column_stride(0),
+     bitmap_position(0),
+     bitmap_bytes_number(0),
+     block_instances_number(65536)
+{
+   open(file_name);
+}
+
+
+// DESTRUCTOR
+
+/// Destructor.
+
+DataBlocks::~DataBlocks(void)
+{
+}
+
+
+// bool is_open(void) const method
+
+/// Returns true if the object is associated to a binary data file, and false otherwise.
+
+bool DataBlocks::is_open(void) const
+{
+   return(data_file.is_open());
+}
+
+
+// const std::string& get_file_name(void) const method
+
+/// Returns the name of the binary data file.
+
+const std::string& DataBlocks::get_file_name(void) const
+{
+   return(data_file.get_file_name());
+}
+
+
+// const size_t& get_instances_number(void) const method
+
+/// Returns the number of instances in the file.
+
+const size_t& DataBlocks::get_instances_number(void) const
+{
+   return(instances_number);
+}
+
+
+// const size_t& get_variables_number(void) const method
+
+/// Returns the number of variables in the file.
+
+const size_t& DataBlocks::get_variables_number(void) const
+{
+   return(variables_number);
+}
+
+
+// const size_t& get_block_instances_number(void) const method
+
+/// Returns the number of consecutive instances in each block.
+
+const size_t& DataBlocks::get_block_instances_number(void) const
+{
+   return(block_instances_number);
+}
+
+
+// size_t count_blocks_number(void) const method
+
+/// Returns the number of blocks of instances in the file.
+
+size_t DataBlocks::count_blocks_number(void) const
+{
+   return((instances_number + block_instances_number - 1)/block_instances_number);
+}
+
+
+// size_t get_block_index(const size_t&) const method
+
+/// Returns the index of the block which contains a given instance.
+/// @param instance_index Index of instance.
+
+size_t DataBlocks::get_block_index(const size_t& instance_index) const
+{
+   return(instance_index/block_instances_number);
+}
+
+
+// const double* get_column(const size_t&) const method
+
+/// Returns a pointer to the values of a variable for all the instances.
+/// The values are stored contiguously, and they are valid until the file is closed.
+/// @param variable_index Index of variable.
+
+const double* DataBlocks::get_column(const size_t& variable_index) const
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(variable_index >= variables_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: DataBlocks class.\n"
+             << "const double* get_column(const size_t&) const method.\n"
+             << "Index of variable (" << variable_index << ") must be less than number of variables (" << variables_number << ").\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   return(reinterpret_cast<const double*>(data_file.get_data() + data_position + variable_index*column_stride));
+}
+
+
+// const char* get_variables_information(void) const method
+
+/// Returns a pointer to the information of the variables, as written by DataSet::save_data_binary.
+
+const char* DataBlocks::get_variables_information(void) const
+{
+   return(data_file.get_data() + variables_information_position);
+}
+
+
+// const size_t& get_variables_information_size(void) const method
+
+/// Returns the size in bytes of the information of the variables.
+
+const size_t& DataBlocks::get_variables_information_size(void) const
+{
+   return(variables_information_size);
+}
+
+
+// bool has_missing_values_bitmap(void) const method
+
+/// Returns true if the file contains a missing values bitmap, and false otherwise.
+
+bool DataBlocks::has_missing_values_bitmap(void) const
+{
+   return(bitmap_position != 0);
+}
+
+
+// const unsigned char* get_missing_values_bitmap(const size_t&) const method
+
+/// Returns the missing values bitmap of a variable.
+/// Bit i%8 of byte i/8 is set if the value of instance i is missing.
+/// @param variable_index Index of variable.
+
+const unsigned char* DataBlocks::get_missing_values_bitmap(const size_t& variable_index) const
+{
+   return(reinterpret_cast<const unsigned char*>(data_file.get_data() + bitmap_position + variable_index*bitmap_bytes_number));
+}
+
+
+// void set_block_instances_number(const size_t&) method
+
+/// Sets the number of consecutive instances in each block.
+/// @param new_block_instances_number Number of instances per block.
+
+void DataBlocks::set_block_instances_number(const size_t& new_block_instances_number)
+{
+   if(new_block_instances_number == 0)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: DataBlocks class.\n"
+             << "void set_block_instances_number(const size_t&) method.\n"
+             << "Number of instances per block must be greater than zero.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   block_instances_number = new_block_instances_number;
+}
+
+
+// void open(const std::string&) method
+
+/// Maps a binary data file, as written by DataSet::save_data_binary, and reads its header.
+/// It throws an exception if the file cannot be opened, or if it is not a valid binary data file.
+/// @param file_name Name of the binary data file.
+
+void DataBlocks::open(const std::string& file_name)
+{
+   close();
+
+   data_file.open(file_name);
+
+   const char* file_data = data_file.get_data();
+   const size_t file_size = data_file.get_size();
+
+   const size_t header_size = 128;
+
+   if(file_size < header_size || memcmp(file_data, "OpenNNDS", 8) != 0)
+   {
+      data_file.close();
+
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: DataBlocks class.\n"
+             << "void open(const std::string&) method.\n"
+             << "File " << file_name << " is not a binary data file.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   if(file_data[8] != (char)sizeof(size_t) || file_data[9] != (char)sizeof(double))
+   {
+      data_file.close();
+
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: DataBlocks class.\n"
+             << "void open(const std::string&) method.\n"
+             << "Data file " << file_name << " was saved on a platform with different sizes of the size or value types.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   size_t header[10];
+
+   memcpy(header, file_data + 16, sizeof(header));
+
+   if(header[1] != 0x01020304)
+   {
+      data_file.close();
+
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: DataBlocks class.\n"
+             << "void open(const std::string&) method.\n"
+             << "Data file " << file_name << " was saved on a platform with a different byte order.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   if(header[0] != 1)
+   {
+      data_file.close();
+
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: DataBlocks class.\n"
+             << "void open(const std::string&) method.\n"
+             << "Unsupported binary data file version: " << header[0] << ".\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   instances_number = header[2];
+   variables_number = header[3];
+   variables_information_position = header[4];
+   variables_information_size = header[5];
+   data_position = header[6];
+   column_stride = header[7];
+   bitmap_position = header[8];
+   bitmap_bytes_number = header[9];
+
+   // All the sections must lie within the file
+
+   const bool corrupted = variables_information_position > file_size
+                       || variables_information_size > file_size - variables_information_position
+                       || data_position > file_size
+                       || data_position%sizeof(double) != 0
+                       || column_stride%sizeof(double) != 0
+                       || (instances_number != 0 && column_stride/sizeof(double) < instances_number)
+                       || (variables_number != 0 && column_stride > (file_size - data_position)/variables_number)
+                       || (bitmap_position != 0 && bitmap_bytes_number < (instances_number+7)/8)
+                       || (bitmap_position != 0 && bitmap_position > file_size)
+                       || (bitmap_position != 0 && variables_number != 0 && bitmap_bytes_number > (file_size - bitmap_position)/variables_number);
+
+   if(corrupted)
+   {
+      close();
+
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: DataBlocks class.\n"
+             << "void open(const std::string&) method.\n"
+             << "Corrupted binary data file: " << file_name << "\n";
+
+      throw std::logic_error(buffer.str());
+   }
+}
+
+
+// void close(void) method
+
+/// Unmaps the binary data file, if any.
+
+void DataBlocks::close(void)
+{
+   data_file.close();
+
+   instances_number = 0;
+   variables_number = 0;
+   variables_information_position = 0;
+   variables_information_size = 0;
+   data_position = 0;
+   column_stride = 0;
+   bitmap_position = 0;
+   bitmap_bytes_number = 0;
+}
+
+
+// void prefetch_block(const size_t&) const method
+
+/// Starts reading the values of a block of instances into memory in the background.
+/// It has no effect if the block index is not less than the number of blocks.
+/// @param block_index Index of block.
+
+void DataBlocks::prefetch_block(const size_t& block_index) const
+{
+   if(block_index >= count_blocks_number())
+   {
+      return;
+   }
+
+   const size_t first_instance = block_index*block_instances_number;
+   const size_t block_size = std::min(block_instances_number, instances_number - first_instance);
+
+   for(size_t j = 0; j < variables_number; j++)
+   {
+      data_file.prefetch(data_position + j*column_stride + first_instance*sizeof(double), block_size*sizeof(double));
+   }
+}
+
+
+// void release_block(const size_t&) const method
+
+/// Releases the memory which holds the values of a block of instances.
+/// The values are read again from the file if the block is accessed later.
+/// It has no effect if the block index is not less than the number of blocks.
+/// @param block_index Index of block.
+
+void DataBlocks::release_block(const size_t& block_index) const
+{
+   if(block_index >= count_blocks_number())
+   {
+      return;
+   }
+
+   const size_t first_instance = block_index*block_instances_number;
+   const size_t block_size = std::min(block_instances_number, instances_number - first_instance);
+
+   for(size_t j = 0; j < variables_number; j++)
+   {
+      data_file.release(data_position + j*column_stride + first_instance*sizeof(double), block_size*sizeof(double));
+   }
+}
+
+
+// Vector<double> arrange_row(const size_t&, const Vector<size_t>&) const method
+
+/// Returns the values of some variables for a single instance.
+/// @param instance_index Index of instance.
+/// @param variables_indices Indices of the variables.
+
+Vector<double> DataBlocks::arrange_row(const size_t& instance_index, const Vector<size_t>& variables_indices) const
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(instance_index >= instances_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: DataBlocks class.\n"
+             << "Vector<double> arrange_row(const size_t&, const Vector<size_t>&) const method.\n"
+             << "Index of instance (" << instance_index << ") must be less than number of instances (" << instances_number << ").\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   const size_t size = variables_indices.size();
+
+   Vector<double> row(size);
+
+   for(size_t j = 0; j < size; j++)
+   {
+      row[j] = get_column(variables_indices[j])[instance_index];
+   }
+
+   return(row);
+}
+
+
+// Matrix<double> arrange_submatrix(const Vector<size_t>&, const Vector<size_t>&) const method
+
+/// Returns the values of some variables for some instances.
+/// The instances are read in runs of consecutive instances of the same block.
+/// When a run enters a new block, the following block is prefetched,
+/// and the block of the previous run is released if the run has moved forward.
+/// @param instances_indices Indices of the instances, preferably in ascending order.
+/// @param variables_indices Indices of the variables.
+
+Matrix<double> DataBlocks::arrange_submatrix(const Vector<size_t>& instances_indices, const Vector<size_t>& variables_indices) const
+{
+   const size_t rows_number = instances_indices.size();
+   const size_t columns_number = variables_indices.size();
+
+   Matrix<double> submatrix(rows_number, columns_number);
+
+   size_t run_begin = 0;
+
+   while(run_begin < rows_number)
+   {
+      const size_t block_index = get_block_index(instances_indices[run_begin]);
+
+      size_t run_end = run_begin + 1;
+
+      while(run_end < rows_number && get_block_index(instances_indices[run_end]) == block_index)
+      {
+         run_end++;
+      }
+
+      if(run_begin != 0 || run_end != rows_number)
+      {
+         prefetch_block(block_index+1);
+      }
+
+      for(size_t j = 0; j < columns_number; j++)
+      {
+         const double* column = get_column(variables_indices[j]);
+
+         for(size_t i = run_begin; i < run_end; i++)
+         {
+            submatrix(i,j) = column[instances_indices[i]];
+         }
+      }
+
+      if(run_begin != 0)
+      {
+         const size_t previous_block_index = get_block_index(instances_indices[run_begin-1]);
+
+         if(previous_block_index < block_index)
+         {
+            release_block(previous_block_index);
+         }
+      }
+
+      run_begin = run_end;
+   }
+
+   return(submatrix);
+}
+
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (c) 2005-2015 Roberto Lopez.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -0,0 +1,174 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.artelnics.com/opennn                                                                                   */
+/*                                                                                                              */
+/*   D A T A   B L O C K S   C L A S S   H E A D E R                                                            */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   Artelnics - Making intelligent use of data                                                                 */
+/*   robertolopez@artelnics.com                                                                                 */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __DATABLOCKS_H__
+#define __DATABLOCKS_H__
+
+// System includes
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <sstream>
+#include <stdexcept>
+#include <cstring>
+
+// OpenNN includes
+
+#include "vector.h"
+#include "matrix.h"
+#include "memory_mapped_file.h"
+
+namespace OpenNN
+{
+
+/// This class gives access to the values of a binary data file, as written by DataSet::save_data_binary,
+/// without loading them into memory.
+/// The file is memory mapped, and the instances are grouped into blocks of consecutive rows.
+/// When the instances are read in order, the next block is prefetched in the background,
+/// and the blocks which have been left behind are released, so that only a window of blocks is resident.
+/// This allows to work with data sets which are larger than the available memory.
+
+class DataBlocks
+{
+
+public:
+
+   // DEFAULT CONSTRUCTOR
+
+   explicit DataBlocks(void);
+
+   // FILE CONSTRUCTOR
+
+   explicit DataBlocks(const std::string&);
+
+   // DESTRUCTOR
+
+   virtual ~DataBlocks(void);
+
+   // GET METHODS
+
+   bool is_open(void) const;
+
+   const std::string& get_file_name(void) const;
+
+   const size_t& get_instances_number(void) const;
+   const size_t& get_variables_number(void) const;
+
+   const size_t& get_block_instances_number(void) const;
+
+   size_t count_blocks_number(void) const;
+   size_t get_block_index(const size_t&) const;
+
+   const double* get_column(const size_t&) const;
+
+   const char* get_variables_information(void) const;
+   const size_t& get_variables_information_size(void) const;
+
+   bool has_missing_values_bitmap(void) const;
+   const unsigned char* get_missing_values_bitmap(const size_t&) const;
+
+   // SET METHODS
+
+   void set_block_instances_number(const size_t&);
+
+   // FILE METHODS
+
+   void open(const std::string&);
+   void close(void);
+
+   // BLOCK METHODS
+
+   void prefetch_block(const size_t&) const;
+   void release_block(const size_t&) const;
+
+   // DATA METHODS
+
+   Vector<double> arrange_row(const size_t&, const Vector<size_t>&) const;
+
+   Matrix<double> arrange_submatrix(const Vector<size_t>&, const Vector<size_t>&) const;
+
+private:
+
+   // COPY CONSTRUCTOR
+
+   DataBlocks(const DataBlocks&);
+
+   // ASSIGNMENT OPERATOR
+
+   DataBlocks& operator = (const DataBlocks&);
+
+   // MEMBERS
+
+   /// Memory mapped binary data file.
+
+   MemoryMappedFile data_file;
+
+   /// Number of instances in the file.
+
+   size_t instances_number;
+
+   /// Number of variables in the file.
+
+   size_t variables_number;
+
+   /// Position in the file of the variables information.
+
+   size_t variables_information_position;
+
+   /// Size in bytes of the variables information.
+
+   size_t variables_information_size;
+
+   /// Position in the file of the values of the first variable.
+
+   size_t data_position;
+
+   /// Distance in bytes between the values of consecutive variables.
+
+   size_t column_stride;
+
+   /// Position in the file of the missing values bitmap, or zero if there are no missing values.
+
+   size_t bitmap_position;
+
+   /// Number of bytes of the missing values bitmap of each variable.
+
+   size_t bitmap_bytes_number;
+
+   /// Number of consecutive instances in each block.
+
+   size_t block_instances_number;
+};
+
+}
+
+#endif
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (c) 2005-2015 Roberto Lopez.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
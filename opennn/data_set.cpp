@@ -15,6 +15,14 @@
 
 #include "data_set.h"
 
+// System includes
+
+#include <cctype>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 
 namespace OpenNN
 {
@@ -148,6 +156,8 @@ DataSet& DataSet::operator = (const DataSet& other_data_set)
 
       data = other_data_set.data;
 
+      training_rows_arranged = false;
+
       // Variables
 
       variables = other_data_set.variables;
@@ -246,11 +256,11 @@ const bool& DataSet::get_display(void) const
 
 // bool empty(void) const method
 
-/// Returns true if the data matrix is empty, and false otherwise.
+/// Returns true if the data matrix is empty and the data set is not backed by a binary data file, and false otherwise.
 
 bool DataSet::empty(void) const
 {
-   return(data.empty());
+   return(data.empty() && data_blocks_pointer == NULL);
 }
 
 
@@ -266,6 +276,47 @@ const Matrix<double>& DataSet::get_data(void) const
 }
 
 
+// DataBlocks* get_data_blocks_pointer(void) const method
+
+/// Returns a pointer to the binary data file which holds the values of the data set,
+/// or NULL if the values are held by the data matrix.
+
+DataBlocks* DataSet::get_data_blocks_pointer(void) const
+{
+   return(data_blocks_pointer);
+}
+
+
+// bool has_data_blocks(void) const method
+
+/// Returns true if the values of the data set are held by a binary data file, and false otherwise.
+
+bool DataSet::has_data_blocks(void) const
+{
+   return(data_blocks_pointer != NULL);
+}
+
+
+// Matrix<double> arrange_data_submatrix(const Vector<size_t>&, const Vector<size_t>&) const method
+
+/// Returns the values of some variables for some instances,
+/// either from the data matrix or from the binary data file which backs the data set.
+/// @param instances_indices Indices of the instances.
+/// @param variables_indices Indices of the variables.
+
+Matrix<double> DataSet::arrange_data_submatrix(const Vector<size_t>& instances_indices, const Vector<size_t>& variables_indices) const
+{
+   if(data_blocks_pointer != NULL)
+   {
+      return(data_blocks_pointer->arrange_submatrix(instances_indices, variables_indices));
+   }
+   else
+   {
+      return(data.arrange_submatrix(instances_indices, variables_indices));
+   }
+}
+
+
 // const Matrix<double>& get_time_series_data(void) const method
 
 /// Returns a reference to the time series data matrix in the data set.
@@ -658,9 +709,9 @@ Matrix<double> DataSet::arrange_training_data(void) const
    
    Vector<size_t> variables_indices(0, 1, (int)variables_number-1);
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
+   const Vector<size_t>& training_indices = instances.arrange_training_indices();
 
-   return(data.arrange_submatrix(training_indices, variables_indices));
+   return(arrange_data_submatrix(training_indices, variables_indices));
 }
 
 
@@ -674,11 +725,11 @@ Matrix<double> DataSet::arrange_generalization_data(void) const
 {
    const size_t variables_number = variables.get_variables_number();
 
-   const Vector<size_t> generalization_indices = instances.arrange_generalization_indices();
+   const Vector<size_t>& generalization_indices = instances.arrange_generalization_indices();
 
    Vector<size_t> variables_indices(0, 1, (int)variables_number-1);
 
-   return(data.arrange_submatrix(generalization_indices, variables_indices));
+   return(arrange_data_submatrix(generalization_indices, variables_indices));
 }
 
 
@@ -693,9 +744,9 @@ Matrix<double> DataSet::arrange_testing_data(void) const
    const size_t variables_number = variables.get_variables_number();
    Vector<size_t> variables_indices(0, 1, (int)variables_number-1);
 
-   const Vector<size_t> testing_indices = instances.arrange_testing_indices();
+   const Vector<size_t>& testing_indices = instances.arrange_testing_indices();
 
-   return(data.arrange_submatrix(testing_indices, variables_indices));
+   return(arrange_data_submatrix(testing_indices, variables_indices));
 }
 
 
@@ -710,9 +761,9 @@ Matrix<double> DataSet::arrange_input_data(void) const
    const size_t instances_number = instances.get_instances_number();
    Vector<size_t> indices(0, 1, (int)instances_number-1);
 
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
+   const Vector<size_t>& inputs_indices = variables.arrange_inputs_indices();
 
-   return(data.arrange_submatrix(indices, inputs_indices));
+   return(arrange_data_submatrix(indices, inputs_indices));
 }
 
 
@@ -727,9 +778,9 @@ Matrix<double> DataSet::arrange_target_data(void) const
    const size_t instances_number = instances.get_instances_number();
    Vector<size_t> indices(0, 1, (size_t)instances_number-1);
 
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
+   const Vector<size_t>& targets_indices = variables.arrange_targets_indices();
 
-   return(data.arrange_submatrix(indices, targets_indices));
+   return(arrange_data_submatrix(indices, targets_indices));
 }
 
 
@@ -741,11 +792,11 @@ Matrix<double> DataSet::arrange_target_data(void) const
 
 Matrix<double> DataSet::arrange_training_input_data(void) const
 {
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
+   const Vector<size_t>& inputs_indices = variables.arrange_inputs_indices();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
+   const Vector<size_t>& training_indices = instances.arrange_training_indices();
 
-   return(data.arrange_submatrix(training_indices, inputs_indices));
+   return(arrange_data_submatrix(training_indices, inputs_indices));
 }
 
 
@@ -757,11 +808,11 @@ Matrix<double> DataSet::arrange_training_input_data(void) const
 
 Matrix<double> DataSet::arrange_training_target_data(void) const 
 {
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
+   const Vector<size_t>& training_indices = instances.arrange_training_indices();
 
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
+   const Vector<size_t>& targets_indices = variables.arrange_targets_indices();
 
-   return(data.arrange_submatrix(training_indices, targets_indices));
+   return(arrange_data_submatrix(training_indices, targets_indices));
 }
 
 
@@ -773,11 +824,11 @@ Matrix<double> DataSet::arrange_training_target_data(void) const
 
 Matrix<double> DataSet::get_generalization_input_data(void) const
 {
-   const Vector<size_t> generalization_indices = instances.arrange_generalization_indices();
+   const Vector<size_t>& generalization_indices = instances.arrange_generalization_indices();
 
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
+   const Vector<size_t>& inputs_indices = variables.arrange_inputs_indices();
 
-   return(data.arrange_submatrix(generalization_indices, inputs_indices));
+   return(arrange_data_submatrix(generalization_indices, inputs_indices));
 }
 
 
@@ -789,11 +840,11 @@ Matrix<double> DataSet::get_generalization_input_data(void) const
 
 Matrix<double> DataSet::get_generalization_target_data(void) const
 {
-   const Vector<size_t> generalization_indices = instances.arrange_generalization_indices();
+   const Vector<size_t>& generalization_indices = instances.arrange_generalization_indices();
 
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
+   const Vector<size_t>& targets_indices = variables.arrange_targets_indices();
 
-   return(data.arrange_submatrix(generalization_indices, targets_indices));
+   return(arrange_data_submatrix(generalization_indices, targets_indices));
 }
 
 
@@ -805,11 +856,11 @@ Matrix<double> DataSet::get_generalization_target_data(void) const
 
 Matrix<double> DataSet::arrange_testing_input_data(void) const
 {
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
+   const Vector<size_t>& inputs_indices = variables.arrange_inputs_indices();
 
-   const Vector<size_t> testing_indices = instances.arrange_testing_indices();
+   const Vector<size_t>& testing_indices = instances.arrange_testing_indices();
 
-   return(data.arrange_submatrix(testing_indices, inputs_indices));
+   return(arrange_data_submatrix(testing_indices, inputs_indices));
 }
 
 
@@ -821,11 +872,11 @@ Matrix<double> DataSet::arrange_testing_input_data(void) const
 
 Matrix<double> DataSet::arrange_testing_target_data(void) const
 {
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
+   const Vector<size_t>& targets_indices = variables.arrange_targets_indices();
 
-   const Vector<size_t> testing_indices = instances.arrange_testing_indices();
+   const Vector<size_t>& testing_indices = instances.arrange_testing_indices();
 
-   return(data.arrange_submatrix(testing_indices, targets_indices));
+   return(arrange_data_submatrix(testing_indices, targets_indices));
 }
 
 
@@ -857,6 +908,16 @@ Vector<double> DataSet::get_instance(const size_t& i) const
 
    // Get instance
 
+   if(data_blocks_pointer != NULL)
+   {
+      const size_t variables_number = variables.get_variables_number();
+
+      Vector<size_t> variables_indices(variables_number);
+      variables_indices.initialize_sequential();
+
+      return(data_blocks_pointer->arrange_row(i, variables_indices));
+   }
+
    return(data.arrange_row(i));
 }
 
@@ -890,10 +951,97 @@ Vector<double> DataSet::get_instance(const size_t& instance_index, const Vector<
 
    // Get instance
 
+   if(data_blocks_pointer != NULL)
+   {
+      return(data_blocks_pointer->arrange_row(instance_index, variables_indices));
+   }
+
    return(data.arrange_row(instance_index, variables_indices));
 }
 
 
+// Vector<size_t> arrange_complete_training_indices(void) const method
+
+/// Returns the indices of the training instances which do not have any missing value.
+/// The performance terms iterate over this list instead of checking each training instance for missing values.
+
+Vector<size_t> DataSet::arrange_complete_training_indices(void) const
+{
+   return(missing_values.arrange_complete_instances(instances.arrange_training_indices()));
+}
+
+
+// Vector<size_t> arrange_complete_generalization_indices(void) const method
+
+/// Returns the indices of the generalization instances which do not have any missing value.
+
+Vector<size_t> DataSet::arrange_complete_generalization_indices(void) const
+{
+   return(missing_values.arrange_complete_instances(instances.arrange_generalization_indices()));
+}
+
+
+// size_t count_training_rows_number(void) const method
+
+/// Returns the number of training rows, which are the training instances without missing values.
+/// The input and target values of these instances are copied into contiguous row-major buffers the first time they are needed,
+/// and they are kept until the data, the instances, the variables or the missing values are modified.
+
+size_t DataSet::count_training_rows_number(void) const
+{
+   update_training_rows();
+
+   return(training_rows_indices.size());
+}
+
+
+// void arrange_training_row(const size_t&, Vector<double>&, Vector<double>&) const method
+
+/// Copies the input and target values of a training row into the given vectors.
+/// Reading the rows in order streams through memory, unlike gathering the values of an instance from the columns of the data matrix.
+/// @param i Index of the training row, which must be less than the number of training rows.
+/// @param inputs Vector for the input values of the row.
+/// @param targets Vector for the target values of the row.
+
+void DataSet::arrange_training_row(const size_t& i, Vector<double>& inputs, Vector<double>& targets) const
+{
+   update_training_rows();
+
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   const size_t training_rows_number = training_rows_indices.size();
+
+   if(i >= training_rows_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: DataSet class.\n"
+             << "void arrange_training_row(const size_t&, Vector<double>&, Vector<double>&) const method.\n"
+             << "Index of training row (" << i << ") must be less than number of training rows (" << training_rows_number << ").\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   if(data_blocks_pointer != NULL)
+   {
+      inputs = data_blocks_pointer->arrange_row(training_rows_indices[i], variables.arrange_inputs_indices());
+      targets = data_blocks_pointer->arrange_row(training_rows_indices[i], variables.arrange_targets_indices());
+
+      return;
+   }
+
+   const size_t inputs_number = variables.count_inputs_number();
+   const size_t targets_number = variables.count_targets_number();
+
+   inputs.assign(training_rows_inputs.begin() + i*inputs_number, training_rows_inputs.begin() + (i+1)*inputs_number);
+   targets.assign(training_rows_targets.begin() + i*targets_number, training_rows_targets.begin() + (i+1)*targets_number);
+}
+
+
 // Vector<double> get_variable(const size_t&) const method
 
 /// Returns all the instances of a single variable in the data set. 
@@ -969,6 +1117,10 @@ void DataSet::set(void)
 
    data.set();
 
+   training_rows_arranged = false;
+
+   data_blocks_pointer = NULL;
+
    variables.set();
    instances.set();
 
@@ -1042,6 +1194,10 @@ void DataSet::set(const size_t& new_instances_number, const size_t& new_variable
 
    data.set(new_instances_number, new_variables_number);
 
+   training_rows_arranged = false;
+
+   data_blocks_pointer = NULL;
+
    instances.set(new_instances_number);
 
    variables.set(new_variables_number);
@@ -1070,6 +1226,10 @@ void DataSet::set(const size_t& new_instances_number, const size_t& new_inputs_n
 
    data.set(new_instances_number, new_variables_number);
 
+   training_rows_arranged = false;
+
+   data_blocks_pointer = NULL;
+
    variables.set(new_inputs_number, new_targets_number);
 
    instances.set(new_instances_number);
@@ -1099,6 +1259,10 @@ void DataSet::set(const DataSet& other_data_set)
 
    data = other_data_set.data;
 
+   training_rows_arranged = false;
+
+   data_blocks_pointer = other_data_set.data_blocks_pointer;
+
    variables = other_data_set.variables;
 
    instances = other_data_set.instances;
@@ -1171,6 +1335,10 @@ void DataSet::set_default(void)
 
     angular_units = Degrees;
 
+    data_blocks_pointer = NULL;
+
+    training_rows_arranged = false;
+
     display = true;
 
     file_type = DAT;
@@ -1225,12 +1393,42 @@ void DataSet::set_data(const Matrix<double>& new_data)
    
    data = new_data;   
 
+   training_rows_arranged = false;
+
+   data_blocks_pointer = NULL;
+
    instances.set_instances_number(data.get_rows_number());
    variables.set_variables_number(data.get_columns_number());
 
 }
 
 
+// void set_data_blocks_pointer(DataBlocks*) method
+
+/// Makes the data set take its values from a binary data file, as written by save_data_binary, instead of from the data matrix.
+/// The data matrix is emptied, and the instances, the variables information and the missing values are set from the file.
+/// Only a window of blocks of the file is kept in memory by the methods which arrange data, 
+/// and by the batch reduction methods of the performance terms, so that the data set can be larger than the available memory.
+/// The data file is not owned by the data set, and it must exist while it is used.
+/// @param new_data_blocks_pointer Pointer to an open binary data file, or NULL to detach the current one.
+
+void DataSet::set_data_blocks_pointer(DataBlocks* new_data_blocks_pointer)
+{
+   if(new_data_blocks_pointer == NULL)
+   {
+      data_blocks_pointer = NULL;
+
+      training_rows_arranged = false;
+
+      return;
+   }
+
+   set_from_data_blocks(*new_data_blocks_pointer);
+
+   data_blocks_pointer = new_data_blocks_pointer;
+}
+
+
 // void set_data_file_name(const std::string&) method
 
 /// Sets the name of the data file.
@@ -1513,6 +1711,8 @@ void DataSet::set_instances_number(const size_t& new_instances_number)
 
    data.set(new_instances_number, variables_number);
 
+   training_rows_arranged = false;
+
    instances.set(new_instances_number);
 }
 
@@ -1530,6 +1730,8 @@ void DataSet::set_variables_number(const size_t& new_variables_number)
 
    data.set(instances_number, new_variables_number);
 
+   training_rows_arranged = false;
+
    variables.set(new_variables_number);
 }
 
@@ -1578,6 +1780,8 @@ void DataSet::set_instance(const size_t& instance_index, const Vector<double>& i
    // Set instance
 
    data.set_row(instance_index, instance);
+
+   training_rows_arranged = false;
 }
 
 
@@ -1615,6 +1819,8 @@ void DataSet::add_instance(const Vector<double>& instance)
 
    data.append_row(instance);
 
+   training_rows_arranged = false;
+
    instances.set(instances_number+1);
 }
 
@@ -1649,6 +1855,8 @@ void DataSet::subtract_instance(const size_t& instance_index)
 
    data.subtract_row(instance_index);
 
+   training_rows_arranged = false;
+
    instances.set_instances_number(instances_number-1);
 
 }
@@ -1685,6 +1893,8 @@ void DataSet::append_variable(const Vector<double>& variable)
 
    data.append_column(variable);
 
+   training_rows_arranged = false;
+
    Matrix<double> new_data(data);
 
    const size_t new_variables_number = variables_number + 1;
@@ -1723,6 +1933,8 @@ void DataSet::subtract_variable(const size_t& variable_index)
 
    data.subtract_column(variable_index);
 
+   training_rows_arranged = false;
+
    Matrix<double> new_data(data);
 
    const size_t new_variables_number = variables_number - 1;
@@ -1780,6 +1992,10 @@ Vector<size_t> DataSet::unuse_constant_variables(void)
 
 /// Removes the training, generalization and testing indices of that instances which are repeated in the data matrix.
 /// It might change the size of the vectors containing the training, generalization and testing indices. 
+/// An instance is repeated if it is equal to some instance with a lower index.
+/// The instances are grouped by a hash of their values, and only the instances within a group are compared value by value,
+/// so that the number of comparisons grows linearly with the number of instances. The groups are examined in parallel.
+/// It returns the indices of the instances which have been set unused, in increasing order.
 
 Vector<size_t> DataSet::unuse_repeated_instances(void)
 {
@@ -1802,31 +2018,136 @@ Vector<size_t> DataSet::unuse_repeated_instances(void)
 
     #endif
 
-    Vector<size_t> repeated_instances;
+    const size_t variables_number = variables.get_variables_number();
+
+    Vector<const double*> columns(variables_number);
+
+    for(size_t j = 0; j < variables_number; j++)
+    {
+        if(data_blocks_pointer != NULL)
+        {
+            columns[j] = data_blocks_pointer->get_column(j);
+        }
+        else
+        {
+            columns[j] = &data[j*instances_number];
+        }
+    }
 
-	Vector<double> instance_i;
-	Vector<double> instance_j;    
+    // Hash the instances, reading the values one variable at a time
+
+    Vector<size_t> hashes(instances_number, 0);
 
     int i = 0;
 
-    #pragma omp parallel for private(i, instance_i, instance_j)
+    for(size_t j = 0; j < variables_number; j++)
+    {
+        const double* column = columns[j];
+
+        #pragma omp parallel for private(i)
 
-    for(i = 0; i < (int)instances_number; i++)
-	{
-	   instance_i = get_instance(i);
-
-       for(size_t j = i+1; j < instances_number; j++)
-	   {	      
-          instance_j = get_instance(j);
-
-          if(instances.get_use(j) != Instances::Unused
-          && instance_j == instance_i)
-		  {
-              instances.set_use(j, Instances::Unused);
-              repeated_instances.push_back(j);
-		  }
-	   }	    
-	}
+        for(i = 0; i < (int)instances_number; i++)
+        {
+            // Zeros of both signs compare equal, so they must have the same hash.
+
+            const double value = (column[i] == 0.0) ? 0.0 : column[i];
+
+            size_t bits = 0;
+
+            memcpy(&bits, &value, std::min(sizeof(size_t), sizeof(double)));
+
+            hashes[i] ^= bits*2654435761u + 0x9e3779b9 + (hashes[i] << 6) + (hashes[i] >> 2);
+        }
+    }
+
+    // Group the instances with equal hashes
+
+    Vector< std::pair<size_t, size_t> > hashes_indices(instances_number);
+
+    for(size_t k = 0; k < instances_number; k++)
+    {
+        hashes_indices[k] = std::make_pair(hashes[k], k);
+    }
+
+    std::sort(hashes_indices.begin(), hashes_indices.end());
+
+    Vector<size_t> groups_positions(1, 0);
+
+    for(size_t k = 1; k < instances_number; k++)
+    {
+        if(hashes_indices[k].first != hashes_indices[k-1].first)
+        {
+            groups_positions.push_back(k);
+        }
+    }
+
+    groups_positions.push_back(instances_number);
+
+    const size_t groups_number = groups_positions.size() - 1;
+
+    // Compare the instances within each group
+
+    Vector<size_t> repeated_flags(instances_number, 0);
+
+    Vector<size_t> distinct_instances;
+
+    #pragma omp parallel for private(i, distinct_instances) schedule(dynamic, 64)
+
+    for(i = 0; i < (int)groups_number; i++)
+    {
+        const size_t group_begin = groups_positions[i];
+        const size_t group_end = groups_positions[i+1];
+
+        if(group_end - group_begin < 2)
+        {
+            continue;
+        }
+
+        distinct_instances.clear();
+
+        for(size_t k = group_begin; k < group_end; k++)
+        {
+            const size_t instance_index = hashes_indices[k].second;
+
+            bool repeated = false;
+
+            for(size_t l = 0; l < distinct_instances.size() && !repeated; l++)
+            {
+                repeated = true;
+
+                for(size_t j = 0; j < variables_number; j++)
+                {
+                    if(columns[j][instance_index] != columns[j][distinct_instances[l]])
+                    {
+                        repeated = false;
+                        break;
+                    }
+                }
+            }
+
+            if(repeated)
+            {
+                repeated_flags[instance_index] = 1;
+            }
+            else
+            {
+                distinct_instances.push_back(instance_index);
+            }
+        }
+    }
+
+    // Set the repeated instances unused
+
+    Vector<size_t> repeated_instances;
+
+    for(size_t k = 0; k < instances_number; k++)
+    {
+        if(repeated_flags[k] == 1 && instances.get_use(k) != Instances::Unused)
+        {
+            instances.set_use(k, Instances::Unused);
+            repeated_instances.push_back(k);
+        }
+    }
 
     return(repeated_instances);
 }
@@ -1988,15 +2309,9 @@ Matrix<double> DataSet::calculate_data_statistics_matrix(void) const
     const Vector<size_t> used_variables_indices = variables.arrange_used_indices();
     const Vector<size_t> used_instances_indices = instances.arrange_used_indices();
 
-    const Vector< Vector<size_t> > used_missing_indices = missing_indices.arrange_subvector(used_variables_indices);
-
-    const Matrix<double> used_data = data.arrange_submatrix(used_instances_indices, used_variables_indices);
-
-    const Vector< Statistics<double> > data_statistics = used_data.calculate_statistics_missing_values(used_missing_indices);
-
-   // std::cout << used_missing_indices << std::endl;
+    const Vector< Statistics<double> > data_statistics = data.calculate_statistics_missing_values(used_instances_indices, used_variables_indices, missing_indices);
 
-    const size_t variables_number = used_variables_indices.size();//variables.count_used_variables_number();
+    const size_t variables_number = used_variables_indices.size();
 
     Matrix<double> data_statistics_matrix(variables_number, 4);
 
@@ -2255,47 +2570,31 @@ Vector<double> DataSet::calculate_testing_target_data_mean(void) const
 // Matrix<double> calculate_linear_correlations(void) const method
 
 /// Calculates the linear correlations between all outputs and all inputs.
-/// It returns a matrix with number of rows the targets number and number of columns the inputs number.
-/// Each element contains the linear correlation between a single target and a single output.
+/// It returns a matrix with number of rows the inputs number and number of columns the targets number.
+/// Each element contains the linear correlation between a single input and a single target.
+/// The whole matrix is obtained from a single product of the standardized input and target variables.
 
 Matrix<double> DataSet::calculate_linear_correlations(void) const
 {
-   const size_t inputs_number = variables.count_inputs_number();
-   const size_t targets_number = variables.count_targets_number();
-
    const Vector<size_t> input_indices = variables.arrange_inputs_indices();
    const Vector<size_t> target_indices = variables.arrange_targets_indices();
 
-   size_t input_index;
-   size_t target_index;
-
-   const size_t instances_number = instances.get_instances_number();
-
-   const Vector< Vector<size_t> > missing_indices = missing_values.arrange_missing_indices();
-
-   Vector<double> input_variable(instances_number);
-   Vector<double> target_variable(instances_number);
-
-   Matrix<double> linear_correlations(inputs_number, targets_number);
-
-   for(size_t i = 0; i < inputs_number; i++)
-   {
-       input_index = input_indices[i];
+   return(data.calculate_linear_correlations(input_indices, target_indices));
+}
 
-       input_variable = data.arrange_column(input_index);
 
-       for(size_t j = 0; j < targets_number; j++)
-       {
-           target_index = target_indices[j];
+// Matrix<double> calculate_inputs_linear_correlations(void) const method
 
-           target_variable = data.arrange_column(target_index);
+/// Calculates the linear correlations between all pairs of inputs.
+/// It returns a symmetric matrix with number of rows and columns the inputs number,
+/// which can be used to detect redundant inputs.
+/// The products of the standardized input variables are computed by blocks.
 
-//           linear_correlations(i,j) = input_variable.calculate_linear_correlation_missing_values(target_variable, missing_indices[target_index]);
-           linear_correlations(i,j) = input_variable.calculate_linear_correlation(target_variable);
-       }
-   }
+Matrix<double> DataSet::calculate_inputs_linear_correlations(void) const
+{
+   const Vector<size_t> input_indices = variables.arrange_inputs_indices();
 
-   return(linear_correlations);
+   return(data.calculate_linear_correlations(input_indices));
 }
 
 
@@ -2343,6 +2642,8 @@ void DataSet::scale_data_mean_standard_deviation(const Vector< Statistics<double
     }
 
    data.scale_mean_standard_deviation(data_statistics);
+
+   training_rows_arranged = false;
 }
 
 
@@ -2354,9 +2655,27 @@ void DataSet::scale_data_mean_standard_deviation(const Vector< Statistics<double
 
 Vector< Statistics<double> > DataSet::scale_data_minimum_maximum(void)
 {
-    const Vector< Statistics<double> > data_statistics = calculate_data_statistics();
+    const size_t variables_number = variables.get_variables_number();
+
+    Vector<size_t> variables_indices(variables_number);
+    variables_indices.initialize_sequential();
+
+    const Vector< Vector<size_t> > missing_indices = missing_values.arrange_missing_indices();
+
+    const Vector< Statistics<double> > data_statistics = data.scale_columns_minimum_maximum_missing_values(variables_indices, missing_indices);
+
+    for(size_t i = 0; i < variables_number; i++)
+    {
+        if(display && data_statistics[i].maximum-data_statistics[i].minimum < 1.0e-99)
+        {
+           std::cout << "OpenNN Warning: DataSet class.\n"
+                     << "Vector< Statistics<double> > scale_data_minimum_maximum(void) method.\n"
+                     << "Range of variable " <<  i << " is zero.\n"
+                     << "That variable won't be scaled.\n";
+        }
+    }
 
-    scale_data_minimum_maximum(data_statistics);
+    training_rows_arranged = false;
 
     return(data_statistics);
 }
@@ -2370,9 +2689,27 @@ Vector< Statistics<double> > DataSet::scale_data_minimum_maximum(void)
 
 Vector< Statistics<double> > DataSet::scale_data_mean_standard_deviation(void)
 {
-    const Vector< Statistics<double> > data_statistics = calculate_data_statistics();
+    const size_t variables_number = variables.get_variables_number();
+
+    Vector<size_t> variables_indices(variables_number);
+    variables_indices.initialize_sequential();
+
+    const Vector< Vector<size_t> > missing_indices = missing_values.arrange_missing_indices();
+
+    const Vector< Statistics<double> > data_statistics = data.scale_columns_mean_standard_deviation_missing_values(variables_indices, missing_indices);
+
+    for(size_t i = 0; i < variables_number; i++)
+    {
+        if(display && data_statistics[i].standard_deviation < 1.0e-99)
+        {
+           std::cout << "OpenNN Warning: DataSet class.\n"
+                     << "Vector< Statistics<double> > scale_data_mean_standard_deviation(void) method.\n"
+                     << "Standard deviation of variable " <<  i << " is zero.\n"
+                     << "That variable won't be scaled.\n";
+        }
+    }
 
-    scale_data_mean_standard_deviation(data_statistics);
+    training_rows_arranged = false;
 
     return(data_statistics);
 }
@@ -2421,6 +2758,8 @@ void DataSet::scale_data_minimum_maximum(const Vector< Statistics<double> >& dat
 
 
    data.scale_minimum_maximum(data_statistics);
+
+   training_rows_arranged = false;
 }
 
 
@@ -2516,6 +2855,8 @@ void DataSet::scale_inputs_mean_standard_deviation(const Vector< Statistics<doub
     const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
 
     data.scale_columns_mean_standard_deviation(inputs_statistics, inputs_indices);
+
+    training_rows_arranged = false;
 }
 
 
@@ -2544,9 +2885,13 @@ Vector< Statistics<double> > DataSet::scale_inputs_mean_standard_deviation(void)
 
     #endif
 
-   const Vector< Statistics<double> > inputs_statistics = calculate_inputs_statistics();
+   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
 
-   scale_inputs_mean_standard_deviation(inputs_statistics);
+   const Vector< Vector<size_t> > missing_indices = missing_values.arrange_missing_indices();
+
+   const Vector< Statistics<double> > inputs_statistics = data.scale_columns_mean_standard_deviation_missing_values(inputs_indices, missing_indices);
+
+   training_rows_arranged = false;
 
    return(inputs_statistics);
 }
@@ -2564,6 +2909,8 @@ void DataSet::scale_inputs_minimum_maximum(const Vector< Statistics<double> >& i
     const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
 
     data.scale_columns_minimum_maximum(inputs_statistics, inputs_indices);
+
+    training_rows_arranged = false;
 }
 
 
@@ -2592,9 +2939,13 @@ Vector< Statistics<double> > DataSet::scale_inputs_minimum_maximum(void)
 
     #endif
 
-   const Vector< Statistics<double> > inputs_statistics = calculate_inputs_statistics();
+   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
+
+   const Vector< Vector<size_t> > missing_indices = missing_values.arrange_missing_indices();
+
+   const Vector< Statistics<double> > inputs_statistics = data.scale_columns_minimum_maximum_missing_values(inputs_indices, missing_indices);
 
-   scale_inputs_minimum_maximum(inputs_statistics);
+   training_rows_arranged = false;
 
    return(inputs_statistics);
 }
@@ -2687,6 +3038,8 @@ void DataSet::scale_targets_mean_standard_deviation(const Vector< Statistics<dou
     const Vector<size_t> targets_indices = variables.arrange_targets_indices();
 
     data.scale_columns_mean_standard_deviation(targets_statistics, targets_indices);
+
+    training_rows_arranged = false;
 }
 
 
@@ -2715,9 +3068,13 @@ Vector< Statistics<double> > DataSet::scale_targets_mean_standard_deviation(void
 
     #endif
 
-   const Vector< Statistics<double> > targets_statistics = calculate_targets_statistics();
+   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
+
+   const Vector< Vector<size_t> > missing_indices = missing_values.arrange_missing_indices();
+
+   const Vector< Statistics<double> > targets_statistics = data.scale_columns_mean_standard_deviation_missing_values(targets_indices, missing_indices);
 
-   scale_targets_mean_standard_deviation(targets_statistics);
+   training_rows_arranged = false;
 
    return(targets_statistics);
 }
@@ -2752,6 +3109,8 @@ void DataSet::scale_targets_minimum_maximum(const Vector< Statistics<double> >&
     const Vector<size_t> targets_indices = variables.arrange_targets_indices();
 
     data.scale_columns_minimum_maximum(targets_statistics, targets_indices);
+
+    training_rows_arranged = false;
 }
 
 
@@ -2763,9 +3122,13 @@ void DataSet::scale_targets_minimum_maximum(const Vector< Statistics<double> >&
 
 Vector< Statistics<double> > DataSet::scale_targets_minimum_maximum(void)
 {
-   const Vector< Statistics<double> > targets_statistics = calculate_targets_statistics();
+   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
+
+   const Vector< Vector<size_t> > missing_indices = missing_values.arrange_missing_indices();
+
+   const Vector< Statistics<double> > targets_statistics = data.scale_columns_minimum_maximum_missing_values(targets_indices, missing_indices);
 
-   scale_targets_minimum_maximum(targets_statistics);
+   training_rows_arranged = false;
 
    return(targets_statistics);
 }
@@ -2855,6 +3218,8 @@ void DataSet::scale_targets(const std::string& scaling_unscaling_method, const V
 void DataSet::unscale_data_mean_standard_deviation(const Vector< Statistics<double> >& data_statistics)
 {
    data.unscale_mean_standard_deviation(data_statistics);
+
+   training_rows_arranged = false;
 }
 
 
@@ -2868,6 +3233,8 @@ void DataSet::unscale_data_mean_standard_deviation(const Vector< Statistics<doub
 void DataSet::unscale_data_minimum_maximum(const Vector< Statistics<double> >& data_statistics)
 {
    data.unscale_minimum_maximum(data_statistics);
+
+   training_rows_arranged = false;
 }
 
 
@@ -2883,6 +3250,8 @@ void DataSet::unscale_inputs_mean_standard_deviation(const Vector< Statistics<do
     const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
 
     data.unscale_columns_mean_standard_deviation(data_statistics, inputs_indices);
+
+    training_rows_arranged = false;
 }
 
 
@@ -2898,6 +3267,8 @@ void DataSet::unscale_inputs_minimum_maximum(const Vector< Statistics<double> >&
     const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
 
     data.unscale_columns_minimum_maximum(data_statistics, inputs_indices);
+
+    training_rows_arranged = false;
 }
 
 
@@ -2913,6 +3284,8 @@ void DataSet::unscale_targets_mean_standard_deviation(const Vector< Statistics<d
     const Vector<size_t> targets_indices = variables.arrange_targets_indices();
 
     data.unscale_columns_mean_standard_deviation(data_statistics, targets_indices);
+
+    training_rows_arranged = false;
 }
 
 
@@ -2928,6 +3301,8 @@ void DataSet::unscale_targets_minimum_maximum(const Vector< Statistics<double> >
     const Vector<size_t> targets_indices = variables.arrange_targets_indices();
 
     data.unscale_columns_minimum_maximum(data_statistics, targets_indices);
+
+    training_rows_arranged = false;
 }
 
 
@@ -2939,6 +3314,8 @@ void DataSet::unscale_targets_minimum_maximum(const Vector< Statistics<double> >
 void DataSet::initialize_data(const double& new_value)
 {
    data.initialize(new_value);
+
+   training_rows_arranged = false;
 }
 
 
@@ -2950,6 +3327,8 @@ void DataSet::initialize_data(const double& new_value)
 void DataSet::randomize_data_uniform(const double& minimum, const double& maximum)
 {
    data.randomize_uniform(minimum, maximum);
+
+   training_rows_arranged = false;
 }
 
 
@@ -2961,6 +3340,8 @@ void DataSet::randomize_data_uniform(const double& minimum, const double& maximu
 void DataSet::randomize_data_normal(const double& mean, const double& standard_deviation)
 {
    data.randomize_normal(mean, standard_deviation);
+
+   training_rows_arranged = false;
 }
 
 
@@ -3714,6 +4095,155 @@ void DataSet::save_data(void) const
    file.close();
 }
 
+// void save_data_binary(void) const method
+
+/// Saves the data matrix, the variables information and the missing values to the data file in binary format.
+/// The file starts with a versioned header, followed by the variables information,
+/// the values of each variable stored as a contiguous block of doubles aligned to 64 bytes,
+/// and a bitmap of the missing values of each variable.
+/// The values can be loaded back with load_data_binary without any parsing.
+
+void DataSet::save_data_binary(void) const
+{
+   std::ofstream file(data_file_name.c_str(), std::ios::binary);
+
+   if(!file.is_open())
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: DataSet class.\n"
+             << "void save_data_binary(void) const method.\n"
+             << "Cannot open data file.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   const size_t instances_number = data.get_rows_number();
+   const size_t variables_number = data.get_columns_number();
+
+   // Variables information
+
+   std::ostringstream metadata;
+
+   for(size_t j = 0; j < variables_number; j++)
+   {
+      Vector<std::string> strings(3);
+
+      size_t use = Variables::Unused;
+
+      if(j < variables.get_variables_number())
+      {
+         use = variables.get_use(j);
+
+         strings[0] = variables.get_name(j);
+         strings[1] = variables.get_unit(j);
+         strings[2] = variables.get_description(j);
+      }
+
+      metadata.write(reinterpret_cast<const char*>(&use), sizeof(size_t));
+
+      for(size_t k = 0; k < 3; k++)
+      {
+         const size_t length = strings[k].size();
+
+         metadata.write(reinterpret_cast<const char*>(&length), sizeof(size_t));
+         metadata.write(strings[k].data(), length);
+      }
+   }
+
+   const std::string metadata_string = metadata.str();
+
+   // Missing values bitmap
+
+   const Vector<MissingValues::Item>& missing_values_items = missing_values.get_items();
+
+   const size_t missing_values_number = missing_values_items.size();
+
+   const size_t bitmap_bytes_number = (instances_number+7)/8;
+
+   std::string bitmap;
+
+   if(missing_values_number != 0)
+   {
+      bitmap.assign(bitmap_bytes_number*variables_number, '\0');
+
+      for(size_t i = 0; i < missing_values_number; i++)
+      {
+         const size_t instance_index = missing_values_items[i].instance_index;
+         const size_t variable_index = missing_values_items[i].variable_index;
+
+         if(instance_index < instances_number && variable_index < variables_number)
+         {
+            bitmap[variable_index*bitmap_bytes_number + instance_index/8] |= (char)(1 << (instance_index%8));
+         }
+      }
+   }
+
+   // Header
+
+   const size_t version = 1;
+   const size_t byte_order_mark = 0x01020304;
+
+   const size_t header_size = 128;
+   const size_t alignment = 64;
+
+   const size_t column_stride = ((instances_number*sizeof(double) + alignment - 1)/alignment)*alignment;
+
+   const size_t metadata_position = header_size;
+   const size_t data_position = ((metadata_position + metadata_string.size() + alignment - 1)/alignment)*alignment;
+   const size_t bitmap_position = bitmap.empty() ? 0 : data_position + variables_number*column_stride;
+
+   size_t header[10];
+
+   header[0] = version;
+   header[1] = byte_order_mark;
+   header[2] = instances_number;
+   header[3] = variables_number;
+   header[4] = metadata_position;
+   header[5] = metadata_string.size();
+   header[6] = data_position;
+   header[7] = column_stride;
+   header[8] = bitmap_position;
+   header[9] = bitmap_bytes_number;
+
+   const std::string padding(header_size, '\0');
+
+   // Magic number, sizes of the size and value types, and padding up to 16 bytes
+
+   file.write("OpenNNDS", 8);
+
+   const char sizes[8] = {(char)sizeof(size_t), (char)sizeof(double), 0, 0, 0, 0, 0, 0};
+
+   file.write(sizes, 8);
+
+   file.write(reinterpret_cast<const char*>(header), sizeof(header));
+
+   file.write(padding.data(), header_size - 16 - sizeof(header));
+
+   file.write(metadata_string.data(), metadata_string.size());
+
+   file.write(padding.data(), data_position - metadata_position - metadata_string.size());
+
+   // Values, one aligned block per variable
+
+   const size_t column_padding = column_stride - instances_number*sizeof(double);
+
+   for(size_t j = 0; j < variables_number; j++)
+   {
+      if(instances_number != 0)
+      {
+         file.write(reinterpret_cast<const char*>(&data[j*instances_number]), instances_number*sizeof(double));
+      }
+
+      file.write(padding.data(), column_padding);
+   }
+
+   file.write(bitmap.data(), bitmap.size());
+
+   file.close();
+}
+
+
 
 // size_t get_column_index(const Vector< Vector<std::string> >&, const size_t) const method
 
@@ -3934,231 +4464,439 @@ Vector<std::string> DataSet::read_header_line(void) const
 }
 
 
-// void read_instance(const std::string&, const Vector< Vector<std::string> >&, const size_t&) method
+// Vector<size_t> split_data_file(const MemoryMappedFile&, const size_t&) const method
 
-/// Sets the values of a single instance in the data matrix from a line in the data file.
-/// @param line Data file line.
-/// @param nominal_labels Values of all nominal variables in the data file.
-/// @param instance_index Index of instance.
+/// Splits the contents of the data file into chunks which can be parsed independently.
+/// The header line, if any, is skipped, and every chunk begins at the start of a line.
+/// Returns a vector with the positions of the chunks, with size the number of chunks plus one.
+/// The last element is the size of the file.
+/// @param data_file Mapped data file.
+/// @param chunks_number Desired number of chunks.
 
-void DataSet::read_instance(const std::string& line, const Vector< Vector<std::string> >& nominal_labels, const size_t& instance_index)
+Vector<size_t> DataSet::split_data_file(const MemoryMappedFile& data_file, const size_t& chunks_number) const
 {
-    // Control sentence (if debug)
+    const char* begin = data_file.get_data();
+    const char* end = begin + data_file.get_size();
 
-    #ifdef __OPENNN_DEBUG__
+    const char* position = begin;
 
-    const size_t instances_number = instances.get_instances_number();
+    std::string line;
 
-    if(instance_index >= instances_number)
+    // Header line
+
+    if(header_line)
     {
-       std::ostringstream buffer;
+        while(get_data_file_line(position, end, line))
+        {
+            if(!line.empty())
+            {
+                break;
+            }
+        }
+    }
 
-       buffer << "OpenNN Exception: DataSet class.\n"
-              << "void read_instance(const std::string&, const Vector< Vector<std::string> >&, const size_t&) method.\n"
-              << "Index of instance (" << instance_index << ") must be less than number of instances (" << instances_number << ").\n";
+    const size_t data_begin = position - begin;
+    const size_t data_size = data_file.get_size() - data_begin;
 
-       throw std::logic_error(buffer.str());
+    Vector<size_t> chunks_positions(1, data_begin);
+
+    for(size_t i = 1; i < chunks_number; i++)
+    {
+        size_t chunk_position = data_begin + (data_size*i)/chunks_number;
+
+        if(chunk_position <= chunks_positions[chunks_positions.size()-1])
+        {
+            continue;
+        }
+
+        // Move the chunk position to the beginning of the next line
+
+        const char* new_line = (const char*)memchr(begin + chunk_position - 1, '\n', end - (begin + chunk_position - 1));
+
+        if(new_line == NULL)
+        {
+            break;
+        }
+
+        chunk_position = new_line + 1 - begin;
+
+        if(chunk_position > chunks_positions[chunks_positions.size()-1] && chunk_position < data_file.get_size())
+        {
+            chunks_positions.push_back(chunk_position);
+        }
     }
 
-    #endif
+    chunks_positions.push_back(data_file.get_size());
 
-    const Vector<std::string> tokens = get_tokens(line);
+    return(chunks_positions);
+}
 
-    #ifdef __OPENNN_DEBUG__
 
-    if(tokens.size() != nominal_labels.size())
+// bool get_data_file_line(const char*&, const char*, std::string&) const method
+
+/// Reads the line of the data file which begins at a given position, and moves that position to the beginning of the next line.
+/// The line is processed in the same way as the lines read from a stream:
+/// tabs are replaced by spaces, unless they are the separator, and spaces at both ends are removed.
+/// The string is reused between calls, so that no memory is allocated once it has grown to the longest line.
+/// Returns false if there are no more lines to read.
+/// @param position Position of the beginning of the line.
+/// @param end End of the data file contents.
+/// @param line String where the line is written.
+
+bool DataSet::get_data_file_line(const char*& position, const char* end, std::string& line) const
+{
+    if(position >= end)
     {
-       std::ostringstream buffer;
+        return(false);
+    }
 
-       buffer << "OpenNN Exception: DataSet class.\n"
-              << "void read_instance(const std::string&, const Vector< Vector<std::string> >&, const size_t&) method.\n"
-              << "Size of tokens (" << tokens.size() << ") must be equal to size of names (" << nominal_labels.size() << ").\n";
+    const char* new_line = (const char*)memchr(position, '\n', end - position);
 
-       throw std::logic_error(buffer.str());
+    const char* line_end = (new_line == NULL) ? end : new_line;
+
+    line.assign(position, line_end - position);
+
+    position = (new_line == NULL) ? end : new_line + 1;
+
+    if(separator != Tab)
+    {
+        std::replace(line.begin(), line.end(), '\t', ' ');
     }
 
-    #endif
+    trim(line);
 
-    size_t column_index;
+    return(true);
+}
+
+
+// void get_tokens_positions(const std::string&, Vector<size_t>&, Vector<size_t>&) const method
+
+/// Finds the tokens of a data file line without creating any string.
+/// The tokens are the same as those returned by get_tokens.
+/// @param line Data file line, as returned by get_data_file_line.
+/// @param tokens_begin Positions of the first character of each token.
+/// @param tokens_end Positions past the last character of each token.
+
+void DataSet::get_tokens_positions(const std::string& line, Vector<size_t>& tokens_begin, Vector<size_t>& tokens_end) const
+{
+    tokens_begin.clear();
+    tokens_end.clear();
 
-    for(size_t j = 0; j < tokens.size(); j++)
+    const char separator_character = get_separator_string()[0];
+
+    const size_t line_size = line.size();
+
+    size_t position = 0;
+
+    size_t token_begin;
+    size_t token_end;
+
+    while(position < line_size)
     {
-        column_index = get_column_index(nominal_labels, j);
+        // Skip separators
 
-        if(nominal_labels[j].size() == 0) // Numeric variable
+        while(position < line_size && line[position] == separator_character)
         {
-            if(tokens[j] != missing_values_label) // No missing values
-            {
-                data(instance_index, column_index) = atof(tokens[j].c_str());
-            }
-            else // Missing values
-            {
-                data(instance_index, column_index) = -99.9;
+            position++;
+        }
 
-                missing_values.append(instance_index, column_index);
-            }
+        if(position == line_size)
+        {
+            break;
         }
 
-        else if(nominal_labels[j].size() == 2) // Binary variable
+        token_begin = position;
+
+        while(position < line_size && line[position] != separator_character)
         {
-            if(tokens[j] != missing_values_label) // No missing values
-            {
-                if(tokens[j] == "false" || tokens[j] == "False"||  tokens[j] == "FALSE"
-                || tokens[j] == "negative"|| tokens[j] == "Negative"|| tokens[j] == "NEGATIVE")
-                {
-                    data(instance_index, column_index) = 0.0;
-                }
-                else if(tokens[j] == "true" || tokens[j] == "True"||  tokens[j] == "TRUE"
-                || tokens[j] == "positive"|| tokens[j] == "Positive"|| tokens[j] == "POSITIVE")
-                {
-                    data(instance_index, column_index) = 1.0;
-                }
-                else if(tokens[j] == nominal_labels[j][0])
-                {
-                    data(instance_index, column_index) = 0.0;
-                }
-                else if(tokens[j] == nominal_labels[j][1])
-                {
-                    data(instance_index, column_index) = 1.0;
-                }
-                else
-                {
-                    std::ostringstream buffer;
+            position++;
+        }
 
-                    buffer << "OpenNN Exception: DataSet class.\n"
-                           << "void read_instance(const std::string&, const Vector< Vector<std::string> >&, const size_t&) method.\n"
-                           << "Unknown token binary value.\n";
+        token_end = position;
 
-                    throw std::logic_error(buffer.str());
-                }
-            }
-            else // Missing values
-            {
-                data(instance_index, column_index) = -99.9;
+        // Trim token
 
-                missing_values.append(instance_index, column_index);
-            }
+        while(token_begin < token_end && line[token_begin] == ' ')
+        {
+            token_begin++;
         }
 
-        else // Nominal variable
+        while(token_end > token_begin && line[token_end-1] == ' ')
         {
-            if(tokens[j] != missing_values_label)
-            {
-                for(size_t k = 0; k < nominal_labels[j].size(); k++)
-                {
-                    if(tokens[j] == nominal_labels[j][k])
-                    {
-                        data(instance_index, column_index+k) = 1.0;
-                    }
-                    else
-                    {
-                        data(instance_index, column_index+k) = 0.0;
-                    }
-                }
-            }
-            else // Missing values
-            {
-                for(size_t k = 0; k < nominal_labels[j].size(); k++)
-                {
-                    data(instance_index, column_index+k) = -99.9;
-
-                    missing_values.append(instance_index, column_index+k);
-                }
-            }
+            token_end--;
         }
-    }       
+
+        tokens_begin.push_back(token_begin);
+        tokens_end.push_back(token_end);
+    }
 }
 
 
-// Vector< Vector<std::string> > set_from_data_file(void) method
+// bool parse_numeric_token(const char*, const char*, double&) const method
 
-/// Performs a first data file read in which the format is checked,
-/// and the numbers of variables, instances and missing values are set.
+/// Parses a token of the data file as a real number, without allocating memory.
+/// The accepted format is the same as that of is_numeric: an optional sign, a decimal mantissa and an optional exponent,
+/// with no other characters after the number.
+/// Returns true if the token is numeric, and false otherwise.
+/// @param begin First character of the token.
+/// @param end Position past the last character of the token.
+/// @param value Value of the number, if the token is numeric.
 
-Vector< Vector<std::string> > DataSet::set_from_data_file(void)
+bool DataSet::parse_numeric_token(const char* begin, const char* end, double& value) const
 {
-    const size_t columns_number = count_data_file_columns_number();
-
-    Vector< Vector<std::string> > nominal_labels(columns_number);
+    const char* position = begin;
 
-    std::string line;
-    Vector<std::string> tokens;
+    while(position < end && isspace((unsigned char)*position))
+    {
+        position++;
+    }
 
-    bool numeric;
+    const char* number_begin = position;
 
-    check_header_line();
+    if(position < end && (*position == '+' || *position == '-'))
+    {
+        position++;
+    }
 
-    int instances_count;
+    size_t digits_number = 0;
 
-    if(header_line)
+    while(position < end && isdigit((unsigned char)*position))
     {
-        instances_count = -1;
+        position++;
+        digits_number++;
     }
-    else
+
+    if(position < end && *position == '.')
     {
-        instances_count = 0;
-    }
+        position++;
 
-    std::ifstream file(data_file_name.c_str());   
+        while(position < end && isdigit((unsigned char)*position))
+        {
+            position++;
+            digits_number++;
+        }
+    }
 
-    // Rest of lines
+    if(digits_number == 0)
+    {
+        return(false);
+    }
 
-    while(file.good())
+    if(position < end && (*position == 'e' || *position == 'E'))
     {
-        getline(file, line);
+        position++;
 
-        if(separator != Tab)
+        if(position < end && (*position == '+' || *position == '-'))
         {
-            std::replace(line.begin(), line.end(), '\t', ' ');
+            position++;
         }
 
-        trim(line);
+        size_t exponent_digits_number = 0;
 
-        if(line.empty())
+        while(position < end && isdigit((unsigned char)*position))
         {
-            continue;
+            position++;
+            exponent_digits_number++;
         }
 
-        if(header_line && instances_count == -1)
+        if(exponent_digits_number == 0)
         {
-            instances_count = 0;
+            return(false);
+        }
+    }
 
-            continue;
+    if(position != end)
+    {
+        return(false);
+    }
+
+    // The token is not null terminated, so it is copied to the stack before conversion
+
+    const size_t number_size = end - number_begin;
+
+    char number[64];
+
+    if(number_size < sizeof(number))
+    {
+        memcpy(number, number_begin, number_size);
+        number[number_size] = '\0';
+
+        value = strtod(number, NULL);
+    }
+    else
+    {
+        const std::string long_number(number_begin, number_size);
+
+        value = strtod(long_number.c_str(), NULL);
+    }
+
+    return(true);
+}
+
+
+// Vector< Vector<std::string> > set_from_data_file(const MemoryMappedFile&, Vector<size_t>&, Vector<size_t>&) method
+
+/// Performs a first data file read in which the format is checked,
+/// and the numbers of variables, instances and missing values are set.
+/// The file is split into chunks of lines which are scanned in parallel.
+/// The nominal labels of each column are collected in order of appearance, with hashed dictionaries.
+/// @param data_file Mapped data file.
+/// @param chunks_positions Positions of the chunks in the data file.
+/// @param chunks_instances_numbers Number of instances in each chunk.
+
+Vector< Vector<std::string> > DataSet::set_from_data_file(const MemoryMappedFile& data_file, Vector<size_t>& chunks_positions, Vector<size_t>& chunks_instances_numbers)
+{
+    const size_t columns_number = count_data_file_columns_number();
+
+    Vector< Vector<std::string> > nominal_labels(columns_number);
+
+    check_header_line();
+
+    // Split data file
+
+    const size_t minimum_chunk_size = 1048576;
+
+    #ifdef _OPENMP
+
+    const size_t threads_number = (size_t)omp_get_max_threads();
+
+    #else
+
+    const size_t threads_number = 1;
+
+    #endif
+
+    const size_t chunks_number = std::max((size_t)1, std::min(4*threads_number, data_file.get_size()/minimum_chunk_size));
+
+    chunks_positions = split_data_file(data_file, chunks_number);
+
+    const size_t chunks_size = chunks_positions.size() - 1;
+
+    chunks_instances_numbers.set(chunks_size, 0);
+
+    // Scan chunks
+
+    Vector< Vector< Vector<std::string> > > chunks_nominal_labels(chunks_size);
+
+    Vector<size_t> chunks_errors(chunks_size, 0);
+    Vector<size_t> chunks_tokens_numbers(chunks_size, 0);
+
+    const std::string separator_string = get_separator_string();
+
+    const char* file_data = data_file.get_data();
+
+    int i = 0;
+
+    #pragma omp parallel for schedule(dynamic)
+
+    for(i = 0; i < (int)chunks_size; i++)
+    {
+        const char* position = file_data + chunks_positions[i];
+        const char* end = file_data + chunks_positions[i+1];
+
+        std::string line;
+        std::string token;
+
+        Vector<size_t> tokens_begin;
+        Vector<size_t> tokens_end;
+
+        double value;
+
+        Vector< std::unordered_set<std::string> > chunk_dictionaries(columns_number);
+
+        chunks_nominal_labels[i].set(columns_number);
+
+        while(get_data_file_line(position, end, line))
+        {
+            if(line.empty())
+            {
+                continue;
+            }
+
+            if(line.find(separator_string) == std::string::npos)
+            {
+                chunks_errors[i] = 1;
+                break;
+            }
+
+            get_tokens_positions(line, tokens_begin, tokens_end);
+
+            if(tokens_begin.size() != columns_number)
+            {
+                chunks_errors[i] = 2;
+                chunks_tokens_numbers[i] = tokens_begin.size();
+                break;
+            }
+
+            chunks_instances_numbers[i]++;
+
+            for(size_t j = 0; j < columns_number; j++)
+            {
+                if(parse_numeric_token(line.data() + tokens_begin[j], line.data() + tokens_end[j], value))
+                {
+                    continue;
+                }
+
+                token.assign(line, tokens_begin[j], tokens_end[j] - tokens_begin[j]);
+
+                if(token != missing_values_label
+                && chunk_dictionaries[j].insert(token).second)
+                {
+                    chunks_nominal_labels[i][j].push_back(token);
+                }
+            }
         }
+    }
 
-        check_separator(line);
+    // Errors, in the same order as if the file was read line by line
+
+    int instances_count = 0;
+
+    for(size_t i = 0; i < chunks_size; i++)
+    {
+        if(chunks_errors[i] == 1)
+        {
+            std::ostringstream buffer;
 
-        tokens = get_tokens(line);
+            buffer << "OpenNN Exception: DataSet class.\n"
+                   << "void check_separator(const std::string&) method.\n"
+                   << "Separator '" << write_separator() << "' not found in data file " << data_file_name << ".\n";
 
-        if(tokens.size() != columns_number)
+            throw std::logic_error(buffer.str());
+        }
+        else if(chunks_errors[i] == 2)
         {
             std::ostringstream buffer;
 
             buffer << "OpenNN Exception: DataSet class.\n"
                    << "Vector< Vector<std::string> > DataSet::set_from_data_file(void).\n"
-                   << "Row " << instances_count << ": Size of tokens (" << tokens.size() << ") is not equal to "
+                   << "Row " << instances_count + chunks_instances_numbers[i] << ": Size of tokens (" << chunks_tokens_numbers[i] << ") is not equal to "
                    << "number of columns (" << columns_number << ").\n";
 
             throw std::logic_error(buffer.str());
         }
 
-        instances_count++;
+        instances_count += (int)chunks_instances_numbers[i];
+    }
+
+    // Merge nominal labels, keeping the order of appearance in the file
 
-        for(size_t j = 0; j < columns_number; j++)
-        {
-            numeric = is_numeric(tokens[j]);
+    for(size_t j = 0; j < columns_number; j++)
+    {
+        std::unordered_set<std::string> dictionary;
 
-            if(!numeric
-            && tokens[j] != missing_values_label
-            && !nominal_labels[j].contains(tokens[j]))
+        for(size_t i = 0; i < chunks_size; i++)
+        {
+            for(size_t k = 0; k < chunks_nominal_labels[i][j].size(); k++)
             {
-                nominal_labels[j].push_back(tokens[j]);
+                if(dictionary.insert(chunks_nominal_labels[i][j][k]).second)
+                {
+                    nominal_labels[j].push_back(chunks_nominal_labels[i][j][k]);
+                }
             }
         }
     }
 
-    file.close();
-
     size_t variables_count = 0;
 
     for(size_t i = 0; i < columns_number; i++)
@@ -4200,6 +4938,8 @@ Vector< Vector<std::string> > DataSet::set_from_data_file(void)
 
     data.set(instances_count, variables_count);
 
+    training_rows_arranged = false;
+
     if(variables.get_variables_number() != variables_count)
     {
         variables.set(variables_count);
@@ -4224,68 +4964,186 @@ Vector< Vector<std::string> > DataSet::set_from_data_file(void)
 }
 
 
-// void read_from_data_file(Vector< Vector<std::string> >&) method
+// void read_from_data_file(const MemoryMappedFile&, const Vector<size_t>&, const Vector<size_t>&, const Vector< Vector<std::string> >&) method
+
+/// Performs a second data file read in which the data is set.
+/// The chunks found in the first read are parsed in parallel, and the values are written directly into the data matrix.
+/// Nominal labels are looked up in hashed dictionaries, and numbers are parsed without allocating memory.
+/// @param data_file Mapped data file.
+/// @param chunks_positions Positions of the chunks in the data file.
+/// @param chunks_instances_numbers Number of instances in each chunk.
+/// @param nominal_labels Values of all nominal variables in the data file.
+
+void DataSet::read_from_data_file(const MemoryMappedFile& data_file,
+                                  const Vector<size_t>& chunks_positions,
+                                  const Vector<size_t>& chunks_instances_numbers,
+                                  const Vector< Vector<std::string> >& nominal_labels)
+{
+    const size_t columns_number = nominal_labels.size();
+
+    const size_t chunks_size = chunks_instances_numbers.size();
+
+    if(data.empty())
+    {
+        return;
+    }
+
+    // Columns layout
+
+    Vector<size_t> columns_indices(columns_number);
+
+    Vector< std::unordered_map<std::string, size_t> > dictionaries(columns_number);
+
+    for(size_t j = 0; j < columns_number; j++)
+    {
+        columns_indices[j] = get_column_index(nominal_labels, j);
+
+        for(size_t k = 0; k < nominal_labels[j].size(); k++)
+        {
+            dictionaries[j][nominal_labels[j][k]] = k;
+        }
+    }
+
+    Vector<size_t> chunks_first_instances(chunks_size, 0);
+
+    for(size_t i = 1; i < chunks_size; i++)
+    {
+        chunks_first_instances[i] = chunks_first_instances[i-1] + chunks_instances_numbers[i-1];
+    }
+
+    // Read chunks
+
+    Vector< Vector<size_t> > chunks_missing_instances(chunks_size);
+    Vector< Vector<size_t> > chunks_missing_variables(chunks_size);
+
+    Vector<size_t> chunks_errors(chunks_size, 0);
+
+    const char* file_data = data_file.get_data();
+
+    int i = 0;
+
+    #pragma omp parallel for schedule(dynamic)
 
-/// Performs a second data file read in which the data is set.
+    for(i = 0; i < (int)chunks_size; i++)
+    {
+        const char* position = file_data + chunks_positions[i];
+        const char* end = file_data + chunks_positions[i+1];
 
-void DataSet::read_from_data_file(const Vector< Vector<std::string> >& nominal_labels)
-{
-    std::ifstream file(data_file_name.c_str());
+        std::string line;
+        std::string token;
 
-    file.clear();
-    file.seekg(0, std::ios::beg);
+        Vector<size_t> tokens_begin;
+        Vector<size_t> tokens_end;
 
-    std::string line;
+        size_t instance_index = chunks_first_instances[i];
 
-    if(header_line)
-    {
-        while(file.good())
-        {
-            getline(file, line);
+        size_t column_index;
 
-            if(separator != Tab)
-            {
-                std::replace(line.begin(), line.end(), '\t', ' ');
-            }
+        double value;
 
-            trim(line);
+        std::unordered_map<std::string, size_t>::const_iterator label;
 
+        while(chunks_errors[i] == 0 && get_data_file_line(position, end, line))
+        {
             if(line.empty())
             {
                 continue;
             }
 
-            break;
-        }                
-    }
+            get_tokens_positions(line, tokens_begin, tokens_end);
 
-    size_t i = 0;
+            for(size_t j = 0; j < columns_number; j++)
+            {
+                column_index = columns_indices[j];
 
-//    #pragma omp parallel for private(i, line)
+                token.assign(line, tokens_begin[j], tokens_end[j] - tokens_begin[j]);
 
-    while(file.good())
-    {
-        getline(file, line);
+                if(token == missing_values_label) // Missing values
+                {
+                    const size_t variables_number = (nominal_labels[j].size() <= 2) ? 1 : nominal_labels[j].size();
 
-        if(separator != Tab)
-        {
-            std::replace(line.begin(), line.end(), '\t', ' ');
-        }
+                    for(size_t k = 0; k < variables_number; k++)
+                    {
+                        data(instance_index, column_index+k) = -99.9;
 
-        trim(line);
+                        chunks_missing_instances[i].push_back(instance_index);
+                        chunks_missing_variables[i].push_back(column_index+k);
+                    }
+                }
+                else if(nominal_labels[j].size() == 0) // Numeric variable
+                {
+                    parse_numeric_token(token.data(), token.data() + token.size(), value);
 
-        if(line.empty())
-        {
-            continue;
+                    data(instance_index, column_index) = value;
+                }
+                else if(nominal_labels[j].size() == 2) // Binary variable
+                {
+                    if(token == "false" || token == "False"||  token == "FALSE"
+                    || token == "negative"|| token == "Negative"|| token == "NEGATIVE")
+                    {
+                        data(instance_index, column_index) = 0.0;
+                    }
+                    else if(token == "true" || token == "True"||  token == "TRUE"
+                    || token == "positive"|| token == "Positive"|| token == "POSITIVE")
+                    {
+                        data(instance_index, column_index) = 1.0;
+                    }
+                    else if(token == nominal_labels[j][0])
+                    {
+                        data(instance_index, column_index) = 0.0;
+                    }
+                    else if(token == nominal_labels[j][1])
+                    {
+                        data(instance_index, column_index) = 1.0;
+                    }
+                    else
+                    {
+                        chunks_errors[i] = 1;
+                        break;
+                    }
+                }
+                else // Nominal variable
+                {
+                    label = dictionaries[j].find(token);
+
+                    for(size_t k = 0; k < nominal_labels[j].size(); k++)
+                    {
+                        data(instance_index, column_index+k) = 0.0;
+                    }
+
+                    if(label != dictionaries[j].end())
+                    {
+                        data(instance_index, column_index+label->second) = 1.0;
+                    }
+                }
+            }
+
+            instance_index++;
         }
+    }
+
+    if(chunks_errors.contains(1))
+    {
+        std::ostringstream buffer;
+
+        buffer << "OpenNN Exception: DataSet class.\n"
+               << "void read_from_data_file(const MemoryMappedFile&, const Vector<size_t>&, const Vector<size_t>&, const Vector< Vector<std::string> >&) method.\n"
+               << "Unknown token binary value.\n";
 
-        // #pragma omp task
+        throw std::logic_error(buffer.str());
+    }
 
-        read_instance(line, nominal_labels, i);
-        i++;
+    // Missing values are appended in file order
+
+    for(size_t i = 0; i < chunks_size; i++)
+    {
+        for(size_t j = 0; j < chunks_missing_instances[i].size(); j++)
+        {
+            missing_values.append(chunks_missing_instances[i][j], chunks_missing_variables[i][j]);
+        }
     }
 
-    file.close();
+    missing_values.build_index();
 }
 
 
@@ -4347,6 +5205,8 @@ void DataSet::convert_time_series(void)
 
     data.convert_time_series(lags_number);
 
+    training_rows_arranged = false;
+
     variables.convert_time_series(lags_number);
 
     instances.convert_time_series(lags_number);
@@ -4364,6 +5224,8 @@ void DataSet::convert_autoassociation(void)
 {
     data.convert_autoassociation();
 
+    training_rows_arranged = false;
+
     variables.convert_autoassociation();
 
     missing_values.convert_autoassociation();
@@ -4373,6 +5235,7 @@ void DataSet::convert_autoassociation(void)
 // void load_data(void) method
 
 /// This method loads the data file.
+/// The file is memory mapped, and it is split into chunks of lines which are parsed in parallel.
 
 void DataSet::load_data(void)
 {
@@ -4402,9 +5265,14 @@ void DataSet::load_data(void)
 
     file.close();
 
-    const Vector< Vector<std::string> > nominal_labels = set_from_data_file();
+    const MemoryMappedFile data_file(data_file_name);
+
+    Vector<size_t> chunks_positions;
+    Vector<size_t> chunks_instances_numbers;
 
-    read_from_data_file(nominal_labels);
+    const Vector< Vector<std::string> > nominal_labels = set_from_data_file(data_file, chunks_positions, chunks_instances_numbers);
+
+    read_from_data_file(data_file, chunks_positions, chunks_instances_numbers, nominal_labels);
 
     // Variables name
 
@@ -4452,6 +5320,8 @@ void DataSet::load_data(void)
 
 
 /// This method loads the data from a binary data file.
+/// Files saved with save_data_binary are memory mapped, and they also set the variables information and the missing values.
+/// Otherwise, the file must contain the numbers of variables and instances followed by the values of the data matrix.
 
 void DataSet::load_data_binary(void)
 {
@@ -4470,6 +5340,39 @@ void DataSet::load_data_binary(void)
         throw std::logic_error(buffer.str());
     }
 
+    char magic[8];
+
+    file.read(magic, 8);
+
+    if(file.gcount() == 8 && memcmp(magic, "OpenNNDS", 8) == 0)
+    {
+        file.close();
+
+        const DataBlocks data_blocks(data_file_name);
+
+        set_from_data_blocks(data_blocks);
+
+        data_blocks_pointer = NULL;
+
+        const size_t instances_number = data_blocks.get_instances_number();
+        const size_t variables_number = data_blocks.get_variables_number();
+
+        if(instances_number != 0 && variables_number != 0)
+        {
+            data.set(instances_number, variables_number);
+
+            for(size_t j = 0; j < variables_number; j++)
+            {
+                memcpy(&data[j*instances_number], data_blocks.get_column(j), instances_number*sizeof(double));
+            }
+        }
+
+        return;
+    }
+
+    file.clear();
+    file.seekg(0, std::ios::beg);
+
     std::streamsize size = sizeof(size_t);
 
     size_t variables_number;
@@ -4484,6 +5387,8 @@ void DataSet::load_data_binary(void)
 
     data.set(instances_number, variables_number);
 
+    training_rows_arranged = false;
+
     for(size_t i = 0; i < variables_number*instances_number; i++)
     {
         file.read(reinterpret_cast<char*>(&value), size);
@@ -4499,6 +5404,194 @@ void DataSet::load_data_binary(void)
     file.close();
 }
 
+// void set_from_data_blocks(const DataBlocks&) method
+
+/// Sets the numbers of instances and variables, the variables information and the missing values
+/// from a binary data file, as written by save_data_binary.
+/// The data matrix is left empty.
+/// @param data_blocks Binary data file.
+
+void DataSet::set_from_data_blocks(const DataBlocks& data_blocks)
+{
+   const size_t instances_number = data_blocks.get_instances_number();
+   const size_t variables_number = data_blocks.get_variables_number();
+
+   data.set();
+
+   training_rows_arranged = false;
+
+   if(instances_number == 0 || variables_number == 0)
+   {
+      instances.set();
+      variables.set();
+      missing_values.set();
+
+      return;
+   }
+
+   instances.set(instances_number);
+   variables.set(variables_number);
+   missing_values.set(instances_number, variables_number);
+
+   // Variables information
+
+   const char* position = data_blocks.get_variables_information();
+   const char* end = position + data_blocks.get_variables_information_size();
+
+   for(size_t j = 0; j < variables_number; j++)
+   {
+      size_t use;
+      Vector<std::string> strings(3);
+
+      bool valid = (size_t)(end - position) >= sizeof(size_t);
+
+      if(valid)
+      {
+         memcpy(&use, position, sizeof(size_t));
+         position += sizeof(size_t);
+
+         valid = use <= Variables::Unused;
+      }
+
+      for(size_t k = 0; k < 3 && valid; k++)
+      {
+         size_t length = 0;
+
+         valid = (size_t)(end - position) >= sizeof(size_t);
+
+         if(valid)
+         {
+            memcpy(&length, position, sizeof(size_t));
+            position += sizeof(size_t);
+
+            valid = length <= (size_t)(end - position);
+         }
+
+         if(valid)
+         {
+            strings[k].assign(position, length);
+            position += length;
+         }
+      }
+
+      if(!valid)
+      {
+         std::ostringstream buffer;
+
+         buffer << "OpenNN Exception: DataSet class.\n"
+                << "void set_from_data_blocks(const DataBlocks&) method.\n"
+                << "Corrupted variables information in binary data file: " << data_blocks.get_file_name() << "\n";
+
+         throw std::logic_error(buffer.str());
+      }
+
+      variables.set_use(j, (Variables::Use)use);
+      variables.set_name(j, strings[0]);
+      variables.set_units(j, strings[1]);
+      variables.set_description(j, strings[2]);
+   }
+
+   // Missing values
+
+   if(data_blocks.has_missing_values_bitmap())
+   {
+      for(size_t j = 0; j < variables_number; j++)
+      {
+         const unsigned char* bitmap = data_blocks.get_missing_values_bitmap(j);
+
+         for(size_t i = 0; i < instances_number; i += 8)
+         {
+            if(bitmap[i/8] == 0)
+            {
+               continue;
+            }
+
+            for(size_t k = i; k < i+8 && k < instances_number; k++)
+            {
+               if(bitmap[i/8] & (1 << (k%8)))
+               {
+                  missing_values.append(k, j);
+               }
+            }
+         }
+      }
+   }
+
+   missing_values.build_index();
+}
+
+
+// void update_training_rows(void) const method
+
+/// Arranges again the training rows if the data, the instances, the variables or the missing values
+/// have been modified since they were last arranged.
+/// The values are gathered one variable at a time, so that the columns of the data matrix are read in order.
+/// This is done in a critical section, so that the training rows can be requested from parallel regions.
+/// The flag and the modifications numbers are published with release ordering after the rows are filled,
+/// and they are read with acquire ordering, so that a thread which finds them up to date also sees the rows.
+
+void DataSet::update_training_rows(void) const
+{
+   if(training_rows_arranged.load(std::memory_order_acquire)
+   && training_rows_instances_modifications_number.load(std::memory_order_acquire) == instances.get_modifications_number()
+   && training_rows_variables_modifications_number.load(std::memory_order_acquire) == variables.get_modifications_number()
+   && training_rows_missing_values_modifications_number.load(std::memory_order_acquire) == missing_values.get_modifications_number())
+   {
+      return;
+   }
+
+   #pragma omp critical(DataSet_update_training_rows)
+   {
+      if(!training_rows_arranged.load(std::memory_order_relaxed)
+      || training_rows_instances_modifications_number.load(std::memory_order_relaxed) != instances.get_modifications_number()
+      || training_rows_variables_modifications_number.load(std::memory_order_relaxed) != variables.get_modifications_number()
+      || training_rows_missing_values_modifications_number.load(std::memory_order_relaxed) != missing_values.get_modifications_number())
+      {
+         training_rows_indices = arrange_complete_training_indices();
+
+         training_rows_inputs.clear();
+         training_rows_targets.clear();
+
+         if(data_blocks_pointer == NULL)
+         {
+            const size_t training_rows_number = training_rows_indices.size();
+
+            const Vector<size_t>& inputs_indices = variables.arrange_inputs_indices();
+            const Vector<size_t>& targets_indices = variables.arrange_targets_indices();
+
+            const size_t inputs_number = inputs_indices.size();
+            const size_t targets_number = targets_indices.size();
+
+            training_rows_inputs.set(training_rows_number*inputs_number);
+            training_rows_targets.set(training_rows_number*targets_number);
+
+            for(size_t j = 0; j < inputs_number; j++)
+            {
+               for(size_t i = 0; i < training_rows_number; i++)
+               {
+                  training_rows_inputs[i*inputs_number + j] = data(training_rows_indices[i], inputs_indices[j]);
+               }
+            }
+
+            for(size_t j = 0; j < targets_number; j++)
+            {
+               for(size_t i = 0; i < training_rows_number; i++)
+               {
+                  training_rows_targets[i*targets_number + j] = data(training_rows_indices[i], targets_indices[j]);
+               }
+            }
+         }
+
+         training_rows_instances_modifications_number.store(instances.get_modifications_number(), std::memory_order_release);
+         training_rows_variables_modifications_number.store(variables.get_modifications_number(), std::memory_order_release);
+         training_rows_missing_values_modifications_number.store(missing_values.get_modifications_number(), std::memory_order_release);
+
+         training_rows_arranged.store(true, std::memory_order_release);
+      }
+   }
+}
+
+
 
 /// This method loads data from a binary data file for time series prediction methods.
 
@@ -4533,6 +5626,8 @@ void DataSet::load_time_series_data_binary(void)
 
     data.set(instances_number, variables_number);
 
+    training_rows_arranged = false;
+
     for(size_t i = 0; i < variables_number*instances_number; i++)
     {
         file.read(reinterpret_cast<char*>(&value), size);
@@ -5055,57 +6150,44 @@ Vector<size_t> DataSet::balance_function_regression_targets_distribution(const d
 }
 
 
-// Vector<double> calculate_distances(const size_t&) const
+// Matrix<double> calculate_instances_distances(void) const
 
-/// Returns a matrix with the distances between every instance and the rest of the instances.
-/// The number of rows is the number of instances in the data set.
-/// The number of columns is the number of instances in the data set.
-/// @param nearest_neighbors_number Nearest neighbors number.
+/// Returns a matrix with the Euclidean distances between every used instance and the rest of the used instances,
+/// measured on the used variables.
+/// The number of rows is the number of used instances in the data set.
+/// The number of columns is the number of used instances in the data set.
+/// The size of this matrix grows quadratically with the number of instances,
+/// and the local outlier factor is calculated from a spatial index instead.
 
-Matrix<double> DataSet::calculate_instances_distances(const size_t& nearest_neighbors_number) const
+Matrix<double> DataSet::calculate_instances_distances(void) const
 {
-    const size_t instances_number = instances.count_used_instances_number();
-    const Vector<size_t> instances_indices = instances.arrange_used_indices();
+    const Vector<size_t>& instances_indices = instances.arrange_used_indices();
+    const Vector<size_t>& variables_indices = variables.arrange_used_indices();
 
-    //Matrix<double> distances(instances_number, instances_number, 0.0);
+    const size_t instances_number = instances_indices.size();
 
-    Vector<double> distances(nearest_neighbors_number , -1.0);
-
-    Vector<double> instance;
-    Vector<double> other_instance;
+    const Matrix<double> used_data = arrange_data_submatrix(instances_indices, variables_indices);
 
-    size_t maximal_index;
+    Matrix<double> distances(instances_number, instances_number, 0.0);
 
     double distance;
 
-   // #pragma omp parallel for private(i)
-
-    for(size_t i = 0; i < instances_number; i++)
-    {
-        for(size_t j = 0; j < instances_number; j++)
-         {
-
-              distance = data.calculate_distance(instances_indices[i], instances_indices[j]);
-
-              if(distances.count_greater_than(distance) != 0)
-              {
-                   maximal_index = distances.calculate_maximal_index();
-
-                   distances[maximal_index] = distance;
-              }
-          }
-       // instance = get_instance(instances_indices[i]);
+    int i = 0;
 
-       // for(size_t j = i+1; j < instances_number; j++)
-        //{
-           // other_instance = get_instance(instances_indices[j]);
+    #pragma omp parallel for private(i, distance) schedule(dynamic)
 
-         //   distances(i, j) = data.calculate_distance(instances_indices[i], instances_indices[j]);
+    for(i = 0; i < (int)instances_number; i++)
+    {
+        for(size_t j = i+1; j < instances_number; j++)
+        {
+            distance = used_data.calculate_distance(i, j);
 
-       // }
+            distances(i, j) = distance;
+            distances(j, i) = distance;
+        }
     }
-    Matrix<double> distances1(instances_number, instances_number, 0.0);
-    return(distances1);
+
+    return(distances);
 }
 
 
@@ -5128,7 +6210,7 @@ Matrix<size_t> DataSet::calculate_nearest_neighbors(const Matrix<double>& distan
 
     for(size_t i = 0; i < instances_number; i++)
     {
-        instance_distances = distances.arrange_row(i);
+        instance_distances = distances.view_row(i);
         minimal_distances_indices = instance_distances.calculate_minimal_indices(nearest_neighbors_number + 1);
 
         for(size_t j = 0; j < nearest_neighbors_number; j++)
@@ -5162,7 +6244,7 @@ Vector<double> DataSet::calculate_k_distances(const Matrix<double>& distances, c
     {
         maximal_index = nearest_neighbors(i, nearest_neighbors_number - 1);
 
-        k_distances[i] = distances.arrange_row(i)[maximal_index];
+        k_distances[i] = distances(i, maximal_index);
     }
 
     return(k_distances);
@@ -5172,6 +6254,8 @@ Vector<double> DataSet::calculate_k_distances(const Matrix<double>& distances, c
 // Matrix<double> calculate_reachability_distance(const Matrix<double>&, Vector<double>&) const
 
 /// Calculates the reachability distances for the instances in the data set.
+/// The reachability distance from an instance to another one is the distance between them,
+/// but not less than the k-distance of the second instance.
 /// @param distances Distances between every instance.
 /// @param k_distances Distances of the k-th nearest neighbors.
 
@@ -5181,19 +6265,17 @@ Matrix<double> DataSet::calculate_reachability_distances(const Matrix<double>& d
 
     Matrix<double> reachability_distances(instances_number, instances_number);
 
-    for(size_t i = 0; i < instances_number; i++)
+    for(size_t j = 0; j < instances_number; j++)
     {
-        for(size_t j = i; j < instances_number; j++)
+        for(size_t i = 0; i < instances_number; i++)
         {
-            if(distances(i, j) <= k_distances[i])
+            if(distances(i, j) <= k_distances[j])
             {
-                reachability_distances(i, j) = k_distances[i];
-                reachability_distances(j, i) = k_distances[i];
+                reachability_distances(i, j) = k_distances[j];
             }
-            else if(distances(i, j) > k_distances[i])
+            else
             {
                 reachability_distances(i, j) = distances(i, j);
-                reachability_distances(j, i) = distances(j, i);
             }
          }
     }
@@ -5226,7 +6308,7 @@ Vector<double> DataSet::calculate_reachability_density(const Matrix<double>& dis
    {
        nearest_neighbors_instance = nearest_neighbors_indices.arrange_row(i);
 
-       reachability_density[i] = nearest_neighbors_number/ reachability_distances.arrange_row(i).calculate_partial_sum(nearest_neighbors_instance);
+       reachability_density[i] = nearest_neighbors_number/ reachability_distances.view_row(i).calculate_partial_sum(nearest_neighbors_instance);
    }
 
    return (reachability_density);
@@ -5236,27 +6318,85 @@ Vector<double> DataSet::calculate_reachability_density(const Matrix<double>& dis
 
 // Vector<double> calculate_local_outlier_factor(const size_t&) const
 
-/// Returns a vector with the local outlier factors for every used instance.
-/// @param nearest_neighbors_number Number of neighbors to be calculated.
+/// Returns a vector with the local outlier factors for every used instance, measured on the used variables.
+/// The nearest neighbors of the instances are found with a spatial index, so that the distances between all the instances are not needed.
+/// Instances whose neighbors are all at zero distance have a local outlier factor of one.
+/// @param nearest_neighbors_number Number of neighbors to be calculated, which must be less than the number of used instances.
 
 Vector<double> DataSet::calculate_local_outlier_factor(const size_t& nearest_neighbors_number) const
 {
-    const size_t instances_number = instances.count_used_instances_number();
+    const Vector<size_t>& instances_indices = instances.arrange_used_indices();
+    const Vector<size_t>& variables_indices = variables.arrange_used_indices();
 
-    const Matrix<double> distances = calculate_instances_distances(nearest_neighbors_number);
-    const Vector<double> reachability_density = calculate_reachability_density(distances, nearest_neighbors_number);
+    const size_t instances_number = instances_indices.size();
 
-    const Matrix<size_t> nearest_neighbors = calculate_nearest_neighbors(distances, nearest_neighbors_number);
+    if(nearest_neighbors_number == 0 || nearest_neighbors_number >= instances_number)
+    {
+       std::ostringstream buffer;
+
+       buffer << "OpenNN Exception: DataSet class.\n"
+              << "Vector<double> calculate_local_outlier_factor(const size_t&) const method.\n"
+              << "Number of nearest neighbors (" << nearest_neighbors_number << ") must be greater than zero and less than number of used instances (" << instances_number << ").\n";
+
+       throw std::logic_error(buffer.str());
+    }
+
+    const SpatialIndex spatial_index(arrange_data_submatrix(instances_indices, variables_indices));
+
+    Matrix<size_t> nearest_neighbors;
+    Matrix<double> nearest_distances;
+
+    spatial_index.calculate_nearest_neighbors(nearest_neighbors_number, nearest_neighbors, nearest_distances);
+
+    const Vector<double> k_distances = nearest_distances.arrange_column(nearest_neighbors_number-1);
+
+    // Reachability density
 
-    Vector<size_t> instance_nearest_neighbors(nearest_neighbors_number);
+    Vector<double> reachability_density(instances_number);
+
+    double reachability_distances_sum;
+
+    int i = 0;
+
+    #pragma omp parallel for private(i, reachability_distances_sum)
+
+    for(i = 0; i < (int)instances_number; i++)
+    {
+        reachability_distances_sum = 0.0;
+
+        for(size_t j = 0; j < nearest_neighbors_number; j++)
+        {
+            reachability_distances_sum += std::max(k_distances[nearest_neighbors(i, j)], nearest_distances(i, j));
+        }
+
+        reachability_density[i] = nearest_neighbors_number/reachability_distances_sum;
+    }
+
+    // Local outlier factor
 
     Vector<double> local_outlier_factor(instances_number);
 
-    for(size_t i = 0; i < instances_number; i++)
+    double reachability_densities_sum;
+
+    #pragma omp parallel for private(i, reachability_densities_sum)
+
+    for(i = 0; i < (int)instances_number; i++)
     {
-        instance_nearest_neighbors = nearest_neighbors.arrange_row(i);
+        if(reachability_density[i] > std::numeric_limits<double>::max())
+        {
+            local_outlier_factor[i] = 1.0;
+
+            continue;
+        }
+
+        reachability_densities_sum = 0.0;
+
+        for(size_t j = 0; j < nearest_neighbors_number; j++)
+        {
+            reachability_densities_sum += reachability_density[nearest_neighbors(i, j)];
+        }
 
-        local_outlier_factor[i] = (reachability_density.calculate_partial_sum(instance_nearest_neighbors))/(nearest_neighbors_number*reachability_density[i]);
+        local_outlier_factor[i] = reachability_densities_sum/(nearest_neighbors_number*reachability_density[i]);
     }
 
     return (local_outlier_factor);
@@ -5421,8 +6561,6 @@ void DataSet::generate_artificial_data(const size_t& instances_number, const siz
 
     for(size_t i = 0; i < instances_number; i++)
     {
-        target_data(i, 0) = input_data.arrange_row(i).calculate_norm();
-
         rosenbrock = 0.0;
 
         for(size_t j = 0; j < inputs_number-1; j++)
@@ -5448,7 +6586,7 @@ void DataSet::generate_artificial_data(const size_t& instances_number, const siz
 
 bool DataSet::has_data(void) const
 {
-    if(data.empty())
+    if(data.empty() && data_blocks_pointer == NULL)
     {
         return(false);
     }
@@ -5573,6 +6711,8 @@ void DataSet::convert_angular_variable_degrees(const size_t& variable_index)
 
     data.convert_angular_variables_degrees(variable_index);
 
+    training_rows_arranged = false;
+
 }
 
 
@@ -5619,6 +6759,8 @@ void DataSet::convert_angular_variable_radians(const size_t& variable_index)
 
     data.convert_angular_variables_radians(variable_index);
 
+    training_rows_arranged = false;
+
 }
 
 
@@ -5804,6 +6946,8 @@ void DataSet::scrub_missing_values_mean(void)
             }
         }
     }
+
+    training_rows_arranged = false;
 }
 
 
@@ -26,11 +26,20 @@
 #include <stdexcept>
 #include <ctime>
 #include <exception>
+#include <cstring>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <atomic>
 
 // OpenNN includes
 
 #include "vector.h"
 #include "matrix.h"
+#include "memory_mapped_file.h"
+#include "data_blocks.h"
+#include "spatial_index.h"
 
 #include "missing_values.h"
 #include "variables.h"
@@ -166,6 +175,11 @@ public:
 
    const Matrix<double>& get_data(void) const;
 
+   DataBlocks* get_data_blocks_pointer(void) const;
+   bool has_data_blocks(void) const;
+
+   Matrix<double> arrange_data_submatrix(const Vector<size_t>&, const Vector<size_t>&) const;
+
    const Matrix<double>& get_time_series_data(void) const;
 
    Matrix<double> arrange_training_data(void) const;
@@ -187,6 +201,15 @@ public:
    Vector<double> get_instance(const size_t&) const;
    Vector<double> get_instance(const size_t&, const Vector<size_t>&) const;
 
+   Vector<size_t> arrange_complete_training_indices(void) const;
+   Vector<size_t> arrange_complete_generalization_indices(void) const;
+
+   // Training rows methods
+
+   size_t count_training_rows_number(void) const;
+
+   void arrange_training_row(const size_t&, Vector<double>&, Vector<double>&) const;
+
    // Variable methods
 
    Vector<double> get_variable(const size_t&) const;
@@ -206,6 +229,8 @@ public:
 
    void set_data(const Matrix<double>&);
 
+   void set_data_blocks_pointer(DataBlocks*);
+
    void set_instances_number(const size_t&);
    void set_variables_number(const size_t&);
 
@@ -289,6 +314,7 @@ public:
    // Correlation methods
 
    Matrix<double> calculate_linear_correlations(void) const;
+   Matrix<double> calculate_inputs_linear_correlations(void) const;
 
    // Histrogram methods
 
@@ -367,7 +393,7 @@ public:
 
    // Outlier detection
 
-   Matrix<double> calculate_instances_distances(const size_t&) const;
+   Matrix<double> calculate_instances_distances(void) const;
    Matrix<size_t> calculate_nearest_neighbors(const Matrix<double>&, const size_t&) const;
    Vector<double> calculate_k_distances(const Matrix<double>&, const size_t&) const;
    Matrix<double> calculate_reachability_distances(const Matrix<double>&, const Vector<double>&) const;
@@ -403,6 +429,7 @@ public:
    void print_data_preview(void) const;
 
    void save_data(void) const;
+   void save_data_binary(void) const;
 
    bool has_data(void) const;
 
@@ -523,6 +550,11 @@ private:
 
    Matrix<double> data;
 
+   /// Pointer to a binary data file which holds the values instead of the data matrix, or NULL.
+   /// The data file is not owned by the data set.
+
+   DataBlocks* data_blocks_pointer;
+
    /// Time series data matrix.
    /// The number of rows is the number of instances before time series changes.
    /// The number of columns is the number of variables before tim series changes.
@@ -541,6 +573,31 @@ private:
 
    MissingValues missing_values;
 
+   /// True if the training rows below are up to date with the data matrix.
+   /// Modifying the data matrix invalidates them, and they are arranged again when they are next requested.
+
+   mutable std::atomic<bool> training_rows_arranged;
+
+   /// Modifications numbers of the instances, the variables and the missing values for which the training rows were arranged.
+
+   mutable std::atomic<size_t> training_rows_instances_modifications_number;
+   mutable std::atomic<size_t> training_rows_variables_modifications_number;
+   mutable std::atomic<size_t> training_rows_missing_values_modifications_number;
+
+   /// Indices of the training instances without missing values, in the order of the training rows.
+
+   mutable Vector<size_t> training_rows_indices;
+
+   /// Input values of the training rows, stored one instance after another.
+   /// It is empty when the values are taken from a binary data file.
+
+   mutable Vector<double> training_rows_inputs;
+
+   /// Target values of the training rows, stored one instance after another.
+   /// It is empty when the values are taken from a binary data file.
+
+   mutable Vector<double> training_rows_targets;
+
    /// Display messages to screen.
    
    bool display;
@@ -555,10 +612,21 @@ private:
    void check_header_line(void);
    Vector<std::string> read_header_line(void) const;
 
-   void read_instance(const std::string&, const Vector< Vector<std::string> >&, const size_t&);
+   // Data file ingestion
+
+   Vector<size_t> split_data_file(const MemoryMappedFile&, const size_t&) const;
+
+   bool get_data_file_line(const char*&, const char*, std::string&) const;
+   void get_tokens_positions(const std::string&, Vector<size_t>&, Vector<size_t>&) const;
+
+   bool parse_numeric_token(const char*, const char*, double&) const;
+
+   Vector< Vector<std::string> > set_from_data_file(const MemoryMappedFile&, Vector<size_t>&, Vector<size_t>&);
+   void read_from_data_file(const MemoryMappedFile&, const Vector<size_t>&, const Vector<size_t>&, const Vector< Vector<std::string> >&);
+
+   void set_from_data_blocks(const DataBlocks&);
 
-   Vector< Vector<std::string> > set_from_data_file(void);
-   void read_from_data_file(const Vector< Vector<std::string> >&);
+   void update_training_rows(void) const;
 
 };
 
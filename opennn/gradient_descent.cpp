@@ -1299,19 +1299,20 @@ GradientDescent::GradientDescentResults* GradientDescent::perform_training(void)
 
       // Performance functional stuff
       
+      first_order_performance = performance_functional_pointer->calculate_performance_and_gradient();
+
+      performance = first_order_performance.performance;
+      gradient = first_order_performance.gradient;
+
       if(iteration == 0)
-      {      
-         performance = performance_functional_pointer->calculate_performance();
+      {
          performance_increase = 1.0e99;
       }
       else
       {
-         performance = directional_point[1];
          performance_increase = old_performance - performance; 
       }
 
-      gradient = performance_functional_pointer->calculate_gradient();
-
       gradient_norm = gradient.calculate_norm();
 
       if(display && gradient_norm >= warning_gradient_norm)
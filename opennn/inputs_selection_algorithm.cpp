@@ -1161,6 +1161,12 @@ Vector<double> InputsSelectionAlgorithm::get_final_performances(const TrainingSt
         performances[1] = results.Levenberg_Marquardt_algorithm_results_pointer->final_generalization_performance;
         break;
     }
+    case TrainingStrategy::STOCHASTIC_GRADIENT_DESCENT:
+    {
+        performances[0] = results.stochastic_gradient_descent_results_pointer->final_performance;
+        performances[1] = results.stochastic_gradient_descent_results_pointer->final_generalization_performance;
+        break;
+    }
     case TrainingStrategy::USER_MAIN:
     {
         performances[0] = 0;
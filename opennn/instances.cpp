@@ -27,6 +27,9 @@ namespace OpenNN
 
 Instances::Instances(void)
 {
+   modifications_number = 1;
+   indices_modifications_number = 0;
+
    set();
 }
 
@@ -40,6 +43,9 @@ Instances::Instances(void)
 
 Instances::Instances(const size_t& new_instances_number)
 {
+    modifications_number = 1;
+    indices_modifications_number = 0;
+
     set(new_instances_number);
 }
 
@@ -52,6 +58,9 @@ Instances::Instances(const size_t& new_instances_number)
 
 Instances::Instances(const tinyxml2::XMLDocument& instances_document)
 {   
+   modifications_number = 1;
+   indices_modifications_number = 0;
+
    set(instances_document);
 }
 
@@ -64,6 +73,9 @@ Instances::Instances(const tinyxml2::XMLDocument& instances_document)
 
 Instances::Instances(const Instances& other_instances)
 {
+   modifications_number = 1;
+   indices_modifications_number = 0;
+
    items = other_instances.items;
 
    display = other_instances.display;
@@ -91,6 +103,8 @@ Instances& Instances::operator=(const Instances& other_instances)
    {
       items = other_instances.items;
       display = other_instances.display;
+
+      modifications_number++;
    }
 
    return(*this);
@@ -366,19 +380,9 @@ bool Instances::is_unused(const size_t& i) const
 
 size_t Instances::count_unused_instances_number(void) const
 {
-    const size_t instances_number = get_instances_number();
-
-    size_t unused_instances_number = 0;
+    update_indices();
 
-    for(size_t i = 0; i < instances_number; i++)
-	{
-       if(items[i].use == Unused)
-	   {
-	      unused_instances_number++;
-	   }
-	}
-
-	return(unused_instances_number);
+    return(unused_indices.size());
 }
 
 
@@ -389,10 +393,9 @@ size_t Instances::count_unused_instances_number(void) const
 
 size_t Instances::count_used_instances_number(void) const
 {
-    const size_t instances_number = get_instances_number();
-    const size_t unused_instances_number = count_unused_instances_number();
+    update_indices();
 
-    return(instances_number - unused_instances_number);
+    return(used_indices.size());
 }
 
 
@@ -402,19 +405,9 @@ size_t Instances::count_used_instances_number(void) const
 
 size_t Instances::count_training_instances_number(void) const
 {
-    const size_t instances_number = get_instances_number();
+    update_indices();
 
-    size_t training_instances_number = 0;
-
-    for(size_t i = 0; i < instances_number; i++)
-	{
-       if(items[i].use == Training)
-	   {
-	      training_instances_number++;
-	   }
-	}
-
-	return(training_instances_number);
+    return(training_indices.size());
 }
 
 
@@ -424,19 +417,9 @@ size_t Instances::count_training_instances_number(void) const
 
 size_t Instances::count_generalization_instances_number(void) const
 {
-    const size_t instances_number = get_instances_number();
+    update_indices();
 
-    size_t generalization_instances_number = 0;
-
-    for(size_t i = 0; i < instances_number; i++)
-	{
-       if(items[i].use == Generalization)
-	   {
-	      generalization_instances_number++;
-	   }
-	}
-
-	return(generalization_instances_number);
+    return(generalization_indices.size());
 }
 
 
@@ -446,19 +429,9 @@ size_t Instances::count_generalization_instances_number(void) const
 
 size_t Instances::count_testing_instances_number(void) const
 {
-    const size_t instances_number = get_instances_number();
+    update_indices();
 
-    size_t testing_instances_number = 0;
-
-    for(size_t i = 0; i < instances_number; i++)
-	{
-       if(items[i].use == Testing)
-	   {
-	      testing_instances_number++;
-	   }
-	}
-
-	return(testing_instances_number);
+    return(testing_indices.size());
 }
 
 
@@ -470,178 +443,142 @@ size_t Instances::count_testing_instances_number(void) const
 
 Vector<size_t> Instances::count_uses(void) const
 {
-    Vector<size_t> count(4, 0);
+    update_indices();
 
-    const size_t instances_number = get_instances_number();
+    Vector<size_t> count(4);
 
-    for(size_t i = 0; i < instances_number; i++)
-    {
-        if(items[i].use == Training)
-        {
-           count[0]++;
-        }
-        else if(items[i].use == Generalization)
-        {
-           count[1]++;
-        }
-        else if(items[i].use == Testing)
-        {
-           count[2]++;
-        }
-        else
-        {
-           count[3]++;
-        }
-    }
+    count[0] = training_indices.size();
+    count[1] = generalization_indices.size();
+    count[2] = testing_indices.size();
+    count[3] = unused_indices.size();
 
     return(count);
 }
 
 
-// Vector<size_t> arrange_used_indices(void) const method
+// const Vector<size_t>& arrange_used_indices(void) const method
 
 /// Returns the indices of the used instances (those which are not set unused).
 
-Vector<size_t> Instances::arrange_used_indices(void) const
+const Vector<size_t>& Instances::arrange_used_indices(void) const
 {
-    const size_t instances_number = get_instances_number();
-
-    const size_t training_instances_number = count_training_instances_number();
-    const size_t generalization_instances_number = count_generalization_instances_number();
-    const size_t testing_instances_number = count_testing_instances_number();
+   update_indices();
 
-    Vector<size_t> used_indices(training_instances_number + generalization_instances_number + testing_instances_number);
-
-    size_t count = 0;
-
-    for(size_t i = 0; i < instances_number; i++)
-    {
-        if(items[i].use == Training)
-        {
-            used_indices [count] = (size_t)i;
-            count++;
-        }
-        else if(items[i].use == Generalization)
-        {
-            used_indices [count] = (size_t)i;
-            count++;
-        }
-        else if(items[i].use == Testing)
-        {
-            used_indices[count] = (size_t)i;
-            count++;
-        }
-    }
-
-    return(used_indices);
+   return(used_indices);
 }
 
 
-// Vector<size_t> arrange_unused_indices(void) const method
+// const Vector<size_t>& arrange_unused_indices(void) const method
 
 /// Returns the indices of the instances set unused.
 
-Vector<size_t> Instances::arrange_unused_indices(void) const
+const Vector<size_t>& Instances::arrange_unused_indices(void) const
 {
-    const size_t instances_number = get_instances_number();
-
-    const size_t unused_instances_number = count_unused_instances_number();
-
-    Vector<size_t> unused_indices(unused_instances_number);
-
-    size_t count = 0;
-
-    for(size_t i = 0; i < instances_number; i++)
-    {
-        if(items[i].use == Unused)
-        {
-            unused_indices[count] = (size_t)i;
-            count++;
-        }
-    }
+   update_indices();
 
-    return(unused_indices);
+   return(unused_indices);
 }
 
 
-// Vector<size_t> arrange_training_indices(void) const method
+// const Vector<size_t>& arrange_training_indices(void) const method
 
 /// Returns the indices of the instances which will be used for training.
 
-Vector<size_t> Instances::arrange_training_indices(void) const
+const Vector<size_t>& Instances::arrange_training_indices(void) const
 {
-   const size_t instances_number = get_instances_number();
-
-   const size_t training_instances_number = count_training_instances_number();
-
-   Vector<size_t> training_indices(training_instances_number);
-
-   size_t count = 0;
-
-   for(size_t i = 0; i < instances_number; i++)
-   {
-      if(items[i].use == Training)
-	  {
-         training_indices[count] = (size_t)i;
-		 count++;
-	  }
-   }
+   update_indices();
 
    return(training_indices);
 }
 
 
-// Vector<size_t> arrange_generalization_indices(void) const method
+// const Vector<size_t>& arrange_generalization_indices(void) const method
 
 /// Returns the indices of the instances which will be used for generalization.
 
-Vector<size_t> Instances::arrange_generalization_indices(void) const
+const Vector<size_t>& Instances::arrange_generalization_indices(void) const
 {
-   const size_t instances_number = get_instances_number();
+   update_indices();
 
-   const size_t generalization_instances_number = count_generalization_instances_number();
+   return(generalization_indices);
+}
 
-   Vector<size_t> generalization_indices(generalization_instances_number);
 
-   size_t count = 0;
+// const Vector<size_t>& arrange_testing_indices(void) const method
 
-   for(size_t i = 0; i < instances_number; i++)
-   {
-      if(items[i].use == Generalization)
-	  {
-	     generalization_indices[count] = i;
-		 count++;
-	  }
-   }
+/// Returns the indices of the instances which will be used for testing.
 
-   return(generalization_indices);
+const Vector<size_t>& Instances::arrange_testing_indices(void) const
+{
+   update_indices();
+
+   return(testing_indices);
 }
 
 
-// Vector<size_t> arrange_testing_indices(void) const method
+// const size_t& get_modifications_number(void) const method
 
-/// Returns the indices of the instances which will be used for testing.
+/// Returns the number of times that the uses of the instances have been modified.
+/// It changes whenever the number of instances or any of their uses is set.
 
-Vector<size_t> Instances::arrange_testing_indices(void) const
+const size_t& Instances::get_modifications_number(void) const
 {
-   const size_t instances_number = get_instances_number();
+   return(modifications_number);
+}
 
-   const size_t testing_instances_number = count_testing_instances_number();
 
-   Vector<size_t> testing_indices(testing_instances_number);
+// void update_indices(void) const method
 
-   size_t count = 0;
+/// Arranges again the cached indices of the used, unused, training, generalization and testing instances,
+/// if the uses have been modified since they were last arranged.
+/// This is done in a critical section, so that the indices can be requested from parallel regions.
+/// The uses must not be modified while a parallel region is requesting the indices.
 
-   for(size_t i = 0; i < instances_number; i++)
+void Instances::update_indices(void) const
+{
+   if(indices_modifications_number.load(std::memory_order_acquire) == modifications_number)
    {
-      if(items[i].use == Testing)
-	  {
-	     testing_indices[count] = i;
-		 count++;
-	  }
+      return;
    }
 
-   return(testing_indices);
+   #pragma omp critical(Instances_update_indices)
+   {
+      if(indices_modifications_number.load(std::memory_order_relaxed) != modifications_number)
+      {
+         const size_t instances_number = get_instances_number();
+
+         used_indices.clear();
+         unused_indices.clear();
+         training_indices.clear();
+         generalization_indices.clear();
+         testing_indices.clear();
+
+         for(size_t i = 0; i < instances_number; i++)
+         {
+            if(items[i].use == Training)
+            {
+               training_indices.push_back(i);
+               used_indices.push_back(i);
+            }
+            else if(items[i].use == Generalization)
+            {
+               generalization_indices.push_back(i);
+               used_indices.push_back(i);
+            }
+            else if(items[i].use == Testing)
+            {
+               testing_indices.push_back(i);
+               used_indices.push_back(i);
+            }
+            else
+            {
+               unused_indices.push_back(i);
+            }
+         }
+
+         indices_modifications_number.store(modifications_number, std::memory_order_release);
+      }
+   }
 }
 
 
@@ -741,6 +678,8 @@ void Instances::set_uses(const Vector<Instances::Use>& new_uses)
    {
        items[i].use = new_uses[i];
    }
+
+   modifications_number++;
 }
 
 
@@ -801,6 +740,8 @@ void Instances::set_uses(const Vector<std::string>& new_uses)
 	     throw std::logic_error(buffer.str());
 	  }
    }   
+
+   modifications_number++;
 }
 
 
@@ -813,6 +754,8 @@ void Instances::set_uses(const Vector<std::string>& new_uses)
 void Instances::set_use(const size_t& i, const Use& new_use)
 {
     items[i].use = new_use;
+
+    modifications_number++;
 }
 
 
@@ -850,6 +793,8 @@ void Instances::set_use(const size_t& i, const std::string& new_use)
 
        throw std::logic_error(buffer.str());
     }
+
+    modifications_number++;
 }
 
 
@@ -867,6 +812,8 @@ void Instances::set_unused(const Vector<size_t> & indices)
 
         items[index].use = Unused;
     }
+
+    modifications_number++;
 }
 
 
@@ -882,6 +829,8 @@ void Instances::set_training(void)
    {
        items[i].use = Training;
    }
+
+   modifications_number++;
 }
 
 
@@ -897,6 +846,8 @@ void Instances::set_generalization(void)
     {
         items[i].use = Generalization;
     }
+
+    modifications_number++;
 }
 
 
@@ -912,6 +863,8 @@ void Instances::set_testing(void)
     {
         items[i].use = Testing;
     }
+
+    modifications_number++;
 }
 
 
@@ -938,6 +891,8 @@ void Instances::set_instances_number(const size_t& new_instances_number)
 {
    items.set(new_instances_number);
 
+   modifications_number++;
+
    split_instances();
 }
 
@@ -1200,6 +1155,8 @@ void Instances::split_random_indices
 
       i++;
    }
+
+   modifications_number++;
 }
 
 
@@ -1286,6 +1243,8 @@ void Instances::split_sequential_indices(const double& training_instances_ratio,
 
       i++;
    }
+
+   modifications_number++;
 }
 
 
@@ -26,6 +26,7 @@
 #include <stdexcept>
 #include <ctime>
 #include <exception>
+#include <atomic>
 
 // OpenNN includes
 
@@ -158,11 +159,13 @@ public:
 
    Vector<size_t> count_uses(void) const;
 
-   Vector<size_t> arrange_used_indices(void)  const;
-   Vector<size_t> arrange_unused_indices(void) const;
-   Vector<size_t> arrange_training_indices(void) const;
-   Vector<size_t> arrange_generalization_indices(void) const;
-   Vector<size_t> arrange_testing_indices(void) const;
+   const Vector<size_t>& arrange_used_indices(void)  const;
+   const Vector<size_t>& arrange_unused_indices(void) const;
+   const Vector<size_t>& arrange_training_indices(void) const;
+   const Vector<size_t>& arrange_generalization_indices(void) const;
+   const Vector<size_t>& arrange_testing_indices(void) const;
+
+   const size_t& get_modifications_number(void) const;
 
    const bool& get_display(void) const;
 
@@ -216,12 +219,45 @@ public:
 
 private:
 
+   void update_indices(void) const;
+
    // MEMBERS
 
    /// Uses of instances (none, training, generalization or testing).
 
    Vector<Item> items;
 
+   /// Number of times that the uses of the instances have been modified.
+   /// Objects which cache information depending on the uses can compare this number to know whether it is still valid.
+
+   size_t modifications_number;
+
+   /// Modifications number for which the cached indices below were arranged.
+   /// It is stored with release semantics once the indices are complete, and read with acquire semantics, 
+   /// so that a thread which sees it up to date also sees the cached indices.
+
+   mutable std::atomic<size_t> indices_modifications_number;
+
+   /// Cached indices of the used instances.
+
+   mutable Vector<size_t> used_indices;
+
+   /// Cached indices of the unused instances.
+
+   mutable Vector<size_t> unused_indices;
+
+   /// Cached indices of the training instances.
+
+   mutable Vector<size_t> training_indices;
+
+   /// Cached indices of the generalization instances.
+
+   mutable Vector<size_t> generalization_indices;
+
+   /// Cached indices of the testing instances.
+
+   mutable Vector<size_t> testing_indices;
+
    /// Display messages to screen.
    
    bool display;
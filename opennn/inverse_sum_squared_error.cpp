@@ -369,20 +369,16 @@ double InverseSumSquaredError::calculate_generalization_performance(void) const
 
    // Data set
 
-   const Instances& instances = data_set_pointer->get_instances();
+   const Vector<size_t> generalization_indices = data_set_pointer->arrange_complete_generalization_indices();
 
-   const size_t generalization_instances_number = instances.count_generalization_instances_number();
-
-   const Vector<size_t> generalization_indices = instances.arrange_generalization_indices();
+   const size_t generalization_instances_number = generalization_indices.size();
 
    size_t generalization_index;
 
    const Variables& variables = data_set_pointer->get_variables();
 
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
-   const MissingValues& missing_values = data_set_pointer->get_missing_values();
+   const Vector<size_t>& inputs_indices = variables.arrange_inputs_indices();
+   const Vector<size_t>& targets_indices = variables.arrange_targets_indices();
 
    // Performance functional
 
@@ -400,11 +396,6 @@ double InverseSumSquaredError::calculate_generalization_performance(void) const
    {
        generalization_index = generalization_indices[i];
 
-       if(missing_values.has_missing_values(generalization_index))
-       {
-           continue;
-       }
-
       // Input vector
 
       inputs = data_set_pointer->get_instance(generalization_index, inputs_indices);
@@ -329,6 +329,17 @@ const bool& LevenbergMarquardtAlgorithm::get_reserve_damping_parameter_history(v
 }
 
 
+// const bool& get_accumulate_Hessian_approximation(void) const method
+
+/// Returns true if the Hessian approximation and the gradient are accumulated by batches of instances, 
+/// and false if they are computed from the whole terms Jacobian. 
+
+const bool& LevenbergMarquardtAlgorithm::get_accumulate_Hessian_approximation(void) const
+{
+   return(accumulate_Hessian_approximation);
+}
+
+
 // const Vector<double> const get_damping_parameter_history(void) const method
 
 /// Returns a vector containing the damping parameter history over the training iterations.
@@ -409,6 +420,8 @@ void LevenbergMarquardtAlgorithm::set_default(void)
    maximum_damping_parameter = 1.0e6;
 
    reserve_damping_parameter_history = false;
+
+   accumulate_Hessian_approximation = true;
 }
 
 
@@ -523,6 +536,19 @@ void LevenbergMarquardtAlgorithm::set_reserve_damping_parameter_history(const bo
 }
 
 
+// void set_accumulate_Hessian_approximation(const bool&) method
+
+/// Sets how the Hessian approximation and the gradient are computed. 
+/// When accumulated, they are added up by batches of instances and the memory needed grows with the squared number of parameters only. 
+/// Otherwise, the whole terms Jacobian, with one row per training instance, is built. 
+/// @param new_accumulate_Hessian_approximation True to accumulate the Hessian approximation, false to build the terms Jacobian.
+
+void LevenbergMarquardtAlgorithm::set_accumulate_Hessian_approximation(const bool& new_accumulate_Hessian_approximation)
+{
+   accumulate_Hessian_approximation = new_accumulate_Hessian_approximation;
+}
+
+
 // void set_warning_parameters_norm(const double&) method
 
 /// Sets a new value for the parameters vector norm at which a warning message is written to the 
@@ -1336,14 +1362,6 @@ LevenbergMarquardtAlgorithm::LevenbergMarquardtAlgorithmResults* LevenbergMarqua
 
    double parameters_norm;
 
-   // Data set stuff
-
-   const DataSet* data_set_pointer = performance_functional_pointer->get_data_set_pointer();
-
-   const Instances& instances = data_set_pointer->get_instances();
-
-   const size_t training_instances_number = instances.count_training_instances_number();
-
    // Performance functional stuff
 
    double performance = 0.0;
@@ -1355,8 +1373,10 @@ LevenbergMarquardtAlgorithm::LevenbergMarquardtAlgorithmResults* LevenbergMarqua
 
    size_t generalization_failures = 0;
 
-   Vector<double> terms(training_instances_number);
-   Matrix<double> terms_Jacobian(training_instances_number, parameters_number);
+   Vector<double> terms;
+   Matrix<double> terms_Jacobian;
+
+   PerformanceTerm::SecondOrderTerms second_order_terms;
 
    Vector<double> gradient(parameters_number);
 
@@ -1392,13 +1412,28 @@ LevenbergMarquardtAlgorithm::LevenbergMarquardtAlgorithmResults* LevenbergMarqua
 
       // Performance functional 
 
-      terms = performance_functional_pointer->calculate_terms();
+      if(accumulate_Hessian_approximation)
+      {
+         second_order_terms = performance_functional_pointer->calculate_second_order_terms();
+
+         performance = second_order_terms.performance;
+
+         gradient = second_order_terms.JacobianT_dot_terms*2.0;
+
+         JacobianT_dot_Jacobian = second_order_terms.JacobianT_dot_Jacobian;
+      }
+      else
+      {
+         terms = performance_functional_pointer->calculate_terms();
+
+         performance = calculate_performance(terms);
 
-      performance = calculate_performance(terms);//*performance_terms).calculate_sum()/2.0;
+         terms_Jacobian = performance_functional_pointer->calculate_terms_Jacobian();
 
-      terms_Jacobian = performance_functional_pointer->calculate_terms_Jacobian();
+         gradient = calculate_gradient(terms, terms_Jacobian);
 
-      gradient = calculate_gradient(terms, terms_Jacobian);
+         JacobianT_dot_Jacobian = terms_Jacobian.calculate_transpose_dot(terms_Jacobian);
+      }
 
       gradient_norm = gradient.calculate_norm();
 
@@ -1407,8 +1442,6 @@ LevenbergMarquardtAlgorithm::LevenbergMarquardtAlgorithmResults* LevenbergMarqua
          std::cout << "OpenNN Warning: Gradient norm is " << gradient_norm << "." << std::endl;          
       }
 
-      JacobianT_dot_Jacobian = terms_Jacobian.calculate_transpose().dot(terms_Jacobian);
-
       do
       {
          Hessian_approximation = (JacobianT_dot_Jacobian.sum_diagonal(damping_parameter));
@@ -1888,6 +1921,17 @@ tinyxml2::XMLDocument* LevenbergMarquardtAlgorithm::to_XML(void) const
    text = document->NewText(buffer.str().c_str());
    element->LinkEndChild(text);
 
+   // Accumulate Hessian approximation
+
+   element = document->NewElement("AccumulateHessianApproximation");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << accumulate_Hessian_approximation;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+
    // Warning parameters norm
 
    element = document->NewElement("WarningParametersNorm");
@@ -2249,6 +2293,24 @@ void LevenbergMarquardtAlgorithm::from_XML(const tinyxml2::XMLDocument& document
        }
     }
 
+    // Accumulate Hessian approximation
+
+    const tinyxml2::XMLElement* accumulate_Hessian_approximation_element = root_element->FirstChildElement("AccumulateHessianApproximation");
+
+    if(accumulate_Hessian_approximation_element)
+    {
+       const std::string new_accumulate_Hessian_approximation = accumulate_Hessian_approximation_element->GetText();
+
+       try
+       {
+          set_accumulate_Hessian_approximation(new_accumulate_Hessian_approximation != "0");
+       }
+       catch(const std::logic_error& e)
+       {
+          std::cout << e.what() << std::endl;
+       }
+    }
+
    // Warning parameters norm
 
    const tinyxml2::XMLElement* warning_parameters_norm_element = root_element->FirstChildElement("WarningParametersNorm");
@@ -222,6 +222,8 @@ public:
 
    const Vector<double>& get_damping_parameter_history(void) const;
 
+   const bool& get_accumulate_Hessian_approximation(void) const;
+
    // Set methods
 
    void set_default(void);
@@ -235,6 +237,8 @@ public:
 
    void set_reserve_damping_parameter_history(const bool&);
 
+   void set_accumulate_Hessian_approximation(const bool&);
+
    // Training parameters
 
    void set_warning_parameters_norm(const double&);
@@ -327,6 +331,11 @@ private:
 
    Vector<double> damping_parameter_history;
 
+   /// True if the Hessian approximation and the gradient are accumulated by batches of instances, 
+   /// false if they are computed from the whole terms Jacobian. 
+
+   bool accumulate_Hessian_approximation;
+
 
    /// Value for the parameters norm at which a warning message is written to the screen. 
 
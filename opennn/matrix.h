@@ -21,6 +21,7 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <stdexcept>
 
@@ -31,6 +32,11 @@
 namespace OpenNN
 {
 
+template <class T> class LUFactorization;
+template <class T> class CholeskyFactorization;
+template <class T> class LDLTFactorization;
+template <class T> class MatrixView;
+
 /// This template class defines a matrix for general purpose use.
 /// This matrix also implements some mathematical methods which can be useful. 
 
@@ -52,6 +58,11 @@ public:
 
     Matrix(const Matrix&);
 
+    Matrix(Matrix&&) noexcept;
+
+    template<class E>
+    Matrix(const VectorExpression<E>&);
+
     // DESTRUCTOR
 
     virtual ~Matrix(void);
@@ -60,6 +71,11 @@ public:
 
     inline Matrix<T>& operator = (const Matrix<T>&);
 
+    inline Matrix<T>& operator = (Matrix<T>&&) noexcept;
+
+    template<class E>
+    Matrix<T>& operator = (const VectorExpression<E>&);
+
     // REFERENCE OPERATORS
 
     inline T& operator () (const size_t&, const size_t&);
@@ -138,6 +154,12 @@ public:
 
     Vector<T> arrange_column(const size_t&, const Vector<size_t>&) const;
 
+    VectorView<T> view_row(const size_t&) const;
+
+    VectorView<T> view_column(const size_t&) const;
+
+    MatrixView<T> view_submatrix(const size_t&, const size_t&, const size_t&, const size_t&) const;
+
     Vector<T> get_diagonal(void) const;
 
     void set_row(const size_t&, const Vector<T>&);
@@ -241,6 +263,12 @@ public:
 
     Vector< Statistics<T> > calculate_columns_statistics_missing_values(const Vector<size_t>&, const Vector< Vector<size_t> >) const;
 
+    Vector< Statistics<T> > calculate_statistics_missing_values(const Vector<size_t>&, const Vector<size_t>&, const Vector< Vector<size_t> >&) const;
+
+    Matrix<double> calculate_linear_correlations(const Vector<size_t>&, const Vector<size_t>&) const;
+
+    Matrix<double> calculate_linear_correlations(const Vector<size_t>&) const;
+
     Vector< Vector<double> > calculate_shape_parameters(void) const;
 
     Vector< Vector<double> > calculate_shape_parameters_missing_values(const Vector<Vector<size_t> > &) const;
@@ -279,6 +307,10 @@ public:
 
     void scale_columns_minimum_maximum(const Vector< Statistics<T> >&, const Vector<size_t>&);
 
+    Vector< Statistics<T> > scale_columns_mean_standard_deviation_missing_values(const Vector<size_t>&, const Vector< Vector<size_t> >&);
+
+    Vector< Statistics<T> > scale_columns_minimum_maximum_missing_values(const Vector<size_t>&, const Vector< Vector<size_t> >&);
+
     void unscale_mean_standard_deviation(const Vector< Statistics<T> >&);
 
     void unscale_rows_mean_standard_deviation(const Vector< Statistics<T> >&, const Vector<size_t>&);
@@ -313,31 +345,59 @@ public:
 
     Matrix<T> calculate_inverse(void) const;
 
+    double calculate_log_determinant(void) const;
+
+    LUFactorization<T> calculate_LU_factorization(void) const;
+
+    CholeskyFactorization<T> calculate_Cholesky_factorization(void) const;
+
+    LDLTFactorization<T> calculate_LDLT_factorization(void) const;
+
+    Vector<T> solve_lower_triangular(const Vector<T>&) const;
+
+    Vector<T> solve_upper_triangular(const Vector<T>&) const;
+
     double calculate_distance(const size_t&, const size_t&) const;
 
-    Matrix<T> operator + (const T&) const;
+    Matrix<T> operator + (const T&) const &;
+    Matrix<T> operator + (const T&) &&;
 
     Matrix<T> operator + (const Vector<T>&) const;
 
-    Matrix<T> operator + (const Matrix<T>&) const;
+    Matrix<T> operator + (const Matrix<T>&) const &;
+    Matrix<T> operator + (const Matrix<T>&) &&;
+    Matrix<T> operator + (Matrix<T>&&) const &;
+    Matrix<T> operator + (Matrix<T>&&) &&;
 
-    Matrix<T> operator - (const T& scalar) const;
+    Matrix<T> operator - (const T&) const &;
+    Matrix<T> operator - (const T&) &&;
 
     Matrix<T> operator - (const Vector<T>&) const;
 
-    Matrix<T> operator - (const Matrix<T>&) const;
+    Matrix<T> operator - (const Matrix<T>&) const &;
+    Matrix<T> operator - (const Matrix<T>&) &&;
+    Matrix<T> operator - (Matrix<T>&&) const &;
+    Matrix<T> operator - (Matrix<T>&&) &&;
 
-    Matrix<T> operator * (const T&) const;
+    Matrix<T> operator * (const T&) const &;
+    Matrix<T> operator * (const T&) &&;
 
     Matrix<T> operator * (const Vector<T>&) const;
 
-    Matrix<T> operator * (const Matrix<T>&) const;
+    Matrix<T> operator * (const Matrix<T>&) const &;
+    Matrix<T> operator * (const Matrix<T>&) &&;
+    Matrix<T> operator * (Matrix<T>&&) const &;
+    Matrix<T> operator * (Matrix<T>&&) &&;
 
-    Matrix<T> operator / (const T&) const;
+    Matrix<T> operator / (const T&) const &;
+    Matrix<T> operator / (const T&) &&;
 
     Matrix<T> operator / (const Vector<T>&) const;
 
-    Matrix<T> operator / (const Matrix<T>&) const;
+    Matrix<T> operator / (const Matrix<T>&) const &;
+    Matrix<T> operator / (const Matrix<T>&) &&;
+    Matrix<T> operator / (Matrix<T>&&) const &;
+    Matrix<T> operator / (Matrix<T>&&) &&;
 
     void operator += (const T& value);
 
@@ -355,12 +415,32 @@ public:
 
     void operator /= (const Matrix<T>&);
 
+    template<class E>
+    void operator += (const VectorExpression<E>&);
+
+    template<class E>
+    void operator -= (const VectorExpression<E>&);
+
+    // Expression methods
+
+    ExpressionTerminal<T> lazy(void) const;
+
 //    void sum_diagonal(const T&);
 
     Vector<double> dot(const Vector<double>&) const;
 
+    Vector<double> dot(const VectorView<double>&) const;
+
     Matrix<double> dot(const Matrix<double>&) const;
 
+    Matrix<double> calculate_transpose_dot(const Matrix<double>&) const;
+
+    void sum_symmetric_rank_update(const Matrix<double>&);
+
+    void sum_lower_rank_update(const Matrix<double>&, const size_t&, const size_t&);
+
+    void copy_lower_triangle_to_upper(void);
+
     Matrix<T> direct(const Matrix<T>&) const;
 
     bool empty(void) const;
@@ -410,6 +490,14 @@ public:
 
 private:
 
+    Vector< Statistics<T> > calculate_blocks_statistics(const Vector<size_t>*, const Vector<size_t>&, const Vector< Vector<size_t> >*) const;
+
+    RunningStatistics<T> calculate_column_running_statistics(const size_t&, const Vector<size_t>&) const;
+
+    void calculate_standardization(const Vector<size_t>&, Vector<double>&, Vector<double>&, Vector<bool>&) const;
+
+    void arrange_standardized_block(const Vector<size_t>&, const Vector<double>&, const Vector<double>&, const size_t&, Matrix<double>&) const;
+
     /// Number of rows in the matrix.
 
     size_t rows_number;
@@ -541,6 +629,39 @@ Matrix<T>::Matrix(const Matrix& other_matrix) : std::vector<T>(other_matrix.begi
 }
 
 
+// MOVE CONSTRUCTOR
+
+/// Move constructor. It takes the elements of an expiring matrix without copying them.
+/// @param other_matrix Matrix to be moved. It is left with zero rows and columns.
+
+template <class T>
+Matrix<T>::Matrix(Matrix&& other_matrix) noexcept : std::vector<T>(std::move(other_matrix))
+{
+   rows_number = other_matrix.rows_number;
+   columns_number = other_matrix.columns_number;
+
+   other_matrix.rows_number = 0;
+   other_matrix.columns_number = 0;
+}
+
+
+// EXPRESSION CONSTRUCTOR
+
+/// Expression constructor. It evaluates a lazy element-wise expression into a new matrix,
+/// whose dimensions are those of the expression.
+/// @param expression Expression to be evaluated, built from the lazy() terminals of matrices.
+
+template <class T>
+template <class E>
+Matrix<T>::Matrix(const VectorExpression<E>& expression) : std::vector<T>()
+{
+   rows_number = 0;
+   columns_number = 0;
+
+   (*this) = expression;
+}
+
+
 // DESTRUCTOR
 
 /// Destructor.
@@ -575,6 +696,56 @@ Matrix<T>& Matrix<T>::operator = (const Matrix<T>& other_matrix)
 }
 
 
+/// Move assignment operator. It takes the elements of an expiring matrix, releasing the previous ones.
+/// @param other_matrix Matrix to be moved. It is left with zero rows and columns.
+
+template <class T>
+Matrix<T>& Matrix<T>::operator = (Matrix<T>&& other_matrix) noexcept
+{
+    std::vector<T>::operator = (std::move(other_matrix));
+
+    rows_number = other_matrix.rows_number;
+    columns_number = other_matrix.columns_number;
+
+    other_matrix.rows_number = 0;
+    other_matrix.columns_number = 0;
+
+    return(*this);
+}
+
+
+/// Expression assignment operator.
+/// It evaluates a lazy element-wise expression in a single loop over the elements, without intermediate matrices.
+/// This matrix might appear in the expression, since each element is read before it is written.
+/// @param expression Expression to be assigned.
+
+template <class T>
+template <class E>
+Matrix<T>& Matrix<T>::operator = (const VectorExpression<E>& expression)
+{
+    const E& expression_node = expression.derived();
+
+    const size_t expression_rows_number = expression_node.get_rows_number();
+    const size_t expression_columns_number = expression_node.get_columns_number();
+
+    if(expression_rows_number != rows_number || expression_columns_number != columns_number)
+    {
+        set(expression_rows_number, expression_columns_number);
+    }
+
+    const size_t this_size = this->size();
+
+    T* this_data = this->data();
+
+    for(size_t i = 0; i < this_size; i++)
+    {
+        this_data[i] = expression_node[i];
+    }
+
+    return(*this);
+}
+
+
 // REFERENCE OPERATORS
 
 /// Reference operator.
@@ -1661,6 +1832,98 @@ Vector<T> Matrix<T>::arrange_column(const size_t& column_index, const Vector<siz
 }
 
 
+// VectorView<T> view_row(const size_t&) const method
+
+/// Returns a view of the row with the given index, without copying it.
+/// Since the elements are stored by columns, consecutive elements of the row are one column apart.
+/// @param row_index Index of row.
+
+template <class T>
+VectorView<T> Matrix<T>::view_row(const size_t& row_index) const
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(row_index >= rows_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Matrix Template.\n"
+             << "VectorView<T> view_row(const size_t&) const method.\n"
+             << "Row index (" << row_index << ") must be less than number of rows (" << rows_number << ").\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   return(VectorView<T>(this->data() + row_index, columns_number, rows_number));
+}
+
+
+// VectorView<T> view_column(const size_t&) const method
+
+/// Returns a view of the column with the given index, whose elements are contiguous.
+/// @param column_index Index of column.
+
+template <class T>
+VectorView<T> Matrix<T>::view_column(const size_t& column_index) const
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(column_index >= columns_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Matrix Template.\n"
+             << "VectorView<T> view_column(const size_t&) const method.\n"
+             << "Column index (" << column_index << ") must be less than number of columns (" << columns_number << ").\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   return(VectorView<T>(this->data() + column_index*rows_number, rows_number, 1));
+}
+
+
+// MatrixView<T> view_submatrix(const size_t&, const size_t&, const size_t&, const size_t&) const method
+
+/// Returns a view of a block of consecutive rows and columns of this matrix, without copying it.
+/// @param first_row Index of the first row of the block.
+/// @param first_column Index of the first column of the block.
+/// @param block_rows_number Number of rows in the block.
+/// @param block_columns_number Number of columns in the block.
+
+template <class T>
+MatrixView<T> Matrix<T>::view_submatrix(const size_t& first_row, const size_t& first_column,
+                                        const size_t& block_rows_number, const size_t& block_columns_number) const
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(first_row + block_rows_number > rows_number || first_column + block_columns_number > columns_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Matrix Template.\n"
+             << "MatrixView<T> view_submatrix(const size_t&, const size_t&, const size_t&, const size_t&) const method.\n"
+             << "Block must be inside the matrix.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   return(MatrixView<T>(this->data() + first_column*rows_number + first_row, block_rows_number, block_columns_number, rows_number));
+}
+
+
 // Vector<T> get_diagonal(void) const method
 
 /// Returns the diagonal of the matrix.
@@ -2462,7 +2725,7 @@ Matrix<T> Matrix<T>::sort_less_rows(const size_t& column_index) const
 
     const Vector<T> column = arrange_column(column_index);
 
-    const Vector<size_t> sorted_indices = column.calculate_minimal_indices(rows_number);
+    const Vector<size_t> sorted_indices = column.sort_less_indices();
 
     size_t index;
 
@@ -2493,7 +2756,7 @@ Matrix<T> Matrix<T>::sort_greater_rows(const size_t& column_index) const
 
     const Vector<T> column = arrange_column(column_index);
 
-    const Vector<size_t> sorted_indices = column.calculate_maximal_indices(rows_number);
+    const Vector<size_t> sorted_indices = column.sort_greater_indices();
 
     size_t index;
 
@@ -3723,18 +3986,10 @@ Vector< Statistics<T> > Matrix<T>::calculate_statistics(void) const
 
    #endif
 
-   Vector< Statistics<T> > statistics(columns_number);
-
-   Vector<T> column(rows_number);
-
-   for(size_t i = 0; i < columns_number; i++)
-   {
-      column = arrange_column(i);
-
-      statistics[i] = column.calculate_statistics();
-   }
+   Vector<size_t> column_indices(columns_number);
+   column_indices.initialize_sequential();
 
-   return(statistics);
+   return(calculate_blocks_statistics(NULL, column_indices, NULL));
 }
 
 
@@ -3776,18 +4031,10 @@ Vector< Statistics<T> > Matrix<T>::calculate_statistics_missing_values(const Vec
 
    #endif
 
-   Vector< Statistics<T> > statistics(columns_number);
-
-   Vector<T> column(rows_number);
-
-   for(size_t i = 0; i < columns_number; i++)
-   {
-      column = arrange_column(i);
-
-      statistics[i] = column.calculate_statistics_missing_values(missing_indices[i]);
-   }
+   Vector<size_t> column_indices(columns_number);
+   column_indices.initialize_sequential();
 
-   return(statistics);
+   return(calculate_blocks_statistics(NULL, column_indices, &missing_indices));
 }
 
 
@@ -3802,25 +4049,7 @@ Vector< Statistics<T> > Matrix<T>::calculate_statistics_missing_values(const Vec
 template <class T>
 Vector< Statistics<T> > Matrix<T>::calculate_statistics(const Vector<size_t>& row_indices, const Vector<size_t>& column_indices) const
 {
-    const size_t row_indices_size = row_indices.size();
-    const size_t column_indices_size = column_indices.size();
-
-    Vector< Statistics<T> > statistics(column_indices_size);
-
-    size_t index;
-
-    Vector<T> column(row_indices_size);
-
-    for(size_t i = 0; i < column_indices_size; i++)
-    {
-        index = column_indices[i];
-
-        column = arrange_column(index, row_indices);
-
-        statistics[i] = column.calculate_statistics();
-    }
-
-    return statistics;
+    return(calculate_blocks_statistics(&row_indices, column_indices, NULL));
 }
 
 
@@ -3834,20 +4063,10 @@ Vector< Statistics<T> > Matrix<T>::calculate_statistics(const Vector<size_t>& ro
 template <class T>
 Vector< Statistics<T> > Matrix<T>::calculate_rows_statistics(const Vector<size_t>& row_indices) const
 {
-    const size_t row_indices_size = row_indices.size();
-
-    Vector< Statistics<T> > statistics(columns_number);
-
-    Vector<T> column(row_indices_size);
-
-    for(size_t i = 0; i < columns_number; i++)
-    {
-        column = arrange_column(i, row_indices);
-
-        statistics[i] = column.calculate_statistics();
-    }
+    Vector<size_t> column_indices(columns_number);
+    column_indices.initialize_sequential();
 
-    return statistics;
+    return(calculate_blocks_statistics(&row_indices, column_indices, NULL));
 }
 
 
@@ -3862,20 +4081,10 @@ Vector< Statistics<T> > Matrix<T>::calculate_rows_statistics(const Vector<size_t
 template <class T>
 Vector< Statistics<T> > Matrix<T>::calculate_rows_statistics_missing_values(const Vector<size_t>& row_indices, const Vector< Vector<size_t> >& missing_indices) const
 {
-    const size_t row_indices_size = row_indices.size();
-
-    Vector< Statistics<T> > statistics(columns_number);
-
-    Vector<T> column(row_indices_size);
-
-    for(size_t i = 0; i < columns_number; i++)
-    {
-        column = arrange_column(i, row_indices);
-
-        statistics[i] = column.calculate_statistics_missing_values(missing_indices[i]);
-    }
+    Vector<size_t> column_indices(columns_number);
+    column_indices.initialize_sequential();
 
-    return statistics;
+    return(calculate_blocks_statistics(&row_indices, column_indices, &missing_indices));
 }
 
 
@@ -3889,23 +4098,7 @@ Vector< Statistics<T> > Matrix<T>::calculate_rows_statistics_missing_values(cons
 template <class T>
 Vector< Statistics<T> > Matrix<T>::calculate_columns_statistics(const Vector<size_t>& column_indices) const
 {
-    const size_t column_indices_size = column_indices.size();
-
-    Vector< Statistics<T> > statistics(column_indices_size);
-
-    size_t index;
-    Vector<T> column(rows_number);
-
-    for(size_t i = 0; i < column_indices_size; i++)
-    {
-        index = column_indices[i];
-
-        column = arrange_column(index);
-
-        statistics[i] = column.calculate_statistics();
-    }
-
-    return statistics;
+    return(calculate_blocks_statistics(NULL, column_indices, NULL));
 }
 
 
@@ -3920,62 +4113,469 @@ Vector< Statistics<T> > Matrix<T>::calculate_columns_statistics(const Vector<siz
 template <class T>
 Vector< Statistics<T> > Matrix<T>::calculate_columns_statistics_missing_values(const Vector<size_t>& column_indices, const Vector< Vector<size_t> > missing_indices) const
 {
-    const size_t column_indices_size = column_indices.size();
-
-    Vector< Statistics<T> > statistics(column_indices_size);
-
-    size_t index;
-    Vector<T> column(rows_number);
-
-    for(size_t i = 0; i < column_indices_size; i++)
-    {
-        index = column_indices[i];
-
-        column = arrange_column(index);
-
-        statistics[i] = column.calculate_statistics_missing_values(missing_indices[index]);
-    }
-
-    return statistics;
+    return(calculate_blocks_statistics(NULL, column_indices, &missing_indices));
 }
 
 
-// Vector < Vector <double> > calculate_shape_parameters(void) const method
+// Vector< Statistics<T> > calculate_statistics_missing_values(const Vector<size_t>&, const Vector<size_t>&, const Vector< Vector<size_t> >&) const method
 
-/// Returns the asymmetry and the kurtosis of the columns.
-/// The format is a vector of subvectors.
-/// The size of that vector is equal to the number of columns in this matrix.
+/// Returns the basic statistics of given columns for given rows when the matrix has missing values.
+/// The format is a vector of statistics structures.
+/// The size of that vector is equal to the number of given columns.
+/// @param row_indices Indices of the rows for which the statistics are to be computed.
+/// @param column_indices Indices of the columns for which the statistics are to be computed.
+/// @param missing_indices Vector of vectors with the indices of the missing values.
+/// It has a subvector for each column in this matrix, with the indices of the rows where the values are missing.
 
 template <class T>
-Vector< Vector<double> > Matrix<T>::calculate_shape_parameters(void) const
+Vector< Statistics<T> > Matrix<T>::calculate_statistics_missing_values(const Vector<size_t>& row_indices, const Vector<size_t>& column_indices, const Vector< Vector<size_t> >& missing_indices) const
 {
     // Control sentence (if debug)
 
     #ifdef __OPENNN_DEBUG__
 
-    if(rows_number == 0)
+    if(missing_indices.size() != columns_number)
     {
        std::ostringstream buffer;
 
        buffer << "OpenNN Exception: Matrix template.\n"
-              << "Vector< Vector<double> > calculate_shape_parameters(void) const method.\n"
-              << "Number of rows must be greater than one.\n";
+              << "Vector< Statistics<T> > calculate_statistics_missing_values(const Vector<size_t>&, const Vector<size_t>&, const Vector< Vector<size_t> >&) const method.\n"
+              << "Size of missing indices (" << missing_indices.size() << ") must be equal to to number of columns (" << columns_number << ").\n";
 
        throw std::logic_error(buffer.str());
     }
 
     #endif
 
-    Vector< Vector<double> > shape_parameters(columns_number);
+    return(calculate_blocks_statistics(&row_indices, column_indices, &missing_indices));
+}
 
-    Vector<T> column(rows_number);
 
-    for(size_t i = 0; i < columns_number; i++)
-    {
-       column = arrange_column(i);
+// Vector< Statistics<T> > calculate_blocks_statistics(const Vector<size_t>*, const Vector<size_t>&, const Vector< Vector<size_t> >*) const method
 
-       shape_parameters[i] = column.calculate_shape_parameters();
-    }
+/// Computes the basic statistics of given columns for given rows in a single pass over the values.
+/// The rows are split into blocks, and each column and block is accumulated by a different task,
+/// reading the values in place.
+/// The partial states of the blocks of each column are then merged.
+/// @param row_indices_pointer Pointer to the indices of the rows to be used, or NULL to use all the rows.
+/// @param column_indices Indices of the columns for which the statistics are to be computed.
+/// @param missing_indices_pointer Pointer to a vector with the indices of the missing rows for each column in this matrix,
+/// or NULL if no values are missing.
+
+template <class T>
+Vector< Statistics<T> > Matrix<T>::calculate_blocks_statistics(const Vector<size_t>* row_indices_pointer,
+                                                              const Vector<size_t>& column_indices,
+                                                              const Vector< Vector<size_t> >* missing_indices_pointer) const
+{
+    const size_t column_indices_size = column_indices.size();
+
+    const size_t used_rows_number = row_indices_pointer == NULL ? rows_number : row_indices_pointer->size();
+
+    const size_t block_size = 65536;
+
+    const size_t blocks_number = (used_rows_number + block_size - 1)/block_size;
+
+    // Missing values
+
+    Vector< Vector<bool> > missing(column_indices_size);
+
+    if(missing_indices_pointer != NULL)
+    {
+        for(size_t j = 0; j < column_indices_size; j++)
+        {
+            const Vector<size_t>& column_missing_indices = (*missing_indices_pointer)[column_indices[j]];
+
+            if(!column_missing_indices.empty())
+            {
+                missing[j].set(rows_number, false);
+
+                for(size_t i = 0; i < column_missing_indices.size(); i++)
+                {
+                    missing[j][column_missing_indices[i]] = true;
+                }
+            }
+        }
+    }
+
+    // Blocks
+
+    Vector< RunningStatistics<T> > blocks_running_statistics(column_indices_size*blocks_number);
+
+    const int tasks_number = (int)(column_indices_size*blocks_number);
+
+    #pragma omp parallel for schedule(dynamic)
+
+    for(int task = 0; task < tasks_number; task++)
+    {
+        const size_t j = task/blocks_number;
+        const size_t block_begin = (task%blocks_number)*block_size;
+        const size_t block_end = std::min(block_begin + block_size, used_rows_number);
+
+        const T* column = this->data() + column_indices[j]*rows_number;
+
+        const Vector<bool>& column_missing = missing[j];
+        const bool has_missing = !column_missing.empty();
+
+        RunningStatistics<T>& running_statistics = blocks_running_statistics[task];
+
+        if(row_indices_pointer == NULL && !has_missing)
+        {
+            running_statistics.update(column + block_begin, block_end - block_begin);
+
+            continue;
+        }
+
+        // Gather the values to be used
+
+        const size_t buffer_size = 256;
+
+        T buffer[buffer_size];
+
+        size_t buffered_number = 0;
+
+        size_t row_index;
+
+        for(size_t i = block_begin; i < block_end; i++)
+        {
+            row_index = row_indices_pointer == NULL ? i : (*row_indices_pointer)[i];
+
+            if(!has_missing || !column_missing[row_index])
+            {
+                buffer[buffered_number] = column[row_index];
+
+                buffered_number++;
+
+                if(buffered_number == buffer_size)
+                {
+                    running_statistics.update(buffer, buffered_number);
+
+                    buffered_number = 0;
+                }
+            }
+        }
+
+        running_statistics.update(buffer, buffered_number);
+    }
+
+    // Merge
+
+    Vector< Statistics<T> > statistics(column_indices_size);
+
+    for(size_t j = 0; j < column_indices_size; j++)
+    {
+        RunningStatistics<T> running_statistics;
+
+        for(size_t block = 0; block < blocks_number; block++)
+        {
+            running_statistics.merge(blocks_running_statistics[j*blocks_number + block]);
+        }
+
+        statistics[j] = running_statistics.calculate_statistics();
+    }
+
+    return(statistics);
+}
+
+
+// Matrix<double> calculate_linear_correlations(const Vector<size_t>&, const Vector<size_t>&) const method
+
+/// Returns the linear correlations between two sets of columns.
+/// The means and norms of the columns are computed in a single pass.
+/// Then the rows are standardized by blocks, and the correlations are accumulated as the matrix product
+/// of the standardized block of the first set, transposed, and that of the second set.
+/// The number of rows of the returned matrix is the size of the first set, and the number of columns the size of the second set.
+/// As with Vector::calculate_linear_correlation, the correlation with a constant column is zero,
+/// unless both columns are all zeros, in which case it is one.
+/// @param row_column_indices Indices of the columns which correspond to the rows of the correlations matrix.
+/// @param column_column_indices Indices of the columns which correspond to the columns of the correlations matrix.
+
+template <class T>
+Matrix<double> Matrix<T>::calculate_linear_correlations(const Vector<size_t>& row_column_indices, const Vector<size_t>& column_column_indices) const
+{
+    const size_t row_column_indices_size = row_column_indices.size();
+    const size_t column_column_indices_size = column_column_indices.size();
+
+    Matrix<double> linear_correlations(row_column_indices_size, column_column_indices_size, 0.0);
+
+    if(row_column_indices_size == 0 || column_column_indices_size == 0)
+    {
+        return(linear_correlations);
+    }
+
+    Vector<double> row_means;
+    Vector<double> row_inverse_norms;
+    Vector<bool> row_zero_columns;
+
+    calculate_standardization(row_column_indices, row_means, row_inverse_norms, row_zero_columns);
+
+    Vector<double> column_means;
+    Vector<double> column_inverse_norms;
+    Vector<bool> column_zero_columns;
+
+    calculate_standardization(column_column_indices, column_means, column_inverse_norms, column_zero_columns);
+
+    Eigen::Map<Eigen::MatrixXd> linear_correlations_eigen(linear_correlations.data(), row_column_indices_size, column_column_indices_size);
+
+    const size_t block_rows_number = std::max((size_t)1, (size_t)1048576/(row_column_indices_size + column_column_indices_size));
+
+    Matrix<double> row_block;
+    Matrix<double> column_block;
+
+    for(size_t block_begin = 0; block_begin < rows_number; block_begin += block_rows_number)
+    {
+        const size_t block_size = std::min(block_rows_number, rows_number - block_begin);
+
+        row_block.set(block_size, row_column_indices_size);
+        column_block.set(block_size, column_column_indices_size);
+
+        arrange_standardized_block(row_column_indices, row_means, row_inverse_norms, block_begin, row_block);
+        arrange_standardized_block(column_column_indices, column_means, column_inverse_norms, block_begin, column_block);
+
+        const Eigen::Map<const Eigen::MatrixXd> row_block_eigen(row_block.data(), block_size, row_column_indices_size);
+        const Eigen::Map<const Eigen::MatrixXd> column_block_eigen(column_block.data(), block_size, column_column_indices_size);
+
+        if(column_column_indices_size < 8)
+        {
+            // Matrix-vector products, which for few columns are faster than a general product
+
+            for(size_t j = 0; j < column_column_indices_size; j++)
+            {
+                linear_correlations_eigen.col(j).noalias() += row_block_eigen.transpose()*column_block_eigen.col(j);
+            }
+        }
+        else
+        {
+            linear_correlations_eigen.noalias() += row_block_eigen.transpose()*column_block_eigen;
+        }
+    }
+
+    for(size_t i = 0; i < row_column_indices_size; i++)
+    {
+        for(size_t j = 0; j < column_column_indices_size; j++)
+        {
+            if(row_zero_columns[i] && column_zero_columns[j])
+            {
+                linear_correlations(i,j) = 1.0;
+            }
+        }
+    }
+
+    return(linear_correlations);
+}
+
+
+// Matrix<double> calculate_linear_correlations(const Vector<size_t>&) const method
+
+/// Returns the symmetric matrix of linear correlations between all the pairs of given columns.
+/// The rows are standardized by blocks, as in the correlations between two sets of columns.
+/// The columns of each standardized block are in turn split into blocks,
+/// and only the products of the pairs of column blocks on and above the diagonal are accumulated, in parallel.
+/// The elements below the diagonal are copied from their transposes, so that the result is exactly symmetric.
+/// @param column_indices Indices of the columns to be correlated.
+
+template <class T>
+Matrix<double> Matrix<T>::calculate_linear_correlations(const Vector<size_t>& column_indices) const
+{
+    const size_t column_indices_size = column_indices.size();
+
+    Matrix<double> linear_correlations(column_indices_size, column_indices_size, 0.0);
+
+    if(column_indices_size == 0)
+    {
+        return(linear_correlations);
+    }
+
+    Vector<double> means;
+    Vector<double> inverse_norms;
+    Vector<bool> zero_columns;
+
+    calculate_standardization(column_indices, means, inverse_norms, zero_columns);
+
+    Eigen::Map<Eigen::MatrixXd> linear_correlations_eigen(linear_correlations.data(), column_indices_size, column_indices_size);
+
+    const size_t block_rows_number = std::max((size_t)1, (size_t)1048576/column_indices_size);
+
+    const size_t block_columns_number = 256;
+
+    const size_t column_blocks_number = (column_indices_size + block_columns_number - 1)/block_columns_number;
+
+    const int tasks_number = (int)(column_blocks_number*column_blocks_number);
+
+    Matrix<double> block;
+
+    for(size_t block_begin = 0; block_begin < rows_number; block_begin += block_rows_number)
+    {
+        const size_t block_size = std::min(block_rows_number, rows_number - block_begin);
+
+        block.set(block_size, column_indices_size);
+
+        arrange_standardized_block(column_indices, means, inverse_norms, block_begin, block);
+
+        const Eigen::Map<const Eigen::MatrixXd> block_eigen(block.data(), block_size, column_indices_size);
+
+        #pragma omp parallel for schedule(dynamic)
+
+        for(int task = 0; task < tasks_number; task++)
+        {
+            const size_t row_column_block = task/column_blocks_number;
+            const size_t column_column_block = task%column_blocks_number;
+
+            if(row_column_block > column_column_block)
+            {
+                continue;
+            }
+
+            const size_t row_begin = row_column_block*block_columns_number;
+            const size_t column_begin = column_column_block*block_columns_number;
+
+            const size_t row_block_size = std::min(block_columns_number, column_indices_size - row_begin);
+            const size_t column_block_size = std::min(block_columns_number, column_indices_size - column_begin);
+
+            linear_correlations_eigen.block(row_begin, column_begin, row_block_size, column_block_size).noalias()
+            += block_eigen.middleCols(row_begin, row_block_size).transpose()*block_eigen.middleCols(column_begin, column_block_size);
+        }
+    }
+
+    for(size_t i = 0; i < column_indices_size; i++)
+    {
+        for(size_t j = i+1; j < column_indices_size; j++)
+        {
+            linear_correlations(j,i) = linear_correlations(i,j);
+        }
+    }
+
+    for(size_t i = 0; i < column_indices_size; i++)
+    {
+        for(size_t j = 0; j < column_indices_size; j++)
+        {
+            if(zero_columns[i] && zero_columns[j])
+            {
+                linear_correlations(i,j) = 1.0;
+            }
+        }
+    }
+
+    return(linear_correlations);
+}
+
+
+// void calculate_standardization(const Vector<size_t>&, Vector<double>&, Vector<double>&, Vector<bool>&) const method
+
+/// Computes, in a single pass over given columns, the values needed to standardize them for the linear correlations:
+/// their means and the inverses of the norms of the centered values.
+/// The dot product of two columns standardized with those values is their linear correlation.
+/// The inverse norm of a constant column is set to zero, so that its standardized values are all zero.
+/// The columns are processed in parallel.
+/// @param column_indices Indices of the columns to be standardized.
+/// @param means Vector to be filled with the means of the columns.
+/// @param inverse_norms Vector to be filled with the inverses of the norms of the centered columns.
+/// @param zero_columns Vector to be filled with true for the columns whose values are all zero, and false otherwise.
+
+template <class T>
+void Matrix<T>::calculate_standardization(const Vector<size_t>& column_indices, Vector<double>& means, Vector<double>& inverse_norms, Vector<bool>& zero_columns) const
+{
+    const size_t column_indices_size = column_indices.size();
+
+    Vector< RunningStatistics<T> > running_statistics(column_indices_size);
+
+    const Vector<size_t> no_missing_indices;
+
+    #pragma omp parallel for schedule(dynamic)
+
+    for(int j = 0; j < (int)column_indices_size; j++)
+    {
+        running_statistics[j] = calculate_column_running_statistics(column_indices[j], no_missing_indices);
+    }
+
+    means.set(column_indices_size);
+    inverse_norms.set(column_indices_size);
+    zero_columns.set(column_indices_size);
+
+    for(size_t j = 0; j < column_indices_size; j++)
+    {
+        means[j] = running_statistics[j].mean;
+
+        if(running_statistics[j].squared_deviations_sum <= 0.0)
+        {
+            inverse_norms[j] = 0.0;
+        }
+        else
+        {
+            inverse_norms[j] = 1.0/sqrt(running_statistics[j].squared_deviations_sum);
+        }
+
+        zero_columns[j] = (running_statistics[j].minimum == 0 && running_statistics[j].maximum == 0);
+    }
+}
+
+
+// void arrange_standardized_block(const Vector<size_t>&, const Vector<double>&, const Vector<double>&, const size_t&, Matrix<double>&) const method
+
+/// Fills a block with consecutive rows of given columns, standardized with given means and inverse norms.
+/// @param column_indices Indices of the columns, which correspond to the columns of the block.
+/// @param means Means of the columns.
+/// @param inverse_norms Inverses of the norms of the centered columns.
+/// @param row_begin Index of the first row of the block.
+/// @param block Matrix to be filled. Its number of rows is the number of rows in the block.
+
+template <class T>
+void Matrix<T>::arrange_standardized_block(const Vector<size_t>& column_indices, const Vector<double>& means, const Vector<double>& inverse_norms,
+                                           const size_t& row_begin, Matrix<double>& block) const
+{
+    const size_t block_rows_number = block.get_rows_number();
+
+    #pragma omp parallel for
+
+    for(int j = 0; j < (int)column_indices.size(); j++)
+    {
+        const T* column = this->data() + column_indices[j]*rows_number + row_begin;
+
+        double* block_column = block.data() + j*block_rows_number;
+
+        for(size_t i = 0; i < block_rows_number; i++)
+        {
+            block_column[i] = (column[i] - means[j])*inverse_norms[j];
+        }
+    }
+}
+
+
+// Vector < Vector <double> > calculate_shape_parameters(void) const method
+
+/// Returns the asymmetry and the kurtosis of the columns.
+/// The format is a vector of subvectors.
+/// The size of that vector is equal to the number of columns in this matrix.
+
+template <class T>
+Vector< Vector<double> > Matrix<T>::calculate_shape_parameters(void) const
+{
+    // Control sentence (if debug)
+
+    #ifdef __OPENNN_DEBUG__
+
+    if(rows_number == 0)
+    {
+       std::ostringstream buffer;
+
+       buffer << "OpenNN Exception: Matrix template.\n"
+              << "Vector< Vector<double> > calculate_shape_parameters(void) const method.\n"
+              << "Number of rows must be greater than one.\n";
+
+       throw std::logic_error(buffer.str());
+    }
+
+    #endif
+
+    Vector< Vector<double> > shape_parameters(columns_number);
+
+    Vector<T> column(rows_number);
+
+    for(size_t i = 0; i < columns_number; i++)
+    {
+       column = arrange_column(i);
+
+       shape_parameters[i] = column.calculate_shape_parameters();
+    }
 
     return(shape_parameters);
 }
@@ -4655,27 +5255,189 @@ void Matrix<T>::scale_columns_minimum_maximum(const Vector< Statistics<T> >& sta
 }
 
 
-// void unscale_mean_standard_deviation(const Vector< Statistics<T> >&) method
+// Vector< Statistics<T> > scale_columns_mean_standard_deviation_missing_values(const Vector<size_t>&, const Vector< Vector<size_t> >&) method
 
-/// Unscales the matrix columns with the mean and standard deviation method.
-/// It updates the matrix elements.
-/// @param statistics Vector of statistics structures containing the mean and standard deviations for the unscaling.
-/// The size of that vector must be equal to the number of columns in this matrix.
+/// Calculates the basic statistics of given columns, leaving out the missing values,
+/// and scales those columns with the mean and standard deviation method.
+/// Each column is scaled right after its statistics are accumulated, while its values are still in cache.
+/// The columns are processed in parallel.
+/// It returns the statistics of the given columns.
+/// @param column_indices Indices of the columns to be scaled.
+/// @param missing_indices Vector of vectors with the indices of the missing values.
+/// It has a subvector for each column in this matrix.
 
 template <class T>
-void Matrix<T>::unscale_mean_standard_deviation(const Vector< Statistics<T> >& statistics)
+Vector< Statistics<T> > Matrix<T>::scale_columns_mean_standard_deviation_missing_values(const Vector<size_t>& column_indices, const Vector< Vector<size_t> >& missing_indices)
 {
-   #ifdef __OPENNN_DEBUG__
+    // Control sentence (if debug)
 
-   const size_t size = statistics.size();
+    #ifdef __OPENNN_DEBUG__
 
-   if(size != columns_number)
-   {
-      std::ostringstream buffer;
+    if(missing_indices.size() != columns_number)
+    {
+       std::ostringstream buffer;
 
-      buffer << "OpenNN Exception: Matrix template."
-             << "void unscale_mean_standard_deviation(const Vector< Statistics<T> >&) const method.\n"
-             << "Size of statistics vector must be equal to number of columns.\n";
+       buffer << "OpenNN Exception: Matrix template.\n"
+              << "Vector< Statistics<T> > scale_columns_mean_standard_deviation_missing_values(const Vector<size_t>&, const Vector< Vector<size_t> >&) method.\n"
+              << "Size of missing indices (" << missing_indices.size() << ") must be equal to to number of columns (" << columns_number << ").\n";
+
+       throw std::logic_error(buffer.str());
+    }
+
+    #endif
+
+    const size_t column_indices_size = column_indices.size();
+
+    Vector< Statistics<T> > statistics(column_indices_size);
+
+    #pragma omp parallel for schedule(dynamic)
+
+    for(int j = 0; j < (int)column_indices_size; j++)
+    {
+        const size_t column_index = column_indices[j];
+
+        statistics[j] = calculate_column_running_statistics(column_index, missing_indices[column_index]).calculate_statistics();
+
+        if(statistics[j].standard_deviation < 1e-99)
+        {
+            // Do nothing
+        }
+        else
+        {
+            T* column = this->data() + column_index*rows_number;
+
+            for(size_t i = 0; i < rows_number; i++)
+            {
+                column[i] = (column[i] - statistics[j].mean)/statistics[j].standard_deviation;
+            }
+        }
+    }
+
+    return(statistics);
+}
+
+
+// Vector< Statistics<T> > scale_columns_minimum_maximum_missing_values(const Vector<size_t>&, const Vector< Vector<size_t> >&) method
+
+/// Calculates the basic statistics of given columns, leaving out the missing values,
+/// and scales those columns with the minimum and maximum method.
+/// As with the mean and standard deviation method, each column is scaled in the same sweep in which its statistics are accumulated.
+/// It returns the statistics of the given columns.
+/// @param column_indices Indices of the columns to be scaled.
+/// @param missing_indices Vector of vectors with the indices of the missing values.
+/// It has a subvector for each column in this matrix.
+
+template <class T>
+Vector< Statistics<T> > Matrix<T>::scale_columns_minimum_maximum_missing_values(const Vector<size_t>& column_indices, const Vector< Vector<size_t> >& missing_indices)
+{
+    // Control sentence (if debug)
+
+    #ifdef __OPENNN_DEBUG__
+
+    if(missing_indices.size() != columns_number)
+    {
+       std::ostringstream buffer;
+
+       buffer << "OpenNN Exception: Matrix template.\n"
+              << "Vector< Statistics<T> > scale_columns_minimum_maximum_missing_values(const Vector<size_t>&, const Vector< Vector<size_t> >&) method.\n"
+              << "Size of missing indices (" << missing_indices.size() << ") must be equal to to number of columns (" << columns_number << ").\n";
+
+       throw std::logic_error(buffer.str());
+    }
+
+    #endif
+
+    const size_t column_indices_size = column_indices.size();
+
+    Vector< Statistics<T> > statistics(column_indices_size);
+
+    #pragma omp parallel for schedule(dynamic)
+
+    for(int j = 0; j < (int)column_indices_size; j++)
+    {
+        const size_t column_index = column_indices[j];
+
+        statistics[j] = calculate_column_running_statistics(column_index, missing_indices[column_index]).calculate_statistics();
+
+        if(statistics[j].maximum - statistics[j].minimum < 1e-99)
+        {
+            // Do nothing
+        }
+        else
+        {
+            T* column = this->data() + column_index*rows_number;
+
+            for(size_t i = 0; i < rows_number; i++)
+            {
+                column[i] = 2.0*(column[i] - statistics[j].minimum)/(statistics[j].maximum - statistics[j].minimum) - 1.0;
+            }
+        }
+    }
+
+    return(statistics);
+}
+
+
+// RunningStatistics<T> calculate_column_running_statistics(const size_t&, const Vector<size_t>&) const method
+
+/// Accumulates the values of a column in a single pass, leaving out the missing ones.
+/// @param column_index Index of the column.
+/// @param column_missing_indices Indices of the rows where the values of that column are missing.
+
+template <class T>
+RunningStatistics<T> Matrix<T>::calculate_column_running_statistics(const size_t& column_index, const Vector<size_t>& column_missing_indices) const
+{
+    const T* column = this->data() + column_index*rows_number;
+
+    RunningStatistics<T> running_statistics;
+
+    if(column_missing_indices.empty())
+    {
+        running_statistics.update(column, rows_number);
+    }
+    else
+    {
+        Vector<bool> missing(rows_number, false);
+
+        for(size_t i = 0; i < column_missing_indices.size(); i++)
+        {
+            missing[column_missing_indices[i]] = true;
+        }
+
+        for(size_t i = 0; i < rows_number; i++)
+        {
+            if(!missing[i])
+            {
+                running_statistics.update(column[i]);
+            }
+        }
+    }
+
+    return(running_statistics);
+}
+
+
+// void unscale_mean_standard_deviation(const Vector< Statistics<T> >&) method
+
+/// Unscales the matrix columns with the mean and standard deviation method.
+/// It updates the matrix elements.
+/// @param statistics Vector of statistics structures containing the mean and standard deviations for the unscaling.
+/// The size of that vector must be equal to the number of columns in this matrix.
+
+template <class T>
+void Matrix<T>::unscale_mean_standard_deviation(const Vector< Statistics<T> >& statistics)
+{
+   #ifdef __OPENNN_DEBUG__
+
+   const size_t size = statistics.size();
+
+   if(size != columns_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Matrix template."
+             << "void unscale_mean_standard_deviation(const Vector< Statistics<T> >&) const method.\n"
+             << "Size of statistics vector must be equal to number of columns.\n";
 
       throw std::logic_error(buffer.str());
    }
@@ -5053,9 +5815,11 @@ double Matrix<T>::calculate_sum_squared_error(const Matrix<double>& other_matrix
    #endif
 
 
+   const size_t this_size = this->size();
+
    double sum_squared_error = 0.0;
 
-   for(size_t i = 0; i < rows_number; i++)
+   for(size_t i = 0; i < this_size; i++)
    {
         sum_squared_error += ((*this)[i] - other_matrix[i])*((*this)[i] - other_matrix[i]);
    }
@@ -5180,6 +5944,8 @@ Matrix<T> Matrix<T>::calculate_transpose(void) const
 // Type calculate_determinant(void) const method
 
 /// Returns the determinant of a square matrix.
+/// Matrices larger than 2x2 are factorized with a partial pivoting LU decomposition, so the cost is cubic in the size.
+/// For integer matrices the result is rounded to the nearest integer.
 
 template <class T>
 T Matrix<T>::calculate_determinant(void) const
@@ -5224,36 +5990,19 @@ T Matrix<T>::calculate_determinant(void) const
    }
    else
    {
-      int sign;
-
-      for(size_t row_index = 0; row_index < rows_number; row_index++)
-      {
-         // Calculate sub data
-
-         Matrix<T> sub_matrix(rows_number-1, columns_number-1);
-
-         for(size_t i = 1; i < rows_number; i++)
-         {
-            size_t j2 = 0;
-
-            for(size_t j = 0; j < columns_number; j++)
-            {
-               if(j == row_index)
-               {
-                  continue;
-               }
-
-               sub_matrix(i-1,j2) = (*this)(i,j);
-
-               j2++;
-            }
-         }
+      const Eigen::Map< const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> > this_eigen(this->data(), rows_number, columns_number);
 
-         //sign = (size_t)(pow(-1.0, row_index+2.0));
+      const Eigen::PartialPivLU<Eigen::MatrixXd> LU_eigen(this_eigen.template cast<double>());
 
-         sign = static_cast<int>( (((row_index + 2) % 2) == 0) ? 1 : -1 );
+      const double LU_determinant = LU_eigen.determinant();
 
-         determinant += sign*(*this)(0,row_index)*sub_matrix.calculate_determinant();
+      if(std::numeric_limits<T>::is_integer)
+      {
+         determinant = static_cast<T>(floor(LU_determinant + 0.5));
+      }
+      else
+      {
+         determinant = static_cast<T>(LU_determinant);
       }
    }
 
@@ -5268,6 +6017,54 @@ T Matrix<T>::calculate_determinant(void) const
 template <class T>
 Matrix<T> Matrix<T>::calculate_cofactor(void) const
 {
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(rows_number != columns_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Matrix Template.\n"
+             << "calculate_cofactor(void) const method.\n"
+             << "Matrix must be square.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   if(rows_number == 1)
+   {
+      Matrix<T> cofactor(1, 1, 1);
+
+      return(cofactor);
+   }
+
+   // Nonsingular matrices: the cofactor matrix is the determinant times the transposed inverse
+
+   if(!std::numeric_limits<T>::is_integer)
+   {
+      const Eigen::Map< const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> > this_eigen(this->data(), rows_number, columns_number);
+
+      const Eigen::PartialPivLU<Eigen::MatrixXd> LU_eigen(this_eigen.template cast<double>());
+
+      const double determinant = LU_eigen.determinant();
+
+      if(determinant != 0.0)
+      {
+         Matrix<T> cofactor(rows_number, columns_number);
+
+         Eigen::Map< Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> > cofactor_eigen(cofactor.data(), rows_number, columns_number);
+
+         cofactor_eigen = (LU_eigen.inverse().transpose()*determinant).template cast<T>();
+
+         return(cofactor);
+      }
+   }
+
+   // Singular or integer matrices: one minor per entry, each one computed by LU
+
    Matrix<T> cofactor(rows_number, columns_number);
 
    Matrix<T> c(rows_number-1, columns_number-1);
@@ -5302,10 +6099,9 @@ Matrix<T> Matrix<T>::calculate_cofactor(void) const
             i1++;
          }
 
-         const double determinant = c.calculate_determinant();
+         const T determinant = c.calculate_determinant();
 
          cofactor(i,j) = static_cast<T>((((i + j) % 2) == 0) ? 1 : -1)*determinant;
-         //cofactor(i,j) = pow(-1.0, i+j+2.0)*determinant;
       }
    }
 
@@ -5316,7 +6112,8 @@ Matrix<T> Matrix<T>::calculate_cofactor(void) const
 // Matrix<T> calculate_inverse(void) const method
 
 /// Returns the inverse of a square matrix.
-/// An error message is printed if the matrix is singular.
+/// Matrices larger than 2x2 are inverted through a partial pivoting LU decomposition.
+/// An exception is thrown if the matrix is singular.
 
 template <class T>
 Matrix<T> Matrix<T>::calculate_inverse(void) const
@@ -5349,9 +6146,43 @@ Matrix<T> Matrix<T>::calculate_inverse(void) const
 
    #endif
 
-   const double determinant = calculate_determinant();
+   if(rows_number <= 2)
+   {
+      const double determinant = calculate_determinant();
+
+      if(determinant == 0.0)
+      {
+         std::ostringstream buffer;
+
+         buffer << "OpenNN Exception: Matrix Template.\n"
+                << "calculate_inverse(void) const method.\n"
+                << "Matrix is singular.\n";
+
+         throw std::logic_error(buffer.str());
+      }
+
+      if(rows_number == 1)
+      {
+         Matrix<T> inverse(1, 1, 1.0/determinant);
+
+         return(inverse);
+      }
+
+      // Inverse matrix is adjoint matrix divided by matrix determinant
+
+      Matrix<T> inverse(2, 2);
+
+      inverse(0,0) = (*this)(1,1)/determinant;
+      inverse(0,1) = -(*this)(0,1)/determinant;
+      inverse(1,0) = -(*this)(1,0)/determinant;
+      inverse(1,1) = (*this)(0,0)/determinant;
+
+      return(inverse);
+   }
+
+   const LUFactorization<T> LU_factorization(*this);
 
-   if(determinant == 0.0)
+   if(LU_factorization.is_singular())
    {
       std::ostringstream buffer;
 
@@ -5362,102 +6193,287 @@ Matrix<T> Matrix<T>::calculate_inverse(void) const
       throw std::logic_error(buffer.str());
    }
 
-   if(rows_number == 1)
-   {
-        Matrix<T> inverse(1, 1, 1.0/determinant);
+   return(LU_factorization.calculate_inverse());
+}
 
-        return(inverse);
-   }
 
-   // Calculate cofactor matrix
+// double calculate_log_determinant(void) const method
+
+/// Returns the natural logarithm of the absolute value of the determinant of a square matrix.
+/// It is computed from the diagonal of a partial pivoting LU decomposition, so it does not overflow for large matrices.
+/// The result is minus infinity if the matrix is singular.
+
+template <class T>
+double Matrix<T>::calculate_log_determinant(void) const
+{
+   // Control sentence (if debug)
 
-   const Matrix<T> cofactor = calculate_cofactor();
+   #ifdef __OPENNN_DEBUG__
 
-   // Adjoint matrix is the transpose of cofactor matrix
+   if(empty())
+   {
+      std::ostringstream buffer;
 
-   const Matrix<T> adjoint = cofactor.calculate_transpose();
+      buffer << "OpenNN Exception: Matrix Template.\n"
+             << "double calculate_log_determinant(void) const method.\n"
+             << "Matrix is empty.\n";
 
-   // Inverse matrix is adjoint matrix divided by matrix determinant
+      throw std::logic_error(buffer.str());
+   }
 
-   const Matrix<T> inverse = adjoint/determinant;
+   if(rows_number != columns_number)
+   {
+      std::ostringstream buffer;
 
-   return(inverse);
-}
+      buffer << "OpenNN Exception: Matrix Template.\n"
+             << "double calculate_log_determinant(void) const method.\n"
+             << "Matrix must be square.\n";
 
+      throw std::logic_error(buffer.str());
+   }
 
-// double calculate_distances(const size_t&, const size_t&) const
+   #endif
 
-/// Calculates the distance between two rows in the matix
+   const Eigen::Map< const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> > this_eigen(this->data(), rows_number, columns_number);
 
-template <class T>
-double Matrix<T>::calculate_distance(const size_t& first_index, const size_t& second_index) const
-{
-    // Control sentence (if debug)
+   const Eigen::PartialPivLU<Eigen::MatrixXd> LU_eigen(this_eigen.template cast<double>());
 
-    #ifdef __OPENNN_DEBUG__
+   double log_determinant = 0.0;
 
-     if(empty())
-     {
-        std::ostringstream buffer;
+   for(size_t i = 0; i < rows_number; i++)
+   {
+      log_determinant += log(fabs(LU_eigen.matrixLU()(i,i)));
+   }
 
-        buffer << "OpenNN Exception: Matrix Template.\n"
-               << "calculate_distance(const size_t&, const size_t&) const method.\n"
-               << "Matrix is empty.\n";
+   return(log_determinant);
+}
 
-        throw std::logic_error(buffer.str());
-     }
 
-     #endif
+// LUFactorization<T> calculate_LU_factorization(void) const method
 
-    const Vector<T> first_row = arrange_row(first_index);
-    const Vector<T> second_row = arrange_row(second_index);
+/// Returns the LU decomposition with partial pivoting of this square matrix.
+/// The factorization object can be reused to solve several systems with the same matrix.
 
-    return(first_row.calculate_distance(second_row));
+template <class T>
+LUFactorization<T> Matrix<T>::calculate_LU_factorization(void) const
+{
+   return(LUFactorization<T>(*this));
 }
 
 
-// Matrix<T> operator + (const T&) const method
+// CholeskyFactorization<T> calculate_Cholesky_factorization(void) const method
 
-/// Sum matrix+scalar arithmetic operator.
-/// @param scalar Scalar value to be added to this matrix.
+/// Returns the Cholesky decomposition of this symmetric positive definite matrix.
+/// Only the lower triangle of the matrix is referenced.
 
 template <class T>
-Matrix<T> Matrix<T>::operator + (const T& scalar) const
+CholeskyFactorization<T> Matrix<T>::calculate_Cholesky_factorization(void) const
 {
-   Matrix<T> sum(rows_number, columns_number);
+   return(CholeskyFactorization<T>(*this));
+}
 
-   std::transform(this->begin(), this->end(), sum.begin(), std::bind2nd(std::plus<T>(), scalar));
 
-   return(sum);
+// LDLTFactorization<T> calculate_LDLT_factorization(void) const method
+
+/// Returns the robust Cholesky decomposition with pivoting of this symmetric matrix.
+/// Unlike the Cholesky decomposition, it also exists for indefinite matrices.
+
+template <class T>
+LDLTFactorization<T> Matrix<T>::calculate_LDLT_factorization(void) const
+{
+   return(LDLTFactorization<T>(*this));
 }
 
 
-// Matrix<T> operator + (const Vector<T>&) const method
+// Vector<T> solve_lower_triangular(const Vector<T>&) const method
 
-/// Sum matrix+vector arithmetic operator.
-/// @param vector Vector to be added to this matrix.
+/// Solves the system L*x = b by forward substitution, where L is the lower triangle of this square matrix.
+/// The entries above the diagonal are not referenced.
+/// @param b Independent terms vector.
 
 template <class T>
-Matrix<T> Matrix<T>::operator + (const Vector<T>& vector) const
+Vector<T> Matrix<T>::solve_lower_triangular(const Vector<T>& b) const
 {
    // Control sentence (if debug)
 
    #ifdef __OPENNN_DEBUG__
 
-   const size_t size = vector.size();
-
-   if(size != rows_number)
+   if(rows_number != columns_number)
    {
       std::ostringstream buffer;
 
       buffer << "OpenNN Exception: Matrix Template.\n"
-             << "Matrix<T> operator + (const Vector<T>&) const.\n"
-             << "Size of vector must be equal to number of rows.\n";
+             << "Vector<T> solve_lower_triangular(const Vector<T>&) const method.\n"
+             << "Matrix must be square.\n";
 
       throw std::logic_error(buffer.str());
    }
 
-   #endif
+   if(b.size() != rows_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Matrix Template.\n"
+             << "Vector<T> solve_lower_triangular(const Vector<T>&) const method.\n"
+             << "Size of independent terms vector (" << b.size() << ") must be equal to number of rows (" << rows_number << ").\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   Vector<T> solution(rows_number);
+
+   const Eigen::Map< const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> > this_eigen(this->data(), rows_number, columns_number);
+   const Eigen::Map< const Eigen::Matrix<T, Eigen::Dynamic, 1> > b_eigen(b.data(), rows_number);
+   Eigen::Map< Eigen::Matrix<T, Eigen::Dynamic, 1> > solution_eigen(solution.data(), rows_number);
+
+   solution_eigen = this_eigen.template triangularView<Eigen::Lower>().solve(b_eigen);
+
+   return(solution);
+}
+
+
+// Vector<T> solve_upper_triangular(const Vector<T>&) const method
+
+/// Solves the system U*x = b by back substitution, where U is the upper triangle of this square matrix.
+/// The entries below the diagonal are not referenced.
+/// @param b Independent terms vector.
+
+template <class T>
+Vector<T> Matrix<T>::solve_upper_triangular(const Vector<T>& b) const
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(rows_number != columns_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Matrix Template.\n"
+             << "Vector<T> solve_upper_triangular(const Vector<T>&) const method.\n"
+             << "Matrix must be square.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   if(b.size() != rows_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Matrix Template.\n"
+             << "Vector<T> solve_upper_triangular(const Vector<T>&) const method.\n"
+             << "Size of independent terms vector (" << b.size() << ") must be equal to number of rows (" << rows_number << ").\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   Vector<T> solution(rows_number);
+
+   const Eigen::Map< const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> > this_eigen(this->data(), rows_number, columns_number);
+   const Eigen::Map< const Eigen::Matrix<T, Eigen::Dynamic, 1> > b_eigen(b.data(), rows_number);
+   Eigen::Map< Eigen::Matrix<T, Eigen::Dynamic, 1> > solution_eigen(solution.data(), rows_number);
+
+   solution_eigen = this_eigen.template triangularView<Eigen::Upper>().solve(b_eigen);
+
+   return(solution);
+}
+
+
+// double calculate_distances(const size_t&, const size_t&) const
+
+/// Calculates the distance between two rows in the matix
+
+template <class T>
+double Matrix<T>::calculate_distance(const size_t& first_index, const size_t& second_index) const
+{
+    // Control sentence (if debug)
+
+    #ifdef __OPENNN_DEBUG__
+
+     if(empty())
+     {
+        std::ostringstream buffer;
+
+        buffer << "OpenNN Exception: Matrix Template.\n"
+               << "calculate_distance(const size_t&, const size_t&) const method.\n"
+               << "Matrix is empty.\n";
+
+        throw std::logic_error(buffer.str());
+     }
+
+     #endif
+
+    const T* data = this->data();
+
+    return(sqrt(calculate_squared_distance_kernel(data + first_index, data + second_index, columns_number, rows_number)));
+}
+
+
+// Matrix<T> operator + (const T&) const & method
+
+/// Sum matrix+scalar arithmetic operator.
+/// @param scalar Scalar value to be added to this matrix.
+
+template <class T>
+Matrix<T> Matrix<T>::operator + (const T& scalar) const &
+{
+   Matrix<T> sum(rows_number, columns_number);
+
+   const size_t size = this->size();
+
+   for(size_t i = 0; i < size; i++)
+   {
+      sum[i] = (*this)[i] + scalar;
+   }
+
+   return(sum);
+}
+
+
+// Matrix<T> operator + (const T&) && method
+
+/// Sum matrix+scalar arithmetic operator for an expiring matrix, whose elements are reused for the result.
+/// @param scalar Scalar value to be added to this matrix.
+
+template <class T>
+Matrix<T> Matrix<T>::operator + (const T& scalar) &&
+{
+   (*this) += scalar;
+
+   return(std::move(*this));
+}
+
+
+// Matrix<T> operator + (const Vector<T>&) const method
+
+/// Sum matrix+vector arithmetic operator.
+/// @param vector Vector to be added to this matrix.
+
+template <class T>
+Matrix<T> Matrix<T>::operator + (const Vector<T>& vector) const
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   const size_t size = vector.size();
+
+   if(size != rows_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Matrix Template.\n"
+             << "Matrix<T> operator + (const Vector<T>&) const.\n"
+             << "Size of vector must be equal to number of rows.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
 
    Matrix<T> sum(rows_number, columns_number);
 
@@ -5473,13 +6489,13 @@ Matrix<T> Matrix<T>::operator + (const Vector<T>& vector) const
 }
 
 
-// Matrix<T> operator + (const Matrix<T>&) const method
+// Matrix<T> operator + (const Matrix<T>&) const & method
 
 /// Sum matrix+matrix arithmetic operator.
 /// @param other_matrix Matrix to be added to this vector.
 
 template <class T>
-Matrix<T> Matrix<T>::operator + (const Matrix<T>& other_matrix) const
+Matrix<T> Matrix<T>::operator + (const Matrix<T>& other_matrix) const &
 {
    // Control sentence (if debug)
 
@@ -5509,22 +6525,105 @@ Matrix<T> Matrix<T>::operator + (const Matrix<T>& other_matrix) const
 }
 
 
-// Matrix<T> operator - (const T&) const method
+// Matrix<T> operator + (const Matrix<T>&) && method
+
+/// Sum matrix+matrix arithmetic operator for an expiring matrix, whose elements are reused for the result.
+/// @param other_matrix Matrix to be added to this matrix.
+
+template <class T>
+Matrix<T> Matrix<T>::operator + (const Matrix<T>& other_matrix) &&
+{
+   (*this) += other_matrix;
+
+   return(std::move(*this));
+}
+
+
+// Matrix<T> operator + (Matrix<T>&&) const & method
+
+/// Sum matrix+matrix arithmetic operator for an expiring right hand side matrix.
+/// The elements of the other matrix are overwritten with the result and then moved to it.
+/// @param other_matrix Matrix to be added to this matrix.
+
+template <class T>
+Matrix<T> Matrix<T>::operator + (Matrix<T>&& other_matrix) const &
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   const size_t other_rows_number = other_matrix.get_rows_number();
+   const size_t other_columns_number = other_matrix.get_columns_number();
+
+   if(other_rows_number != rows_number || other_columns_number != columns_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Matrix Template.\n"
+             << "Matrix<T> operator + (Matrix<T>&&) const & method.\n"
+             << "Sizes of other matrix (" << other_rows_number << "," << other_columns_number << ") must be equal to sizes of this matrix (" << rows_number << "," << columns_number << ").\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   std::transform(this->begin(), this->end(), other_matrix.begin(), other_matrix.begin(), std::plus<T>());
+
+   return(std::move(other_matrix));
+}
+
+
+// Matrix<T> operator + (Matrix<T>&&) && method
+
+/// Sum matrix+matrix arithmetic operator when both matrices are expiring.
+/// The elements of this matrix are reused for the result.
+/// @param other_matrix Matrix to be added to this matrix.
+
+template <class T>
+Matrix<T> Matrix<T>::operator + (Matrix<T>&& other_matrix) &&
+{
+   (*this) += other_matrix;
+
+   return(std::move(*this));
+}
+
+
+// Matrix<T> operator - (const T&) const & method
 
 /// Difference matrix-scalar arithmetic operator.
 /// @param scalar Scalar value to be subtracted to this matrix.
 
 template <class T>
-Matrix<T> Matrix<T>::operator - (const T& scalar) const
+Matrix<T> Matrix<T>::operator - (const T& scalar) const &
 {
    Matrix<T> difference(rows_number, columns_number);
 
-   std::transform( this->begin(), this->end(), difference.begin(), std::bind2nd(std::minus<T>(), scalar));
+   const size_t size = this->size();
+
+   for(size_t i = 0; i < size; i++)
+   {
+      difference[i] = (*this)[i] - scalar;
+   }
 
    return(difference);
 }
 
 
+// Matrix<T> operator - (const T&) && method
+
+/// Difference matrix-scalar arithmetic operator for an expiring matrix, whose elements are reused for the result.
+/// @param scalar Scalar value to be subtracted from this matrix.
+
+template <class T>
+Matrix<T> Matrix<T>::operator - (const T& scalar) &&
+{
+   (*this) -= scalar;
+
+   return(std::move(*this));
+}
+
+
 // Matrix<T> operator - (const Vector<T>&) const method
 
 /// Sum matrix-vector arithmetic operator.
@@ -5566,13 +6665,13 @@ Matrix<T> Matrix<T>::operator - (const Vector<T>& vector) const
 }
 
 
-// Matrix<T> operator - (const Matrix<T>&) const method
+// Matrix<T> operator - (const Matrix<T>&) const & method
 
 /// Difference matrix-matrix arithmetic operator.
 /// @param other_matrix Matrix to be subtracted to this matrix.
 
 template <class T>
-Matrix<T> Matrix<T>::operator - (const Matrix<T>& other_matrix) const
+Matrix<T> Matrix<T>::operator - (const Matrix<T>& other_matrix) const &
 {
    // Control sentence (if debug)
 
@@ -5602,13 +6701,77 @@ Matrix<T> Matrix<T>::operator - (const Matrix<T>& other_matrix) const
 }
 
 
-// Matrix<T> operator * (const T&) const method
+// Matrix<T> operator - (const Matrix<T>&) && method
+
+/// Difference matrix-matrix arithmetic operator for an expiring matrix, whose elements are reused for the result.
+/// @param other_matrix Matrix to be subtracted from this matrix.
+
+template <class T>
+Matrix<T> Matrix<T>::operator - (const Matrix<T>& other_matrix) &&
+{
+   (*this) -= other_matrix;
+
+   return(std::move(*this));
+}
+
+
+// Matrix<T> operator - (Matrix<T>&&) const & method
+
+/// Difference matrix-matrix arithmetic operator for an expiring right hand side matrix.
+/// The elements of the other matrix are overwritten with the result and then moved to it.
+/// @param other_matrix Matrix to be subtracted from this matrix.
+
+template <class T>
+Matrix<T> Matrix<T>::operator - (Matrix<T>&& other_matrix) const &
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   const size_t other_rows_number = other_matrix.get_rows_number();
+   const size_t other_columns_number = other_matrix.get_columns_number();
+
+   if(other_rows_number != rows_number || other_columns_number != columns_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Matrix Template.\n"
+             << "Matrix<T> operator - (Matrix<T>&&) const & method.\n"
+             << "Sizes of other matrix (" << other_rows_number << "," << other_columns_number << ") must be equal to sizes of this matrix (" << rows_number << "," << columns_number << ").\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   std::transform(this->begin(), this->end(), other_matrix.begin(), other_matrix.begin(), std::minus<T>());
+
+   return(std::move(other_matrix));
+}
+
+
+// Matrix<T> operator - (Matrix<T>&&) && method
+
+/// Difference matrix-matrix arithmetic operator when both matrices are expiring.
+/// The elements of this matrix are reused for the result.
+/// @param other_matrix Matrix to be subtracted from this matrix.
+
+template <class T>
+Matrix<T> Matrix<T>::operator - (Matrix<T>&& other_matrix) &&
+{
+   (*this) -= other_matrix;
+
+   return(std::move(*this));
+}
+
+
+// Matrix<T> operator * (const T&) const & method
 
 /// Product matrix*scalar arithmetic operator.
 /// @param scalar Scalar value to be multiplied to this matrix.
 
 template <class T>
-Matrix<T> Matrix<T>::operator * (const T& scalar) const
+Matrix<T> Matrix<T>::operator * (const T& scalar) const &
 {
     Matrix<T> product(rows_number, columns_number);
 
@@ -5621,6 +6784,20 @@ Matrix<T> Matrix<T>::operator * (const T& scalar) const
 }
 
 
+// Matrix<T> operator * (const T&) && method
+
+/// Product matrix*scalar arithmetic operator for an expiring matrix, whose elements are reused for the result.
+/// @param scalar Scalar value to be multiplied by this matrix.
+
+template <class T>
+Matrix<T> Matrix<T>::operator * (const T& scalar) &&
+{
+   (*this) *= scalar;
+
+   return(std::move(*this));
+}
+
+
 // Matrix<T> operator * (const Vector<T>&) const  method
 
 /// Row by element matrix*row arithmetic operator.
@@ -5662,13 +6839,13 @@ Matrix<T> Matrix<T>::operator * (const Vector<T>& vector) const
 }
 
 
-// Matrix<T> operator * (const Matrix<T>&) const  method
+// Matrix<T> operator * (const Matrix<T>&) const & method
 
 /// Product matrix*matrix arithmetic operator.
 /// @param other_matrix Matrix to be multiplied to this matrix.
 
 template <class T>
-Matrix<T> Matrix<T>::operator * (const Matrix<T>& other_matrix) const
+Matrix<T> Matrix<T>::operator * (const Matrix<T>& other_matrix) const &
 {
    // Control sentence (if debug)
 
@@ -5701,45 +6878,123 @@ Matrix<T> Matrix<T>::operator * (const Matrix<T>& other_matrix) const
 }
 
 
-// Matrix<T> operator / (const T&) const method
+// Matrix<T> operator * (const Matrix<T>&) && method
 
-/// Cocient Matrix/scalar arithmetic operator.
-/// @param scalar Value of scalar.
+/// Product matrix*matrix arithmetic operator for an expiring matrix, whose elements are reused for the result.
+/// @param other_matrix Matrix to be multiplied by this matrix.
 
 template <class T>
-Matrix<T> Matrix<T>::operator / (const T& scalar) const
+Matrix<T> Matrix<T>::operator * (const Matrix<T>& other_matrix) &&
 {
-    Matrix<T> results(rows_number, columns_number);
+   (*this) *= other_matrix;
 
-    for(size_t i = 0; i < results.size(); i++)
-    {
-        results[i] = (*this)[i]/scalar;
-    }
-
-    return(results);
+   return(std::move(*this));
 }
 
 
-// Matrix<T> operator / (const Vector<T>&) const method
+// Matrix<T> operator * (Matrix<T>&&) const & method
 
-/// Cocient matrix/vector arithmetic operator.
-/// @param vector Vector to be divided to this matrix.
+/// Product matrix*matrix arithmetic operator for an expiring right hand side matrix.
+/// The elements of the other matrix are overwritten with the result and then moved to it.
+/// @param other_matrix Matrix to be multiplied by this matrix.
 
 template <class T>
-Matrix<T> Matrix<T>::operator / (const Vector<T>& vector) const
+Matrix<T> Matrix<T>::operator * (Matrix<T>&& other_matrix) const &
 {
    // Control sentence (if debug)
 
    #ifdef __OPENNN_DEBUG__
 
-   const size_t size = vector.size();
+   const size_t other_rows_number = other_matrix.get_rows_number();
+   const size_t other_columns_number = other_matrix.get_columns_number();
 
-   if(size != columns_number)
+   if(other_rows_number != rows_number || other_columns_number != columns_number)
    {
       std::ostringstream buffer;
 
       buffer << "OpenNN Exception: Matrix Template.\n"
-             << "Matrix<T> operator / (const Vector<T>&) const.\n"
+             << "Matrix<T> operator * (Matrix<T>&&) const & method.\n"
+             << "Sizes of other matrix (" << other_rows_number << "," << other_columns_number << ") must be equal to sizes of this matrix (" << rows_number << "," << columns_number << ").\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   std::transform(this->begin(), this->end(), other_matrix.begin(), other_matrix.begin(), std::multiplies<T>());
+
+   return(std::move(other_matrix));
+}
+
+
+// Matrix<T> operator * (Matrix<T>&&) && method
+
+/// Product matrix*matrix arithmetic operator when both matrices are expiring.
+/// The elements of this matrix are reused for the result.
+/// @param other_matrix Matrix to be multiplied by this matrix.
+
+template <class T>
+Matrix<T> Matrix<T>::operator * (Matrix<T>&& other_matrix) &&
+{
+   (*this) *= other_matrix;
+
+   return(std::move(*this));
+}
+
+
+// Matrix<T> operator / (const T&) const & method
+
+/// Cocient Matrix/scalar arithmetic operator.
+/// @param scalar Value of scalar.
+
+template <class T>
+Matrix<T> Matrix<T>::operator / (const T& scalar) const &
+{
+    Matrix<T> results(rows_number, columns_number);
+
+    for(size_t i = 0; i < results.size(); i++)
+    {
+        results[i] = (*this)[i]/scalar;
+    }
+
+    return(results);
+}
+
+
+// Matrix<T> operator / (const T&) && method
+
+/// Cocient matrix/scalar arithmetic operator for an expiring matrix, whose elements are reused for the result.
+/// @param scalar Scalar value to be divided by this matrix.
+
+template <class T>
+Matrix<T> Matrix<T>::operator / (const T& scalar) &&
+{
+   (*this) /= scalar;
+
+   return(std::move(*this));
+}
+
+
+// Matrix<T> operator / (const Vector<T>&) const method
+
+/// Cocient matrix/vector arithmetic operator.
+/// @param vector Vector to be divided to this matrix.
+
+template <class T>
+Matrix<T> Matrix<T>::operator / (const Vector<T>& vector) const
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   const size_t size = vector.size();
+
+   if(size != columns_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Matrix Template.\n"
+             << "Matrix<T> operator / (const Vector<T>&) const.\n"
              << "Size of vector must be equal to number of columns.\n";
 
       throw std::logic_error(buffer.str());
@@ -5761,13 +7016,13 @@ Matrix<T> Matrix<T>::operator / (const Vector<T>& vector) const
 }
 
 
-// Matrix<T> operator / (const Matrix<T>&) const  method
+// Matrix<T> operator / (const Matrix<T>&) const & method
 
 /// Cocient matrix/matrix arithmetic operator.
 /// @param other_matrix Matrix to be divided to this vector.
 
 template <class T>
-Matrix<T> Matrix<T>::operator / (const Matrix<T>& other_matrix) const
+Matrix<T> Matrix<T>::operator / (const Matrix<T>& other_matrix) const &
 {
    // Control sentence (if debug)
 
@@ -5791,7 +7046,7 @@ Matrix<T> Matrix<T>::operator / (const Matrix<T>& other_matrix) const
 
    Matrix<T> cocient(rows_number, columns_number);
 
-   for(size_t i = 0; i < rows_number; i++)
+   for(size_t i = 0; i < this->size(); i++)
    {
          cocient[i] = (*this)[i]/other_matrix[i];
    }
@@ -5800,6 +7055,70 @@ Matrix<T> Matrix<T>::operator / (const Matrix<T>& other_matrix) const
 }
 
 
+// Matrix<T> operator / (const Matrix<T>&) && method
+
+/// Cocient matrix/matrix arithmetic operator for an expiring matrix, whose elements are reused for the result.
+/// @param other_matrix Matrix to be divided by this matrix.
+
+template <class T>
+Matrix<T> Matrix<T>::operator / (const Matrix<T>& other_matrix) &&
+{
+   (*this) /= other_matrix;
+
+   return(std::move(*this));
+}
+
+
+// Matrix<T> operator / (Matrix<T>&&) const & method
+
+/// Cocient matrix/matrix arithmetic operator for an expiring right hand side matrix.
+/// The elements of the other matrix are overwritten with the result and then moved to it.
+/// @param other_matrix Matrix to be divided by this matrix.
+
+template <class T>
+Matrix<T> Matrix<T>::operator / (Matrix<T>&& other_matrix) const &
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   const size_t other_rows_number = other_matrix.get_rows_number();
+   const size_t other_columns_number = other_matrix.get_columns_number();
+
+   if(other_rows_number != rows_number || other_columns_number != columns_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Matrix Template.\n"
+             << "Matrix<T> operator / (Matrix<T>&&) const & method.\n"
+             << "Sizes of other matrix (" << other_rows_number << "," << other_columns_number << ") must be equal to sizes of this matrix (" << rows_number << "," << columns_number << ").\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   std::transform(this->begin(), this->end(), other_matrix.begin(), other_matrix.begin(), std::divides<T>());
+
+   return(std::move(other_matrix));
+}
+
+
+// Matrix<T> operator / (Matrix<T>&&) && method
+
+/// Cocient matrix/matrix arithmetic operator when both matrices are expiring.
+/// The elements of this matrix are reused for the result.
+/// @param other_matrix Matrix to be divided by this matrix.
+
+template <class T>
+Matrix<T> Matrix<T>::operator / (Matrix<T>&& other_matrix) &&
+{
+   (*this) /= other_matrix;
+
+   return(std::move(*this));
+}
+
+
 // void operator += (const T&)
 
 /// Scalar sum and assignment operator.
@@ -5808,12 +7127,11 @@ Matrix<T> Matrix<T>::operator / (const Matrix<T>& other_matrix) const
 template <class T>
 void Matrix<T>::operator += (const T& value)
 {
-   for(size_t i = 0; i < rows_number; i++)
+   const size_t size = this->size();
+
+   for(size_t i = 0; i < size; i++)
    {
-      for(size_t j = 0; j < columns_number; j++)
-      {
-         (*this)(i,j) += value;
-      }
+      (*this)[i] += value;
    }
 }
 
@@ -5858,13 +7176,7 @@ void Matrix<T>::operator += (const Matrix<T>& other_matrix)
 
    #endif
 
-   for(size_t i = 0; i < rows_number; i++)
-   {
-      for(size_t j = 0; j < columns_number; j++)
-      {
-         (*this)(i,j) += other_matrix(i,j);
-      }
-   }
+   std::transform(this->begin(), this->end(), other_matrix.begin(), this->begin(), std::plus<T>());
 }
 
 
@@ -5876,12 +7188,11 @@ void Matrix<T>::operator += (const Matrix<T>& other_matrix)
 template <class T>
 void Matrix<T>::operator -= (const T& value)
 {
-   for(size_t i = 0; i < rows_number; i++)
+   const size_t size = this->size();
+
+   for(size_t i = 0; i < size; i++)
    {
-      for(size_t j = 0; j < columns_number; j++)
-      {
-         (*this)(i,j) -= value;
-      }
+      (*this)[i] -= value;
    }
 }
 
@@ -5926,13 +7237,7 @@ void Matrix<T>::operator -= (const Matrix<T>& other_matrix)
 
    #endif
 
-   for(size_t i = 0; i < rows_number; i++)
-   {
-      for(size_t j = 0; j < columns_number; j++)
-      {
-         (*this)(i,j) -= other_matrix(i,j);
-      }
-   }
+   std::transform(this->begin(), this->end(), other_matrix.begin(), this->begin(), std::minus<T>());
 }
 
 
@@ -5944,12 +7249,11 @@ void Matrix<T>::operator -= (const Matrix<T>& other_matrix)
 template <class T>
 void Matrix<T>::operator *= (const T& value)
 {
-   for(size_t i = 0; i < rows_number; i++)
+   const size_t size = this->size();
+
+   for(size_t i = 0; i < size; i++)
    {
-      for(size_t j = 0; j < columns_number; j++)
-      {
-         (*this)(i,j) *= value;
-      }
+      (*this)[i] *= value;
    }
 }
 
@@ -5984,13 +7288,7 @@ void Matrix<T>::operator *= (const Matrix<T>& other_matrix)
 
    #endif
 
-   for(size_t i = 0; i < rows_number; i++)
-   {
-      for(size_t j = 0; j < columns_number; j++)
-      {
-         (*this)(i,j) *= other_matrix(i,j);
-      }
-   }
+   std::transform(this->begin(), this->end(), other_matrix.begin(), this->begin(), std::multiplies<T>());
 }
 
 
@@ -6002,12 +7300,11 @@ void Matrix<T>::operator *= (const Matrix<T>& other_matrix)
 template <class T>
 void Matrix<T>::operator /= (const T& value)
 {
-   for(size_t i = 0; i < rows_number; i++)
+   const size_t size = this->size();
+
+   for(size_t i = 0; i < size; i++)
    {
-      for(size_t j = 0; j < columns_number; j++)
-      {
-         (*this)(i,j) /= value;
-      }
+      (*this)[i] /= value;
    }
 }
 
@@ -6052,13 +7349,105 @@ void Matrix<T>::operator /= (const Matrix<T>& other_matrix)
 
    #endif
 
-   for(size_t i = 0; i < rows_number; i++)
+   std::transform(this->begin(), this->end(), other_matrix.begin(), this->begin(), std::divides<T>());
+}
+
+
+// void operator += (const VectorExpression<E>&)
+
+/// Sum and assignment operator with a lazy expression, which is evaluated while it is added.
+/// @param expression Expression to be added to this matrix.
+
+template <class T>
+template <class E>
+void Matrix<T>::operator += (const VectorExpression<E>& expression)
+{
+   const E& expression_node = expression.derived();
+
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   const size_t expression_rows_number = expression_node.get_rows_number();
+   const size_t expression_columns_number = expression_node.get_columns_number();
+
+   if(expression_rows_number != rows_number || expression_columns_number != columns_number)
    {
-      for(size_t j = 0; j < columns_number; j++)
-      {
-         (*this)(i,j) /= other_matrix(i,j);
-      }
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Matrix Template.\n"
+             << "void operator += (const VectorExpression<E>&).\n"
+             << "Dimensions of expression (" << expression_rows_number << "," << expression_columns_number << ") must be equal to dimensions of this matrix (" << rows_number << "," << columns_number << ").\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   const size_t this_size = this->size();
+
+   T* this_data = this->data();
+
+   for(size_t i = 0; i < this_size; i++)
+   {
+      this_data[i] += expression_node[i];
+   }
+}
+
+
+// void operator -= (const VectorExpression<E>&)
+
+/// Difference and assignment operator with a lazy expression, which is evaluated while it is subtracted.
+/// @param expression Expression to be subtracted from this matrix.
+
+template <class T>
+template <class E>
+void Matrix<T>::operator -= (const VectorExpression<E>& expression)
+{
+   const E& expression_node = expression.derived();
+
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   const size_t expression_rows_number = expression_node.get_rows_number();
+   const size_t expression_columns_number = expression_node.get_columns_number();
+
+   if(expression_rows_number != rows_number || expression_columns_number != columns_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Matrix Template.\n"
+             << "void operator -= (const VectorExpression<E>&).\n"
+             << "Dimensions of expression (" << expression_rows_number << "," << expression_columns_number << ") must be equal to dimensions of this matrix (" << rows_number << "," << columns_number << ").\n";
+
+      throw std::logic_error(buffer.str());
    }
+
+   #endif
+
+   const size_t this_size = this->size();
+
+   T* this_data = this->data();
+
+   for(size_t i = 0; i < this_size; i++)
+   {
+      this_data[i] -= expression_node[i];
+   }
+}
+
+
+// ExpressionTerminal<T> lazy(void) const method
+
+/// Returns a terminal for building lazy element-wise expressions with this matrix.
+/// The expression is evaluated element by element when it is assigned,
+/// as in <tt>output_gradient = (outputs.lazy() - targets.lazy())*2.0;</tt>.
+/// The matrix must outlive the expressions which use it.
+
+template <class T>
+ExpressionTerminal<T> Matrix<T>::lazy(void) const
+{
+   return(ExpressionTerminal<T>(this->data(), rows_number, columns_number));
 }
 
 
@@ -6143,6 +7532,46 @@ Vector<double> Matrix<T>::dot(const Vector<double>& vector) const
 }
 
 
+// Vector<double> dot(const VectorView<double>&) const method
+
+/// Returns the dot product of this matrix with the elements referred by a view, such as a row of another matrix.
+/// The elements of the view are not copied.
+/// @param vector_view View of the vector to be multiplied, whose size must be the number of columns.
+
+template <class T>
+Vector<double> Matrix<T>::dot(const VectorView<double>& vector_view) const
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   const size_t size = vector_view.size();
+
+   if(size != columns_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Matrix Template.\n"
+             << "Vector<T> dot(const VectorView<double>&) const method.\n"
+             << "Size of view must be equal to matrix number of columns.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   Vector<double> product(rows_number);
+
+   const Eigen::Map<Eigen::MatrixXd> matrix_eigen((double*)this->data(), rows_number, columns_number);
+   const Eigen::Map<Eigen::VectorXd, 0, Eigen::InnerStride<> > vector_eigen((double*)vector_view.get_data(), columns_number, Eigen::InnerStride<>(vector_view.get_stride()));
+   Eigen::Map<Eigen::VectorXd> product_eigen(product.data(), rows_number);
+
+   product_eigen = matrix_eigen*vector_eigen;
+
+   return(product);
+}
+
+
 // Matrix<double> dot(const Matrix<double>&) const method
 
 /// Returns the dot product of this matrix with another matrix.
@@ -6191,22 +7620,201 @@ Matrix<double> Matrix<T>::dot(const Matrix<double>& other_matrix) const
 }
 
 
-// Matrix<T> direct(const Matrix<T>&) const method
+// Matrix<double> calculate_transpose_dot(const Matrix<double>&) const method
 
-/// Calculates the direct product of this matrix with another matrix.
-/// This product is also known as the Kronecker product.
-/// @param other_matrix Second product term.
+/// Returns the dot product of the transpose of this matrix with another matrix.
+/// The transpose is never formed explicitly, so this is cheaper than calculate_transpose().dot(other_matrix).
+/// @param other_matrix Matrix to be multiplied to the transpose of this matrix.
 
 template <class T>
-Matrix<T> Matrix<T>::direct(const Matrix<T>& other_matrix) const
+Matrix<double> Matrix<T>::calculate_transpose_dot(const Matrix<double>& other_matrix) const
 {
-   const size_t other_rows_number = other_matrix.get_rows_number();
    const size_t other_columns_number = other_matrix.get_columns_number();
+   const size_t other_rows_number = other_matrix.get_rows_number();
 
-   Matrix<T> direct(rows_number*other_rows_number, columns_number*other_columns_number);
+   // Control sentence (if debug)
 
-   size_t alpha;
-   size_t beta;
+   #ifdef __OPENNN_DEBUG__
+
+   if(other_rows_number != rows_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Matrix Template.\n"
+             << "Matrix<double> calculate_transpose_dot(const Matrix<double>&) const method.\n"
+             << "The number of rows of the other matrix (" << other_rows_number << ") must be equal to the number of rows of this matrix (" << rows_number << ").\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   Matrix<double> product(columns_number, other_columns_number);
+
+   const Eigen::Map<Eigen::MatrixXd> this_eigen((double*)this->data(), rows_number, columns_number);
+   const Eigen::Map<Eigen::MatrixXd> other_eigen((double*)other_matrix.data(), other_rows_number, other_columns_number);
+   Eigen::Map<Eigen::MatrixXd> product_eigen(product.data(), columns_number, other_columns_number);
+
+   product_eigen = this_eigen.transpose()*other_eigen;
+
+   return(product);
+}
+
+
+// void sum_symmetric_rank_update(const Matrix<double>&) method
+
+/// Adds the product of the transpose of another matrix with itself to this square matrix.
+/// Only the lower triangle of the product is computed, as a symmetric rank-k update, and it is then mirrored to the upper triangle.
+/// This matrix must be symmetric, as is the case when it accumulates the products of several blocks of rows.
+/// @param other_matrix Matrix whose number of columns is the size of this matrix.
+
+template <class T>
+void Matrix<T>::sum_symmetric_rank_update(const Matrix<double>& other_matrix)
+{
+   const size_t other_rows_number = other_matrix.get_rows_number();
+   const size_t other_columns_number = other_matrix.get_columns_number();
+
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(rows_number != columns_number || other_columns_number != rows_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Matrix Template.\n"
+             << "void sum_symmetric_rank_update(const Matrix<double>&) method.\n"
+             << "This matrix must be square and its size (" << rows_number << ") must be equal to the number of columns of the other matrix (" << other_columns_number << ").\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   if(other_rows_number == 0)
+   {
+      return;
+   }
+
+   Eigen::Map<Eigen::MatrixXd> this_eigen((double*)this->data(), rows_number, columns_number);
+   const Eigen::Map<Eigen::MatrixXd> other_eigen((double*)other_matrix.data(), other_rows_number, other_columns_number);
+
+   this_eigen.selfadjointView<Eigen::Lower>().rankUpdate(other_eigen.transpose());
+
+   this_eigen.triangularView<Eigen::StrictlyUpper>() = this_eigen.transpose();
+}
+
+
+// void sum_lower_rank_update(const Matrix<double>&, const size_t&, const size_t&) method
+
+/// Adds a block of columns of the lower triangle of the product of the transpose of another matrix with itself to this square matrix.
+/// Blocks of columns which do not overlap can be updated from different threads.
+/// The upper triangle is only modified within the diagonal block, and it can be filled afterwards with copy_lower_triangle_to_upper().
+/// @param other_matrix Matrix whose number of columns is the size of this matrix.
+/// @param column_begin Index of the first column of the block.
+/// @param column_end Index after the last column of the block.
+
+template <class T>
+void Matrix<T>::sum_lower_rank_update(const Matrix<double>& other_matrix, const size_t& column_begin, const size_t& column_end)
+{
+   const size_t other_rows_number = other_matrix.get_rows_number();
+   const size_t other_columns_number = other_matrix.get_columns_number();
+
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(rows_number != columns_number || other_columns_number != rows_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Matrix Template.\n"
+             << "void sum_lower_rank_update(const Matrix<double>&, const size_t&, const size_t&) method.\n"
+             << "This matrix must be square and its size (" << rows_number << ") must be equal to the number of columns of the other matrix (" << other_columns_number << ").\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   if(column_begin > column_end || column_end > columns_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Matrix Template.\n"
+             << "void sum_lower_rank_update(const Matrix<double>&, const size_t&, const size_t&) method.\n"
+             << "Columns block [" << column_begin << ", " << column_end << ") is not valid for a matrix with " << columns_number << " columns.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   if(other_rows_number == 0 || column_begin == column_end)
+   {
+      return;
+   }
+
+   const size_t block_rows_number = rows_number - column_begin;
+   const size_t block_columns_number = column_end - column_begin;
+
+   Eigen::Map<Eigen::MatrixXd> this_eigen((double*)this->data(), rows_number, columns_number);
+   const Eigen::Map<Eigen::MatrixXd> other_eigen((double*)other_matrix.data(), other_rows_number, other_columns_number);
+
+   this_eigen.block(column_begin, column_begin, block_rows_number, block_columns_number).noalias()
+   += other_eigen.rightCols(block_rows_number).transpose()*other_eigen.middleCols(column_begin, block_columns_number);
+}
+
+
+// void copy_lower_triangle_to_upper(void) method
+
+/// Sets the strict upper triangle of this square matrix to the transpose of its strict lower triangle,
+/// so that a matrix whose lower triangle has been accumulated becomes symmetric.
+
+template <class T>
+void Matrix<T>::copy_lower_triangle_to_upper(void)
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(rows_number != columns_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Matrix Template.\n"
+             << "void copy_lower_triangle_to_upper(void) method.\n"
+             << "Matrix must be square.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   for(size_t j = 1; j < columns_number; j++)
+   {
+      for(size_t i = 0; i < j; i++)
+      {
+         (*this)(i,j) = (*this)(j,i);
+      }
+   }
+}
+
+
+// Matrix<T> direct(const Matrix<T>&) const method
+
+/// Calculates the direct product of this matrix with another matrix.
+/// This product is also known as the Kronecker product.
+/// @param other_matrix Second product term.
+
+template <class T>
+Matrix<T> Matrix<T>::direct(const Matrix<T>& other_matrix) const
+{
+   const size_t other_rows_number = other_matrix.get_rows_number();
+   const size_t other_columns_number = other_matrix.get_columns_number();
+
+   Matrix<T> direct(rows_number*other_rows_number, columns_number*other_columns_number);
+
+   size_t alpha;
+   size_t beta;
 
     for(size_t i = 0; i < rows_number; i++)
     {
@@ -7113,6 +8721,1019 @@ std::ostream& operator << (std::ostream& os, const Matrix< Matrix<T> >& m)
    return(os);
 }
 
+
+/// This template class stores the LU decomposition with partial pivoting, P*A = L*U, of a square matrix.
+/// The factorization is computed once and can then be reused to solve systems, invert the matrix or evaluate its determinant.
+/// It is intended for floating point types.
+
+template <class T>
+class LUFactorization
+{
+
+public:
+
+    // CONSTRUCTOR
+
+    explicit LUFactorization(const Matrix<T>&);
+
+    // METHODS
+
+    size_t get_size(void) const;
+
+    Matrix<T> arrange_lower_triangular(void) const;
+    Matrix<T> arrange_upper_triangular(void) const;
+
+    bool is_singular(void) const;
+
+    Vector<T> solve(const Vector<T>&) const;
+    Matrix<T> solve(const Matrix<T>&) const;
+
+    Matrix<T> calculate_inverse(void) const;
+
+    T calculate_determinant(void) const;
+    double calculate_log_determinant(void) const;
+
+private:
+
+    typedef Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> EigenMatrix;
+
+    /// Eigen decomposition, with the unit lower and the upper triangular factors packed in a single matrix.
+
+    Eigen::PartialPivLU<EigenMatrix> LU_eigen;
+};
+
+
+/// This template class stores the Cholesky decomposition, A = L*L^T, of a symmetric positive definite matrix.
+/// It halves the cost of the LU decomposition and fails if the matrix is not positive definite.
+
+template <class T>
+class CholeskyFactorization
+{
+
+public:
+
+    // CONSTRUCTOR
+
+    explicit CholeskyFactorization(const Matrix<T>&);
+
+    // METHODS
+
+    size_t get_size(void) const;
+
+    Matrix<T> arrange_lower_triangular(void) const;
+
+    bool is_positive_definite(void) const;
+
+    Vector<T> solve(const Vector<T>&) const;
+    Matrix<T> solve(const Matrix<T>&) const;
+
+    Matrix<T> calculate_inverse(void) const;
+
+    T calculate_determinant(void) const;
+    double calculate_log_determinant(void) const;
+
+private:
+
+    typedef Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> EigenMatrix;
+
+    /// Eigen decomposition referencing the lower triangle of the matrix.
+
+    Eigen::LLT<EigenMatrix, Eigen::Lower> LLT_eigen;
+};
+
+
+/// This template class stores the pivoted decomposition P^T*L*D*L^T*P of a symmetric matrix.
+/// It exists for semidefinite and indefinite matrices, so it is suitable for Hessians far from a minimum.
+
+template <class T>
+class LDLTFactorization
+{
+
+public:
+
+    // CONSTRUCTOR
+
+    explicit LDLTFactorization(const Matrix<T>&);
+
+    // METHODS
+
+    size_t get_size(void) const;
+
+    Vector<T> arrange_diagonal(void) const;
+
+    bool is_positive_definite(void) const;
+
+    Vector<T> solve(const Vector<T>&) const;
+    Matrix<T> solve(const Matrix<T>&) const;
+
+    Matrix<T> calculate_inverse(void) const;
+
+    T calculate_determinant(void) const;
+    double calculate_log_determinant(void) const;
+
+private:
+
+    typedef Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> EigenMatrix;
+
+    /// Eigen decomposition referencing the lower triangle of the matrix.
+
+    Eigen::LDLT<EigenMatrix, Eigen::Lower> LDLT_eigen;
+};
+
+
+// Matrix<T> solve_factorization(const Eigen decomposition&, const Matrix<T>&) function
+
+/// Solves A*X = B for several right hand sides with an already computed Eigen decomposition of A.
+/// It is shared by the factorization classes.
+/// @param decomposition Eigen decomposition of the coefficients matrix.
+/// @param b Independent terms, one system per column.
+
+template <class T, class Decomposition>
+Matrix<T> solve_factorization(const Decomposition& decomposition, const Matrix<T>& b)
+{
+   const size_t size = decomposition.rows();
+
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(b.get_rows_number() != size)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Matrix Template.\n"
+             << "Matrix<T> solve(const Matrix<T>&) const method.\n"
+             << "Number of rows of independent terms (" << b.get_rows_number() << ") must be equal to size of factorization (" << size << ").\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   const size_t columns_number = b.get_columns_number();
+
+   Matrix<T> solution(size, columns_number);
+
+   const Eigen::Map< const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> > b_eigen(b.data(), size, columns_number);
+   Eigen::Map< Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> > solution_eigen(solution.data(), size, columns_number);
+
+   solution_eigen = decomposition.solve(b_eigen);
+
+   return(solution);
+}
+
+
+// Vector<T> solve_factorization(const Eigen decomposition&, const Vector<T>&) function
+
+/// Solves A*x = b with an already computed Eigen decomposition of A.
+/// It is shared by the factorization classes.
+/// @param decomposition Eigen decomposition of the coefficients matrix.
+/// @param b Independent terms vector.
+
+template <class T, class Decomposition>
+Vector<T> solve_factorization(const Decomposition& decomposition, const Vector<T>& b)
+{
+   const size_t size = decomposition.rows();
+
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(b.size() != size)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Matrix Template.\n"
+             << "Vector<T> solve(const Vector<T>&) const method.\n"
+             << "Size of independent terms vector (" << b.size() << ") must be equal to size of factorization (" << size << ").\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   Vector<T> solution(size);
+
+   const Eigen::Map< const Eigen::Matrix<T, Eigen::Dynamic, 1> > b_eigen(b.data(), size);
+   Eigen::Map< Eigen::Matrix<T, Eigen::Dynamic, 1> > solution_eigen(solution.data(), size);
+
+   solution_eigen = decomposition.solve(b_eigen);
+
+   return(solution);
+}
+
+
+// LUFactorization CONSTRUCTOR
+
+/// Factorizes a square matrix.
+/// @param matrix Matrix to be factorized.
+
+template <class T>
+LUFactorization<T>::LUFactorization(const Matrix<T>& matrix)
+{
+   const size_t rows_number = matrix.get_rows_number();
+   const size_t columns_number = matrix.get_columns_number();
+
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(rows_number != columns_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: LUFactorization Template.\n"
+             << "LUFactorization(const Matrix<T>&) constructor.\n"
+             << "Matrix must be square.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   const Eigen::Map<const EigenMatrix> matrix_eigen(matrix.data(), rows_number, columns_number);
+
+   LU_eigen.compute(matrix_eigen);
+}
+
+
+// size_t get_size(void) const method
+
+/// Returns the number of rows and columns of the factorized matrix.
+
+template <class T>
+size_t LUFactorization<T>::get_size(void) const
+{
+   return(LU_eigen.rows());
+}
+
+
+// Matrix<T> arrange_lower_triangular(void) const method
+
+/// Returns the unit lower triangular factor L.
+
+template <class T>
+Matrix<T> LUFactorization<T>::arrange_lower_triangular(void) const
+{
+   const size_t size = LU_eigen.rows();
+
+   Matrix<T> lower_triangular(size, size, 0);
+
+   Eigen::Map<EigenMatrix> lower_triangular_eigen(lower_triangular.data(), size, size);
+
+   lower_triangular_eigen.template triangularView<Eigen::UnitLower>() = LU_eigen.matrixLU();
+
+   return(lower_triangular);
+}
+
+
+// Matrix<T> arrange_upper_triangular(void) const method
+
+/// Returns the upper triangular factor U.
+
+template <class T>
+Matrix<T> LUFactorization<T>::arrange_upper_triangular(void) const
+{
+   const size_t size = LU_eigen.rows();
+
+   Matrix<T> upper_triangular(size, size, 0);
+
+   Eigen::Map<EigenMatrix> upper_triangular_eigen(upper_triangular.data(), size, size);
+
+   upper_triangular_eigen.template triangularView<Eigen::Upper>() = LU_eigen.matrixLU();
+
+   return(upper_triangular);
+}
+
+
+// bool is_singular(void) const method
+
+/// Returns true if some pivot of the factorization is zero, and false otherwise.
+
+template <class T>
+bool LUFactorization<T>::is_singular(void) const
+{
+   const size_t size = LU_eigen.rows();
+
+   for(size_t i = 0; i < size; i++)
+   {
+      if(LU_eigen.matrixLU()(i,i) == 0)
+      {
+         return(true);
+      }
+   }
+
+   return(false);
+}
+
+
+// Vector<T> solve(const Vector<T>&) const method
+
+/// Solves A*x = b by forward and back substitution.
+/// @param b Independent terms vector.
+
+template <class T>
+Vector<T> LUFactorization<T>::solve(const Vector<T>& b) const
+{
+   return(solve_factorization(LU_eigen, b));
+}
+
+
+// Matrix<T> solve(const Matrix<T>&) const method
+
+/// Solves A*X = B, with one system for each column of B.
+/// @param b Independent terms matrix.
+
+template <class T>
+Matrix<T> LUFactorization<T>::solve(const Matrix<T>& b) const
+{
+   return(solve_factorization(LU_eigen, b));
+}
+
+
+// Matrix<T> calculate_inverse(void) const method
+
+/// Returns the inverse of the factorized matrix.
+
+template <class T>
+Matrix<T> LUFactorization<T>::calculate_inverse(void) const
+{
+   const size_t size = LU_eigen.rows();
+
+   Matrix<T> inverse(size, size);
+
+   Eigen::Map<EigenMatrix> inverse_eigen(inverse.data(), size, size);
+
+   inverse_eigen = LU_eigen.inverse();
+
+   return(inverse);
+}
+
+
+// T calculate_determinant(void) const method
+
+/// Returns the determinant of the factorized matrix.
+
+template <class T>
+T LUFactorization<T>::calculate_determinant(void) const
+{
+   return(LU_eigen.determinant());
+}
+
+
+// double calculate_log_determinant(void) const method
+
+/// Returns the logarithm of the absolute value of the determinant of the factorized matrix.
+
+template <class T>
+double LUFactorization<T>::calculate_log_determinant(void) const
+{
+   const size_t size = LU_eigen.rows();
+
+   double log_determinant = 0.0;
+
+   for(size_t i = 0; i < size; i++)
+   {
+      log_determinant += log(fabs(static_cast<double>(LU_eigen.matrixLU()(i,i))));
+   }
+
+   return(log_determinant);
+}
+
+
+// CholeskyFactorization CONSTRUCTOR
+
+/// Factorizes a symmetric positive definite matrix.
+/// Use is_positive_definite() to check whether the factorization succeeded.
+/// @param matrix Matrix to be factorized.
+
+template <class T>
+CholeskyFactorization<T>::CholeskyFactorization(const Matrix<T>& matrix)
+{
+   const size_t rows_number = matrix.get_rows_number();
+   const size_t columns_number = matrix.get_columns_number();
+
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(rows_number != columns_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: CholeskyFactorization Template.\n"
+             << "CholeskyFactorization(const Matrix<T>&) constructor.\n"
+             << "Matrix must be square.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   const Eigen::Map<const EigenMatrix> matrix_eigen(matrix.data(), rows_number, columns_number);
+
+   LLT_eigen.compute(matrix_eigen);
+}
+
+
+// size_t get_size(void) const method
+
+/// Returns the number of rows and columns of the factorized matrix.
+
+template <class T>
+size_t CholeskyFactorization<T>::get_size(void) const
+{
+   return(LLT_eigen.rows());
+}
+
+
+// Matrix<T> arrange_lower_triangular(void) const method
+
+/// Returns the lower triangular factor L.
+
+template <class T>
+Matrix<T> CholeskyFactorization<T>::arrange_lower_triangular(void) const
+{
+   const size_t size = LLT_eigen.rows();
+
+   Matrix<T> lower_triangular(size, size);
+
+   Eigen::Map<EigenMatrix> lower_triangular_eigen(lower_triangular.data(), size, size);
+
+   lower_triangular_eigen = LLT_eigen.matrixL();
+
+   return(lower_triangular);
+}
+
+
+// bool is_positive_definite(void) const method
+
+/// Returns true if the factorized matrix is positive definite, that is, if the factorization succeeded.
+
+template <class T>
+bool CholeskyFactorization<T>::is_positive_definite(void) const
+{
+   return(LLT_eigen.info() == Eigen::Success);
+}
+
+
+// Vector<T> solve(const Vector<T>&) const method
+
+/// Solves A*x = b by forward and back substitution.
+/// @param b Independent terms vector.
+
+template <class T>
+Vector<T> CholeskyFactorization<T>::solve(const Vector<T>& b) const
+{
+   return(solve_factorization(LLT_eigen, b));
+}
+
+
+// Matrix<T> solve(const Matrix<T>&) const method
+
+/// Solves A*X = B, with one system for each column of B.
+/// @param b Independent terms matrix.
+
+template <class T>
+Matrix<T> CholeskyFactorization<T>::solve(const Matrix<T>& b) const
+{
+   return(solve_factorization(LLT_eigen, b));
+}
+
+
+// Matrix<T> calculate_inverse(void) const method
+
+/// Returns the inverse of the factorized matrix.
+
+template <class T>
+Matrix<T> CholeskyFactorization<T>::calculate_inverse(void) const
+{
+   const size_t size = LLT_eigen.rows();
+
+   Matrix<T> identity(size, size);
+
+   identity.initialize_identity();
+
+   return(solve(identity));
+}
+
+
+// T calculate_determinant(void) const method
+
+/// Returns the determinant of the factorized matrix, which is the squared product of the diagonal of L.
+
+template <class T>
+T CholeskyFactorization<T>::calculate_determinant(void) const
+{
+   const size_t size = LLT_eigen.rows();
+
+   T determinant = 1;
+
+   for(size_t i = 0; i < size; i++)
+   {
+      determinant *= LLT_eigen.matrixLLT()(i,i)*LLT_eigen.matrixLLT()(i,i);
+   }
+
+   return(determinant);
+}
+
+
+// double calculate_log_determinant(void) const method
+
+/// Returns the logarithm of the determinant of the factorized matrix.
+
+template <class T>
+double CholeskyFactorization<T>::calculate_log_determinant(void) const
+{
+   const size_t size = LLT_eigen.rows();
+
+   double log_determinant = 0.0;
+
+   for(size_t i = 0; i < size; i++)
+   {
+      log_determinant += 2.0*log(static_cast<double>(LLT_eigen.matrixLLT()(i,i)));
+   }
+
+   return(log_determinant);
+}
+
+
+// LDLTFactorization CONSTRUCTOR
+
+/// Factorizes a symmetric matrix.
+/// @param matrix Matrix to be factorized.
+
+template <class T>
+LDLTFactorization<T>::LDLTFactorization(const Matrix<T>& matrix)
+{
+   const size_t rows_number = matrix.get_rows_number();
+   const size_t columns_number = matrix.get_columns_number();
+
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(rows_number != columns_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: LDLTFactorization Template.\n"
+             << "LDLTFactorization(const Matrix<T>&) constructor.\n"
+             << "Matrix must be square.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   const Eigen::Map<const EigenMatrix> matrix_eigen(matrix.data(), rows_number, columns_number);
+
+   LDLT_eigen.compute(matrix_eigen);
+}
+
+
+// size_t get_size(void) const method
+
+/// Returns the number of rows and columns of the factorized matrix.
+
+template <class T>
+size_t LDLTFactorization<T>::get_size(void) const
+{
+   return(LDLT_eigen.rows());
+}
+
+
+// Vector<T> arrange_diagonal(void) const method
+
+/// Returns the diagonal of the factor D.
+
+template <class T>
+Vector<T> LDLTFactorization<T>::arrange_diagonal(void) const
+{
+   const size_t size = LDLT_eigen.rows();
+
+   Vector<T> diagonal(size);
+
+   for(size_t i = 0; i < size; i++)
+   {
+      diagonal[i] = LDLT_eigen.vectorD()(i);
+   }
+
+   return(diagonal);
+}
+
+
+// bool is_positive_definite(void) const method
+
+/// Returns true if all the entries of the factor D are positive, and false otherwise.
+
+template <class T>
+bool LDLTFactorization<T>::is_positive_definite(void) const
+{
+   const size_t size = LDLT_eigen.rows();
+
+   for(size_t i = 0; i < size; i++)
+   {
+      if(LDLT_eigen.vectorD()(i) <= 0)
+      {
+         return(false);
+      }
+   }
+
+   return(true);
+}
+
+
+// Vector<T> solve(const Vector<T>&) const method
+
+/// Solves A*x = b with the factorized matrix.
+/// @param b Independent terms vector.
+
+template <class T>
+Vector<T> LDLTFactorization<T>::solve(const Vector<T>& b) const
+{
+   return(solve_factorization(LDLT_eigen, b));
+}
+
+
+// Matrix<T> solve(const Matrix<T>&) const method
+
+/// Solves A*X = B, with one system for each column of B.
+/// @param b Independent terms matrix.
+
+template <class T>
+Matrix<T> LDLTFactorization<T>::solve(const Matrix<T>& b) const
+{
+   return(solve_factorization(LDLT_eigen, b));
+}
+
+
+// Matrix<T> calculate_inverse(void) const method
+
+/// Returns the inverse of the factorized matrix.
+
+template <class T>
+Matrix<T> LDLTFactorization<T>::calculate_inverse(void) const
+{
+   const size_t size = LDLT_eigen.rows();
+
+   Matrix<T> identity(size, size);
+
+   identity.initialize_identity();
+
+   return(solve(identity));
+}
+
+
+// T calculate_determinant(void) const method
+
+/// Returns the determinant of the factorized matrix, which is the product of the diagonal of D.
+
+template <class T>
+T LDLTFactorization<T>::calculate_determinant(void) const
+{
+   return(LDLT_eigen.vectorD().prod());
+}
+
+
+// double calculate_log_determinant(void) const method
+
+/// Returns the logarithm of the absolute value of the determinant of the factorized matrix.
+
+template <class T>
+double LDLTFactorization<T>::calculate_log_determinant(void) const
+{
+   const size_t size = LDLT_eigen.rows();
+
+   double log_determinant = 0.0;
+
+   for(size_t i = 0; i < size; i++)
+   {
+      log_determinant += log(fabs(static_cast<double>(LDLT_eigen.vectorD()(i))));
+   }
+
+   return(log_determinant);
+}
+
+
+///
+/// This template refers to a block of a matrix, such as a range of rows and columns, without copying or owning it.
+/// The elements of each column of the block are contiguous, and consecutive columns are a leading dimension apart.
+/// The referred matrix must outlive the view.
+///
+
+template <class T>
+class MatrixView
+{
+
+public:
+
+    // DEFAULT CONSTRUCTOR
+
+    explicit MatrixView(void);
+
+    // DATA CONSTRUCTOR
+
+    explicit MatrixView(const T*, const size_t&, const size_t&, const size_t&);
+
+    // MATRIX CONSTRUCTOR
+
+    MatrixView(const Matrix<T>&);
+
+    // GET METHODS
+
+    inline const size_t& get_rows_number(void) const;
+
+    inline const size_t& get_columns_number(void) const;
+
+    inline const size_t& get_leading_dimension(void) const;
+
+    inline const T& operator () (const size_t&, const size_t&) const;
+
+    VectorView<T> view_row(const size_t&) const;
+
+    VectorView<T> view_column(const size_t&) const;
+
+    MatrixView<T> view_submatrix(const size_t&, const size_t&, const size_t&, const size_t&) const;
+
+    Matrix<T> arrange_matrix(void) const;
+
+    // MATHEMATICAL METHODS
+
+    T calculate_sum(void) const;
+
+    Vector< Statistics<T> > calculate_statistics(void) const;
+
+    Vector<double> dot(const VectorView<double>&) const;
+
+private:
+
+    /// Pointer to the first element of the block.
+
+    const T* data;
+
+    /// Number of rows in the block.
+
+    size_t rows_number;
+
+    /// Number of columns in the block.
+
+    size_t columns_number;
+
+    /// Distance between the first elements of consecutive columns, which is the number of rows of the whole matrix.
+
+    size_t leading_dimension;
+};
+
+
+// DEFAULT CONSTRUCTOR
+
+/// Default constructor. It creates a view with no rows and no columns.
+
+template <class T>
+MatrixView<T>::MatrixView(void) : data(NULL), rows_number(0), columns_number(0), leading_dimension(0)
+{
+}
+
+
+// DATA CONSTRUCTOR
+
+/// Data constructor.
+/// @param new_data Pointer to the first element of the block.
+/// @param new_rows_number Number of rows in the block.
+/// @param new_columns_number Number of columns in the block.
+/// @param new_leading_dimension Distance between the first elements of consecutive columns.
+
+template <class T>
+MatrixView<T>::MatrixView(const T* new_data, const size_t& new_rows_number, const size_t& new_columns_number, const size_t& new_leading_dimension)
+    : data(new_data), rows_number(new_rows_number), columns_number(new_columns_number), leading_dimension(new_leading_dimension)
+{
+}
+
+
+// MATRIX CONSTRUCTOR
+
+/// Matrix constructor. It creates a view of a whole matrix.
+/// @param matrix Matrix to be referred.
+
+template <class T>
+MatrixView<T>::MatrixView(const Matrix<T>& matrix)
+    : data(matrix.data()), rows_number(matrix.get_rows_number()), columns_number(matrix.get_columns_number()), leading_dimension(matrix.get_rows_number())
+{
+}
+
+
+// const size_t& get_rows_number(void) const method
+
+/// Returns the number of rows in the block.
+
+template <class T>
+inline const size_t& MatrixView<T>::get_rows_number(void) const
+{
+    return(rows_number);
+}
+
+
+// const size_t& get_columns_number(void) const method
+
+/// Returns the number of columns in the block.
+
+template <class T>
+inline const size_t& MatrixView<T>::get_columns_number(void) const
+{
+    return(columns_number);
+}
+
+
+// const size_t& get_leading_dimension(void) const method
+
+/// Returns the distance between the first elements of consecutive columns in the underlying storage.
+
+template <class T>
+inline const size_t& MatrixView<T>::get_leading_dimension(void) const
+{
+    return(leading_dimension);
+}
+
+
+// const T& operator () (const size_t&, const size_t&) const method
+
+/// Returns the element (i,j) of the block.
+/// @param row Index of row in the block.
+/// @param column Index of column in the block.
+
+template <class T>
+inline const T& MatrixView<T>::operator () (const size_t& row, const size_t& column) const
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(row >= rows_number || column >= columns_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: MatrixView Template.\n"
+             << "const T& operator () (const size_t&, const size_t&) const method.\n"
+             << "Element (" << row << "," << column << ") must be inside the view (" << rows_number << "," << columns_number << ").\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+    return(data[column*leading_dimension + row]);
+}
+
+
+// VectorView<T> view_row(const size_t&) const method
+
+/// Returns a view of a row of the block.
+/// @param row_index Index of row in the block.
+
+template <class T>
+VectorView<T> MatrixView<T>::view_row(const size_t& row_index) const
+{
+    return(VectorView<T>(data + row_index, columns_number, leading_dimension));
+}
+
+
+// VectorView<T> view_column(const size_t&) const method
+
+/// Returns a view of a column of the block, whose elements are contiguous.
+/// @param column_index Index of column in the block.
+
+template <class T>
+VectorView<T> MatrixView<T>::view_column(const size_t& column_index) const
+{
+    return(VectorView<T>(data + column_index*leading_dimension, rows_number, 1));
+}
+
+
+// MatrixView<T> view_submatrix(const size_t&, const size_t&, const size_t&, const size_t&) const method
+
+/// Returns a view of a block of this block.
+/// @param first_row Index of the first row of the block.
+/// @param first_column Index of the first column of the block.
+/// @param block_rows_number Number of rows in the block.
+/// @param block_columns_number Number of columns in the block.
+
+template <class T>
+MatrixView<T> MatrixView<T>::view_submatrix(const size_t& first_row, const size_t& first_column,
+                                            const size_t& block_rows_number, const size_t& block_columns_number) const
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(first_row + block_rows_number > rows_number || first_column + block_columns_number > columns_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: MatrixView Template.\n"
+             << "MatrixView<T> view_submatrix(const size_t&, const size_t&, const size_t&, const size_t&) const method.\n"
+             << "Block must be inside the view.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+    return(MatrixView<T>(data + first_column*leading_dimension + first_row, block_rows_number, block_columns_number, leading_dimension));
+}
+
+
+// Matrix<T> arrange_matrix(void) const method
+
+/// Returns a new matrix with a copy of the elements of the block.
+
+template <class T>
+Matrix<T> MatrixView<T>::arrange_matrix(void) const
+{
+    Matrix<T> matrix(rows_number, columns_number);
+
+    for(size_t j = 0; j < columns_number; j++)
+    {
+        std::copy(data + j*leading_dimension, data + j*leading_dimension + rows_number, matrix.begin() + j*rows_number);
+    }
+
+    return(matrix);
+}
+
+
+// T calculate_sum(void) const method
+
+/// Returns the sum of all the elements of the block.
+
+template <class T>
+T MatrixView<T>::calculate_sum(void) const
+{
+    T sum = 0;
+
+    for(size_t j = 0; j < columns_number; j++)
+    {
+        sum += view_column(j).calculate_sum();
+    }
+
+    return(sum);
+}
+
+
+// Vector< Statistics<T> > calculate_statistics(void) const method
+
+/// Returns the minimum, maximum, mean and standard deviation of each column of the block.
+
+template <class T>
+Vector< Statistics<T> > MatrixView<T>::calculate_statistics(void) const
+{
+    Vector< Statistics<T> > statistics(columns_number);
+
+    for(size_t j = 0; j < columns_number; j++)
+    {
+        statistics[j] = view_column(j).calculate_statistics();
+    }
+
+    return(statistics);
+}
+
+
+// Vector<double> dot(const VectorView<double>&) const method
+
+/// Returns the product of the block with a vector, given by a view of it.
+/// @param vector_view View of the vector, whose size must be the number of columns of the block.
+
+template <class T>
+Vector<double> MatrixView<T>::dot(const VectorView<double>& vector_view) const
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(vector_view.size() != columns_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: MatrixView Template.\n"
+             << "Vector<double> dot(const VectorView<double>&) const method.\n"
+             << "Size of view must be equal to number of columns.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   Vector<double> product(rows_number);
+
+   const Eigen::Map<const Eigen::MatrixXd, 0, Eigen::OuterStride<> > matrix_eigen(data, rows_number, columns_number, Eigen::OuterStride<>(leading_dimension));
+   const Eigen::Map<const Eigen::VectorXd, 0, Eigen::InnerStride<> > vector_eigen(vector_view.get_data(), columns_number, Eigen::InnerStride<>(vector_view.get_stride()));
+   Eigen::Map<Eigen::VectorXd> product_eigen(product.data(), rows_number);
+
+   product_eigen = matrix_eigen*vector_eigen;
+
+   return(product);
+}
+
+
 } // end namespace
 
 #endif
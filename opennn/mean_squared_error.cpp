@@ -206,7 +206,7 @@ void MeanSquaredError::check(void) const
 
 double MeanSquaredError::calculate_performance(void) const
 {
-   // Control sentence
+   // Control sentence (if debug)
 
    #ifdef __OPENNN_DEBUG__ 
 
@@ -214,69 +214,17 @@ double MeanSquaredError::calculate_performance(void) const
 
    #endif
 
-   // Neural network stuff 
-
-   const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
-
-   const size_t inputs_number = multilayer_perceptron_pointer->get_inputs_number();
-   const size_t outputs_number = multilayer_perceptron_pointer->get_outputs_number();
-
-   // Data set stuff 
+   // Data set stuff
 
    const Instances& instances = data_set_pointer->get_instances();
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
-   const MissingValues& missing_values = data_set_pointer->get_missing_values();
-
-   // Mean squared error stuff
-
-   Vector<double> inputs(inputs_number);
-   Vector<double> outputs(outputs_number);
-   Vector<double> targets(outputs_number);
-
-   int i = 0;
-
-   double sum_squared_error = 0.0;
-
-   #pragma omp parallel for private(i, training_index, inputs, outputs, targets) reduction(+:sum_squared_error)
-
-   for(i = 0; i < (int)training_instances_number; i++)
-   {
-       training_index = training_indices[i];
+   const Vector<size_t>& training_indices = instances.arrange_training_indices();
 
-       if(missing_values.has_missing_values(training_index))
-       {
-           continue;
-       }
-
-      // Input vector
-
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
-
-      // Output vector
-
-      outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
-
-      // Target vector
-
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
-
-      // Sum squared error
-
-	  sum_squared_error += outputs.calculate_sum_squared_error(targets);
-   }
+   // Mean squared error
 
-   return(sum_squared_error/(double)training_instances_number);
+   return(calculate_error_sum(training_indices)/(double)training_instances_number);
 }
 
 
@@ -328,16 +276,7 @@ double MeanSquaredError::calculate_performance(const Vector<double>& parameters)
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
-   const MissingValues& missing_values = data_set_pointer->get_missing_values();
+   const size_t complete_training_instances_number = data_set_pointer->count_training_rows_number();
 
    // Mean squared error stuff
 
@@ -349,29 +288,18 @@ double MeanSquaredError::calculate_performance(const Vector<double>& parameters)
 
    int i = 0;
 
-   #pragma omp parallel for private(i, training_index, inputs, outputs, targets) reduction(+:sum_squared_error)
+   #pragma omp parallel for private(i, inputs, outputs, targets) reduction(+:sum_squared_error)
 
-   for(i = 0; i < (int)training_instances_number; i++)
+   for(i = 0; i < (int)complete_training_instances_number; i++)
    {
-       training_index = training_indices[i];
+      // Input and target vectors
 
-       if(missing_values.has_missing_values(training_index))
-       {
-           continue;
-       }
-
-      // Input vector
-
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+      data_set_pointer->arrange_training_row(i, inputs, targets);
 
       // Output vector
 
       outputs = multilayer_perceptron_pointer->calculate_outputs(inputs, parameters);
 
-      // Target vector
-
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
-
       // Sum squared error
 
       sum_squared_error += outputs.calculate_sum_squared_error(targets);
@@ -396,10 +324,7 @@ double MeanSquaredError::calculate_generalization_performance(void) const
 
    #endif
 
-   const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
-
-   const size_t inputs_number = multilayer_perceptron_pointer->get_inputs_number();
-   const size_t outputs_number = multilayer_perceptron_pointer->get_outputs_number();
+   // Data set stuff
 
    const Instances& instances = data_set_pointer->get_instances();
 
@@ -410,55 +335,97 @@ double MeanSquaredError::calculate_generalization_performance(void) const
       return(0.0);
    }
 
-   const Vector<size_t> generalization_indices = instances.arrange_generalization_indices();
+   const Vector<size_t>& generalization_indices = instances.arrange_generalization_indices();
 
-   size_t generalization_index;
+   // Mean squared error
 
-   const Variables& variables = data_set_pointer->get_variables();
+   return(calculate_error_sum(generalization_indices)/(double)generalization_instances_number);
+}
 
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
 
-   const MissingValues& missing_values = data_set_pointer->get_missing_values();
+// double calculate_batch_error(const Matrix<double>&, const Matrix<double>&) const method
 
+/// Returns the sum squared error of a batch of instances. 
+/// The mean is taken once all the batches have been added up.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
 
-      Vector<double> inputs(inputs_number);
-      Vector<double> outputs(outputs_number);
-      Vector<double> targets(outputs_number);
+double MeanSquaredError::calculate_batch_error(const Matrix<double>& outputs, const Matrix<double>& targets) const
+{
+   return(outputs.calculate_sum_squared_error(targets));
+}
 
-      double generalization_performance = 0.0;
 
-      int i = 0;
+// Matrix<double> calculate_batch_output_gradient(const Matrix<double>&, const Matrix<double>&) const method
 
-      #pragma omp parallel for private(i, generalization_index, inputs, outputs, targets) reduction(+:generalization_performance)
+/// Returns the derivatives of the squared error of each instance in a batch with respect to its outputs.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
 
-      for(i = 0; i < (int)generalization_instances_number; i++)
-      {
-          generalization_index = generalization_indices[i];
+Matrix<double> MeanSquaredError::calculate_batch_output_gradient(const Matrix<double>& outputs, const Matrix<double>& targets) const
+{
+   return((outputs.lazy() - targets.lazy())*2.0);
+}
 
-          if(missing_values.has_missing_values(generalization_index))
-          {
-              continue;
-          }
 
-         // Input vector
+// Matrix<double> calculate_batch_terms_output_gradient(const Matrix<double>&, const Matrix<double>&) const method
 
-         inputs = data_set_pointer->get_instance(generalization_index, inputs_indices);
+/// Returns the derivatives of the norm of the errors of each instance in a batch with respect to its outputs.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
 
-         // Output vector
+Matrix<double> MeanSquaredError::calculate_batch_terms_output_gradient(const Matrix<double>& outputs, const Matrix<double>& targets) const
+{
+   const size_t instances_number = outputs.get_rows_number();
+   const size_t outputs_number = outputs.get_columns_number();
 
-         outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
+   Matrix<double> terms_output_gradient = outputs-targets;
 
-         // Target vector
+   double term_norm;
 
-         targets = data_set_pointer->get_instance(generalization_index, targets_indices);
+   for(size_t i = 0; i < instances_number; i++)
+   {
+      term_norm = 0.0;
+
+      for(size_t j = 0; j < outputs_number; j++)
+      {
+         term_norm += terms_output_gradient(i,j)*terms_output_gradient(i,j);
+      }
 
-         // Sum of squares error
+      term_norm = sqrt(term_norm);
 
-         generalization_performance += outputs.calculate_sum_squared_error(targets);
+      for(size_t j = 0; j < outputs_number; j++)
+      {
+         terms_output_gradient(i,j) = (term_norm == 0.0) ? 0.0 : terms_output_gradient(i,j)/term_norm;
       }
+   }
+
+   return(terms_output_gradient);
+}
+
+
+// Vector<double> calculate_batch_terms(const Matrix<double>&, const Matrix<double>&) const method
+
+/// Returns the norm of the errors of each instance in a batch.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
+
+Vector<double> MeanSquaredError::calculate_batch_terms(const Matrix<double>& outputs, const Matrix<double>& targets) const
+{
+   return((outputs-targets).calculate_rows_norm());
+}
+
+
+// Matrix<double> calculate_batch_output_Hessian_dot(const Matrix<double>&, const Matrix<double>&, const Matrix<double>&) const method
 
-      return(generalization_performance/(double)generalization_instances_number);
+/// Returns the product of the Hessian of the squared error of each instance in a batch with respect to its outputs 
+/// with a direction in the outputs space. 
+/// That Hessian is twice the identity, so the targets are not needed.
+/// @param outputs_direction Direction of each instance in the outputs space, with one instance per row.
+
+Matrix<double> MeanSquaredError::calculate_batch_output_Hessian_dot(const Matrix<double>&, const Matrix<double>&, const Matrix<double>& outputs_direction) const
+{
+   return(outputs_direction*2.0);
 }
 
 
@@ -477,25 +444,33 @@ Vector<double> MeanSquaredError::calculate_gradient(void) const
 
    #endif
 
-   // Multilayer percepron stuff
+   // Data set stuff
 
-   const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
+   const Instances& instances = data_set_pointer->get_instances();
 
-   const size_t inputs_number = multilayer_perceptron_pointer->get_inputs_number();
-   const size_t outputs_number = multilayer_perceptron_pointer->get_outputs_number();
+   const size_t training_instances_number = instances.count_training_instances_number();
 
-   const size_t layers_number = multilayer_perceptron_pointer->get_layers_number();
+   const Vector<size_t>& training_indices = instances.arrange_training_indices();
 
-   const size_t parameters_number = multilayer_perceptron_pointer->count_parameters_number();
+   // Mean squared error stuff
+
+   return(calculate_error_gradient_sum(training_indices)/(double)training_instances_number);
+}
 
-   Vector< Vector< Vector<double> > > first_order_forward_propagation(2); 
 
-   const bool has_conditions_layer = neural_network_pointer->has_conditions_layer();
+// FirstOrderPerformance calculate_performance_and_gradient(void) const method
 
-   const ConditionsLayer* conditions_layer_pointer = has_conditions_layer ? neural_network_pointer->get_conditions_layer_pointer() : NULL;
+/// Returns the mean squared error and its gradient, computed from a single forward propagation of the training instances.
 
-   Vector<double> particular_solution;
-   Vector<double> homogeneous_solution;
+PerformanceTerm::FirstOrderPerformance MeanSquaredError::calculate_performance_and_gradient(void) const
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__ 
+
+   check();
+
+   #endif
 
    // Data set stuff
 
@@ -503,76 +478,63 @@ Vector<double> MeanSquaredError::calculate_gradient(void) const
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
+   const Vector<size_t>& training_indices = instances.arrange_training_indices();
 
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
+   // Mean squared error stuff
 
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
+   FirstOrderPerformance first_order_performance = calculate_error_sum_and_gradient_sum(training_indices);
 
-   const MissingValues& missing_values = data_set_pointer->get_missing_values();
+   first_order_performance.performance /= (double)training_instances_number;
+   first_order_performance.gradient /= (double)training_instances_number;
 
-   Vector<double> inputs(inputs_number);
-   Vector<double> targets(outputs_number);
+   return(first_order_performance);
+}
 
-   // Mean squared error stuff
 
-   Vector< Vector<double> > layers_delta; 
+// Vector<double> calculate_vector_dot_Hessian(const Vector<double>&) const method
 
-   Vector<double> output_gradient(outputs_number);
+/// Returns the product of the mean squared error Hessian with a vector, without forming the Hessian matrix.
+/// It uses the R-operator on the training instances, whose cost is about that of two gradient evaluations.
+/// @param vector Vector in the dot product, with size the number of parameters. 
 
-   Vector<double> point_gradient(parameters_number, 0.0);
+Vector<double> MeanSquaredError::calculate_vector_dot_Hessian(const Vector<double>& vector) const
+{
+   #ifdef __OPENNN_DEBUG__
 
-   Vector<double> gradient(parameters_number, 0.0);
+   check();
 
-   int i = 0;
+   #endif
 
-   #pragma omp parallel for private(i, training_index, inputs, targets, first_order_forward_propagation, \
-    output_gradient, layers_delta, particular_solution, homogeneous_solution, point_gradient)
+   // Data set stuff
 
-   for(i = 0; i < (int)training_instances_number; i++)
-   {
-       training_index = training_indices[i];
+   const Instances& instances = data_set_pointer->get_instances();
 
-       if(missing_values.has_missing_values(training_index))
-       {
-           continue;
-       }
+   const size_t training_instances_number = instances.count_training_instances_number();
 
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+   const Vector<size_t>& training_indices = instances.arrange_training_indices();
 
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
+   // Mean squared error stuff
 
-      first_order_forward_propagation = multilayer_perceptron_pointer->calculate_first_order_forward_propagation(inputs);
+   return(calculate_error_vector_dot_Hessian_sum(training_indices, vector)/(double)training_instances_number);
+}
 
-	  const Vector< Vector<double> >& layers_activation = first_order_forward_propagation[0];
-      const Vector< Vector<double> >& layers_activation_derivative = first_order_forward_propagation[1];
 
-      if(!has_conditions_layer)
-      {
-         output_gradient = (layers_activation[layers_number-1]-targets)*(2.0/(double)training_instances_number);
+// double calculate_error_normalization_coefficient(void) const method
 
-         layers_delta = calculate_layers_delta(layers_activation_derivative, output_gradient);
-      }
-      else
-      {
-         particular_solution = conditions_layer_pointer->calculate_particular_solution(inputs);
-         homogeneous_solution = conditions_layer_pointer->calculate_homogeneous_solution(inputs);
+/// Returns the coefficient which divides the sum of the training errors to give the mean squared error, 
+/// which is the number of training instances.
 
-         output_gradient = (particular_solution+homogeneous_solution*layers_activation[layers_number-1] - targets)*(2.0/(double)training_instances_number);
+double MeanSquaredError::calculate_error_normalization_coefficient(void) const
+{
+   #ifdef __OPENNN_DEBUG__
 
-         layers_delta = calculate_layers_delta(layers_activation_derivative, homogeneous_solution, output_gradient);
-      }
+   check();
 
-      point_gradient = calculate_point_gradient(inputs, layers_activation, layers_delta);
+   #endif
 
-      #pragma omp critical
-      gradient += point_gradient;
-   }
+   const Instances& instances = data_set_pointer->get_instances();
 
-   return(gradient);
+   return((double)instances.count_training_instances_number());
 }
 
 
@@ -590,7 +552,8 @@ Matrix<double> MeanSquaredError::calculate_Hessian(void) const
 
 // FirstOrderPerformance calculate_first_order_performance(void) const method
 
-/// @todo
+/// Returns the mean squared error and its gradient. 
+/// See calculate_performance_and_gradient().
 
 PerformanceTerm::FirstOrderPerformance MeanSquaredError::calculate_first_order_performance(void) const
 {
@@ -602,12 +565,7 @@ PerformanceTerm::FirstOrderPerformance MeanSquaredError::calculate_first_order_p
 
     #endif
 
-   FirstOrderPerformance first_order_performance;
-
-   first_order_performance.performance = calculate_performance();
-   first_order_performance.gradient = calculate_gradient();
-
-   return(first_order_performance);
+   return(calculate_performance_and_gradient());
 }
 
 
@@ -663,14 +621,14 @@ Vector<double> MeanSquaredError::calculate_terms(void) const
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
+   const Vector<size_t>& training_indices = instances.arrange_training_indices();
 
    size_t training_index;
 
    const Variables& variables = data_set_pointer->get_variables();
 
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
+   const Vector<size_t>& inputs_indices = variables.arrange_inputs_indices();
+   const Vector<size_t>& targets_indices = variables.arrange_targets_indices();
 
    const MissingValues& missing_values = data_set_pointer->get_missing_values();
 
@@ -778,153 +736,79 @@ Matrix<double> MeanSquaredError::calculate_terms_Jacobian(void) const
 
    #endif
 
-   // Neural network stuff
-
-   const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
-
-   const size_t inputs_number = multilayer_perceptron_pointer->get_inputs_number();
-   const size_t outputs_number = multilayer_perceptron_pointer->get_outputs_number();
-
-   const size_t layers_number = multilayer_perceptron_pointer->get_layers_number();
-
-   const size_t neural_parameters_number = multilayer_perceptron_pointer->count_parameters_number();
-
-   Vector< Vector< Vector<double> > > first_order_forward_propagation(2);
-
-   Vector<double> particular_solution;
-   Vector<double> homogeneous_solution;
-
-   const bool has_conditions_layer = neural_network_pointer->has_conditions_layer();
-
-   const ConditionsLayer* conditions_layer_pointer = has_conditions_layer ? neural_network_pointer->get_conditions_layer_pointer() : NULL;
-
    // Data set stuff
 
    const Instances& instances = data_set_pointer->get_instances();
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
-   const MissingValues& missing_values = data_set_pointer->get_missing_values();
-
-   Vector<double> inputs(inputs_number);
-   Vector<double> targets(outputs_number);
-
-   // Performance functional
-
-   Vector<double> term(outputs_number);
-   double term_norm;
-
-   Vector<double> output_gradient(outputs_number);
-
-   Vector< Vector<double> > layers_delta(layers_number);
-   Vector<double> point_gradient(neural_parameters_number);
-
-   Matrix<double> terms_Jacobian(training_instances_number, neural_parameters_number);
+   const Vector<size_t>& training_indices = instances.arrange_training_indices();
 
-   // Main loop
-
-   int i = 0;
+   // Mean squared error stuff
 
-#pragma omp parallel for private(i, training_index, inputs, targets, first_order_forward_propagation,  \
- term, term_norm, output_gradient, layers_delta, particular_solution, homogeneous_solution, point_gradient)
+   return(calculate_error_terms_Jacobian(training_indices)/sqrt((double)training_instances_number));
+}
 
-   for(i = 0; i < (int)training_instances_number; i++)
-   {
-       training_index = training_indices[i];
 
-       if(missing_values.has_missing_values(training_index))
-       {
-           continue;
-       }
-
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+// FirstOrderTerms calculate_first_order_terms(void) const method
 
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
+/// Returns a first order terms performance structure, which contains the values and the Jacobian of the performance terms function.
 
-      first_order_forward_propagation = multilayer_perceptron_pointer->calculate_first_order_forward_propagation(inputs);
+/// @todo
 
-      const Vector< Vector<double> >& layers_activation = first_order_forward_propagation[0];
-      const Vector< Vector<double> >& layers_activation_derivative = first_order_forward_propagation[1];
+MeanSquaredError::FirstOrderTerms MeanSquaredError::calculate_first_order_terms(void) const
+{
+    // Control sentence (if debug)
 
-      if(!has_conditions_layer)
-      {
-         const Vector<double>& outputs = first_order_forward_propagation[0][layers_number-1]; 
+    #ifdef __OPENNN_DEBUG__
 
-         term = (outputs-targets);
-         term_norm = term.calculate_norm();
+    check();
 
-         if(term_norm == 0.0)
-         {
-             output_gradient.set(outputs_number, 0.0);
-         }
-         else
-         {
-            output_gradient = term/term_norm;
-         }
+    #endif
 
-         layers_delta = calculate_layers_delta(layers_activation_derivative, output_gradient);
-      }
-      else
-      {
-         particular_solution = conditions_layer_pointer->calculate_particular_solution(inputs);
-         homogeneous_solution = conditions_layer_pointer->calculate_homogeneous_solution(inputs);
+   FirstOrderTerms first_order_terms;
 
-         term = (particular_solution+homogeneous_solution*layers_activation[layers_number-1] - targets)/sqrt((double)training_instances_number);              
-         term_norm = term.calculate_norm();
+   first_order_terms.terms = calculate_terms();
 
-         if(term_norm == 0.0)
-         {
-             output_gradient.set(outputs_number, 0.0);
-         }
-         else
-         {
-            output_gradient = term/term_norm;
-         }
+   first_order_terms.Jacobian = calculate_terms_Jacobian();
 
-         layers_delta = calculate_layers_delta(layers_activation_derivative, homogeneous_solution, output_gradient);
-	  }
+   return(first_order_terms);
+}
 
-      point_gradient = calculate_point_gradient(inputs, layers_activation, layers_delta);
 
-      terms_Jacobian.set_row(i, point_gradient);
-  }
+// SecondOrderTerms calculate_second_order_terms(void) const method
 
-   return(terms_Jacobian/sqrt((double)training_instances_number));
-}
+/// Returns the mean squared error of the training instances, together with the products of the transposed terms Jacobian 
+/// with the terms and with itself. 
+/// The products are accumulated by batches of instances, so the terms Jacobian is never built.
 
+MeanSquaredError::SecondOrderTerms MeanSquaredError::calculate_second_order_terms(void) const
+{
+   // Control sentence
 
-// FirstOrderTerms calculate_first_order_terms(void) const method
+   #ifdef __OPENNN_DEBUG__ 
 
-/// Returns a first order terms performance structure, which contains the values and the Jacobian of the performance terms function.
+   check();
 
-/// @todo
+   #endif
 
-MeanSquaredError::FirstOrderTerms MeanSquaredError::calculate_first_order_terms(void) const
-{
-    // Control sentence (if debug)
+   // Data set stuff
 
-    #ifdef __OPENNN_DEBUG__
+   const Instances& instances = data_set_pointer->get_instances();
 
-    check();
+   const size_t training_instances_number = instances.count_training_instances_number();
 
-    #endif
+   const Vector<size_t>& training_indices = instances.arrange_training_indices();
 
-   FirstOrderTerms first_order_terms;
+   // Mean squared error stuff
 
-   first_order_terms.terms = calculate_terms();
+   SecondOrderTerms second_order_terms = calculate_error_second_order_terms(training_indices);
 
-   first_order_terms.Jacobian = calculate_terms_Jacobian();
+   second_order_terms.performance /= (double)training_instances_number;
+   second_order_terms.JacobianT_dot_terms /= (double)training_instances_number;
+   second_order_terms.JacobianT_dot_Jacobian /= (double)training_instances_number;
 
-   return(first_order_terms);
+   return(second_order_terms);
 }
 
 
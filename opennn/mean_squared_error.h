@@ -94,11 +94,25 @@ public:
 
    Vector<double> calculate_gradient(void) const;
 
+   FirstOrderPerformance calculate_performance_and_gradient(void) const;
+
+   Vector<double> calculate_vector_dot_Hessian(const Vector<double>&) const;
+
+   double calculate_error_normalization_coefficient(void) const;
+
    Matrix<double> calculate_Hessian(void) const;
 
    FirstOrderPerformance calculate_first_order_performance(void) const;
    SecondOrderPerformance calculate_second_order_performance(void) const;
 
+   // Batch kernel methods
+
+   double calculate_batch_error(const Matrix<double>&, const Matrix<double>&) const;
+   Matrix<double> calculate_batch_output_gradient(const Matrix<double>&, const Matrix<double>&) const;
+   Matrix<double> calculate_batch_terms_output_gradient(const Matrix<double>&, const Matrix<double>&) const;
+   Vector<double> calculate_batch_terms(const Matrix<double>&, const Matrix<double>&) const;
+   Matrix<double> calculate_batch_output_Hessian_dot(const Matrix<double>&, const Matrix<double>&, const Matrix<double>&) const;
+
    // Objective terms methods
 
    Vector<double> calculate_terms(void) const;
@@ -108,6 +122,8 @@ public:
 
    FirstOrderTerms calculate_first_order_terms(void) const;
 
+   SecondOrderTerms calculate_second_order_terms(void) const;
+
    std::string write_performance_term_type(void) const;
 
    // Serialization methods
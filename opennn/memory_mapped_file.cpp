@@ -0,0 +1,374 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.artelnics.com/opennn                                                                                   */
+/*                                                                                                              */
+/*   M E M O R Y   M A P P E D   F I L E   C L A S S                                                            */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   Artelnics - Making intelligent use of data                                                                 */
+/*   robertolopez@artelnics.com                                                                                 */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// OpenNN includes
+
+#include "memory_mapped_file.h"
+
+// System includes
+
+#if defined(_WIN32)
+   #ifndef NOMINMAX
+      #define NOMINMAX
+   #endif
+   #ifndef WIN32_LEAN_AND_MEAN
+      #define WIN32_LEAN_AND_MEAN
+   #endif
+   #include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__)
+   #include <fcntl.h>
+   #include <sys/mman.h>
+   #include <sys/stat.h>
+   #include <unistd.h>
+#endif
+
+namespace OpenNN
+{
+
+// DEFAULT CONSTRUCTOR
+
+/// Default constructor.
+/// It creates a memory mapped file object which is not associated to any file.
+
+MemoryMappedFile::MemoryMappedFile(void)
+   : data(NULL), size(0), file_buffer(NULL)
+{
+}
+
+
+// FILE CONSTRUCTOR
+
+/// File constructor.
+/// It creates a memory mapped file object and maps the contents of a given file.
+/// @param new_file_name Name of the file to be mapped.
+
+MemoryMappedFile::MemoryMappedFile(const std::string& new_file_name)
+   : data(NULL), size(0), file_buffer(NULL)
+{
+   open(new_file_name);
+}
+
+
+// DESTRUCTOR
+
+/// Destructor.
+/// It unmaps the file, if any.
+
+MemoryMappedFile::~MemoryMappedFile(void)
+{
+   close();
+}
+
+
+// bool is_open(void) const method
+
+/// Returns true if the object is associated to a file, and false otherwise.
+
+bool MemoryMappedFile::is_open(void) const
+{
+   return(data != NULL);
+}
+
+
+// const char* get_data(void) const method
+
+/// Returns a pointer to the first byte of the file contents.
+/// The contents are not null terminated, and they are valid until the file is closed.
+
+const char* MemoryMappedFile::get_data(void) const
+{
+   return(data);
+}
+
+
+// const size_t& get_size(void) const method
+
+/// Returns the size of the file in bytes.
+
+const size_t& MemoryMappedFile::get_size(void) const
+{
+   return(size);
+}
+
+
+// const std::string& get_file_name(void) const method
+
+/// Returns the name of the mapped file.
+
+const std::string& MemoryMappedFile::get_file_name(void) const
+{
+   return(file_name);
+}
+
+
+// void open(const std::string&) method
+
+/// Maps the contents of a given file for reading.
+/// Any file previously mapped by this object is closed first.
+/// It throws an exception if the file cannot be opened.
+/// @param new_file_name Name of the file to be mapped.
+
+void MemoryMappedFile::open(const std::string& new_file_name)
+{
+   close();
+
+   file_name = new_file_name;
+
+   // Empty files cannot be mapped, but they are valid files
+
+   static const char empty_data[1] = {'\0'};
+
+   bool opened = false;
+
+   #if defined(_WIN32)
+
+   const HANDLE file_handle = CreateFileA(file_name.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+   if(file_handle != INVALID_HANDLE_VALUE)
+   {
+      LARGE_INTEGER file_size;
+
+      if(GetFileSizeEx(file_handle, &file_size))
+      {
+         size = (size_t)file_size.QuadPart;
+
+         if(size == 0)
+         {
+            data = empty_data;
+            opened = true;
+         }
+         else
+         {
+            const HANDLE mapping_handle = CreateFileMappingA(file_handle, NULL, PAGE_READONLY, 0, 0, NULL);
+
+            if(mapping_handle != NULL)
+            {
+               data = (const char*)MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0);
+
+               opened = (data != NULL);
+
+               // The view keeps the mapping alive
+
+               CloseHandle(mapping_handle);
+            }
+         }
+      }
+
+      CloseHandle(file_handle);
+   }
+
+   #elif defined(__unix__) || defined(__APPLE__)
+
+   const int file_descriptor = ::open(file_name.c_str(), O_RDONLY);
+
+   if(file_descriptor != -1)
+   {
+      struct stat file_status;
+
+      if(fstat(file_descriptor, &file_status) == 0)
+      {
+         size = (size_t)file_status.st_size;
+
+         if(size == 0)
+         {
+            data = empty_data;
+            opened = true;
+         }
+         else
+         {
+            void* address = mmap(NULL, size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+
+            if(address != MAP_FAILED)
+            {
+               // The whole file is going to be read from the beginning to the end
+
+               madvise(address, size, MADV_SEQUENTIAL);
+
+               data = (const char*)address;
+               opened = true;
+            }
+         }
+      }
+
+      // The mapping keeps the file alive
+
+      ::close(file_descriptor);
+   }
+
+   #else
+
+   std::ifstream file(file_name.c_str(), std::ios::binary);
+
+   if(file.is_open())
+   {
+      file.seekg(0, std::ios::end);
+      size = (size_t)file.tellg();
+      file.seekg(0, std::ios::beg);
+
+      if(size == 0)
+      {
+         data = empty_data;
+      }
+      else
+      {
+         file_buffer = new char[size];
+
+         file.read(file_buffer, size);
+
+         data = file_buffer;
+      }
+
+      opened = true;
+   }
+
+   #endif
+
+   if(!opened)
+   {
+      data = NULL;
+      size = 0;
+
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: MemoryMappedFile class.\n"
+             << "void open(const std::string&) method.\n"
+             << "Cannot open file: " << file_name << "\n";
+
+      throw std::logic_error(buffer.str());
+   }
+}
+
+
+// void close(void) method
+
+/// Unmaps the file, if any, and releases the associated resources.
+
+void MemoryMappedFile::close(void)
+{
+   if(file_buffer != NULL)
+   {
+      delete [] file_buffer;
+   }
+   else if(data != NULL && size != 0)
+   {
+      #if defined(_WIN32)
+
+      UnmapViewOfFile(data);
+
+      #elif defined(__unix__) || defined(__APPLE__)
+
+      munmap((void*)data, size);
+
+      #endif
+   }
+
+   data = NULL;
+   size = 0;
+   file_buffer = NULL;
+}
+
+
+// void prefetch(const size_t&, const size_t&) const method
+
+/// Asks the operating system to start reading a range of the file into memory in the background,
+/// so that it is resident when it is accessed.
+/// It has no effect if the file is not memory mapped.
+/// @param position Position of the first byte of the range.
+/// @param bytes_number Number of bytes in the range.
+
+void MemoryMappedFile::prefetch(const size_t& position, const size_t& bytes_number) const
+{
+   #if defined(__unix__) || defined(__APPLE__)
+
+   if(file_buffer != NULL || data == NULL || position >= size || bytes_number == 0)
+   {
+      return;
+   }
+
+   const size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+
+   // The range is extended to whole pages
+
+   const size_t begin = position - position%page_size;
+   const size_t end = std::min(position + bytes_number, size);
+
+   madvise((void*)(data + begin), end - begin, MADV_WILLNEED);
+
+   #else
+
+   (void)position;
+   (void)bytes_number;
+
+   #endif
+}
+
+
+// void release(const size_t&, const size_t&) const method
+
+/// Tells the operating system that a range of the file is not going to be accessed soon,
+/// so that its pages can be removed from the memory of the process.
+/// The contents are read again from the file if the range is accessed later.
+/// It has no effect if the file is not memory mapped.
+/// @param position Position of the first byte of the range.
+/// @param bytes_number Number of bytes in the range.
+
+void MemoryMappedFile::release(const size_t& position, const size_t& bytes_number) const
+{
+   #if defined(__unix__) || defined(__APPLE__)
+
+   if(file_buffer != NULL || data == NULL || position >= size || bytes_number == 0)
+   {
+      return;
+   }
+
+   const size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+
+   // Only the pages which lie entirely within the range are released
+
+   const size_t begin = ((position + page_size - 1)/page_size)*page_size;
+   const size_t end = std::min(position + bytes_number, size);
+
+   const size_t last = end == size ? end : end - end%page_size;
+
+   if(last > begin)
+   {
+      madvise((void*)(data + begin), last - begin, MADV_DONTNEED);
+   }
+
+   #else
+
+   (void)position;
+   (void)bytes_number;
+
+   #endif
+}
+
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (c) 2005-2015 Roberto Lopez.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -0,0 +1,120 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.artelnics.com/opennn                                                                                   */
+/*                                                                                                              */
+/*   M E M O R Y   M A P P E D   F I L E   C L A S S   H E A D E R                                              */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   Artelnics - Making intelligent use of data                                                                 */
+/*   robertolopez@artelnics.com                                                                                 */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __MEMORYMAPPEDFILE_H__
+#define __MEMORYMAPPEDFILE_H__
+
+// System includes
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <sstream>
+#include <stdexcept>
+#include <cstddef>
+#include <algorithm>
+
+namespace OpenNN
+{
+
+/// This class gives read-only access to the whole contents of a file as a contiguous block of memory.
+/// On POSIX and Windows systems the file is mapped into the address space of the process,
+/// so that its pages are loaded by the operating system on demand and no copy is made.
+/// On other systems the file is read into a buffer owned by the object.
+
+class MemoryMappedFile
+{
+
+public:
+
+   // DEFAULT CONSTRUCTOR
+
+   explicit MemoryMappedFile(void);
+
+   // FILE CONSTRUCTOR
+
+   explicit MemoryMappedFile(const std::string&);
+
+   // DESTRUCTOR
+
+   virtual ~MemoryMappedFile(void);
+
+   // GET METHODS
+
+   bool is_open(void) const;
+
+   const char* get_data(void) const;
+   const size_t& get_size(void) const;
+
+   const std::string& get_file_name(void) const;
+
+   // FILE METHODS
+
+   void open(const std::string&);
+   void close(void);
+
+   // MEMORY METHODS
+
+   void prefetch(const size_t&, const size_t&) const;
+   void release(const size_t&, const size_t&) const;
+
+private:
+
+   // COPY CONSTRUCTOR
+
+   MemoryMappedFile(const MemoryMappedFile&);
+
+   // ASSIGNMENT OPERATOR
+
+   MemoryMappedFile& operator = (const MemoryMappedFile&);
+
+   // MEMBERS
+
+   /// Name of the file which is mapped.
+
+   std::string file_name;
+
+   /// Pointer to the first byte of the file contents.
+
+   const char* data;
+
+   /// Size of the file in bytes.
+
+   size_t size;
+
+   /// Buffer holding the file contents when memory mapping is not available.
+
+   char* file_buffer;
+};
+
+}
+
+#endif
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (c) 2005-2015 Roberto Lopez.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
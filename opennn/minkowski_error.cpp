@@ -259,67 +259,15 @@ double MinkowskiError::calculate_performance(void) const
 
    #endif
 
-   // Neural network stuff
-
-   const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
-
-   const size_t inputs_number = multilayer_perceptron_pointer->get_inputs_number();
-   const size_t outputs_number = multilayer_perceptron_pointer->get_outputs_number();
-
-   // Data set
+   // Data set stuff
 
    const Instances& instances = data_set_pointer->get_instances();
 
-   const size_t training_instances_number = instances.count_training_instances_number();
-
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
-   const MissingValues& missing_values = data_set_pointer->get_missing_values();
-
-   Vector<double> inputs(inputs_number);
-   Vector<double> outputs(outputs_number);
-   Vector<double> targets(outputs_number);
-
-   double Minkowski_error = 0.0;
-
-   int i = 0;
-
-   #pragma omp parallel for private(i, training_index, inputs, outputs, targets) reduction(+ : Minkowski_error)
-
-   for(i = 0; i < (int)training_instances_number; i++)
-   {       
-       training_index = training_indices[i];
-
-       if(missing_values.has_missing_values(training_index))
-       {
-           continue;
-       }
-
-      // Input vector
-
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
-
-      // Output vector
-
-      outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
-
-      // Target vector
-
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
+   const Vector<size_t>& training_indices = instances.arrange_training_indices();
 
-      // Minkowski error
-
-      Minkowski_error += (outputs-targets).calculate_p_norm(Minkowski_parameter);
-   }
+   // Minkowski error
 
-   return(Minkowski_error);
+   return(calculate_error_sum(training_indices));
 }
 
 
@@ -367,19 +315,7 @@ double MinkowskiError::calculate_performance(const Vector<double>& parameters) c
 
    // Data set
 
-   const Instances& instances = data_set_pointer->get_instances();
-   const size_t training_instances_number = instances.count_training_instances_number();
-
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
-   const MissingValues& missing_values = data_set_pointer->get_missing_values();
+   const size_t training_instances_number = data_set_pointer->count_training_rows_number();
 
    Vector<double> inputs(inputs_number);
    Vector<double> outputs(outputs_number);
@@ -389,29 +325,18 @@ double MinkowskiError::calculate_performance(const Vector<double>& parameters) c
 
    int i = 0;
 
-   #pragma omp parallel for private(i, training_index, inputs, outputs, targets) reduction(+ : Minkowski_error)
+   #pragma omp parallel for private(i, inputs, outputs, targets) reduction(+ : Minkowski_error)
 
    for(i = 0; i < (int)training_instances_number; i++)
    {
-       training_index = training_indices[i];
+      // Input and target vectors
 
-       if(missing_values.has_missing_values(training_index))
-       {
-           continue;
-       }
-
-      // Input vector
-
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+      data_set_pointer->arrange_training_row(i, inputs, targets);
 
       // Output vector
 
       outputs = multilayer_perceptron_pointer->calculate_outputs(inputs, parameters);
 
-      // Target vector
-
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
-
       // Minkowski error
 
       Minkowski_error += (outputs-targets).calculate_p_norm(Minkowski_parameter);
@@ -436,69 +361,57 @@ double MinkowskiError::calculate_generalization_performance(void) const
 
    #endif
 
-   // Neural network
-
-   const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
-
-   const size_t inputs_number = multilayer_perceptron_pointer->get_inputs_number();
-   const size_t outputs_number = multilayer_perceptron_pointer->get_outputs_number();
-
-   // Data set
+   // Data set stuff
 
    const Instances& instances = data_set_pointer->get_instances();
 
-   const size_t generalization_instances_number = instances.count_generalization_instances_number();
+   const Vector<size_t>& generalization_indices = instances.arrange_generalization_indices();
 
-   const Vector<size_t> generalization_indices = instances.arrange_generalization_indices();
-
-   size_t generalization_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
+   // Minkowski error
 
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
+   return(calculate_error_sum(generalization_indices));
+}
 
-   const MissingValues& missing_values = data_set_pointer->get_missing_values();
 
-   // Performance functional
+// double calculate_batch_error(const Matrix<double>&, const Matrix<double>&) const method
 
-   Vector<double> inputs(inputs_number);
-   Vector<double> outputs(outputs_number);
-   Vector<double> targets(outputs_number);
+/// Returns the Minkowski error of a batch of instances, which is the sum of the Minkowski norms of their errors.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
 
-   double generalization_performance = 0.0;
-
-   int i = 0;
+double MinkowskiError::calculate_batch_error(const Matrix<double>& outputs, const Matrix<double>& targets) const
+{
+   const size_t instances_number = outputs.get_rows_number();
 
-   #pragma omp parallel for private(i, generalization_index, inputs, outputs, targets) reduction(+ : generalization_performance)
+   double Minkowski_error = 0.0;
 
-   for(i = 0; i < (int)generalization_instances_number; i++)
+   for(size_t i = 0; i < instances_number; i++)
    {
-       generalization_index = generalization_indices[i];
-
-       if(missing_values.has_missing_values(generalization_index))
-       {
-           continue;
-       }
+      Minkowski_error += (outputs.arrange_row(i)-targets.arrange_row(i)).calculate_p_norm(Minkowski_parameter);
+   }
 
-      // Input vector
+   return(Minkowski_error);
+}
 
-      inputs = data_set_pointer->get_instance(generalization_index, inputs_indices);
 
-      // Output vector
+// Matrix<double> calculate_batch_output_gradient(const Matrix<double>&, const Matrix<double>&) const method
 
-      outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
+/// Returns the derivatives of the Minkowski norm of the errors of each instance in a batch with respect to its outputs.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
 
-      // Target vector
-
-      targets = data_set_pointer->get_instance(generalization_index, targets_indices);
+Matrix<double> MinkowskiError::calculate_batch_output_gradient(const Matrix<double>& outputs, const Matrix<double>& targets) const
+{
+   const size_t instances_number = outputs.get_rows_number();
 
-      // Minkowski error
+   Matrix<double> output_gradient(instances_number, outputs.get_columns_number());
 
-      generalization_performance += (outputs-targets).calculate_p_norm(Minkowski_parameter);
+   for(size_t i = 0; i < instances_number; i++)
+   {
+      output_gradient.set_row(i, (outputs.arrange_row(i)-targets.arrange_row(i)).calculate_p_norm_gradient(Minkowski_parameter));
    }
 
-   return(generalization_performance);
+   return(output_gradient);
 }
 
 
@@ -517,138 +430,63 @@ Vector<double> MinkowskiError::calculate_gradient(void) const
 
    #endif
 
-   // Neural network stuff
-
-   const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
-
-   // Neural network stuff
-
-   const bool has_conditions_layer = neural_network_pointer->has_conditions_layer();
-
-   const ConditionsLayer* conditions_layer_pointer = has_conditions_layer ? neural_network_pointer->get_conditions_layer_pointer() : NULL;
-
-   const size_t inputs_number = multilayer_perceptron_pointer->get_inputs_number();
-   const size_t outputs_number = multilayer_perceptron_pointer->get_outputs_number();
-
-   const size_t layers_number = multilayer_perceptron_pointer->get_layers_number();
-
-   const size_t neural_parameters_number = multilayer_perceptron_pointer->count_parameters_number();
-
-   Vector< Vector< Vector<double> > > first_order_forward_propagation(2);
-
-   Vector<double> particular_solution;
-   Vector<double> homogeneous_solution;
-
    // Data set stuff
 
    const Instances& instances = data_set_pointer->get_instances();
 
-   const size_t training_instances_number = instances.count_training_instances_number();
-
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
-   const MissingValues& missing_values = data_set_pointer->get_missing_values();
-
-   Vector<double> inputs(inputs_number);
-   Vector<double> targets(outputs_number);
+   const Vector<size_t>& training_indices = instances.arrange_training_indices();
 
    // Minkowski error stuff
 
-   Vector<double> output_gradient(outputs_number);
-
-   Vector< Matrix<double> > layers_combination_parameters_Jacobian;
-
-   Vector< Vector<double> > layers_inputs(layers_number);
-   Vector< Vector<double> > layers_delta;
-
-   Vector<double> point_gradient(neural_parameters_number, 0.0);
-
-   Vector<double> gradient(neural_parameters_number, 0.0);
-
-   int i = 0;
-
-   #pragma omp parallel for private(i, training_index, inputs, targets, first_order_forward_propagation, layers_inputs, layers_combination_parameters_Jacobian, \
-    output_gradient, layers_delta, particular_solution, homogeneous_solution, point_gradient)
-
-   for(i = 0; i < (int)training_instances_number; i++)
-   {
-       training_index = training_indices[i];
-
-       if(missing_values.has_missing_values(training_index))
-       {
-           continue;
-       }
-
-       // Data set
+   return(calculate_error_gradient_sum(training_indices));
+}
 
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
 
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
+// FirstOrderPerformance calculate_performance_and_gradient(void) const method
 
-      // Neural network
+/// Returns the Minkowski error and its gradient, computed from a single forward propagation of the training instances.
 
-      first_order_forward_propagation = multilayer_perceptron_pointer->calculate_first_order_forward_propagation(inputs);
+PerformanceTerm::FirstOrderPerformance MinkowskiError::calculate_performance_and_gradient(void) const
+{
+   // Control sentence (if debug)
 
-      const Vector< Vector<double> >& layers_activation = first_order_forward_propagation[0];
-      const Vector< Vector<double> >& layers_activation_derivative = first_order_forward_propagation[1];
+   #ifdef __OPENNN_DEBUG__ 
 
-      layers_inputs = multilayer_perceptron_pointer->arrange_layers_input(inputs, layers_activation);
+   check();
 
-      layers_combination_parameters_Jacobian = multilayer_perceptron_pointer->calculate_layers_combination_parameters_Jacobian(layers_inputs);
+   #endif
 
-      // Performance functional
+   // Data set stuff
 
-      if(!has_conditions_layer)
-      {
-         output_gradient = (layers_activation[layers_number-1]-targets).calculate_p_norm_gradient(Minkowski_parameter);
+   const Instances& instances = data_set_pointer->get_instances();
 
-         layers_delta = calculate_layers_delta(layers_activation_derivative, output_gradient);
-      }
-      else
-      {
-         particular_solution = conditions_layer_pointer->calculate_particular_solution(inputs);
-         homogeneous_solution = conditions_layer_pointer->calculate_homogeneous_solution(inputs);
+   const Vector<size_t>& training_indices = instances.arrange_training_indices();
 
-         output_gradient = (particular_solution+homogeneous_solution*layers_activation[layers_number-1] - targets).calculate_pow(Minkowski_parameter-1.0)*Minkowski_parameter;
+   // Minkowski error stuff
 
-         layers_delta = calculate_layers_delta(layers_activation_derivative, homogeneous_solution, output_gradient);
-      }
+   return(calculate_error_sum_and_gradient_sum(training_indices));
+}
 
-      point_gradient = calculate_point_gradient(layers_combination_parameters_Jacobian, layers_delta);
 
-      #pragma omp critical
+// double calculate_error_normalization_coefficient(void) const method
 
-      gradient += point_gradient;
-   }
+/// Returns the coefficient which divides the sum of the training errors to give the Minkowski error.
+/// It is one, because that error is the plain sum of the errors of the training instances.
 
-   return(gradient);
+double MinkowskiError::calculate_error_normalization_coefficient(void) const
+{
+   return(1.0);
 }
 
 
 // Matrix<double> calculate_Hessian(void) const method
 
-/// @todo
+/// Returns the Minkowski error function Hessian of a multilayer perceptron on a data set. 
+/// It is computed by numerical differentiation. 
 
 Matrix<double> MinkowskiError::calculate_Hessian(void) const
 {
-    // Control sentence (if debug)
-
-    #ifdef __OPENNN_DEBUG__
-
-    check();
-
-    #endif
-
-   Matrix<double> Hessian;
-
-   return(Hessian);
+   return(PerformanceTerm::calculate_Hessian());
 }
 
 
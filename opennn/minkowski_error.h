@@ -92,8 +92,17 @@ public:
    double calculate_generalization_performance(void) const;   
 
    Vector<double> calculate_gradient(void) const;
+
+   FirstOrderPerformance calculate_performance_and_gradient(void) const;
    Matrix<double> calculate_Hessian(void) const;
 
+   double calculate_error_normalization_coefficient(void) const;
+
+   // Batch kernel methods
+
+   double calculate_batch_error(const Matrix<double>&, const Matrix<double>&) const;
+   Matrix<double> calculate_batch_output_gradient(const Matrix<double>&, const Matrix<double>&) const;
+
    std::string write_performance_term_type(void) const;
 
    // Serialization methods
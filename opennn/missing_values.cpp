@@ -26,6 +26,8 @@ namespace OpenNN
 
 MissingValues::MissingValues(void)
 {
+    modifications_number = 0;
+
     set();
 
     set_default();
@@ -40,6 +42,8 @@ MissingValues::MissingValues(void)
 
 MissingValues::MissingValues(const size_t& new_instances_number,const size_t& new_variables_number)
 {
+    modifications_number = 0;
+
     set(new_instances_number, new_variables_number);
 
     set_default();
@@ -54,6 +58,8 @@ MissingValues::MissingValues(const size_t& new_instances_number,const size_t& ne
 
 MissingValues::MissingValues(const tinyxml2::XMLDocument& missing_values_document)
 {   
+    modifications_number = 0;
+
     set(missing_values_document);
 }
 
@@ -66,6 +72,8 @@ MissingValues::MissingValues(const tinyxml2::XMLDocument& missing_values_documen
 
 MissingValues::MissingValues(const MissingValues& other_missing_values)
 {
+    modifications_number = 0;
+
     instances_number = other_missing_values.instances_number;
     variables_number = other_missing_values.variables_number;
 
@@ -73,6 +81,12 @@ MissingValues::MissingValues(const MissingValues& other_missing_values)
 
     items = other_missing_values.items;
 
+    indexed = other_missing_values.indexed;
+    instances_missing_flags = other_missing_values.instances_missing_flags;
+    missing_instances_number = other_missing_values.missing_instances_number;
+    variables_missing_positions = other_missing_values.variables_missing_positions;
+    variables_missing_instances = other_missing_values.variables_missing_instances;
+
     display = other_missing_values.display;
 }
 
@@ -101,7 +115,15 @@ MissingValues& MissingValues::operator=(const MissingValues& other_missing_value
 
         items = other_missing_values.items;
 
+        indexed = other_missing_values.indexed;
+        instances_missing_flags = other_missing_values.instances_missing_flags;
+        missing_instances_number = other_missing_values.missing_instances_number;
+        variables_missing_positions = other_missing_values.variables_missing_positions;
+        variables_missing_instances = other_missing_values.variables_missing_instances;
+
         display = other_missing_values.display;
+
+        modifications_number++;
     }
 
     return(*this);
@@ -162,6 +184,16 @@ Vector<size_t> MissingValues::get_missing_values_numbers(void) const
 {
     Vector<size_t> missing_values_numbers(variables_number, 0);
 
+    if(indexed)
+    {
+        for(size_t i = 0; i < variables_number; i++)
+        {
+            missing_values_numbers[i] = variables_missing_positions[i+1] - variables_missing_positions[i];
+        }
+
+        return(missing_values_numbers);
+    }
+
     const size_t missing_values_number = get_missing_values_number();
 
     size_t variable_index;
@@ -300,6 +332,17 @@ const bool& MissingValues::get_display(void) const
 }
 
 
+// const size_t& get_modifications_number(void) const method
+
+/// Returns the number of times that the missing values have been modified.
+/// Objects which cache information depending on the missing values can compare this number to know whether it is still valid.
+
+const size_t& MissingValues::get_modifications_number(void) const
+{
+    return(modifications_number);
+}
+
+
 // void set(void) method
 
 /// Sets a missing values object with zero instances, variables and missing values.
@@ -311,6 +354,8 @@ void MissingValues::set(void)
 
     set_missing_values_number(0);
 
+    build_index();
+
     set_default();
 }
 
@@ -328,6 +373,8 @@ void MissingValues::set(const size_t& new_instances_number, const size_t& new_va
 
     set_missing_values_number(0);
 
+    build_index();
+
     set_default();
 }
 
@@ -354,6 +401,8 @@ void MissingValues::set_instances_number(const size_t& new_instances_number)
     set_missing_values_number(0);
 
     instances_number = new_instances_number;
+
+    build_index();
 }
 
 
@@ -366,6 +415,8 @@ void MissingValues::set_variables_number(const size_t& new_variables_number)
     set_missing_values_number(0);
 
     variables_number = new_variables_number;
+
+    build_index();
 }
 
 
@@ -400,11 +451,13 @@ void MissingValues::set_display(const bool& new_display)
 
 // void set_items(const Vector<Item>&) method
 
-/// Sets a new vector of missing value items.
+/// Sets a new vector of missing value items, and builds the index of the missing values.
 
 void MissingValues::set_items(const Vector<Item>& new_items)
 {
     items = new_items;
+
+    build_index();
 }
 
 
@@ -457,12 +510,17 @@ void MissingValues::set_item(const size_t& index, const size_t& instance_index,
 
     items[index].instance_index = instance_index;
     items[index].variable_index = variable_index;
+
+    indexed = false;
+
+    modifications_number++;
 }
 
 
 // void append(const size_t&, const size_t&) method
 
 /// Appends a new item to the vector of missing values.
+/// This invalidates the index of the missing values, which should be built again once all the items have been appended.
 /// @param instance_index Instance with a missing value.
 /// @param variable_index Variable with a missing value.
 
@@ -497,6 +555,10 @@ void MissingValues::append(const size_t& instance_index, const size_t& variable_
     Item item(instance_index, variable_index);
 
     items.push_back(item);
+
+    indexed = false;
+
+    modifications_number++;
 }
 
 
@@ -508,6 +570,10 @@ void MissingValues::append(const size_t& instance_index, const size_t& variable_
 void MissingValues::set_missing_values_number(const size_t& new_missing_values_number)
 {
     items.set(new_missing_values_number);
+
+    indexed = false;
+
+    modifications_number++;
 }
 
 
@@ -580,6 +646,11 @@ bool MissingValues::has_missing_values(const size_t& instance_index) const
         return(false);
     }
 
+    if(indexed)
+    {
+        return(instance_index < instances_number && instances_missing_flags[instance_index]);
+    }
+
     const size_t missing_values_number = get_missing_values_number();
 
     for(size_t i = 0; i < missing_values_number; i++)
@@ -603,10 +674,28 @@ bool MissingValues::has_missing_values(const size_t& instance_index) const
 
 bool MissingValues::has_missing_values(const size_t& instance_index, const Vector<size_t>& variables_indices) const
 {
-    const size_t missing_values_number = get_missing_values_number();
-
     const size_t variables_number = variables_indices.size();
 
+    if(indexed)
+    {
+        if(!has_missing_values(instance_index))
+        {
+            return(false);
+        }
+
+        for(size_t j = 0; j < variables_number; j++)
+        {
+            if(is_missing_value(instance_index, variables_indices[j]))
+            {
+                return(true);
+            }
+        }
+
+        return(false);
+    }
+
+    const size_t missing_values_number = get_missing_values_number();
+
     for(size_t i = 0; i < missing_values_number; i++)
     {
         if(items[i].instance_index == instance_index)
@@ -638,6 +727,19 @@ bool MissingValues::is_missing_value(const size_t& instance_index, const size_t&
         return(false);
     }
 
+    if(indexed)
+    {
+        if(variable_index >= variables_number || !has_missing_values(instance_index))
+        {
+            return(false);
+        }
+
+        const Vector<size_t>::const_iterator begin = variables_missing_instances.begin() + variables_missing_positions[variable_index];
+        const Vector<size_t>::const_iterator end = variables_missing_instances.begin() + variables_missing_positions[variable_index+1];
+
+        return(std::binary_search(begin, end, instance_index));
+    }
+
     const size_t missing_values_number = get_missing_values_number();
 
     for(size_t i = 0; i < missing_values_number; i++)
@@ -662,6 +764,29 @@ Vector<size_t> MissingValues::arrange_missing_instances(void) const
 
     Vector<size_t> missing_instances;
 
+    if(indexed)
+    {
+        missing_instances.reserve(missing_instances_number);
+
+        Vector<bool> arranged(instances_number, false);
+
+        size_t instance_index;
+
+        for(size_t i = 0; i < missing_values_number; i++)
+        {
+            instance_index = items[i].instance_index;
+
+            if(!arranged[instance_index])
+            {
+                arranged[instance_index] = true;
+
+                missing_instances.push_back(instance_index);
+            }
+        }
+
+        return(missing_instances);
+    }
+
     for(size_t i = 0; i < missing_values_number; i++)
     {
         if(!missing_instances.contains(items[i].instance_index))
@@ -674,12 +799,94 @@ Vector<size_t> MissingValues::arrange_missing_instances(void) const
 }
 
 
+// Vector<size_t> arrange_missing_instances(const size_t&) const method
+
+/// Returns a vector with the indices of those instances which have a missing value for a given variable.
+/// If the index has been built, the instances are sorted in ascending order.
+/// @param variable_index Index of variable.
+
+Vector<size_t> MissingValues::arrange_missing_instances(const size_t& variable_index) const
+{
+    // Control sentence (if debug)
+
+#ifdef __OPENNN_DEBUG__
+
+    if(variable_index >= variables_number)
+    {
+        std::ostringstream buffer;
+
+        buffer << "OpenNN Exception: MissingValues class.\n"
+               << "Vector<size_t> arrange_missing_instances(const size_t&) const method.\n"
+               << "Index of variable (" << variable_index << ") must be less than number of variables (" << variables_number << ").\n";
+
+        throw std::logic_error(buffer.str());
+    }
+
+#endif
+
+    if(indexed)
+    {
+        return(Vector<size_t>(variables_missing_instances.begin() + variables_missing_positions[variable_index],
+                              variables_missing_instances.begin() + variables_missing_positions[variable_index+1]));
+    }
+
+    const size_t missing_values_number = get_missing_values_number();
+
+    Vector<size_t> missing_instances;
+
+    for(size_t i = 0; i < missing_values_number; i++)
+    {
+        if(items[i].variable_index == variable_index && !missing_instances.contains(items[i].instance_index))
+        {
+            missing_instances.push_back(items[i].instance_index);
+        }
+    }
+
+    return(missing_instances);
+}
+
+
+// Vector<size_t> arrange_complete_instances(const Vector<size_t>&) const method
+
+/// Returns those instances from a given list which do not have any missing value.
+/// The training loops can iterate directly over the returned list instead of checking each instance.
+/// @param instances_indices Indices of instances.
+
+Vector<size_t> MissingValues::arrange_complete_instances(const Vector<size_t>& instances_indices) const
+{
+    if(items.empty())
+    {
+        return(instances_indices);
+    }
+
+    const size_t instances_indices_size = instances_indices.size();
+
+    Vector<size_t> complete_instances;
+    complete_instances.reserve(instances_indices_size);
+
+    for(size_t i = 0; i < instances_indices_size; i++)
+    {
+        if(!has_missing_values(instances_indices[i]))
+        {
+            complete_instances.push_back(instances_indices[i]);
+        }
+    }
+
+    return(complete_instances);
+}
+
+
 // size_t count_missing_instances(void) const method
 
 /// Returns the number of instances with missing values.
 
 size_t MissingValues::count_missing_instances(void) const
 {
+    if(indexed)
+    {
+        return(missing_instances_number);
+    }
+
     return(arrange_missing_instances().size());
 }
 
@@ -694,6 +901,27 @@ Vector<size_t> MissingValues::arrange_missing_variables(void) const
 
     Vector<size_t> missing_variables;
 
+    if(indexed)
+    {
+        Vector<bool> arranged(variables_number, false);
+
+        size_t variable_index;
+
+        for(size_t i = 0; i < missing_values_number; i++)
+        {
+            variable_index = items[i].variable_index;
+
+            if(!arranged[variable_index])
+            {
+                arranged[variable_index] = true;
+
+                missing_variables.push_back(variable_index);
+            }
+        }
+
+        return(missing_variables);
+    }
+
     for(size_t i = 0; i < missing_values_number; i++)
     {
         if(!missing_variables.contains(items[i].variable_index))
@@ -788,6 +1016,89 @@ Vector< Vector<size_t> > MissingValues::arrange_missing_indices(void) const
 }
 
 
+// bool is_indexed(void) const method
+
+/// Returns true if the index of the missing values is up to date with the items, and false otherwise.
+
+bool MissingValues::is_indexed(void) const
+{
+    return(indexed);
+}
+
+
+// void build_index(void) method
+
+/// Builds the index of the missing values from the items.
+/// The index consists of a per-instance bitmap and the lists of instances with missing values of each variable,
+/// so that the per-instance and per-variable queries do not need to scan all the items.
+/// It is built once the data has been loaded, and whenever the whole vector of items is set.
+/// If some item lies outside the dimensions of the data set, the index is not built.
+
+void MissingValues::build_index(void)
+{
+    indexed = false;
+
+    modifications_number++;
+
+    const size_t missing_values_number = get_missing_values_number();
+
+    for(size_t i = 0; i < missing_values_number; i++)
+    {
+        if(items[i].instance_index >= instances_number || items[i].variable_index >= variables_number)
+        {
+            return;
+        }
+    }
+
+    instances_missing_flags.set(instances_number, false);
+
+    missing_instances_number = 0;
+
+    variables_missing_positions.set(variables_number+1, 0);
+
+    variables_missing_instances.set(missing_values_number);
+
+    for(size_t i = 0; i < missing_values_number; i++)
+    {
+        variables_missing_positions[items[i].variable_index+1]++;
+    }
+
+    for(size_t j = 0; j < variables_number; j++)
+    {
+        variables_missing_positions[j+1] += variables_missing_positions[j];
+    }
+
+    Vector<size_t> variables_next_positions(variables_missing_positions.begin(), variables_missing_positions.end()-1);
+
+    size_t instance_index;
+    size_t variable_index;
+
+    for(size_t i = 0; i < missing_values_number; i++)
+    {
+        instance_index = items[i].instance_index;
+        variable_index = items[i].variable_index;
+
+        variables_missing_instances[variables_next_positions[variable_index]] = instance_index;
+        variables_next_positions[variable_index]++;
+
+        if(!instances_missing_flags[instance_index])
+        {
+            instances_missing_flags[instance_index] = true;
+
+            missing_instances_number++;
+        }
+    }
+
+    for(size_t j = 0; j < variables_number; j++)
+    {
+        std::sort(variables_missing_instances.begin() + variables_missing_positions[j],
+                  variables_missing_instances.begin() + variables_missing_positions[j+1]);
+    }
+
+    indexed = true;
+}
+
+
 // tinyxml2::XMLDocument* to_XML(void) const method
 
 /// Serializes the MissingValues object into a XML document of the TinyXML library.
@@ -990,6 +1301,8 @@ void MissingValues::from_XML(const tinyxml2::XMLDocument& document)
 
     if(missing_values_number <= 0)
     {
+        build_index();
+
         return;
     }
 
@@ -1058,6 +1371,8 @@ void MissingValues::from_XML(const tinyxml2::XMLDocument& document)
 
         items[i].variable_index = variable_index;
     }
+
+    build_index();
 }
 
 
@@ -168,6 +168,8 @@ public:
 
    const bool& get_display(void) const;
 
+   const size_t& get_modifications_number(void) const;
+
    // Set methods
 
    void set(void);
@@ -200,6 +202,9 @@ public:
    bool is_missing_value(const size_t&, const size_t&) const;
 
    Vector<size_t> arrange_missing_instances(void) const;
+   Vector<size_t> arrange_missing_instances(const size_t&) const;
+
+   Vector<size_t> arrange_complete_instances(const Vector<size_t>&) const;
 
    size_t count_missing_instances(void) const;
 
@@ -210,6 +215,12 @@ public:
    void convert_time_series(const size_t&);
    void convert_autoassociation(void);
 
+   // Index methods
+
+   bool is_indexed(void) const;
+
+   void build_index(void);
+
    // Serialization methods
 
    std::string to_string(void) const;
@@ -239,6 +250,32 @@ private:
 
    Vector<Item> items;
 
+   /// True if the index below is up to date with the missing value items.
+   /// Modifying the items invalidates the index, and the query methods fall back to scanning the items until it is built again.
+
+   bool indexed;
+
+   /// Per-instance bitmap, which is true for those instances having at least one missing value.
+
+   Vector<bool> instances_missing_flags;
+
+   /// Number of instances with at least one missing value.
+
+   size_t missing_instances_number;
+
+   /// Position in variables_missing_instances of the first missing value of each variable.
+   /// The size of this vector is the number of variables plus one, and its last element is the number of missing values.
+
+   Vector<size_t> variables_missing_positions;
+
+   /// Instances with missing values, grouped by variable and sorted within each group.
+
+   Vector<size_t> variables_missing_instances;
+
+   /// Number of times that the missing values have been modified.
+
+   size_t modifications_number;
+
    /// Display messages to screen.
    
    bool display;
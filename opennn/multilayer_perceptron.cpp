@@ -359,6 +359,118 @@ Vector< Matrix<double> > MultilayerPerceptron::arrange_layers_synaptic_weights(v
 }
 
 
+// Vector< Vector<double> > arrange_layers_biases(const Vector<double>&) const method
+
+/// Returns the bias values of all the layers for a hypothetical vector of parameters. 
+/// The format is the same as that of arrange_layers_biases(void). 
+/// @param parameters Vector of parameters, in the order given by arrange_parameters(). 
+
+Vector< Vector<double> > MultilayerPerceptron::arrange_layers_biases(const Vector<double>& parameters) const
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   const size_t size = parameters.size();
+
+   const size_t parameters_number = count_parameters_number();
+
+   if(size != parameters_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: MultilayerPerceptron class.\n"
+             << "Vector< Vector<double> > arrange_layers_biases(const Vector<double>&) const method.\n"
+             << "Size of parameters (" << size << ") must be equal to number of parameters (" << parameters_number << ").\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   const size_t layers_number = get_layers_number();
+
+   Vector< Vector<double> > layers_biases(layers_number);
+
+   size_t index = 0;
+
+   for(size_t i = 0; i < layers_number; i++)
+   {
+      const size_t layer_perceptrons_number = layers[i].get_perceptrons_number();
+      const size_t layer_inputs_number = layers[i].get_inputs_number();
+
+      layers_biases[i].set(layer_perceptrons_number);
+
+      for(size_t j = 0; j < layer_perceptrons_number; j++)
+      {
+         layers_biases[i][j] = parameters[index];
+
+         index += 1 + layer_inputs_number;
+      }
+   }
+
+   return(layers_biases);
+}
+
+
+// Vector< Matrix<double> > arrange_layers_synaptic_weights(const Vector<double>&) const method
+
+/// Returns the synaptic weight values of all the layers for a hypothetical vector of parameters. 
+/// The format is the same as that of arrange_layers_synaptic_weights(void). 
+/// @param parameters Vector of parameters, in the order given by arrange_parameters(). 
+
+Vector< Matrix<double> > MultilayerPerceptron::arrange_layers_synaptic_weights(const Vector<double>& parameters) const
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   const size_t size = parameters.size();
+
+   const size_t parameters_number = count_parameters_number();
+
+   if(size != parameters_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: MultilayerPerceptron class.\n"
+             << "Vector< Matrix<double> > arrange_layers_synaptic_weights(const Vector<double>&) const method.\n"
+             << "Size of parameters (" << size << ") must be equal to number of parameters (" << parameters_number << ").\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   const size_t layers_number = get_layers_number();
+
+   Vector< Matrix<double> > layers_synaptic_weights(layers_number);
+
+   size_t index = 0;
+
+   for(size_t i = 0; i < layers_number; i++)
+   {
+      const size_t layer_perceptrons_number = layers[i].get_perceptrons_number();
+      const size_t layer_inputs_number = layers[i].get_inputs_number();
+
+      layers_synaptic_weights[i].set(layer_perceptrons_number, layer_inputs_number);
+
+      for(size_t j = 0; j < layer_perceptrons_number; j++)
+      {
+         index++;
+
+         for(size_t k = 0; k < layer_inputs_number; k++)
+         {
+            layers_synaptic_weights[i](j,k) = parameters[index];
+            index++;
+         }
+      }
+   }
+
+   return(layers_synaptic_weights);
+}
+
+
 // Vector< Matrix<double> > get_layers_parameters(void) const method
 
 /// Returns the neural parameter values (biases and synaptic weights) from the neurons in all 
@@ -405,6 +517,7 @@ size_t MultilayerPerceptron::count_parameters_number(void) const
 // Vector<double> arrange_parameters(void) const method
 
 /// Returns the values of all the biases and synaptic weights in the multilayer perceptron as a single vector.
+/// The vector is allocated once, and each layer writes its parameters directly at its offset in it.
 
 Vector<double> MultilayerPerceptron::arrange_parameters(void) const
 {
@@ -418,11 +531,8 @@ Vector<double> MultilayerPerceptron::arrange_parameters(void) const
 
    for(size_t i = 0; i < layers_number; i++)
    {
-      const Vector<double> layer_parameters = layers[i].arrange_parameters();
-      const size_t layer_parameters_number = layer_parameters.size();
-
-      parameters.tuck_in(position, layer_parameters);
-      position += layer_parameters_number; 
+      layers[i].arrange_parameters(parameters, position);
+      position += layers[i].count_parameters_number(); 
    }
 
    return(parameters);
@@ -558,7 +668,7 @@ size_t MultilayerPerceptron::get_layer_bias_index(const size_t& layer_index, con
 
    for(size_t j = 0; j < perceptron_index; j++)
    {
-      layer_bias_index += layers[layer_index].get_perceptron(j).count_parameters_number();
+      layer_bias_index += layers[layer_index].count_perceptron_parameters_number();
    }
 
    return(layer_bias_index);
@@ -638,7 +748,7 @@ size_t MultilayerPerceptron::get_layer_synaptic_weight_index
    {
       for(size_t i = 0; i < perceptron_index-1; i++)
       {
-         layer_synaptic_weight_index += layers[layer_index].get_perceptron(i).count_parameters_number();
+         layer_synaptic_weight_index += layers[layer_index].count_perceptron_parameters_number();
       }
    }
 
@@ -708,7 +818,7 @@ Matrix<size_t> MultilayerPerceptron::arrange_parameters_indices(void) const
    {
       for(size_t j = 0; j < layers_size[i]; j++)
 	  {
-         perceptron_parameters_number = layers[i].get_perceptron(j).count_parameters_number();
+         perceptron_parameters_number = layers[i].count_perceptron_parameters_number();
 
          for(size_t k = 0; k < perceptron_parameters_number; k++)
 		 {
@@ -1199,6 +1309,7 @@ void MultilayerPerceptron::set_layers_parameters(const Vector< Vector<double> >&
 // void set_parameters(const Vector<double>&) method
 
 /// Sets all the biases and synaptic weights in the multilayer perceptron from a single vector.
+/// Each layer reads its parameters directly from its offset in that vector, without temporary copies.
 /// @param new_parameters New set of biases and synaptic weights values. 
 
 void MultilayerPerceptron::set_parameters(const Vector<double>& new_parameters)
@@ -1226,20 +1337,12 @@ void MultilayerPerceptron::set_parameters(const Vector<double>& new_parameters)
 
    const size_t layers_number = get_layers_number();
 
-   size_t layer_parameters_number;
-   Vector<double> layer_parameters;
-
    size_t position = 0;
 
    for(size_t i = 0; i < layers_number; i++)
    {
-      layer_parameters_number = layers[i].count_parameters_number();
-      layer_parameters = layers[i].arrange_parameters();
-
-      layer_parameters = new_parameters.take_out(position, layer_parameters_number);
-
-      layers[i].set_parameters(layer_parameters);
-      position += layer_parameters_number;
+      layers[i].set_parameters(new_parameters, position);
+      position += layers[i].count_parameters_number();
    }
 }
 
@@ -1932,6 +2035,55 @@ Vector<double> MultilayerPerceptron::calculate_outputs(const Vector<double>& inp
 }
 
 
+// Matrix<double> calculate_outputs(const Matrix<double>&) const method
+
+/// Returns the outputs from the last layer for a batch of inputs to the first layer.
+/// Each row of the inputs matrix is an instance, and each row of the returned matrix contains the outputs for that instance.
+/// @param inputs Matrix of inputs to the multilayer perceptron, with one instance per row.
+
+Matrix<double> MultilayerPerceptron::calculate_outputs(const Matrix<double>& inputs) const
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   const size_t columns_number = inputs.get_columns_number();
+
+   const size_t inputs_number = get_inputs_number();
+
+   if(columns_number != inputs_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: MultilayerPerceptron class.\n"
+             << "Matrix<double> calculate_outputs(const Matrix<double>&) const method.\n"
+             << "Number of columns of inputs (" << columns_number <<") must be equal to number of inputs (" << inputs_number << ").\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   const size_t layers_number = get_layers_number();
+
+   Matrix<double> outputs;
+
+   if(layers_number == 0)
+   {
+      return(outputs);
+   }
+
+   outputs = layers[0].calculate_activations(layers[0].calculate_combinations(inputs));
+
+   for(size_t i = 1; i < layers_number; i++)
+   {
+      outputs = layers[i].calculate_activations(layers[i].calculate_combinations(outputs));
+   }
+
+   return(outputs);
+}
+
+
 // Matrix<double> calculate_Jacobian(const Vector<double>&) const method
 
 /// Returns the partial derivatives of the outputs from the last layer with respect to the inputs to the first layer.
@@ -3513,6 +3665,467 @@ Vector< Vector< Vector<double> > > MultilayerPerceptron::calculate_second_order_
 }
 
 
+// Vector< Vector< Matrix<double> > > calculate_first_order_forward_propagation(const Matrix<double>&) const method
+
+/// Returns the first order forward propagation quantities from the multilayer perceptron for a batch of inputs.
+/// That quantites include the activation and the activation derivative of all layers.
+/// The format is a vector of vectors of matrices.
+/// The first index refers to the quantity (0 for the activation and 1 for the activation derivative).
+/// The second index is the index of the layer.
+/// Each matrix has one row per instance and one column per neuron in the layer.
+/// @param inputs Matrix of inputs to the multilayer perceptron, with one instance per row.
+
+Vector< Vector< Matrix<double> > > MultilayerPerceptron::calculate_first_order_forward_propagation(const Matrix<double>& inputs) const
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   const size_t columns_number = inputs.get_columns_number();
+
+   const size_t inputs_number = get_inputs_number();
+
+   if(columns_number != inputs_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: MultilayerPerceptron class.\n"
+             << "Vector< Vector< Matrix<double> > > calculate_first_order_forward_propagation(const Matrix<double>&) const method.\n"
+             << "Number of columns must be equal to number of inputs.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   const size_t layers_number = get_layers_number();
+
+   Matrix<double> layer_combinations;
+
+   Vector< Vector< Matrix<double> > > first_order_forward_propagation(2);
+
+   first_order_forward_propagation[0].set(layers_number);
+   first_order_forward_propagation[1].set(layers_number);
+
+   for(size_t i = 0; i < layers_number; i++)
+   {
+      if(i == 0)
+      {
+         layer_combinations = layers[0].calculate_combinations(inputs);
+      }
+      else
+      {
+         layer_combinations = layers[i].calculate_combinations(first_order_forward_propagation[0][i-1]);
+      }
+
+      first_order_forward_propagation[0][i] = layers[i].calculate_activations(layer_combinations);
+
+      first_order_forward_propagation[1][i] = layers[i].calculate_activations_derivatives(layer_combinations);
+   }
+
+   return(first_order_forward_propagation);
+}
+
+
+// Vector< Vector< Matrix<double> > > calculate_second_order_forward_propagation(const Matrix<double>&) const method
+
+/// Returns the second order forward propagation quantities from the multilayer perceptron for a batch of inputs.
+/// That quantites include the activation, the activation derivative and the activation second derivative of all layers.
+/// The first index refers to the quantity (0 for the activation, 1 for the activation derivative and 2 for the activation second derivative).
+/// The second index is the index of the layer.
+/// Each matrix has one row per instance and one column per neuron in the layer.
+/// @param inputs Matrix of inputs to the multilayer perceptron, with one instance per row.
+
+Vector< Vector< Matrix<double> > > MultilayerPerceptron::calculate_second_order_forward_propagation(const Matrix<double>& inputs) const
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   const size_t columns_number = inputs.get_columns_number();
+
+   const size_t inputs_number = get_inputs_number();
+
+   if(columns_number != inputs_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: MultilayerPerceptron class.\n"
+             << "Vector< Vector< Matrix<double> > > calculate_second_order_forward_propagation(const Matrix<double>&) const method.\n"
+             << "Number of columns must be equal to number of inputs.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   const size_t layers_number = get_layers_number();
+
+   Matrix<double> layer_combinations;
+
+   Vector< Vector< Matrix<double> > > second_order_forward_propagation(3);
+
+   second_order_forward_propagation[0].set(layers_number);
+   second_order_forward_propagation[1].set(layers_number);
+   second_order_forward_propagation[2].set(layers_number);
+
+   for(size_t i = 0; i < layers_number; i++)
+   {
+      if(i == 0)
+      {
+         layer_combinations = layers[0].calculate_combinations(inputs);
+      }
+      else
+      {
+         layer_combinations = layers[i].calculate_combinations(second_order_forward_propagation[0][i-1]);
+      }
+
+      second_order_forward_propagation[0][i] = layers[i].calculate_activations(layer_combinations);
+
+      second_order_forward_propagation[1][i] = layers[i].calculate_activations_derivatives(layer_combinations);
+
+      second_order_forward_propagation[2][i] = layers[i].calculate_activations_second_derivatives(layer_combinations);
+   }
+
+   return(second_order_forward_propagation);
+}
+
+
+// Vector< Matrix<double> > calculate_layers_delta(const Vector< Vector< Matrix<double> > >&, const Matrix<double>&) const method
+
+/// Back-propagates the output gradients of a batch of instances through the layers.
+/// It returns the delta matrix of each layer, with one instance per row and one perceptron per column.
+/// @param first_order_forward_propagation Batch forward propagation quantities.
+/// @param outputs_gradient Derivatives of the error with respect to the outputs, with one instance per row.
+
+Vector< Matrix<double> > MultilayerPerceptron::calculate_layers_delta(const Vector< Vector< Matrix<double> > >& first_order_forward_propagation,
+                                                                      const Matrix<double>& outputs_gradient) const
+{
+   const size_t layers_number = get_layers_number();
+
+   Vector< Matrix<double> > layers_delta(layers_number);
+
+   if(layers_number == 0)
+   {
+      return(layers_delta);
+   }
+
+   const Vector< Matrix<double> >& layers_activation_derivative = first_order_forward_propagation[1];
+
+   layers_delta[layers_number-1] = layers_activation_derivative[layers_number-1]*outputs_gradient;
+
+   for(int i = (int)layers_number-2; i >= 0; i--)
+   {
+      layers_delta[i] = layers_activation_derivative[i]*layers_delta[i+1].dot(layers[i+1].arrange_synaptic_weights());
+   }
+
+   return(layers_delta);
+}
+
+
+// Vector<double> calculate_error_gradient(const Matrix<double>&, const Vector< Vector< Matrix<double> > >&, const Matrix<double>&) const method
+
+/// Back-propagates the output gradients of a batch of instances and returns the gradient of the error with respect to the parameters.
+/// The result is the sum of the gradients of all the instances in the batch,
+/// arranged in the same order as the vector returned by arrange_parameters().
+/// Each layer needs one matrix product to propagate the deltas and another one to compute the synaptic weights gradient.
+/// @param inputs Matrix of inputs to the multilayer perceptron, with one instance per row.
+/// @param first_order_forward_propagation Batch forward propagation quantities for those inputs.
+/// @param outputs_gradient Derivatives of the error with respect to the outputs, with one instance per row.
+
+Vector<double> MultilayerPerceptron::calculate_error_gradient(const Matrix<double>& inputs,
+                                                              const Vector< Vector< Matrix<double> > >& first_order_forward_propagation,
+                                                              const Matrix<double>& outputs_gradient) const
+{
+   const size_t layers_number = get_layers_number();
+
+   const size_t parameters_number = count_parameters_number();
+
+   Vector<double> error_gradient(parameters_number);
+
+   if(layers_number == 0)
+   {
+      return(error_gradient);
+   }
+
+   const Vector< Matrix<double> >& layers_activation = first_order_forward_propagation[0];
+
+   const Vector< Matrix<double> > layers_delta = calculate_layers_delta(first_order_forward_propagation, outputs_gradient);
+
+   // Parameters gradient
+
+   Vector<double> layer_biases_gradient;
+   Matrix<double> layer_synaptic_weights_gradient;
+
+   size_t index = 0;
+
+   for(size_t i = 0; i < layers_number; i++)
+   {
+      const size_t layer_perceptrons_number = layers[i].get_perceptrons_number();
+      const size_t layer_inputs_number = layers[i].get_inputs_number();
+
+      layer_biases_gradient = layers_delta[i].calculate_rows_sum();
+
+      if(i == 0)
+      {
+         layer_synaptic_weights_gradient = layers_delta[0].calculate_transpose_dot(inputs);
+      }
+      else
+      {
+         layer_synaptic_weights_gradient = layers_delta[i].calculate_transpose_dot(layers_activation[i-1]);
+      }
+
+      for(size_t j = 0; j < layer_perceptrons_number; j++)
+      {
+         error_gradient[index] = layer_biases_gradient[j];
+         index++;
+
+         for(size_t k = 0; k < layer_inputs_number; k++)
+         {
+            error_gradient[index] = layer_synaptic_weights_gradient(j,k);
+            index++;
+         }
+      }
+   }
+
+   return(error_gradient);
+}
+
+
+// Matrix<double> calculate_error_Jacobian(const Matrix<double>&, const Vector< Vector< Matrix<double> > >&, const Matrix<double>&) const method
+
+/// Back-propagates the output gradients of a batch of instances and returns the gradient of each instance separately.
+/// Row i of the result is the gradient of the error of instance i with respect to the parameters,
+/// arranged in the same order as the vector returned by arrange_parameters().
+/// @param inputs Matrix of inputs to the multilayer perceptron, with one instance per row.
+/// @param first_order_forward_propagation Batch forward propagation quantities for those inputs.
+/// @param outputs_gradient Derivatives of the error with respect to the outputs, with one instance per row.
+
+Matrix<double> MultilayerPerceptron::calculate_error_Jacobian(const Matrix<double>& inputs,
+                                                              const Vector< Vector< Matrix<double> > >& first_order_forward_propagation,
+                                                              const Matrix<double>& outputs_gradient) const
+{
+   const size_t layers_number = get_layers_number();
+
+   const size_t instances_number = inputs.get_rows_number();
+
+   const size_t parameters_number = count_parameters_number();
+
+   Matrix<double> error_Jacobian(instances_number, parameters_number);
+
+   if(layers_number == 0)
+   {
+      return(error_Jacobian);
+   }
+
+   const Vector< Matrix<double> >& layers_activation = first_order_forward_propagation[0];
+
+   const Vector< Matrix<double> > layers_delta = calculate_layers_delta(first_order_forward_propagation, outputs_gradient);
+
+   size_t index = 0;
+
+   for(size_t i = 0; i < layers_number; i++)
+   {
+      const size_t layer_perceptrons_number = layers[i].get_perceptrons_number();
+      const size_t layer_inputs_number = layers[i].get_inputs_number();
+
+      const Matrix<double>& layer_inputs = (i == 0) ? inputs : layers_activation[i-1];
+
+      for(size_t j = 0; j < layer_perceptrons_number; j++)
+      {
+         for(size_t r = 0; r < instances_number; r++)
+         {
+            error_Jacobian(r,index) = layers_delta[i](r,j);
+         }
+
+         index++;
+
+         for(size_t k = 0; k < layer_inputs_number; k++)
+         {
+            for(size_t r = 0; r < instances_number; r++)
+            {
+               error_Jacobian(r,index) = layers_delta[i](r,j)*layer_inputs(r,k);
+            }
+
+            index++;
+         }
+      }
+   }
+
+   return(error_Jacobian);
+}
+
+
+// Vector< Matrix<double> > calculate_layers_combinations_direction(const Matrix<double>&, const Vector< Vector< Matrix<double> > >&, const Vector<double>&) const method
+
+/// Returns the directional derivatives of the combinations of all layers for a batch of inputs, 
+/// when the parameters move along a given direction. 
+/// This is the forward pass of the R-operator of Pearlmutter, and it costs about one forward propagation. 
+/// Each matrix has one row per instance and one column per neuron in the layer.
+/// @param inputs Matrix of inputs to the multilayer perceptron, with one instance per row.
+/// @param forward_propagation Batch forward propagation quantities for those inputs. 
+/// @param parameters_direction Direction in the parameters space, in the order given by arrange_parameters().
+
+Vector< Matrix<double> > MultilayerPerceptron::calculate_layers_combinations_direction(const Matrix<double>& inputs,
+                                                                                       const Vector< Vector< Matrix<double> > >& forward_propagation,
+                                                                                       const Vector<double>& parameters_direction) const
+{
+   const size_t layers_number = get_layers_number();
+
+   const size_t instances_number = inputs.get_rows_number();
+
+   Vector< Matrix<double> > layers_combinations_direction(layers_number);
+
+   if(layers_number == 0)
+   {
+      return(layers_combinations_direction);
+   }
+
+   const Vector< Matrix<double> >& layers_activation = forward_propagation[0];
+   const Vector< Matrix<double> >& layers_activation_derivative = forward_propagation[1];
+
+   const Vector< Vector<double> > layers_biases_direction = arrange_layers_biases(parameters_direction);
+   const Vector< Matrix<double> > layers_synaptic_weights_direction = arrange_layers_synaptic_weights(parameters_direction);
+
+   Matrix<double> layer_activations_direction;
+
+   for(size_t i = 0; i < layers_number; i++)
+   {
+      const size_t layer_perceptrons_number = layers[i].get_perceptrons_number();
+
+      if(i == 0)
+      {
+         layers_combinations_direction[0] = inputs.dot(layers_synaptic_weights_direction[0].calculate_transpose());
+      }
+      else
+      {
+         layer_activations_direction = layers_activation_derivative[i-1]*layers_combinations_direction[i-1];
+
+         layers_combinations_direction[i] = layer_activations_direction.dot(layers[i].arrange_synaptic_weights().calculate_transpose())
+                                          + layers_activation[i-1].dot(layers_synaptic_weights_direction[i].calculate_transpose());
+      }
+
+      for(size_t j = 0; j < layer_perceptrons_number; j++)
+      {
+         for(size_t r = 0; r < instances_number; r++)
+         {
+            layers_combinations_direction[i](r,j) += layers_biases_direction[i][j];
+         }
+      }
+   }
+
+   return(layers_combinations_direction);
+}
+
+
+// Vector<double> calculate_error_vector_dot_Hessian(const Matrix<double>&, const Vector< Vector< Matrix<double> > >&, const Vector< Matrix<double> >&,
+//                                                   const Matrix<double>&, const Matrix<double>&, const Vector<double>&) const method
+
+/// Returns the product of the Hessian of the error of a batch of instances with a direction in the parameters space, 
+/// without forming the Hessian matrix. 
+/// This is the backward pass of the R-operator of Pearlmutter, which differentiates the back-propagation equations along that direction. 
+/// Together with the forward pass, it costs about two gradient evaluations. 
+/// The result is the sum over the instances in the batch, arranged in the same order as the vector returned by arrange_parameters().
+/// @param inputs Matrix of inputs to the multilayer perceptron, with one instance per row.
+/// @param second_order_forward_propagation Batch second order forward propagation quantities for those inputs.
+/// @param layers_combinations_direction Directional derivatives of the layers combinations, from calculate_layers_combinations_direction().
+/// @param outputs_gradient Derivatives of the error with respect to the outputs, with one instance per row.
+/// @param outputs_gradient_direction Directional derivatives of the outputs gradient, with one instance per row.
+/// @param parameters_direction Direction in the parameters space.
+
+Vector<double> MultilayerPerceptron::calculate_error_vector_dot_Hessian(const Matrix<double>& inputs,
+                                                                        const Vector< Vector< Matrix<double> > >& second_order_forward_propagation,
+                                                                        const Vector< Matrix<double> >& layers_combinations_direction,
+                                                                        const Matrix<double>& outputs_gradient,
+                                                                        const Matrix<double>& outputs_gradient_direction,
+                                                                        const Vector<double>& parameters_direction) const
+{
+   const size_t layers_number = get_layers_number();
+
+   const size_t parameters_number = count_parameters_number();
+
+   Vector<double> vector_Hessian_product(parameters_number);
+
+   if(layers_number == 0)
+   {
+      return(vector_Hessian_product);
+   }
+
+   const Vector< Matrix<double> >& layers_activation = second_order_forward_propagation[0];
+   const Vector< Matrix<double> >& layers_activation_derivative = second_order_forward_propagation[1];
+   const Vector< Matrix<double> >& layers_activation_second_derivative = second_order_forward_propagation[2];
+
+   const Vector< Matrix<double> > layers_synaptic_weights_direction = arrange_layers_synaptic_weights(parameters_direction);
+
+   // Deltas and their directional derivatives
+
+   Vector< Matrix<double> > layers_delta(layers_number);
+   Vector< Matrix<double> > layers_delta_direction(layers_number);
+
+   layers_delta[layers_number-1] = layers_activation_derivative[layers_number-1]*outputs_gradient;
+
+   layers_delta_direction[layers_number-1] = layers_activation_second_derivative[layers_number-1]*layers_combinations_direction[layers_number-1]*outputs_gradient
+                                           + layers_activation_derivative[layers_number-1]*outputs_gradient_direction;
+
+   Matrix<double> layer_error;
+   Matrix<double> layer_error_direction;
+
+   for(int i = (int)layers_number-2; i >= 0; i--)
+   {
+      const Matrix<double> next_layer_synaptic_weights = layers[i+1].arrange_synaptic_weights();
+
+      layer_error = layers_delta[i+1].dot(next_layer_synaptic_weights);
+
+      layer_error_direction = layers_delta_direction[i+1].dot(next_layer_synaptic_weights)
+                            + layers_delta[i+1].dot(layers_synaptic_weights_direction[i+1]);
+
+      layers_delta[i] = layers_activation_derivative[i]*layer_error;
+
+      layers_delta_direction[i] = layers_activation_second_derivative[i]*layers_combinations_direction[i]*layer_error
+                                + layers_activation_derivative[i]*layer_error_direction;
+   }
+
+   // Directional derivatives of the parameters gradient
+
+   Vector<double> layer_biases_Hessian_product;
+   Matrix<double> layer_synaptic_weights_Hessian_product;
+
+   size_t index = 0;
+
+   for(size_t i = 0; i < layers_number; i++)
+   {
+      const size_t layer_perceptrons_number = layers[i].get_perceptrons_number();
+      const size_t layer_inputs_number = layers[i].get_inputs_number();
+
+      layer_biases_Hessian_product = layers_delta_direction[i].calculate_rows_sum();
+
+      if(i == 0)
+      {
+         layer_synaptic_weights_Hessian_product = layers_delta_direction[0].calculate_transpose_dot(inputs);
+      }
+      else
+      {
+         layer_synaptic_weights_Hessian_product = layers_delta_direction[i].calculate_transpose_dot(layers_activation[i-1])
+                                                + layers_delta[i].calculate_transpose_dot(layers_activation_derivative[i-1]*layers_combinations_direction[i-1]);
+      }
+
+      for(size_t j = 0; j < layer_perceptrons_number; j++)
+      {
+         vector_Hessian_product[index] = layer_biases_Hessian_product[j];
+         index++;
+
+         for(size_t k = 0; k < layer_inputs_number; k++)
+         {
+            vector_Hessian_product[index] = layer_synaptic_weights_Hessian_product(j,k);
+            index++;
+         }
+      }
+   }
+
+   return(vector_Hessian_product);
+}
+
+
 // std::string to_string(void) const method
 
 /// Returns a string representation of the current multilayer perceptron object. 
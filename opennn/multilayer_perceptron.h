@@ -234,6 +234,9 @@ public:
    Vector< Vector<double> > arrange_layers_biases(void) const;
    Vector< Matrix<double> > arrange_layers_synaptic_weights(void) const;
 
+   Vector< Vector<double> > arrange_layers_biases(const Vector<double>&) const;
+   Vector< Matrix<double> > arrange_layers_synaptic_weights(const Vector<double>&) const;
+
    Vector< Vector<double> > get_layers_parameters(void) const;
 
    size_t count_parameters_number(void) const;
@@ -397,6 +400,23 @@ public:
    Vector< Vector< Vector<double> > > calculate_first_order_forward_propagation(const Vector<double>&) const;
    Vector< Vector< Vector<double> > > calculate_second_order_forward_propagation(const Vector<double>&) const;
 
+   // Batch forward and back propagation
+
+   Vector< Vector< Matrix<double> > > calculate_first_order_forward_propagation(const Matrix<double>&) const;
+   Vector< Vector< Matrix<double> > > calculate_second_order_forward_propagation(const Matrix<double>&) const;
+
+   Vector< Matrix<double> > calculate_layers_delta(const Vector< Vector< Matrix<double> > >&, const Matrix<double>&) const;
+
+   Vector<double> calculate_error_gradient(const Matrix<double>&, const Vector< Vector< Matrix<double> > >&, const Matrix<double>&) const;
+   Matrix<double> calculate_error_Jacobian(const Matrix<double>&, const Vector< Vector< Matrix<double> > >&, const Matrix<double>&) const;
+
+   // Batch Hessian vector product (R-operator)
+
+   Vector< Matrix<double> > calculate_layers_combinations_direction(const Matrix<double>&, const Vector< Vector< Matrix<double> > >&, const Vector<double>&) const;
+
+   Vector<double> calculate_error_vector_dot_Hessian(const Matrix<double>&, const Vector< Vector< Matrix<double> > >&, const Vector< Matrix<double> >&,
+                                                     const Matrix<double>&, const Matrix<double>&, const Vector<double>&) const;
+
    // Output 
 
    Vector<double> calculate_outputs(const Vector<double>&) const;
@@ -407,6 +427,8 @@ public:
    Matrix<double> calculate_Jacobian(const Vector<double>&, const Vector<double>&) const;
    Vector< Matrix<double> > calculate_Hessian_form(const Vector<double>&, const Vector<double>&) const;
 
+   Matrix<double> calculate_outputs(const Matrix<double>&) const;
+
    // Serialization methods
 
    tinyxml2::XMLDocument* to_XML(void) const;
@@ -2550,7 +2550,7 @@ Matrix<double> NeuralNetwork::calculate_output_data(const Matrix<double>& input_
 
    for(size_t i = 0; i < input_vectors_number; i++)
    {
-      inputs = input_data.arrange_row(i);
+      inputs = input_data.view_row(i);
       outputs = calculate_outputs(inputs);
       output_data.set_row(i, outputs);
    }
@@ -2720,7 +2720,7 @@ Vector< Matrix<double> > NeuralNetwork::calculate_Jacobian_data(const Matrix<dou
 
     for(size_t i = 0; i < input_data_size; i++)
     {
-        input_values = input_data.arrange_row(i);
+        input_values = input_data.view_row(i);
 
         Jacobian_data[i] = calculate_Jacobian(input_values);
     }
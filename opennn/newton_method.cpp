@@ -93,6 +93,71 @@ TrainingRateAlgorithm* NewtonMethod::get_training_rate_algorithm_pointer(void)
 }
 
 
+// const TrainingDirectionMethod& get_training_direction_method(void) const method
+
+/// Returns the method used for computing the Newton training direction.
+
+const NewtonMethod::TrainingDirectionMethod& NewtonMethod::get_training_direction_method(void) const
+{
+   return(training_direction_method);
+}
+
+
+// std::string write_training_direction_method(void) const method
+
+/// Returns a string with the name of the method used for computing the Newton training direction.
+
+std::string NewtonMethod::write_training_direction_method(void) const
+{
+   switch(training_direction_method)
+   {
+      case FullNewton:
+      {
+         return("FullNewton");
+      }
+      break;
+
+      case TruncatedNewton:
+      {
+         return("TruncatedNewton");
+      }
+      break;
+
+      default:
+      {
+         std::ostringstream buffer;
+
+         buffer << "OpenNN Exception: NewtonMethod class.\n"
+                << "std::string write_training_direction_method(void) const method.\n"
+                << "Unknown training direction method.\n";
+
+         throw std::logic_error(buffer.str());
+      }
+      break;
+   }
+}
+
+
+// const size_t& get_maximum_conjugate_gradient_iterations_number(void) const method
+
+/// Returns the maximum number of conjugate gradient iterations for the truncated Newton training direction.
+
+const size_t& NewtonMethod::get_maximum_conjugate_gradient_iterations_number(void) const
+{
+   return(maximum_conjugate_gradient_iterations_number);
+}
+
+
+// const double& get_conjugate_gradient_tolerance(void) const method
+
+/// Returns the relative residual norm at which the conjugate gradient iterations of the truncated Newton method stop.
+
+const double& NewtonMethod::get_conjugate_gradient_tolerance(void) const
+{
+   return(conjugate_gradient_tolerance);
+}
+
+
 // const double& get_warning_parameters_norm(void) const method
 
 /// Returns the minimum value for the norm of the parameters vector at wich a warning message is 
@@ -349,6 +414,13 @@ void NewtonMethod::set_performance_functional_pointer(PerformanceFunctional* new
 
 void NewtonMethod::set_default(void)
 {
+   // TRAINING OPERATORS
+
+   training_direction_method = FullNewton;
+
+   maximum_conjugate_gradient_iterations_number = 100;
+   conjugate_gradient_tolerance = 0.1;
+
    // TRAINING PARAMETERS
 
    warning_parameters_norm = 1.0e6;
@@ -393,6 +465,106 @@ void NewtonMethod::set_default(void)
 }
 
 
+// void set_training_direction_method(const TrainingDirectionMethod&) method
+
+/// Sets a new method for computing the Newton training direction.
+/// @param new_training_direction_method Training direction method.
+
+void NewtonMethod::set_training_direction_method(const NewtonMethod::TrainingDirectionMethod& new_training_direction_method)
+{
+   training_direction_method = new_training_direction_method;
+}
+
+
+// void set_training_direction_method(const std::string&) method
+
+/// Sets a new method for computing the Newton training direction from a string representation.
+/// Possible values are:
+/// <ul>
+/// <li> "FullNewton"
+/// <li> "TruncatedNewton"
+/// </ul>
+/// @param new_training_direction_method_name String with the name of the training direction method.
+
+void NewtonMethod::set_training_direction_method(const std::string& new_training_direction_method_name)
+{
+   if(new_training_direction_method_name == "FullNewton")
+   {
+      training_direction_method = FullNewton;
+   }
+   else if(new_training_direction_method_name == "TruncatedNewton")
+   {
+      training_direction_method = TruncatedNewton;
+   }
+   else
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: NewtonMethod class.\n"
+             << "void set_training_direction_method(const std::string&) method.\n"
+             << "Unknown training direction method: " << new_training_direction_method_name << ".\n";
+
+      throw std::logic_error(buffer.str());
+   }
+}
+
+
+// void set_maximum_conjugate_gradient_iterations_number(const size_t&) method
+
+/// Sets a new maximum number of conjugate gradient iterations for the truncated Newton training direction.
+/// @param new_maximum_conjugate_gradient_iterations_number Maximum number of conjugate gradient iterations.
+
+void NewtonMethod::set_maximum_conjugate_gradient_iterations_number(const size_t& new_maximum_conjugate_gradient_iterations_number)
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_maximum_conjugate_gradient_iterations_number == 0)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: NewtonMethod class.\n"
+             << "void set_maximum_conjugate_gradient_iterations_number(const size_t&) method.\n"
+             << "Maximum number of conjugate gradient iterations must be greater than 0.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   maximum_conjugate_gradient_iterations_number = new_maximum_conjugate_gradient_iterations_number;
+}
+
+
+// void set_conjugate_gradient_tolerance(const double&) method
+
+/// Sets a new relative residual norm at which the conjugate gradient iterations of the truncated Newton method stop.
+/// @param new_conjugate_gradient_tolerance Conjugate gradient tolerance.
+
+void NewtonMethod::set_conjugate_gradient_tolerance(const double& new_conjugate_gradient_tolerance)
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_conjugate_gradient_tolerance <= 0.0)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: NewtonMethod class.\n"
+             << "void set_conjugate_gradient_tolerance(const double&) method.\n"
+             << "Conjugate gradient tolerance must be greater than 0.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   conjugate_gradient_tolerance = new_conjugate_gradient_tolerance;
+}
+
+
 // void set_warning_parameters_norm(const double&) method
 
 /// Sets a new value for the parameters vector norm at which a warning message is written to the 
@@ -934,6 +1106,110 @@ Vector<double> NewtonMethod::calculate_training_direction
 }
 
 
+// Vector<double> calculate_training_direction(const Vector<double>&, const LDLTFactorization<double>&) const method
+
+/// Returns the Newton method training direction, which has been previously normalized.
+/// The direction is obtained by solving the Hessian system, which is cheaper and more stable than inverting the Hessian.
+/// @param gradient Gradient vector. 
+/// @param Hessian_factorization LDLT factorization of the Hessian matrix. 
+
+Vector<double> NewtonMethod::calculate_training_direction
+(const Vector<double>& gradient, const LDLTFactorization<double>& Hessian_factorization) const
+{
+   return((Hessian_factorization.solve(gradient)*(-1.0)).calculate_normalized());
+}
+
+
+// Vector<double> calculate_truncated_Newton_training_direction(const Vector<double>&) const method
+
+/// Returns the truncated Newton training direction, which has been previously normalized.
+/// The Newton system is solved approximately with the conjugate gradient method, 
+/// which only needs products of the Hessian with vectors. 
+/// Those products are computed by the performance functional without forming the Hessian matrix. 
+/// The iterations stop when the residual norm falls below the conjugate gradient tolerance times the gradient norm, 
+/// or when a direction of non positive curvature is found. 
+/// In the latter case at the first iteration, the gradient descent training direction is returned.
+/// @param gradient Gradient vector. 
+
+Vector<double> NewtonMethod::calculate_truncated_Newton_training_direction(const Vector<double>& gradient) const
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   std::ostringstream buffer;
+
+   if(!performance_functional_pointer)
+   {
+      buffer << "OpenNN Exception: NewtonMethod class.\n"
+             << "Vector<double> calculate_truncated_Newton_training_direction(const Vector<double>&) const method.\n"
+             << "Performance functional pointer is NULL.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   const size_t parameters_number = gradient.size();
+
+   const double gradient_norm = gradient.calculate_norm();
+
+   Vector<double> direction(parameters_number, 0.0);
+
+   if(gradient_norm == 0.0)
+   {
+      return(direction);
+   }
+
+   const double residual_norm_goal = conjugate_gradient_tolerance*gradient_norm;
+
+   Vector<double> residual = gradient*(-1.0);
+   Vector<double> conjugate_direction = residual;
+   Vector<double> Hessian_conjugate_direction;
+
+   double residual_squared_norm = residual.dot(residual);
+   double new_residual_squared_norm;
+
+   double curvature;
+   double step;
+
+   for(size_t i = 0; i < maximum_conjugate_gradient_iterations_number; i++)
+   {
+      Hessian_conjugate_direction = performance_functional_pointer->calculate_vector_dot_Hessian(conjugate_direction);
+
+      curvature = conjugate_direction.dot(Hessian_conjugate_direction);
+
+      if(curvature <= 0.0)
+      {
+         if(i == 0)
+         {
+            return(calculate_gradient_descent_training_direction(gradient));
+         }
+
+         break;
+      }
+
+      step = residual_squared_norm/curvature;
+
+      direction += conjugate_direction*step;
+      residual -= Hessian_conjugate_direction*step;
+
+      new_residual_squared_norm = residual.dot(residual);
+
+      if(sqrt(new_residual_squared_norm) <= residual_norm_goal)
+      {
+         break;
+      }
+
+      conjugate_direction = residual + conjugate_direction*(new_residual_squared_norm/residual_squared_norm);
+
+      residual_squared_norm = new_residual_squared_norm;
+   }
+
+   return(direction.calculate_normalized());
+}
+
+
 // void resize_training_history(const size_t&) method
 
 /// Resizes all the training history variables. 
@@ -1207,19 +1483,12 @@ Matrix<std::string> NewtonMethod::NewtonMethodResults::write_final_results(const
 
 /// Trains a neural network with an associated performance functional according to the Newton method algorithm.
 /// Training occurs according to the training operators, the training parameters and the stopping criteria. 
-/// @todo
+/// With the full Newton method, the Newton step is obtained by solving the Hessian system with a LDLT factorization, 
+/// so the inverse Hessian is only formed when its history is to be reserved.
+/// With the truncated Newton method, the Hessian is never formed, and no inverse Hessian history is reserved.
 
 NewtonMethod::NewtonMethodResults* NewtonMethod::perform_training(void)
 {
-   std::ostringstream buffer;
-
-   buffer << "OpenNN Exception: NewtonMethod class.\n"
-          << "NewtonMethodResults* perform_training(void) method.\n"
-          << "This method is under development.\n";
-
-   throw std::logic_error(buffer.str());	  
-
-/*
    // Control sentence (if debug)
 
    #ifdef __OPENNN_DEBUG__ 
@@ -1237,6 +1506,8 @@ NewtonMethod::NewtonMethodResults* NewtonMethod::perform_training(void)
 
    NewtonMethodResults* Newton_method_results_pointer = new NewtonMethodResults(this);
 
+   Newton_method_results_pointer->resize_training_history(1+maximum_iterations_number);
+
    // Elapsed time
 
    time_t beginning_time, current_time;
@@ -1249,7 +1520,7 @@ NewtonMethod::NewtonMethodResults* NewtonMethod::perform_training(void)
 
    const size_t parameters_number = neural_network_pointer->count_parameters_number();
 
-   const Vector<double> parameters = neural_network_pointer->arrange_parameters();
+   Vector<double> parameters(parameters_number);
    double parameters_norm;
 
    Vector<double> parameters_increment(parameters_number);
@@ -1259,7 +1530,6 @@ NewtonMethod::NewtonMethodResults* NewtonMethod::perform_training(void)
 
    double generalization_performance = 0.0; 
    double old_generalization_performance = 0.0;
-   double generalization_performance_increment = 0.0;
       
    double performance = 0.0;
    double old_performance = 0.0;
@@ -1268,27 +1538,25 @@ NewtonMethod::NewtonMethodResults* NewtonMethod::perform_training(void)
    Vector<double> gradient(parameters_number);
    double gradient_norm;
 
-   Matrix<double> inverse_Hessian(parameters_number, parameters_number);
+   Matrix<double> Hessian;
 
    // Training algorithm stuff 
 
-   Vector<double> old_gradient(parameters_number);
+   size_t generalization_failures = 0;
+
    Vector<double> training_direction(parameters_number);
-   Vector<double> gradient_descent_training_direction(parameters_number);
-   Vector<double> old_training_direction(parameters_number);
 
    double training_slope;
 
-   //double initial_training_rate = 0.0;
+   const double first_training_rate = 0.01;
+
+   double initial_training_rate = 0.0;
    double training_rate = 0.0;
-   //double old_training_rate = 0.0;
+   double old_training_rate = 0.0;
 
-   Vector<double> directional_point(2);
-   directional_point[0] = 0.0;
-   directional_point[1] = 0.0;
-   
-   bool stop_training = false;
+   Vector<double> directional_point(2, 0.0);
 
+   bool stop_training = false;
 
    // Main loop
 
@@ -1320,13 +1588,9 @@ NewtonMethod::NewtonMethodResults* NewtonMethod::perform_training(void)
 
       generalization_performance = performance_functional_pointer->calculate_generalization_performance();
 
-      if(iteration == 0)
-      {
-         generalization_performance_increment = 0.0;
-      }
-      else 
+      if(iteration != 0 && generalization_performance > old_generalization_performance)
       {
-         generalization_performance_increment = generalization_performance - old_generalization_performance;
+         generalization_failures++;
       }
 
       gradient = performance_functional_pointer->calculate_gradient();
@@ -1338,11 +1602,25 @@ NewtonMethod::NewtonMethodResults* NewtonMethod::perform_training(void)
          std::cout << "OpenNN Warning: Gradient norm is " << gradient_norm << ".\n";          
       }
 
-      inverse_Hessian = performance_functional_pointer->calculate_inverse_Hessian();
-
       // Training algorithm 
 
-      training_direction = calculate_training_direction(gradient, inverse_Hessian);
+      if(training_direction_method == TruncatedNewton)
+      {
+         training_direction = calculate_truncated_Newton_training_direction(gradient);
+      }
+      else
+      {
+         Hessian = performance_functional_pointer->calculate_Hessian();
+
+         const LDLTFactorization<double> Hessian_factorization(Hessian);
+
+         training_direction = calculate_training_direction(gradient, Hessian_factorization);
+
+         if(reserve_inverse_Hessian_history)
+         {
+            Newton_method_results_pointer->inverse_Hessian_history[iteration] = Hessian_factorization.calculate_inverse();
+         }
+      }
 
       // Calculate performance training_slope
 
@@ -1353,9 +1631,9 @@ NewtonMethod::NewtonMethodResults* NewtonMethod::perform_training(void)
       if(training_slope >= 0.0)
       {
          if(display)
-		 {
-			 std::cout << "Iteration " << iteration << ": Training slope is greater than zero. Reseting training direction.\n";
-		 }
+         {
+            std::cout << "Iteration " << iteration << ": Training slope is greater than zero. Reseting training direction.\n";
+         }
 
          // Reset training direction
 
@@ -1364,16 +1642,16 @@ NewtonMethod::NewtonMethodResults* NewtonMethod::perform_training(void)
             
       if(iteration == 0)
       {
-//         initial_training_rate = first_training_rate;
+         initial_training_rate = first_training_rate;
       }
       else
       {
-//         initial_training_rate = old_training_rate;
+         initial_training_rate = old_training_rate;
       }    
       
-//	  directional_point = calculate_directional_point(performance, training_direction, initial_training_rate);
+      directional_point = training_rate_algorithm.calculate_directional_point(performance, training_direction, initial_training_rate);
 
-	  training_rate = directional_point[0];
+      training_rate = directional_point[0];
 
       parameters_increment = training_direction*training_rate;
       parameters_increment_norm = parameters_increment.calculate_norm();
@@ -1417,11 +1695,6 @@ NewtonMethod::NewtonMethodResults* NewtonMethod::perform_training(void)
          Newton_method_results_pointer->gradient_norm_history[iteration] = gradient_norm;
       }
 
-      if(reserve_inverse_Hessian_history)
-      {
-         Newton_method_results_pointer->inverse_Hessian_history[iteration] = inverse_Hessian;
-      }
-
       // Training history training algorithm
 
       if(reserve_training_direction_history)
@@ -1439,14 +1712,14 @@ NewtonMethod::NewtonMethodResults* NewtonMethod::perform_training(void)
          Newton_method_results_pointer->elapsed_time_history[iteration] = elapsed_time;
       }
 
-	  // Stopping Criteria
+      // Stopping Criteria
 
       if(parameters_increment_norm <= minimum_parameters_increment_norm)
       {
          if(display)
          {
             std::cout << "Iteration " << iteration << ": Minimum parameters increment norm reached.\n"
-			          << "Parameters increment norm: " << parameters_increment_norm << std::endl;
+                      << "Parameters increment norm: " << parameters_increment_norm << std::endl;
          }
 
          stop_training = true;
@@ -1473,12 +1746,12 @@ NewtonMethod::NewtonMethodResults* NewtonMethod::perform_training(void)
          stop_training = true;
       }
 
-      else if(iteration != 0 && generalization_performance_increment < 0.0)
+      else if(generalization_failures >= maximum_generalization_performance_decreases)
       {
          if(display)
          {
-            std::cout << "Iteration " << iteration << ": Selection performance stopped improving.\n";
-            std::cout << "Selection performance increment: "<< generalization_performance_increment << std::endl;
+            std::cout << "Iteration " << iteration << ": Maximum generalization failures reached.\n"
+                      << "Generalization failures: " << generalization_failures << std::endl;
          }
 
          stop_training = true;
@@ -1494,7 +1767,7 @@ NewtonMethod::NewtonMethodResults* NewtonMethod::perform_training(void)
          stop_training = true;
       }
 
-      if(iteration == maximum_iterations_number)
+      else if(iteration == maximum_iterations_number)
       {
          if(display)
          {
@@ -1516,11 +1789,28 @@ NewtonMethod::NewtonMethodResults* NewtonMethod::perform_training(void)
 
       if(iteration != 0 && iteration % save_period == 0)
       {
-            neural_network_pointer->save(neural_network_file_name);
+         neural_network_pointer->save(neural_network_file_name);
       }
 
-	  if(stop_training)
+      if(stop_training)
       {
+         if(display)
+         {
+            std::cout << "Parameters norm: " << parameters_norm << "\n"
+                      << "Performance: " << performance << "\n"
+                      << "Gradient norm: " << gradient_norm << "\n"
+                      << performance_functional_pointer->write_information()
+                      << "Training rate: " << training_rate << "\n"
+                      << "Elapsed time: " << elapsed_time << std::endl; 
+
+            if(generalization_performance != 0)
+            {
+               std::cout << "Selection performance: " << generalization_performance << std::endl;
+            }
+         }   
+ 
+         Newton_method_results_pointer->resize_training_history(1+iteration);
+
          Newton_method_results_pointer->final_parameters = parameters;
          Newton_method_results_pointer->final_parameters_norm = parameters_norm;
 
@@ -1534,21 +1824,8 @@ NewtonMethod::NewtonMethodResults* NewtonMethod::perform_training(void)
          Newton_method_results_pointer->final_training_rate = training_rate;
          Newton_method_results_pointer->elapsed_time = elapsed_time;
 
-         if(display)
-		 {
-            std::cout << "Parameters norm: " << parameters_norm << "\n"
-                      << "Performance: " << performance << "\n"
-					  << "Gradient norm: " << gradient_norm << "\n"
-                      << performance_functional_pointer->write_information()
-                      << "Training rate: " << training_rate << "\n"
-                      << "Elapsed time: " << elapsed_time << std::endl; 
+         Newton_method_results_pointer->iterations_number = iteration;
 
-            if(generalization_performance != 0)
-            {
-               std::cout << "Selection performance: " << generalization_performance << std::endl;
-            }
-		 }   
- 
          break;
       }
       else if(display && iteration % display_period == 0)
@@ -1578,11 +1855,10 @@ NewtonMethod::NewtonMethodResults* NewtonMethod::perform_training(void)
       old_performance = performance;
       old_generalization_performance = generalization_performance;
    
-      //old_training_rate = training_rate;
+      old_training_rate = training_rate;
    } 
 
    return(Newton_method_results_pointer);
-*/
 }
 
 
@@ -1622,6 +1898,12 @@ Matrix<std::string> NewtonMethod::to_string_matrix(void) const
 
    values.push_back(buffer.str());
 
+   // Training direction method
+
+   labels.push_back("Training direction method");
+
+   values.push_back(write_training_direction_method());
+
    // Minimum parameters increment norm
 
    labels.push_back("Minimum parameters increment norm");
@@ -1804,6 +2086,39 @@ tinyxml2::XMLDocument* NewtonMethod::to_XML(void) const
       delete training_rate_algorithm_document;
    }
 
+   // Training direction method
+   {
+   element = document->NewElement("TrainingDirectionMethod");
+   root_element->LinkEndChild(element);
+
+   text = document->NewText(write_training_direction_method().c_str());
+   element->LinkEndChild(text);
+   }
+
+   // Maximum conjugate gradient iterations number
+   {
+   element = document->NewElement("MaximumConjugateGradientIterationsNumber");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << maximum_conjugate_gradient_iterations_number;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+   }
+
+   // Conjugate gradient tolerance
+   {
+   element = document->NewElement("ConjugateGradientTolerance");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << conjugate_gradient_tolerance;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+   }
+
    // Warning parameters norm
    {
    element = document->NewElement("WarningParametersNorm");
@@ -2163,6 +2478,63 @@ void NewtonMethod::from_XML(const tinyxml2::XMLDocument& document)
       }
    }
 
+   // Training direction method
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("TrainingDirectionMethod");
+
+       if(element)
+       {
+          const std::string new_training_direction_method = element->GetText();
+
+          try
+          {
+             set_training_direction_method(new_training_direction_method);
+          }
+          catch(const std::logic_error& e)
+          {
+             std::cout << e.what() << std::endl;
+          }
+       }
+   }
+
+   // Maximum conjugate gradient iterations number
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("MaximumConjugateGradientIterationsNumber");
+
+       if(element)
+       {
+          const size_t new_maximum_conjugate_gradient_iterations_number = atoi(element->GetText());
+
+          try
+          {
+             set_maximum_conjugate_gradient_iterations_number(new_maximum_conjugate_gradient_iterations_number);
+          }
+          catch(const std::logic_error& e)
+          {
+             std::cout << e.what() << std::endl;
+          }
+       }
+   }
+
+   // Conjugate gradient tolerance
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("ConjugateGradientTolerance");
+
+       if(element)
+       {
+          const double new_conjugate_gradient_tolerance = atof(element->GetText());
+
+          try
+          {
+             set_conjugate_gradient_tolerance(new_conjugate_gradient_tolerance);
+          }
+          catch(const std::logic_error& e)
+          {
+             std::cout << e.what() << std::endl;
+          }
+       }
+   }
+
    // Warning parameters norm
    {
        const tinyxml2::XMLElement* element = root_element->FirstChildElement("WarningParametersNorm");
@@ -64,6 +64,12 @@ public:
 
    virtual ~NewtonMethod(void);
 
+   // ENUMERATIONS
+
+   /// Enumeration of the available methods for computing the Newton training direction.
+
+   enum TrainingDirectionMethod{FullNewton, TruncatedNewton};
+
 
    // STRUCTURES
 
@@ -193,6 +199,14 @@ public:
    const TrainingRateAlgorithm& get_training_rate_algorithm(void) const;
    TrainingRateAlgorithm* get_training_rate_algorithm_pointer(void);
 
+   // Training operators
+
+   const TrainingDirectionMethod& get_training_direction_method(void) const;
+   std::string write_training_direction_method(void) const;
+
+   const size_t& get_maximum_conjugate_gradient_iterations_number(void) const;
+   const double& get_conjugate_gradient_tolerance(void) const;
+
    // Training parameters
 
    const double& get_warning_parameters_norm(void) const;
@@ -236,6 +250,14 @@ public:
 
    void set_default(void);
 
+   // Training operators
+
+   void set_training_direction_method(const TrainingDirectionMethod&);
+   void set_training_direction_method(const std::string&);
+
+   void set_maximum_conjugate_gradient_iterations_number(const size_t&);
+   void set_conjugate_gradient_tolerance(const double&);
+
    // Training parameters
 
    void set_warning_parameters_norm(const double&);
@@ -285,6 +307,8 @@ public:
 
    Vector<double> calculate_gradient_descent_training_direction(const Vector<double>&) const;
    Vector<double> calculate_training_direction(const Vector<double>&, const Matrix<double>&) const;
+   Vector<double> calculate_training_direction(const Vector<double>&, const LDLTFactorization<double>&) const;
+   Vector<double> calculate_truncated_Newton_training_direction(const Vector<double>&) const;
 
    NewtonMethodResults* perform_training(void);
 
@@ -304,6 +328,20 @@ private:
 
    TrainingRateAlgorithm training_rate_algorithm;
 
+   /// Method for computing the Newton training direction. 
+   /// The full Newton method factorizes the Hessian, while the truncated Newton method 
+   /// solves the Newton system approximately with conjugate gradient iterations on Hessian vector products.
+
+   TrainingDirectionMethod training_direction_method;
+
+   /// Maximum number of conjugate gradient iterations for the truncated Newton training direction.
+
+   size_t maximum_conjugate_gradient_iterations_number;
+
+   /// Residual norm, relative to the gradient norm, at which the conjugate gradient iterations of the truncated Newton method stop. 
+
+   double conjugate_gradient_tolerance;
+
    /// Value for the parameters norm at which a warning message is written to the screen. 
 
    double warning_parameters_norm;
@@ -106,6 +106,48 @@ double NormalizedSquaredError::calculate_normalization_coefficient(const Matrix<
 }
 
 
+// double calculate_training_normalization_coefficient(void) const method
+
+/// Returns the normalization coefficient measured on the training instances without missing values. 
+/// This is the sum squared error between their targets and the training target data mean.
+
+double NormalizedSquaredError::calculate_training_normalization_coefficient(void) const
+{
+   // Data set stuff
+
+   const Matrix<double>& data = data_set_pointer->get_data();
+
+   const Vector<size_t> training_indices = data_set_pointer->arrange_complete_training_indices();
+
+   const size_t training_instances_number = training_indices.size();
+
+   size_t training_index;
+
+   const Variables& variables = data_set_pointer->get_variables();
+
+   const Vector<size_t>& targets_indices = variables.arrange_targets_indices();
+
+   const Vector<double> training_target_data_mean = data_set_pointer->calculate_training_target_data_mean();
+
+   // Normalization coefficient
+
+   double normalization_coefficient = 0.0;
+
+   int i = 0;
+
+   #pragma omp parallel for private(i, training_index) reduction(+ : normalization_coefficient)
+
+   for(i = 0; i < (int)training_instances_number; i++)
+   {
+       training_index = training_indices[i];
+
+       normalization_coefficient += training_target_data_mean.calculate_sum_squared_error(data, training_index, targets_indices);
+   }
+
+   return(normalization_coefficient);
+}
+
+
 // void check(void) const method
 
 /// Checks that there are a neural network and a data set associated to the normalized squared error, 
@@ -220,23 +262,7 @@ double NormalizedSquaredError::calculate_performance(void) const
 
    // Data set stuff
 
-
-   const Instances& instances = data_set_pointer->get_instances();
-
-   const size_t training_instances_number = instances.count_training_instances_number();
-
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
-   const MissingValues& missing_values = data_set_pointer->get_missing_values();
-
-   const Vector<size_t> missing_instances = missing_values.arrange_missing_instances();
+   const size_t training_instances_number = data_set_pointer->count_training_rows_number();
 
    const Vector<double> training_target_data_mean = data_set_pointer->calculate_training_target_data_mean();
 
@@ -251,29 +277,18 @@ double NormalizedSquaredError::calculate_performance(void) const
    double sum_squared_error = 0.0;
    double normalization_coefficient = 0.0;
 
-   #pragma omp parallel for private(i, training_index, inputs, outputs, targets) reduction(+ : sum_squared_error, normalization_coefficient)
+   #pragma omp parallel for private(i, inputs, outputs, targets) reduction(+ : sum_squared_error, normalization_coefficient)
 
    for(i = 0; i < (int)training_instances_number; i++)
    {
-       training_index = training_indices[i];
+      // Input and target vectors
 
-       if(missing_values.has_missing_values(training_index))
-       {
-           continue;
-       }
-
-      // Input vector
-
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+      data_set_pointer->arrange_training_row(i, inputs, targets);
 
       // Output vector
 
       outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
 
-      // Target vector
-
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
-
       // Sum squared error
 
       sum_squared_error += outputs.calculate_sum_squared_error(targets);
@@ -342,20 +357,7 @@ double NormalizedSquaredError::calculate_performance(const Vector<double>& param
 
    // Data set stuff
 
-   const Instances& instances = data_set_pointer->get_instances();
-
-   const size_t training_instances_number = instances.count_training_instances_number();
-
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
-   const MissingValues& missing_values = data_set_pointer->get_missing_values();
+   const size_t training_instances_number = data_set_pointer->count_training_rows_number();
 
    const Vector<double> training_target_data_mean = data_set_pointer->calculate_training_target_data_mean();
 
@@ -370,29 +372,18 @@ double NormalizedSquaredError::calculate_performance(const Vector<double>& param
 
    int i = 0;
 
-   #pragma omp parallel for private(i, training_index, inputs, outputs, targets) reduction(+ : sum_squared_error, normalization_coefficient)
+   #pragma omp parallel for private(i, inputs, outputs, targets) reduction(+ : sum_squared_error, normalization_coefficient)
 
    for(i = 0; i < (int)training_instances_number; i++)
    {
-       training_index = training_indices[i];
+      // Input and target vectors
 
-       if(missing_values.has_missing_values(training_index))
-       {
-           continue;
-       }
-
-      // Input vector
-
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+      data_set_pointer->arrange_training_row(i, inputs, targets);
 
       // Output vector
 
       outputs = multilayer_perceptron_pointer->calculate_outputs(inputs, parameters);
 
-      // Target vector
-
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
-
       // Sum squared error
 
       sum_squared_error += outputs.calculate_sum_squared_error(targets);
@@ -447,16 +438,16 @@ double NormalizedSquaredError::calculate_generalization_performance(void) const
       return(0.0);
    }
    
-   const Vector<size_t> generalization_indices = instances.arrange_generalization_indices();
+   const Vector<size_t> complete_generalization_indices = data_set_pointer->arrange_complete_generalization_indices();
+
+   const size_t complete_generalization_instances_number = complete_generalization_indices.size();
 
    size_t generalization_index;
 
    const Variables& variables = data_set_pointer->get_variables();
 
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
-   const MissingValues& missing_values = data_set_pointer->get_missing_values();
+   const Vector<size_t>& inputs_indices = variables.arrange_inputs_indices();
+   const Vector<size_t>& targets_indices = variables.arrange_targets_indices();
 
    const Vector<double> generalization_target_data_mean = data_set_pointer->calculate_generalization_target_data_mean();
 
@@ -471,14 +462,9 @@ double NormalizedSquaredError::calculate_generalization_performance(void) const
 
    #pragma omp parallel for private(i, generalization_index, inputs, outputs, targets) reduction(+ : sum_squared_error, normalization_coefficient)
 
-   for(i = 0; i < (int)generalization_instances_number; i++)
+   for(i = 0; i < (int)complete_generalization_instances_number; i++)
    {
-       generalization_index = generalization_indices[i];
-
-       if(missing_values.has_missing_values(generalization_index))
-       {
-           continue;
-       }
+       generalization_index = complete_generalization_indices[i];
 
       // Input vector
 
@@ -516,6 +502,92 @@ double NormalizedSquaredError::calculate_generalization_performance(void) const
 }
 
 
+// double calculate_batch_error(const Matrix<double>&, const Matrix<double>&) const method
+
+/// Returns the sum squared error of a batch of instances. 
+/// The normalization is applied once all the batches have been added up.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
+
+double NormalizedSquaredError::calculate_batch_error(const Matrix<double>& outputs, const Matrix<double>& targets) const
+{
+   return(outputs.calculate_sum_squared_error(targets));
+}
+
+
+// Matrix<double> calculate_batch_output_gradient(const Matrix<double>&, const Matrix<double>&) const method
+
+/// Returns the derivatives of the squared error of each instance in a batch with respect to its outputs.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
+
+Matrix<double> NormalizedSquaredError::calculate_batch_output_gradient(const Matrix<double>& outputs, const Matrix<double>& targets) const
+{
+   return((outputs.lazy() - targets.lazy())*2.0);
+}
+
+
+// Matrix<double> calculate_batch_terms_output_gradient(const Matrix<double>&, const Matrix<double>&) const method
+
+/// Returns the derivatives of the norm of the errors of each instance in a batch with respect to its outputs.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
+
+Matrix<double> NormalizedSquaredError::calculate_batch_terms_output_gradient(const Matrix<double>& outputs, const Matrix<double>& targets) const
+{
+   const size_t instances_number = outputs.get_rows_number();
+   const size_t outputs_number = outputs.get_columns_number();
+
+   Matrix<double> terms_output_gradient = outputs-targets;
+
+   double term_norm;
+
+   for(size_t i = 0; i < instances_number; i++)
+   {
+      term_norm = 0.0;
+
+      for(size_t j = 0; j < outputs_number; j++)
+      {
+         term_norm += terms_output_gradient(i,j)*terms_output_gradient(i,j);
+      }
+
+      term_norm = sqrt(term_norm);
+
+      for(size_t j = 0; j < outputs_number; j++)
+      {
+         terms_output_gradient(i,j) = (term_norm == 0.0) ? 0.0 : terms_output_gradient(i,j)/term_norm;
+      }
+   }
+
+   return(terms_output_gradient);
+}
+
+
+// Vector<double> calculate_batch_terms(const Matrix<double>&, const Matrix<double>&) const method
+
+/// Returns the norm of the errors of each instance in a batch.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
+
+Vector<double> NormalizedSquaredError::calculate_batch_terms(const Matrix<double>& outputs, const Matrix<double>& targets) const
+{
+   return((outputs-targets).calculate_rows_norm());
+}
+
+
+// Matrix<double> calculate_batch_output_Hessian_dot(const Matrix<double>&, const Matrix<double>&, const Matrix<double>&) const method
+
+/// Returns the product of the Hessian of the squared error of each instance in a batch with respect to its outputs 
+/// with a direction in the outputs space. 
+/// That Hessian is twice the identity, so the targets are not needed.
+/// @param outputs_direction Direction of each instance in the outputs space, with one instance per row.
+
+Matrix<double> NormalizedSquaredError::calculate_batch_output_Hessian_dot(const Matrix<double>&, const Matrix<double>&, const Matrix<double>& outputs_direction) const
+{
+   return(outputs_direction*2.0);
+}
+
+
 // Vector<double> calculate_gradient(void) const method
 
 /// Returns the normalized squared error function gradient of a multilayer perceptron on a data set. 
@@ -531,151 +603,152 @@ Vector<double> NormalizedSquaredError::calculate_gradient(void) const
 
    #endif
 
-   // Neural network stuff
+   // Data set stuff
 
-   const size_t parameters_number = neural_network_pointer->count_parameters_number();
+   const Instances& instances = data_set_pointer->get_instances();
 
-   const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
+   const Vector<size_t>& training_indices = instances.arrange_training_indices();
 
-   const size_t inputs_number = multilayer_perceptron_pointer->get_inputs_number();
-   const size_t outputs_number = multilayer_perceptron_pointer->get_outputs_number();
+   // Normalized squared error stuff
 
-   const size_t layers_number = multilayer_perceptron_pointer->get_layers_number();
+   const double normalization_coefficient = calculate_training_normalization_coefficient();
 
-   Vector< Vector< Vector<double> > > first_order_forward_propagation(2); 
+   if(normalization_coefficient < 1.0e-99)
+   {
+      std::ostringstream buffer;
 
-   Vector< Vector<double> > layers_inputs(layers_number); 
+      buffer << "OpenNN Exception: NormalizedSquaredError class.\n"
+             << "Vector<double> calculate_gradient(void) const method.\n"
+             << "Normalization coefficient is zero.\n";
 
-   Vector< Matrix<double> > layers_combination_parameters_Jacobian; 
+      throw std::logic_error(buffer.str());
+   }
 
-   const bool has_conditions_layer = neural_network_pointer->has_conditions_layer();
+   return(calculate_error_gradient_sum(training_indices)/normalization_coefficient);
+}
 
-   const ConditionsLayer* conditions_layer_pointer = has_conditions_layer ? neural_network_pointer->get_conditions_layer_pointer() : NULL;
 
-   Vector<double> particular_solution;
-   Vector<double> homogeneous_solution;
+// FirstOrderPerformance calculate_performance_and_gradient(void) const method
 
-   // Data set stuff
+/// Returns the normalized squared error and its gradient, computed from a single forward propagation of the training instances.
 
-   const Instances& instances = data_set_pointer->get_instances();
+PerformanceTerm::FirstOrderPerformance NormalizedSquaredError::calculate_performance_and_gradient(void) const
+{
+   // Control sentence (if debug)
 
-   const size_t training_instances_number = instances.count_training_instances_number();
+   #ifdef __OPENNN_DEBUG__ 
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
+   check();
 
-   size_t training_index;
+   #endif
 
-   const Variables& variables = data_set_pointer->get_variables();
+   // Data set stuff
 
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
+   const Instances& instances = data_set_pointer->get_instances();
 
-   const MissingValues& missing_values = data_set_pointer->get_missing_values();
+   const Vector<size_t>& training_indices = instances.arrange_training_indices();
 
-   const Vector<double> training_target_data_mean = data_set_pointer->calculate_training_target_data_mean();
+   // Normalized squared error stuff
 
-   Vector<double> inputs(inputs_number);
-   Vector<double> targets(outputs_number);
+   const double normalization_coefficient = calculate_training_normalization_coefficient();
 
-   // Normalized squared error stuff
+   if(normalization_coefficient < 1.0e-99)
+   {
+      std::ostringstream buffer;
 
-   Vector<double> output_gradient(outputs_number);
+      buffer << "OpenNN Exception: NormalizedSquaredError class.\n"
+             << "FirstOrderPerformance calculate_performance_and_gradient(void) const method.\n"
+             << "Normalization coefficient is zero.\n";
 
-   Vector< Vector<double> > layers_delta; 
+      throw std::logic_error(buffer.str());
+   }
 
-   Vector<double> point_gradient(parameters_number, 0.0);
+   FirstOrderPerformance first_order_performance = calculate_error_sum_and_gradient_sum(training_indices);
 
-   double normalization_coefficient = 0.0;
+   first_order_performance.performance /= normalization_coefficient;
+   first_order_performance.gradient /= normalization_coefficient;
 
-   // Main loop
+   return(first_order_performance);
+}
 
-   Vector<double> gradient(parameters_number, 0.0);
 
-   int i = 0;
+// Vector<double> calculate_vector_dot_Hessian(const Vector<double>&) const method
 
-   #pragma omp parallel for private(i, training_index, inputs, targets, first_order_forward_propagation, layers_inputs, layers_combination_parameters_Jacobian,\
-    output_gradient, layers_delta, particular_solution, homogeneous_solution, point_gradient) \
-    reduction(+ : normalization_coefficient)
+/// Returns the product of the normalized squared error Hessian with a vector, without forming the Hessian matrix.
+/// It uses the R-operator on the training instances, whose cost is about that of two gradient evaluations.
+/// @param vector Vector in the dot product, with size the number of parameters. 
 
-   for(i = 0; i < (int)training_instances_number; i++)
-   {
-       training_index = training_indices[i];
+Vector<double> NormalizedSquaredError::calculate_vector_dot_Hessian(const Vector<double>& vector) const
+{
+   #ifdef __OPENNN_DEBUG__
 
-       if(missing_values.has_missing_values(training_index))
-       {
-           continue;
-       }
+   check();
 
-      // Data set
+   #endif
 
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+   // Data set stuff
 
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
+   const Instances& instances = data_set_pointer->get_instances();
 
-	  // Multilayer perceptron
+   const Vector<size_t>& training_indices = instances.arrange_training_indices();
 
-      first_order_forward_propagation = multilayer_perceptron_pointer->calculate_first_order_forward_propagation(inputs);
+   // Normalized squared error stuff
 
-      const Vector< Vector<double> >& layers_activation = first_order_forward_propagation[0];
-      const Vector< Vector<double> >& layers_activation_derivative = first_order_forward_propagation[1];
+   const double normalization_coefficient = calculate_training_normalization_coefficient();
 
-      layers_inputs = multilayer_perceptron_pointer->arrange_layers_input(inputs, layers_activation);   
+   if(normalization_coefficient < 1.0e-99)
+   {
+      std::ostringstream buffer;
 
-	  layers_combination_parameters_Jacobian = multilayer_perceptron_pointer->calculate_layers_combination_parameters_Jacobian(layers_inputs);
+      buffer << "OpenNN Exception: NormalizedSquaredError class.\n"
+             << "Vector<double> calculate_vector_dot_Hessian(const Vector<double>&) const method.\n"
+             << "Normalization coefficient is zero.\n";
 
-	  // Performance functional
+      throw std::logic_error(buffer.str());
+   }
 
-      if(!has_conditions_layer)
-      {
-         output_gradient = (layers_activation[layers_number-1]-targets)*2.0;
+   return(calculate_error_vector_dot_Hessian_sum(training_indices, vector)/normalization_coefficient);
+}
 
-         layers_delta = calculate_layers_delta(layers_activation_derivative, output_gradient);
-      }
-      else
-      {
-         particular_solution = conditions_layer_pointer->calculate_particular_solution(inputs);
-         homogeneous_solution = conditions_layer_pointer->calculate_homogeneous_solution(inputs);
 
-         output_gradient = (particular_solution+homogeneous_solution*layers_activation[layers_number-1] - targets)*2.0;
+// double calculate_error_normalization_coefficient(void) const method
 
-         layers_delta = calculate_layers_delta(layers_activation_derivative, homogeneous_solution, output_gradient);
-      }
+/// Returns the coefficient which divides the sum of the training errors to give the normalized squared error, 
+/// which is the training normalization coefficient.
 
-      point_gradient = calculate_point_gradient(layers_combination_parameters_Jacobian, layers_delta);
+double NormalizedSquaredError::calculate_error_normalization_coefficient(void) const
+{
+   #ifdef __OPENNN_DEBUG__
 
-      #pragma omp critical
+   check();
 
-      gradient += point_gradient;
+   #endif
 
-      normalization_coefficient += targets.calculate_sum_squared_error(training_target_data_mean);
-   }
+   const double normalization_coefficient = calculate_training_normalization_coefficient();
 
    if(normalization_coefficient < 1.0e-99)
    {
       std::ostringstream buffer;
 
       buffer << "OpenNN Exception: NormalizedSquaredError class.\n"
-             << "Vector<double> calculate_gradient(void) const method.\n"
+             << "double calculate_error_normalization_coefficient(void) const method.\n"
              << "Normalization coefficient is zero.\n";
 
       throw std::logic_error(buffer.str());
    }
 
-   return(gradient/normalization_coefficient);
+   return(normalization_coefficient);
 }
 	
 
 // Matrix<double> calculate_Hessian(void) const method
 
 /// Returns the normalized squared error function Hessian of a multilayer perceptron on a data set. 
-/// It uses the error back-propagation method.
-/// @todo
+/// It is computed by numerical differentiation. 
 
 Matrix<double> NormalizedSquaredError::calculate_Hessian(void) const
 {
-   Matrix<double> Hessian;
-
-   return(Hessian);
+   return(PerformanceTerm::calculate_Hessian());
 }
 
 
@@ -707,14 +780,14 @@ Vector<double> NormalizedSquaredError::calculate_terms(void) const
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
+   const Vector<size_t>& training_indices = instances.arrange_training_indices();
 
    size_t training_index;
 
    const Variables& variables = data_set_pointer->get_variables();
 
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
+   const Vector<size_t>& inputs_indices = variables.arrange_inputs_indices();
+   const Vector<size_t>& targets_indices = variables.arrange_targets_indices();
 
    const MissingValues& missing_values = data_set_pointer->get_missing_values();
 
@@ -845,177 +918,92 @@ Matrix<double> NormalizedSquaredError::calculate_terms_Jacobian(void) const
 
    #endif
 
-   // Neural network stuff
-
-   const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
-
-   const size_t inputs_number = multilayer_perceptron_pointer->get_inputs_number();
-   const size_t outputs_number = multilayer_perceptron_pointer->get_outputs_number();
-   const size_t layers_number = multilayer_perceptron_pointer->get_layers_number();
-
-   const size_t parameters_number = multilayer_perceptron_pointer->count_parameters_number();
-
-   Vector< Vector< Vector<double> > > first_order_forward_propagation(2);
-
-   Vector< Matrix<double> > layers_combination_parameters_Jacobian; 
-
-   Vector< Vector<double> > layers_inputs(layers_number); 
-
-   Vector<double> particular_solution;
-   Vector<double> homogeneous_solution;
-
-   const bool has_conditions_layer = neural_network_pointer->has_conditions_layer();
-
-   const ConditionsLayer* conditions_layer_pointer = has_conditions_layer ? neural_network_pointer->get_conditions_layer_pointer() : NULL;
-
    // Data set stuff
 
    const Instances& instances = data_set_pointer->get_instances();
 
-   const size_t training_instances_number = instances.count_training_instances_number();
-
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
-   const MissingValues& missing_values = data_set_pointer->get_missing_values();
-
-   const Vector<double> training_target_data_mean = data_set_pointer->calculate_training_target_data_mean();
-
-   Vector<double> inputs(inputs_number);
-   Vector<double> targets(outputs_number);
+   const Vector<size_t>& training_indices = instances.arrange_training_indices();
 
    // Normalized squared error
 
-   Vector<double> term(outputs_number);
-   double term_norm;
-
-   Vector<double> output_gradient(outputs_number);
-
-   Vector< Vector<double> > layers_delta(layers_number);
-   Vector<double> point_gradient(parameters_number);
-
-   Matrix<double> terms_Jacobian(training_instances_number, parameters_number);
-
-   double normalization_coefficient = 0.0;
-
-   // Main loop
-
-   int i = 0;
-
-   #pragma omp parallel for private(i, training_index, inputs, targets, first_order_forward_propagation, layers_inputs, \
-    layers_combination_parameters_Jacobian, term, term_norm, output_gradient, layers_delta, particular_solution, homogeneous_solution, point_gradient)
+   const double normalization_coefficient = calculate_training_normalization_coefficient();
 
-   for(i = 0; i < (int)training_instances_number; i++)
+   if(normalization_coefficient < 1.0e-99)
    {
-       training_index = training_indices[i];
+      std::ostringstream buffer;
 
-       if(missing_values.has_missing_values(training_index))
-       {
-           continue;
-       }
+      buffer << "OpenNN Exception: NormalizedSquaredError class.\n"
+             << "Matrix<double> calculate_terms_Jacobian(void) const method.\n"
+             << "Normalization coefficient is zero.\n";
 
-      // Data set
+      throw std::logic_error(buffer.str());
+   }
 
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+   return(calculate_error_terms_Jacobian(training_indices)/sqrt(normalization_coefficient));
+}
 
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
 
-	  // Neural network
+// FirstOrderTerms calculate_first_order_terms(void) const method
 
-      first_order_forward_propagation = multilayer_perceptron_pointer->calculate_first_order_forward_propagation(inputs);
+/// Returns a first order performance terms performance structure, which contains the values and the Jacobian of the performance terms function.
+/// @todo
 
-      const Vector< Vector<double> >& layers_activation = first_order_forward_propagation[0];
-      const Vector< Vector<double> >& layers_activation_derivative = first_order_forward_propagation[1];
+NormalizedSquaredError::FirstOrderTerms NormalizedSquaredError::calculate_first_order_terms(void) const
+{
+   FirstOrderTerms first_order_terms;
 
-      layers_inputs = multilayer_perceptron_pointer->arrange_layers_input(inputs, layers_activation);
+   first_order_terms.terms = calculate_terms();
 
-	  layers_combination_parameters_Jacobian = multilayer_perceptron_pointer->calculate_layers_combination_parameters_Jacobian(layers_inputs);
-	  
-	  // Performance functional
+   first_order_terms.Jacobian = calculate_terms_Jacobian();
 
-      if(!has_conditions_layer) // No conditions
-      {
-         const Vector<double>& outputs = layers_activation[layers_number-1]; 
+   return(first_order_terms);
+}
 
-         term = outputs-targets;
-         term_norm = term.calculate_norm();
 
-         if(term_norm == 0.0)
-   	     {
-            output_gradient.initialize(0.0);
-	     }
-         else
-	     {
-            output_gradient = term/term_norm;
-	     }
+// SecondOrderTerms calculate_second_order_terms(void) const method
 
-         layers_delta = calculate_layers_delta(layers_activation_derivative, output_gradient);
-      }
-      else // Conditions
-      {        
-         particular_solution = conditions_layer_pointer->calculate_particular_solution(inputs);
-         homogeneous_solution = conditions_layer_pointer->calculate_homogeneous_solution(inputs);
+/// Returns the normalized squared error of the training instances, together with the products of the transposed terms Jacobian 
+/// with the terms and with itself. 
+/// The products are accumulated by batches of instances, so the terms Jacobian is never built.
 
-         const Vector<double>& output_layer_activation = layers_activation[layers_number-1]; 
+NormalizedSquaredError::SecondOrderTerms NormalizedSquaredError::calculate_second_order_terms(void) const
+{
+   // Control sentence
 
-         term = (particular_solution+homogeneous_solution*output_layer_activation - targets);              
-         term_norm = term.calculate_norm();
+   #ifdef __OPENNN_DEBUG__ 
 
-         if(term_norm == 0.0)
-   	     {
-            output_gradient.initialize(0.0);
-	     }
-	     else
-	     {
-            output_gradient = term/term_norm;
-	     }
+   check();
 
-         layers_delta = calculate_layers_delta(layers_activation_derivative, homogeneous_solution, output_gradient);
-	  }
+   #endif
 
-	  normalization_coefficient += targets.calculate_sum_squared_error(training_target_data_mean);
+   // Data set stuff
 
-      point_gradient = calculate_point_gradient(layers_combination_parameters_Jacobian, layers_delta);
+   const Instances& instances = data_set_pointer->get_instances();
+
+   const Vector<size_t>& training_indices = instances.arrange_training_indices();
 
-      terms_Jacobian.set_row(i, point_gradient);
+   // Normalized squared error
 
-  }
+   const double normalization_coefficient = calculate_training_normalization_coefficient();
 
    if(normalization_coefficient < 1.0e-99)
    {
       std::ostringstream buffer;
 
       buffer << "OpenNN Exception: NormalizedSquaredError class.\n"
-             << "Matrix<double> calculate_terms_Jacobian(void) const method.\n"
+             << "SecondOrderTerms calculate_second_order_terms(void) const method.\n"
              << "Normalization coefficient is zero.\n";
 
       throw std::logic_error(buffer.str());
    }
 
-   return(terms_Jacobian/sqrt(normalization_coefficient));
-}
-
-
-// FirstOrderTerms calculate_first_order_terms(void) const method
+   SecondOrderTerms second_order_terms = calculate_error_second_order_terms(training_indices);
 
-/// Returns a first order performance terms performance structure, which contains the values and the Jacobian of the performance terms function.
-/// @todo
+   second_order_terms.performance /= normalization_coefficient;
+   second_order_terms.JacobianT_dot_terms /= normalization_coefficient;
+   second_order_terms.JacobianT_dot_Jacobian /= normalization_coefficient;
 
-NormalizedSquaredError::FirstOrderTerms NormalizedSquaredError::calculate_first_order_terms(void) const
-{
-   FirstOrderTerms first_order_terms;
-
-   first_order_terms.terms = calculate_terms();
-
-   first_order_terms.Jacobian = calculate_terms_Jacobian();
-
-   return(first_order_terms);
+   return(second_order_terms);
 }
 
 
@@ -1046,14 +1034,14 @@ Vector<double> NormalizedSquaredError::calculate_squared_errors(void) const
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
+   const Vector<size_t>& training_indices = instances.arrange_training_indices();
 
    size_t training_index;
 
    const Variables& variables = data_set_pointer->get_variables();
 
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
+   const Vector<size_t>& inputs_indices = variables.arrange_inputs_indices();
+   const Vector<size_t>& targets_indices = variables.arrange_targets_indices();
 
    const MissingValues& missing_values = data_set_pointer->get_missing_values();
 
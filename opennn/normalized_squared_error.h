@@ -79,6 +79,7 @@ public:
    // Normalization coefficients 
 
    double calculate_normalization_coefficient(const Matrix<double>&, const Vector<double>&) const;
+   double calculate_training_normalization_coefficient(void) const;
 
    // Checking methods
 
@@ -88,6 +89,12 @@ public:
 
    double calculate_performance(void) const;
    Vector<double> calculate_gradient(void) const;
+
+   FirstOrderPerformance calculate_performance_and_gradient(void) const;
+
+   Vector<double> calculate_vector_dot_Hessian(const Vector<double>&) const;
+
+   double calculate_error_normalization_coefficient(void) const;
    Matrix<double> calculate_Hessian(void) const;
 
    double calculate_performance(const Vector<double>&) const;
@@ -96,6 +103,14 @@ public:
 
    // Objective terms methods
 
+   // Batch kernel methods
+
+   double calculate_batch_error(const Matrix<double>&, const Matrix<double>&) const;
+   Matrix<double> calculate_batch_output_gradient(const Matrix<double>&, const Matrix<double>&) const;
+   Matrix<double> calculate_batch_terms_output_gradient(const Matrix<double>&, const Matrix<double>&) const;
+   Vector<double> calculate_batch_terms(const Matrix<double>&, const Matrix<double>&) const;
+   Matrix<double> calculate_batch_output_Hessian_dot(const Matrix<double>&, const Matrix<double>&, const Matrix<double>&) const;
+
    Vector<double> calculate_terms(void) const;
    Vector<double> calculate_terms(const Vector<double>&) const;
 
@@ -103,6 +118,8 @@ public:
 
    PerformanceTerm::FirstOrderTerms calculate_first_order_terms(void) const;
 
+   PerformanceTerm::SecondOrderTerms calculate_second_order_terms(void) const;
+
    // Squared errors methods
 
    Vector<double> calculate_squared_errors(void) const;
@@ -20,6 +20,9 @@
 #include "instances.h"
 #include "variables.h"
 #include "missing_values.h"
+#include "memory_mapped_file.h"
+#include "data_blocks.h"
+#include "spatial_index.h"
 
 
 // Mathematical model
@@ -89,6 +92,7 @@
 #include "newton_method.h"
 #include "quasi_newton_method.h"
 #include "random_search.h"
+#include "stochastic_gradient_descent.h"
 #include "training_algorithm.h"
 #include "training_rate_algorithm.h"
 
@@ -18,6 +18,7 @@ TARGET = opennn
 TEMPLATE = lib
 
 CONFIG += staticlib
+CONFIG += c++11
 
 CONFIG(debug, debug|release) {
     DEFINES += __OPENNN_DEBUG__
@@ -51,6 +52,14 @@ QMAKE_CXXFLAGS+= -fopenmp
 QMAKE_LFLAGS +=  -fopenmp
 }
 
+# Instruction set of the vectorized kernels in vector_kernels.h.
+# With GCC and Clang on x86 the kernels are also compiled for AVX with FMA and for AVX-512,
+# and the best one supported by the processor is chosen at run time.
+# Uncomment the define to use only the instruction set selected by the compiler flags.
+
+#QMAKE_CXXFLAGS += -march=native
+#DEFINES += __OPENNN_NO_RUNTIME_DISPATCH__
+
 #QMAKE_CXXFLAGS += -funroll-all-loops
 #QMAKE_LFLAGS   += -funroll-all-loops
 
@@ -61,9 +70,14 @@ QMAKE_LFLAGS +=  -fopenmp
 
 
 HEADERS += \
+    vector_kernels.h \
+    vector_block_kernels.h \
     variables.h \
     instances.h \
     missing_values.h \
+    memory_mapped_file.h \
+    data_blocks.h \
+    spatial_index.h \
     data_set.h \
     plug_in.h \
     ordinary_differential_equations.h \
@@ -102,6 +116,7 @@ HEADERS += \
     newton_method.h \
     levenberg_marquardt_algorithm.h \
     gradient_descent.h \
+    stochastic_gradient_descent.h \
     evolutionary_algorithm.h \
     conjugate_gradient.h \
     model_selection.h \
@@ -124,6 +139,9 @@ SOURCES += \
     variables.cpp \
     instances.cpp \
     missing_values.cpp \
+    memory_mapped_file.cpp \
+    data_blocks.cpp \
+    spatial_index.cpp \
     data_set.cpp \
     plug_in.cpp \
     ordinary_differential_equations.cpp \
@@ -162,6 +180,7 @@ SOURCES += \
     newton_method.cpp \
     levenberg_marquardt_algorithm.cpp \
     gradient_descent.cpp \
+    stochastic_gradient_descent.cpp \
     evolutionary_algorithm.cpp \
     conjugate_gradient.cpp \
     model_selection.cpp \
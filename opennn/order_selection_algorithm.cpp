@@ -1054,6 +1054,12 @@ Vector<double> OrderSelectionAlgorithm::get_final_performances(const TrainingStr
         performances[1] = results.Levenberg_Marquardt_algorithm_results_pointer->final_generalization_performance;
         break;
     }
+    case TrainingStrategy::STOCHASTIC_GRADIENT_DESCENT:
+    {
+        performances[0] = results.stochastic_gradient_descent_results_pointer->final_performance;
+        performances[1] = results.stochastic_gradient_descent_results_pointer->final_generalization_performance;
+        break;
+    }
     case TrainingStrategy::USER_MAIN:
     {
         performances[0] = 0;
@@ -77,7 +77,11 @@ PerceptronLayer& PerceptronLayer::operator = (const PerceptronLayer& other_perce
 {
    if(this != &other_perceptron_layer) 
    {
-      perceptrons = other_perceptron_layer.perceptrons; 
+      inputs_number = other_perceptron_layer.inputs_number;
+
+      layer_parameters = other_perceptron_layer.layer_parameters;
+
+      activation_function = other_perceptron_layer.activation_function;
 
       display = other_perceptron_layer.display;
    }
@@ -97,7 +101,9 @@ PerceptronLayer& PerceptronLayer::operator = (const PerceptronLayer& other_perce
 
 bool PerceptronLayer::operator == (const PerceptronLayer& other_perceptron_layer) const
 {
-   if(perceptrons == other_perceptron_layer.perceptrons 
+   if(inputs_number == other_perceptron_layer.inputs_number
+   && layer_parameters == other_perceptron_layer.layer_parameters
+   && activation_function == other_perceptron_layer.activation_function
    && display == other_perceptron_layer.display)
    {
       return(true);
@@ -118,7 +124,7 @@ bool PerceptronLayer::operator == (const PerceptronLayer& other_perceptron_layer
 
 bool PerceptronLayer::is_empty(void) const
 {
-    if(perceptrons.empty())
+    if(layer_parameters.empty())
     {
         return(true);
     }
@@ -129,12 +135,23 @@ bool PerceptronLayer::is_empty(void) const
 }
 
 
-// const Vector<Perceptron>& get_perceptrons(void) const method
+// Vector<Perceptron> get_perceptrons(void) const method
 
-/// Returns a constant reference to the vector of perceptrons defining the layer. 
+/// Returns the vector of perceptrons defining the layer. 
+/// The perceptrons are built from the parameters buffer of the layer,
+/// so that modifying them does not modify the layer. 
 
-const Vector<Perceptron>& PerceptronLayer::get_perceptrons(void) const
+Vector<Perceptron> PerceptronLayer::get_perceptrons(void) const
 {
+   const size_t perceptrons_number = get_perceptrons_number();
+
+   Vector<Perceptron> perceptrons(perceptrons_number);
+
+   for(size_t i = 0; i < perceptrons_number; i++)
+   {
+      perceptrons[i] = get_perceptron(i);
+   }
+
    return(perceptrons);
 }
 
@@ -151,7 +168,7 @@ size_t PerceptronLayer::get_inputs_number(void) const
    }
    else
    {
-      return(perceptrons[0].get_inputs_number());
+      return(inputs_number);
    }
 }
 
@@ -162,18 +179,19 @@ size_t PerceptronLayer::get_inputs_number(void) const
 
 size_t PerceptronLayer::get_perceptrons_number(void) const
 {
-   const size_t perceptrons_number = perceptrons.size();
+   const size_t perceptrons_number = layer_parameters.size()/(inputs_number+1);
 
    return(perceptrons_number);
 }
 
 
-// const Perceptron& get_perceptron(const size_t&) const method
+// Perceptron get_perceptron(const size_t&) const method
 
-/// Returns a reference to a given element in the perceptrons vector.
+/// Returns a given perceptron of the layer. 
+/// It is built from the corresponding segment of the parameters buffer of the layer.
 /// @param index Index of perceptron element.
 
-const Perceptron& PerceptronLayer::get_perceptron(const size_t& index) const
+Perceptron PerceptronLayer::get_perceptron(const size_t& index) const
 {
    // Control sentence (if debug)
 
@@ -186,7 +204,7 @@ const Perceptron& PerceptronLayer::get_perceptron(const size_t& index) const
       std::ostringstream buffer;
 
       buffer << "OpenNN Exception: PerceptronLayer class.\n"
-             << "const Perceptron& get_perceptron(const size_t&) const method.\n"
+             << "Perceptron get_perceptron(const size_t&) const method.\n"
              << "Index of perceptron must be less than layer size.\n";
 
 	  throw std::logic_error(buffer.str());
@@ -194,7 +212,18 @@ const Perceptron& PerceptronLayer::get_perceptron(const size_t& index) const
 
    #endif
 
-   return(perceptrons[index]);
+   const size_t position = index*(inputs_number+1);
+
+   Perceptron perceptron(inputs_number, layer_parameters[position]);
+
+   for(size_t j = 0; j < inputs_number; j++)
+   {
+      perceptron.set_synaptic_weight(j, layer_parameters[position+1+j]);
+   }
+
+   perceptron.set_activation_function(activation_function);
+
+   return(perceptron);
 }
 
 
@@ -206,14 +235,7 @@ size_t PerceptronLayer::count_parameters_number(void) const
 {
    const size_t perceptrons_number = get_perceptrons_number();
 
-   size_t parameters_number = 0;
-
-   for(size_t i = 0; i < perceptrons_number; i++)
-   {   
-      parameters_number += perceptrons[i].count_parameters_number();
-   }
-
-   return(parameters_number);
+   return(perceptrons_number*count_perceptron_parameters_number());
 }
 
 
@@ -226,16 +248,13 @@ Vector<size_t> PerceptronLayer::count_cumulative_parameters_number(void) const
 {
    const size_t perceptrons_number = get_perceptrons_number();
 
-   Vector<size_t> cumulative_parameters_number(perceptrons_number);
+   const size_t perceptron_parameters_number = count_perceptron_parameters_number();
 
-   if(perceptrons_number > 0)
-   {
-      cumulative_parameters_number[0] = perceptrons[0].count_parameters_number();
+   Vector<size_t> cumulative_parameters_number(perceptrons_number);
 
-      for(size_t i = 1; i < perceptrons_number; i++)
-      {  
-         cumulative_parameters_number[i] = cumulative_parameters_number[i-1] + perceptrons[i].count_parameters_number();   
-      }
+   for(size_t i = 0; i < perceptrons_number; i++)
+   {  
+      cumulative_parameters_number[i] = (i+1)*perceptron_parameters_number;   
    }
 
    return(cumulative_parameters_number);
@@ -249,14 +268,14 @@ Vector<size_t> PerceptronLayer::count_cumulative_parameters_number(void) const
 /// The size of this vector is the number of neurons in the layer.
 
 Vector<double> PerceptronLayer::arrange_biases(void) const
-{   
+{
    const size_t perceptrons_number = get_perceptrons_number();
 
    Vector<double> biases(perceptrons_number);
 
    for(size_t i = 0; i < perceptrons_number; i++)
    {
-      biases[i] = perceptrons[i].get_bias();   
+      biases[i] = layer_parameters[i*(inputs_number+1)];
    }
 
    return(biases);
@@ -274,15 +293,13 @@ Matrix<double> PerceptronLayer::arrange_synaptic_weights(void) const
 {
    const size_t perceptrons_number = get_perceptrons_number();
 
-   const size_t inputs_number = get_inputs_number(); 
-
    Matrix<double> synaptic_weights(perceptrons_number, inputs_number);
-   
+
    for(size_t i = 0; i < perceptrons_number; i++)
    {
       for(size_t j = 0; j < inputs_number; j++)
       {
-         synaptic_weights(i,j) = perceptrons[i].get_synaptic_weight(j);
+         synaptic_weights(i,j) = layer_parameters[i*(inputs_number+1)+1+j];
       }
    }
 
@@ -298,35 +315,49 @@ Matrix<double> PerceptronLayer::arrange_synaptic_weights(void) const
 
 Vector<double> PerceptronLayer::arrange_parameters(void) const
 {
-   const size_t perceptrons_number = get_perceptrons_number();
+   const size_t parameters_number = count_parameters_number();
 
-   if(perceptrons_number == 0)
-   {
-      Vector<double> parameters;
-         
-      return(parameters);
-   }
-   else
-   {
-      const size_t parameters_number = count_parameters_number(); 
+   Vector<double> parameters(parameters_number);
 
-      Vector<double> parameters(parameters_number);
+   arrange_parameters(parameters, 0);
 
-      const size_t perceptron_parameters_number = perceptrons[0].count_parameters_number();
-      
-      Vector<double> perceptron_parameters(perceptron_parameters_number);
+   return(parameters);
+}
 
-      size_t position = 0;
 
-      for(size_t i = 0; i < perceptrons_number; i++)
-      {
-         perceptron_parameters = perceptrons[i].arrange_parameters();
-         parameters.tuck_in(position, perceptron_parameters);
-         position += perceptron_parameters_number; 
-      }
+// void arrange_parameters(Vector<double>&, const size_t&) const method
 
-      return(parameters);
+/// Writes the layer parameters into a given vector, starting at a given position.
+/// The format is the same as that of arrange_parameters(void). 
+/// Since the layer stores its parameters in that order, this is a single contiguous copy. 
+/// This allows a multilayer perceptron to gather the parameters of all its layers in a single buffer.
+/// @param parameters Vector where the layer parameters are written.
+/// @param position Index of the first layer parameter in that vector.
+
+void PerceptronLayer::arrange_parameters(Vector<double>& parameters, const size_t& position) const
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__ 
+
+   const size_t parameters_size = parameters.size();
+
+   const size_t parameters_number = count_parameters_number();
+
+   if(position + parameters_number > parameters_size)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: PerceptronLayer class.\n"
+             << "void arrange_parameters(Vector<double>&, const size_t&) const method.\n"
+             << "Position plus number of parameters (" << position + parameters_number << ") must be less or equal than size of parameters (" << parameters_size << ").\n";
+
+	  throw std::logic_error(buffer.str());
    }
+
+   #endif
+
+   std::copy(layer_parameters.begin(), layer_parameters.end(), parameters.begin() + position);
 }
 
 
@@ -354,11 +385,17 @@ Vector< Vector<double> > PerceptronLayer::arrange_perceptrons_parameters(void) c
 {
     const size_t perceptrons_number = get_perceptrons_number();
 
+    const size_t perceptron_parameters_number = count_perceptron_parameters_number();
+
     Vector< Vector<double> > perceptrons_parameters(perceptrons_number);
 
     for(size_t i = 0; i < perceptrons_number; i++)
     {
-        perceptrons_parameters[i] = perceptrons[i].arrange_parameters();
+        perceptrons_parameters[i].set(perceptron_parameters_number);
+
+        std::copy(layer_parameters.begin() + i*perceptron_parameters_number,
+                  layer_parameters.begin() + (i+1)*perceptron_parameters_number,
+                  perceptrons_parameters[i].begin());
     }
 
     return(perceptrons_parameters);
@@ -376,7 +413,7 @@ const Perceptron::ActivationFunction& PerceptronLayer::get_activation_function(v
 
    if(perceptrons_number > 0)
    {
-      return(perceptrons[0].get_activation_function());
+      return(activation_function);
    }
    else
    {
@@ -398,9 +435,7 @@ const Perceptron::ActivationFunction& PerceptronLayer::get_activation_function(v
 
 std::string PerceptronLayer::write_activation_function(void) const
 {
-   const Perceptron::ActivationFunction activation_function = get_activation_function();
-
-   switch(activation_function)
+   switch(get_activation_function())
    {
       case Perceptron::Logistic:
       {
@@ -465,7 +500,11 @@ const bool& PerceptronLayer::get_display(void) const
 
 void PerceptronLayer::set(void)
 {
-   perceptrons.set();
+   inputs_number = 0;
+
+   layer_parameters.set();
+
+   activation_function = Perceptron::HyperbolicTangent;
 
    set_default();
 }
@@ -474,11 +513,13 @@ void PerceptronLayer::set(void)
 // void set(const Vector<Perceptron>&) method
 
 /// Sets a new layer from a given vector of perceptrons. 
+/// The biases and synaptic weights of the perceptrons are copied into the layer.
+/// All the perceptrons must have the same activation function, which becomes that of the layer. 
 /// The rest of members of this class are given their defaul values. 
 
 void PerceptronLayer::set(const Vector<Perceptron>& new_perceptrons)
 {
-   perceptrons = new_perceptrons;   
+   set_perceptrons(new_perceptrons);
 
    set_default();
 }
@@ -493,12 +534,13 @@ void PerceptronLayer::set(const Vector<Perceptron>& new_perceptrons)
 
 void PerceptronLayer::set(const size_t& new_inputs_number, const size_t& new_perceptrons_number)
 {
-   perceptrons.set(new_perceptrons_number);
+   activation_function = Perceptron::HyperbolicTangent;
 
-   for(size_t i = 0; i < new_perceptrons_number; i++)
-   {
-      perceptrons[i].set_inputs_number(new_inputs_number);
-   }
+   inputs_number = 0;
+
+   layer_parameters.set(new_perceptrons_number);
+
+   set_inputs_number(new_inputs_number);
    
    set_default();
 }
@@ -511,7 +553,11 @@ void PerceptronLayer::set(const size_t& new_inputs_number, const size_t& new_per
 
 void PerceptronLayer::set(const PerceptronLayer& other_perceptron_layer)
 {
-   perceptrons = other_perceptron_layer.perceptrons;
+   inputs_number = other_perceptron_layer.inputs_number;
+
+   layer_parameters = other_perceptron_layer.layer_parameters;
+
+   activation_function = other_perceptron_layer.activation_function;
    
    display = other_perceptron_layer.display;
 }
@@ -520,23 +566,117 @@ void PerceptronLayer::set(const PerceptronLayer& other_perceptron_layer)
 // void set_perceptrons(const Vector<Perceptron>&) method
 
 /// Sets a new vector of percpetrons in the layer. 
+/// All the perceptrons must have the same number of inputs and the same activation function, 
+/// which becomes the activation function of the layer. 
 /// @param new_perceptrons Perceptrons vector. 
 
 void PerceptronLayer::set_perceptrons(const Vector<Perceptron>& new_perceptrons) 
 {
-   perceptrons = new_perceptrons;
+   const size_t new_perceptrons_number = new_perceptrons.size();
+
+   // Control sentence
+
+   for(size_t i = 1; i < new_perceptrons_number; i++)
+   {
+      if(new_perceptrons[i].get_activation_function() != new_perceptrons[0].get_activation_function())
+      {
+         std::ostringstream buffer;
+
+         buffer << "OpenNN Exception: PerceptronLayer class.\n"
+                << "void set_perceptrons(const Vector<Perceptron>&) method.\n"
+                << "Activation function of perceptron " << i << " must be equal to that of the first perceptron, "
+                << "since all the perceptrons in a layer share the same activation function.\n";
+
+         throw std::logic_error(buffer.str());
+      }
+   }
+
+   if(new_perceptrons_number == 0)
+   {
+      inputs_number = 0;
+      layer_parameters.set();
+
+      return;
+   }
+
+   inputs_number = new_perceptrons[0].get_inputs_number();
+
+   activation_function = new_perceptrons[0].get_activation_function();
+
+   layer_parameters.set(new_perceptrons_number*(inputs_number+1));
+
+   for(size_t i = 0; i < new_perceptrons_number; i++)
+   {
+      set_perceptron(i, new_perceptrons[i]);
+   }
 }
 
 
 // void set_perceptron(const size_t&, const Perceptron&) method
 
 /// Sets a single perceptron in the layer. 
+/// Its bias and synaptic weights are copied into the layer. 
+/// All the perceptrons in a layer share the same activation function, 
+/// so the activation function of the perceptron must be that of the layer, unless the layer has a single perceptron. 
 /// @param i Index of perceptron. 
 /// @param new_perceptron Perceptron neuron to be set. 
 
 void PerceptronLayer::set_perceptron(const size_t& i, const Perceptron& new_perceptron)
 {
-   perceptrons[i] = new_perceptron;
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__ 
+
+   const size_t perceptrons_number = get_perceptrons_number();
+
+   if(i >= perceptrons_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: PerceptronLayer class.\n"
+             << "void set_perceptron(const size_t&, const Perceptron&) method.\n"
+             << "Index of perceptron must be less than layer size.\n";
+
+	  throw std::logic_error(buffer.str());
+   }
+
+   if(new_perceptron.get_inputs_number() != inputs_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: PerceptronLayer class.\n"
+             << "void set_perceptron(const size_t&, const Perceptron&) method.\n"
+             << "Number of inputs of perceptron must be equal to number of layer inputs.\n";
+
+	  throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   // Control sentence
+
+   if(new_perceptron.get_activation_function() != activation_function && get_perceptrons_number() > 1)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: PerceptronLayer class.\n"
+             << "void set_perceptron(const size_t&, const Perceptron&) method.\n"
+             << "Activation function of perceptron (" << new_perceptron.write_activation_function() << ") "
+             << "must be equal to that of the layer (" << write_activation_function() << ").\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   const size_t position = i*(inputs_number+1);
+
+   layer_parameters[position] = new_perceptron.get_bias();
+
+   for(size_t j = 0; j < inputs_number; j++)
+   {
+      layer_parameters[position+1+j] = new_perceptron.get_synaptic_weight(j);
+   }
+
+   activation_function = new_perceptron.get_activation_function();
 }
 
 
@@ -563,10 +703,18 @@ void PerceptronLayer::set_inputs_number(const size_t& new_inputs_number)
 {
    const size_t perceptrons_number = get_perceptrons_number();
 
-   for(size_t i = 0; i < perceptrons_number; i++)
+   if(perceptrons_number == 0)
+   {
+      inputs_number = 0;
+   }
+   else
    {
-      perceptrons[i].set_inputs_number(new_inputs_number);
+      inputs_number = new_inputs_number;
    }
+
+   layer_parameters.set(perceptrons_number*(inputs_number+1));
+
+   randomize_parameters_normal();
 }
 
 
@@ -578,19 +726,7 @@ void PerceptronLayer::set_inputs_number(const size_t& new_inputs_number)
 
 void PerceptronLayer::set_perceptrons_number(const size_t& new_perceptrons_number)
 {
-   const size_t perceptrons_number = get_perceptrons_number();
-   const size_t inputs_number = get_inputs_number();
-
-   if(perceptrons_number > 0)
-   {
-      const Perceptron::ActivationFunction& activation_function = get_activation_function();
-      perceptrons.set(new_perceptrons_number);
-      set_activation_function(activation_function); 
-   }
-   else
-   {
-      perceptrons.set(new_perceptrons_number);  
-   }
+   layer_parameters.set(new_perceptrons_number*(inputs_number+1));
 
    set_inputs_number(inputs_number);
 }
@@ -628,8 +764,8 @@ void PerceptronLayer::set_biases(const Vector<double>& new_biases)
 
    for(size_t i = 0; i < perceptrons_number; i++)
    {
-      perceptrons[i].set_bias(new_biases[i]); 
-   }   
+      layer_parameters[i*(inputs_number+1)] = new_biases[i];
+   }
 }
 
 
@@ -643,7 +779,6 @@ void PerceptronLayer::set_biases(const Vector<double>& new_biases)
 
 void PerceptronLayer::set_synaptic_weights(const Matrix<double>& new_synaptic_weights)
 {
-   const size_t inputs_number = get_inputs_number();
    const size_t perceptrons_number = get_perceptrons_number();
 
    // Control sentence (if debug)
@@ -680,7 +815,7 @@ void PerceptronLayer::set_synaptic_weights(const Matrix<double>& new_synaptic_we
    {
       for(size_t j = 0; j < inputs_number; j++)
       {
-         perceptrons[i].set_synaptic_weight(j, new_synaptic_weights(i,j));
+         layer_parameters[i*(inputs_number+1)+1+j] = new_synaptic_weights(i,j);
       }
    }
 }
@@ -693,8 +828,6 @@ void PerceptronLayer::set_synaptic_weights(const Matrix<double>& new_synaptic_we
 
 void PerceptronLayer::set_parameters(const Vector<double>& new_parameters)
 {
-   const size_t perceptrons_number = get_perceptrons_number();
-
    // Control sentence (if debug)
 
    #ifdef __OPENNN_DEBUG__ 
@@ -716,21 +849,41 @@ void PerceptronLayer::set_parameters(const Vector<double>& new_parameters)
 
    #endif
 
-   if(perceptrons_number != 0)
-   {
-      const size_t perceptron_parameters_number = perceptrons[0].count_parameters_number();
+   set_parameters(new_parameters, 0);
+}
 
-      Vector<double> perceptron_parameters(perceptron_parameters_number);
 
-      size_t position = 0;
+// void set_parameters(const Vector<double>&, const size_t&) method
 
-      for(size_t i = 0; i < perceptrons_number; i++)
-      {                  
-         perceptron_parameters = new_parameters.take_out(position, perceptron_parameters_number);
-         perceptrons[i].set_parameters(perceptron_parameters);
-         position += perceptron_parameters_number;
-      }
+/// Sets the parameters of this layer from a segment of a larger vector, with a single contiguous copy. 
+/// This allows a multilayer perceptron to scatter a single parameters buffer among its layers.
+/// @param new_parameters Vector containing the layer parameters.
+/// @param position Index of the first layer parameter in that vector.
+
+void PerceptronLayer::set_parameters(const Vector<double>& new_parameters, const size_t& position)
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__ 
+
+   const size_t parameters_number = count_parameters_number();
+
+   const size_t new_parameters_size = new_parameters.size();
+
+   if(position + parameters_number > new_parameters_size)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: PerceptronLayer class.\n"
+             << "void set_parameters(const Vector<double>&, const size_t&) method.\n"
+             << "Position plus number of parameters (" << position + parameters_number << ") must be less or equal than size of new parameters (" << new_parameters_size << ").\n";
+
+	  throw std::logic_error(buffer.str());
    }
+
+   #endif
+
+   std::copy(new_parameters.begin() + position, new_parameters.begin() + position + layer_parameters.size(), layer_parameters.begin());
 }
 
 
@@ -741,12 +894,7 @@ void PerceptronLayer::set_parameters(const Vector<double>& new_parameters)
 
 void PerceptronLayer::set_activation_function(const Perceptron::ActivationFunction& new_activation_function)
 {
-   const size_t perceptrons_number = get_perceptrons_number();
-
-   for(size_t i = 0; i < perceptrons_number; i++)
-   {
-      perceptrons[i].set_activation_function(new_activation_function);
-   }
+   activation_function = new_activation_function;
 }
 
 
@@ -758,12 +906,11 @@ void PerceptronLayer::set_activation_function(const Perceptron::ActivationFuncti
 
 void PerceptronLayer::set_activation_function(const std::string& new_activation_function)
 {
-   const size_t perceptrons_number = get_perceptrons_number();
+   Perceptron perceptron;
 
-   for(size_t i = 0; i < perceptrons_number; i++)
-   {
-      perceptrons[i].set_activation_function(new_activation_function);
-   }
+   perceptron.set_activation_function(new_activation_function);
+
+   activation_function = perceptron.get_activation_function();
 }
 
 
@@ -788,9 +935,20 @@ void PerceptronLayer::grow_input(void)
 {
    const size_t perceptrons_number = get_perceptrons_number();
 
-   for(size_t i = 0; i < perceptrons_number; i++)
+   if(perceptrons_number != 0)
    {
-      perceptrons[i].grow_input();
+      Vector<double> new_layer_parameters(perceptrons_number*(inputs_number+2), 0.0);
+
+      for(size_t i = 0; i < perceptrons_number; i++)
+      {
+         std::copy(layer_parameters.begin() + i*(inputs_number+1),
+                   layer_parameters.begin() + (i+1)*(inputs_number+1),
+                   new_layer_parameters.begin() + i*(inputs_number+2));
+      }
+
+      layer_parameters = new_layer_parameters;
+
+      inputs_number++;
    }
 }
 
@@ -801,13 +959,7 @@ void PerceptronLayer::grow_input(void)
 
 void PerceptronLayer::grow_perceptron(void)
 {
-   const size_t inputs_number = get_inputs_number();
-
-   Perceptron perceptron(inputs_number);
-
-   perceptron.initialize_parameters(0.0);
-
-   perceptrons.push_back(perceptron);
+   layer_parameters.insert(layer_parameters.end(), inputs_number+1, 0.0);
 }
 
 //void grow_perceptrons(const size_t&) mehtod
@@ -833,8 +985,6 @@ void PerceptronLayer::prune_input(const size_t& index)
 
     #ifdef __OPENNN_DEBUG__
 
-    const size_t inputs_number = get_inputs_number();
-
     if(index >= inputs_number)
     {
        std::ostringstream buffer;
@@ -850,9 +1000,32 @@ void PerceptronLayer::prune_input(const size_t& index)
 
    const size_t perceptrons_number = get_perceptrons_number();
 
-   for(size_t i = 0; i < perceptrons_number; i++)
+   if(perceptrons_number != 0)
    {
-      perceptrons[i].prune_input(index);
+      Vector<double> new_layer_parameters(perceptrons_number*inputs_number);
+
+      size_t new_position = 0;
+
+      for(size_t i = 0; i < perceptrons_number; i++)
+      {
+         const size_t position = i*(inputs_number+1);
+
+         new_layer_parameters[new_position] = layer_parameters[position];
+         new_position++;
+
+         for(size_t j = 0; j < inputs_number; j++)
+         {
+            if(j != index)
+            {
+               new_layer_parameters[new_position] = layer_parameters[position+1+j];
+               new_position++;
+            }
+         }
+      }
+
+      layer_parameters = new_layer_parameters;
+
+      inputs_number--;
    }
 }
 
@@ -883,7 +1056,12 @@ void PerceptronLayer::prune_perceptron(const size_t& index)
 
     #endif
 
-   perceptrons.erase(perceptrons.begin() + index);
+   layer_parameters.erase(layer_parameters.begin() + index*(inputs_number+1), layer_parameters.begin() + (index+1)*(inputs_number+1));
+
+   if(layer_parameters.empty())
+   {
+      inputs_number = 0;
+   }
 }
 
 
@@ -914,7 +1092,7 @@ void PerceptronLayer::initialize_biases(const double& value)
 
    for(size_t i = 0; i < perceptrons_number; i++)
    {
-      perceptrons[i].initialize_bias(value);
+      layer_parameters[i*(inputs_number+1)] = value;
    }
 }
 
@@ -930,7 +1108,7 @@ void PerceptronLayer::initialize_synaptic_weights(const double& value)
 
    for(size_t i = 0; i < perceptrons_number; i++)
    {
-      perceptrons[i].initialize_synaptic_weights(value);
+      std::fill(layer_parameters.begin() + i*(inputs_number+1) + 1, layer_parameters.begin() + (i+1)*(inputs_number+1), value);
    }
 }
 
@@ -1140,18 +1318,25 @@ Vector<double> PerceptronLayer::calculate_combinations(const Vector<double>& inp
 
    #endif
 
-   const size_t perceptrons_number = get_perceptrons_number();
+   if(inputs_number == 0)
+   {
+      return(layer_parameters);
+   }
 
    // Calculate combination to layer
 
-   Vector<double> combination(perceptrons_number);
-   
-   for(size_t i = 0; i < perceptrons_number; i++)
-   {         
-      combination[i] = perceptrons[i].calculate_combination(inputs);
-   }             
-   
-   return(combination);
+   const size_t perceptrons_number = get_perceptrons_number();
+
+   Vector<double> combinations(perceptrons_number);
+
+   const Eigen::Map<const Eigen::VectorXd> inputs_eigen(inputs.data(), inputs_number);
+   const Eigen::Map<const Eigen::VectorXd, 0, Eigen::InnerStride<> > biases_eigen(layer_parameters.data(), perceptrons_number, Eigen::InnerStride<>(inputs_number+1));
+   const Eigen::Map<const Eigen::MatrixXd, 0, Eigen::OuterStride<> > synaptic_weights_transpose_eigen(layer_parameters.data()+1, inputs_number, perceptrons_number, Eigen::OuterStride<>(inputs_number+1));
+   Eigen::Map<Eigen::VectorXd> combinations_eigen(combinations.data(), perceptrons_number);
+
+   combinations_eigen = synaptic_weights_transpose_eigen.transpose()*inputs_eigen + biases_eigen;
+
+   return(combinations);
 }
 
 
@@ -1233,21 +1418,79 @@ Vector<double> PerceptronLayer::calculate_combinations(const Vector<double>& inp
 
    const size_t perceptrons_number = get_perceptrons_number();
 
-   const size_t perceptron_parameters_number = count_perceptron_parameters_number();
+   if(perceptrons_number == 0 || inputs_number == 0)
+   {
+      return(parameters);
+   }
 
-   // Calculate combination to layer
+   // Calculate combination to layer, reading the biases and synaptic weights in place from the parameters
 
    Vector<double> combinations(perceptrons_number);
 
-   Vector<double> perceptron_parameters(perceptron_parameters_number);
+   const Eigen::Map<const Eigen::VectorXd> inputs_eigen(inputs.data(), inputs_number);
+   const Eigen::Map<const Eigen::VectorXd, 0, Eigen::InnerStride<> > biases_eigen(parameters.data(), perceptrons_number, Eigen::InnerStride<>(inputs_number+1));
+   const Eigen::Map<const Eigen::MatrixXd, 0, Eigen::OuterStride<> > synaptic_weights_transpose_eigen(parameters.data()+1, inputs_number, perceptrons_number, Eigen::OuterStride<>(inputs_number+1));
+   Eigen::Map<Eigen::VectorXd> combinations_eigen(combinations.data(), perceptrons_number);
 
-   for(size_t i = 0; i < perceptrons_number; i++)
-   {   
-       perceptron_parameters = parameters.take_out(i*perceptron_parameters_number, perceptron_parameters_number);
+   combinations_eigen = synaptic_weights_transpose_eigen.transpose()*inputs_eigen + biases_eigen;
+
+   return(combinations);
+}
+
+
+// Matrix<double> calculate_combinations(const Matrix<double>&) const method
+
+/// Returns the combinations of every perceptron in the layer for a batch of inputs.
+/// Each row of the inputs matrix is an instance, and each row of the returned matrix contains the combinations for that instance.
+/// The whole batch is computed with a single matrix product.
+/// @param inputs Matrix of inputs to the layer, with one instance per row.
+
+Matrix<double> PerceptronLayer::calculate_combinations(const Matrix<double>& inputs) const
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   const size_t inputs_columns_number = inputs.get_columns_number();
 
-       combinations[i] = perceptrons[i].calculate_combination(inputs, perceptron_parameters);
+   const size_t inputs_number = get_inputs_number();
+
+   if(inputs_columns_number != inputs_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: PerceptronLayer class.\n"
+             << "Matrix<double> calculate_combinations(const Matrix<double>&) const method.\n"
+             << "Number of columns of inputs (" << inputs_columns_number << ") must be equal to number of layer inputs (" << inputs_number << ").\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   const size_t instances_number = inputs.get_rows_number();
+   const size_t perceptrons_number = get_perceptrons_number();
+
+   if(instances_number == 0 || perceptrons_number == 0)
+   {
+      return(Matrix<double>());
    }
 
+   Matrix<double> combinations(instances_number, perceptrons_number, 0.0);
+
+   const Eigen::Map<const Eigen::VectorXd, 0, Eigen::InnerStride<> > biases_eigen(layer_parameters.data(), perceptrons_number, Eigen::InnerStride<>(inputs_number+1));
+   Eigen::Map<Eigen::MatrixXd> combinations_eigen(combinations.data(), instances_number, perceptrons_number);
+
+   if(inputs_number != 0)
+   {
+      const Eigen::Map<const Eigen::MatrixXd> inputs_eigen(inputs.data(), instances_number, inputs_number);
+      const Eigen::Map<const Eigen::MatrixXd, 0, Eigen::OuterStride<> > synaptic_weights_transpose_eigen(layer_parameters.data()+1, inputs_number, perceptrons_number, Eigen::OuterStride<>(inputs_number+1));
+
+      combinations_eigen.noalias() = inputs_eigen*synaptic_weights_transpose_eigen;
+   }
+
+   combinations_eigen.rowwise() += biases_eigen.transpose();
+
    return(combinations);
 }
 
@@ -1344,9 +1587,12 @@ Vector<double> PerceptronLayer::calculate_activations(const Vector<double>& comb
 
    Vector<double> activations(perceptrons_number);
 
+   Perceptron perceptron(0, 0.0);
+   perceptron.set_activation_function(activation_function);
+
    for(size_t i = 0; i < perceptrons_number; i++)
    {
-      activations[i] = perceptrons[i].calculate_activation(combinations[i]);
+      activations[i] = perceptron.calculate_activation(combinations[i]);
    }
 
    return(activations);
@@ -1385,9 +1631,12 @@ Vector<double> PerceptronLayer::calculate_activations_derivatives(const Vector<d
 
    Vector<double> activation_derivatives(perceptrons_number);
 
+   Perceptron perceptron(0, 0.0);
+   perceptron.set_activation_function(activation_function);
+
    for(size_t i = 0; i < perceptrons_number; i++)
    {          
-      activation_derivatives[i] = perceptrons[i].calculate_activation_derivative(combination[i]);
+      activation_derivatives[i] = perceptron.calculate_activation_derivative(combination[i]);
    }
 
    return(activation_derivatives);
@@ -1426,15 +1675,156 @@ Vector<double> PerceptronLayer::calculate_activations_second_derivatives(const V
 
    Vector<double> activation_second_derivatives(perceptrons_number);
 
+   Perceptron perceptron(0, 0.0);
+   perceptron.set_activation_function(activation_function);
+
    for(size_t i = 0; i < perceptrons_number; i++)
    {          
-      activation_second_derivatives[i] = perceptrons[i].calculate_activation_second_derivative(combination[i]);
+      activation_second_derivatives[i] = perceptron.calculate_activation_second_derivative(combination[i]);
    }
 
    return(activation_second_derivatives);
 }
 
 
+// Matrix<double> calculate_activations(const Matrix<double>&) const method
+
+/// Returns the activations of every perceptron in the layer for a batch of combinations.
+/// @param combinations Matrix of combinations, with one instance per row and one perceptron per column.
+
+Matrix<double> PerceptronLayer::calculate_activations(const Matrix<double>& combinations) const
+{
+   const size_t instances_number = combinations.get_rows_number();
+   const size_t perceptrons_number = get_perceptrons_number();
+
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   const size_t combinations_columns_number = combinations.get_columns_number();
+
+   if(combinations_columns_number != perceptrons_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: PerceptronLayer class.\n"
+             << "Matrix<double> calculate_activations(const Matrix<double>&) const method.\n"
+             << "Number of columns of combinations must be equal to number of neurons.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   Matrix<double> activations(instances_number, perceptrons_number);
+
+   Perceptron perceptron(0, 0.0);
+   perceptron.set_activation_function(activation_function);
+
+   for(size_t j = 0; j < perceptrons_number; j++)
+   {
+      for(size_t i = 0; i < instances_number; i++)
+      {
+         activations(i,j) = perceptron.calculate_activation(combinations(i,j));
+      }
+   }
+
+   return(activations);
+}
+
+
+// Matrix<double> calculate_activations_derivatives(const Matrix<double>&) const method
+
+/// Returns the activation derivatives of every perceptron in the layer for a batch of combinations.
+/// @param combinations Matrix of combinations, with one instance per row and one perceptron per column.
+
+Matrix<double> PerceptronLayer::calculate_activations_derivatives(const Matrix<double>& combinations) const
+{
+   const size_t instances_number = combinations.get_rows_number();
+   const size_t perceptrons_number = get_perceptrons_number();
+
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   const size_t combinations_columns_number = combinations.get_columns_number();
+
+   if(combinations_columns_number != perceptrons_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: PerceptronLayer class.\n"
+             << "Matrix<double> calculate_activations_derivatives(const Matrix<double>&) const method.\n"
+             << "Number of columns of combinations must be equal to number of neurons.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   Matrix<double> activations_derivatives(instances_number, perceptrons_number);
+
+   Perceptron perceptron(0, 0.0);
+   perceptron.set_activation_function(activation_function);
+
+   for(size_t j = 0; j < perceptrons_number; j++)
+   {
+      for(size_t i = 0; i < instances_number; i++)
+      {
+         activations_derivatives(i,j) = perceptron.calculate_activation_derivative(combinations(i,j));
+      }
+   }
+
+   return(activations_derivatives);
+}
+
+
+// Matrix<double> calculate_activations_second_derivatives(const Matrix<double>&) const method
+
+/// Returns the activation second derivatives of every perceptron in the layer for a batch of combinations.
+/// @param combinations Matrix of combinations, with one instance per row and one perceptron per column.
+
+Matrix<double> PerceptronLayer::calculate_activations_second_derivatives(const Matrix<double>& combinations) const
+{
+   const size_t instances_number = combinations.get_rows_number();
+   const size_t perceptrons_number = get_perceptrons_number();
+
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   const size_t combinations_columns_number = combinations.get_columns_number();
+
+   if(combinations_columns_number != perceptrons_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: PerceptronLayer class.\n"
+             << "Matrix<double> calculate_activations_second_derivatives(const Matrix<double>&) const method.\n"
+             << "Number of columns of combinations must be equal to number of neurons.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   Matrix<double> activations_second_derivatives(instances_number, perceptrons_number);
+
+   Perceptron perceptron(0, 0.0);
+   perceptron.set_activation_function(activation_function);
+
+   for(size_t j = 0; j < perceptrons_number; j++)
+   {
+      for(size_t i = 0; i < instances_number; i++)
+      {
+         activations_second_derivatives(i,j) = perceptron.calculate_activation_second_derivative(combinations(i,j));
+      }
+   }
+
+   return(activations_second_derivatives);
+}
+
+
 // Matrix<double> arrange_activations_Jacobian(const Vector<double>&) const method
 
 /// Arranges a "Jacobian" matrix from a vector of derivatives. 
@@ -1541,9 +1931,7 @@ Matrix<double> PerceptronLayer::calculate_Jacobian(const Vector<double>& inputs)
 
    const Vector<double> activations_derivatives = calculate_activations_derivatives(combinations);
 
-   const Matrix<double> synaptic_weights = arrange_synaptic_weights();
-
-   return(activations_derivatives*synaptic_weights);
+   return(activations_derivatives*arrange_synaptic_weights());
 }
 
 
@@ -1769,7 +2157,7 @@ std::string PerceptronLayer::write_expression(const Vector<std::string>& inputs_
 
    for(size_t i = 0; i < perceptrons_number; i++)
    {
-      buffer << perceptrons[i].write_expression(inputs_name, outputs_name[i]);      
+      buffer << get_perceptron(i).write_expression(inputs_name, outputs_name[i]);      
    }
 
    return(buffer.str());
@@ -69,8 +69,8 @@ public:
 
    bool is_empty(void) const;
 
-   const Vector<Perceptron>& get_perceptrons(void) const;
-   const Perceptron& get_perceptron(const size_t&) const;
+   Vector<Perceptron> get_perceptrons(void) const;
+   Perceptron get_perceptron(const size_t&) const;
 
    size_t get_inputs_number(void) const;
    size_t get_perceptrons_number(void) const;
@@ -82,6 +82,7 @@ public:
 
    size_t count_parameters_number(void) const;
    Vector<double> arrange_parameters(void) const;
+   void arrange_parameters(Vector<double>&, const size_t&) const;
 
    size_t count_perceptron_parameters_number(void) const;
    Vector< Vector<double> > arrange_perceptrons_parameters(void) const;
@@ -121,6 +122,7 @@ public:
    void set_synaptic_weights(const Matrix<double>&);
 
    void set_parameters(const Vector<double>&);
+   void set_parameters(const Vector<double>&, const size_t&);
 
    // Activation functions
 
@@ -173,6 +175,8 @@ public:
    Vector< Matrix<double> > calculate_combinations_Hessian_form(const Vector<double>&) const;
 
    Vector<double> calculate_combinations(const Vector<double>&, const Vector<double>&) const;
+
+   Matrix<double> calculate_combinations(const Matrix<double>&) const;
    Matrix<double> calculate_combinations_Jacobian(const Vector<double>&, const Vector<double>&) const;
    Vector< Matrix<double> > calculate_combinations_Hessian_form(const Vector<double>&, const Vector<double>&) const;
 
@@ -182,6 +186,10 @@ public:
    Vector<double> calculate_activations_derivatives(const Vector<double>&) const;
    Vector<double> calculate_activations_second_derivatives(const Vector<double>&) const;
 
+   Matrix<double> calculate_activations(const Matrix<double>&) const;
+   Matrix<double> calculate_activations_derivatives(const Matrix<double>&) const;
+   Matrix<double> calculate_activations_second_derivatives(const Matrix<double>&) const;
+
    Matrix<double> arrange_activations_Jacobian(const Vector<double>&) const;
    Vector< Matrix<double> > arrange_activations_Hessian_form(const Vector<double>&) const;
 
@@ -208,10 +216,19 @@ protected:
 
    // MEMBERS
 
-   /// Vectors of perceptrons which defines the layer.
-   /// The size of the vector is equal to the number of perceptrons in the layer.
+   /// Number of inputs to every perceptron in the layer.
+
+   size_t inputs_number;
+
+   /// Biases and synaptic weights of all the perceptrons in the layer, stored in a single buffer.
+   /// The order is that of the parameters vector: the bias of each perceptron followed by its synaptic weights.
+   /// The size of this vector is the number of perceptrons times one plus the number of inputs.
+
+   Vector<double> layer_parameters;
+
+   /// Activation function shared by all the perceptrons in the layer.
 
-   Vector<Perceptron> perceptrons;
+   Perceptron::ActivationFunction activation_function;
 
    /// Display messages to screen. 
 
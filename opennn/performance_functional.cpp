@@ -1118,6 +1118,108 @@ PerformanceTerm* PerformanceFunctional::get_user_objective_pointer(void) const
 }
 
 
+// PerformanceTerm* get_objective_term_pointer(void) const method
+
+/// Returns a pointer to the performance term which is used as objective, whatever its type. 
+/// If there is no objective term, it returns NULL.
+
+PerformanceTerm* PerformanceFunctional::get_objective_term_pointer(void) const
+{
+    switch(objective_type)
+    {
+        case NO_OBJECTIVE:
+        {
+            return(NULL);
+        }
+        break;
+
+        case SUM_SQUARED_ERROR_OBJECTIVE:
+        {
+            return(sum_squared_error_objective_pointer);
+        }
+        break;
+
+        case MEAN_SQUARED_ERROR_OBJECTIVE:
+        {
+            return(mean_squared_error_objective_pointer);
+        }
+        break;
+
+        case ROOT_MEAN_SQUARED_ERROR_OBJECTIVE:
+        {
+            return(root_mean_squared_error_objective_pointer);
+        }
+        break;
+
+        case NORMALIZED_SQUARED_ERROR_OBJECTIVE:
+        {
+            return(normalized_squared_error_objective_pointer);
+        }
+        break;
+
+        case MINKOWSKI_ERROR_OBJECTIVE:
+        {
+            return(Minkowski_error_objective_pointer);
+        }
+        break;
+
+        case CROSS_ENTROPY_ERROR_OBJECTIVE:
+        {
+            return(cross_entropy_error_objective_pointer);
+        }
+        break;
+
+        case OUTPUTS_INTEGRALS_OBJECTIVE:
+        {
+            return(outputs_integrals_objective_pointer);
+        }
+        break;
+
+        case SOLUTIONS_ERROR_OBJECTIVE:
+        {
+            return(solutions_error_objective_pointer);
+        }
+        break;
+
+        case FINAL_SOLUTIONS_ERROR_OBJECTIVE:
+        {
+            return(final_solutions_error_objective_pointer);
+        }
+        break;
+
+        case INDEPENDENT_PARAMETERS_ERROR_OBJECTIVE:
+        {
+            return(independent_parameters_error_objective_pointer);
+        }
+        break;
+
+        case INVERSE_SUM_SQUARED_ERROR_OBJECTIVE:
+        {
+            return(inverse_sum_squared_error_objective_pointer);
+        }
+        break;
+
+        case USER_OBJECTIVE:
+        {
+            return(user_objective_pointer);
+        }
+        break;
+
+        default:
+        {
+            std::ostringstream buffer;
+
+            buffer << "OpenNN Exception: PerformanceFunctional class.\n"
+                   << "PerformanceTerm* get_objective_term_pointer(void) const method.\n"
+                   << "Unknown objective type.\n";
+
+            throw std::logic_error(buffer.str());
+        }
+        break;
+    }
+}
+
+
 // NeuralParametersNorm* get_neural_parameters_norm_regularization_pointer(void) const method
 
 /// Returns a pointer to the neural parameters norm functional which is used as regularization.
@@ -4002,13 +4104,12 @@ Vector<double> PerformanceFunctional::calculate_objective_gradient(void) const
 }
 
 
-// Vector<double> calculate_objective_gradient(const Vector<double>&) const method
+// FirstOrderPerformance calculate_objective_performance_and_gradient(void) const method
 
-/// Returns the gradient of the objective, according to the objective type.
-/// That gradient is the vector of partial derivatives of the objective with respect to the parameters.
-/// The size is thus the number of parameters.
+/// Returns the objective and its gradient, according to the objective type.
+/// The objective term computes both quantities together, which for error terms means a single pass over the training instances.
 
-Vector<double> PerformanceFunctional::calculate_objective_gradient(const Vector<double>& parameters) const
+PerformanceTerm::FirstOrderPerformance PerformanceFunctional::calculate_objective_performance_and_gradient(void) const
 {
     // Control sentence (if debug)
 
@@ -4020,7 +4121,10 @@ Vector<double> PerformanceFunctional::calculate_objective_gradient(const Vector<
 
     const size_t parameters_number = neural_network_pointer->count_parameters_number();
 
-    Vector<double> gradient(parameters_number, 0.0);
+    PerformanceTerm::FirstOrderPerformance first_order_objective;
+
+    first_order_objective.performance = 0.0;
+    first_order_objective.gradient.set(parameters_number, 0.0);
 
     // Objective
 
@@ -4034,73 +4138,73 @@ Vector<double> PerformanceFunctional::calculate_objective_gradient(const Vector<
 
          case SUM_SQUARED_ERROR_OBJECTIVE:
          {
-             //gradient = sum_squared_error_objective_pointer->calculate_gradient(parameters);
+             first_order_objective = sum_squared_error_objective_pointer->calculate_performance_and_gradient();
          }
          break;
 
          case MEAN_SQUARED_ERROR_OBJECTIVE:
          {
-             //gradient = mean_squared_error_objective_pointer->calculate_gradient(parameters);
+             first_order_objective = mean_squared_error_objective_pointer->calculate_performance_and_gradient();
          }
          break;
 
          case ROOT_MEAN_SQUARED_ERROR_OBJECTIVE:
          {
-             //gradient = root_mean_squared_error_objective_pointer->calculate_gradient(parameters);
+             first_order_objective = root_mean_squared_error_objective_pointer->calculate_performance_and_gradient();
          }
          break;
 
          case NORMALIZED_SQUARED_ERROR_OBJECTIVE:
          {
-             //gradient = normalized_squared_error_objective_pointer->calculate_gradient(parameters);
+             first_order_objective = normalized_squared_error_objective_pointer->calculate_performance_and_gradient();
          }
          break;
 
          case MINKOWSKI_ERROR_OBJECTIVE:
          {
-             //gradient = Minkowski_error_objective_pointer->calculate_gradient(parameters);
+             first_order_objective = Minkowski_error_objective_pointer->calculate_performance_and_gradient();
          }
          break;
 
          case CROSS_ENTROPY_ERROR_OBJECTIVE:
          {
-             //gradient = cross_entropy_error_objective_pointer->calculate_gradient(parameters);
+             first_order_objective = cross_entropy_error_objective_pointer->calculate_performance_and_gradient();
          }
          break;
 
          case OUTPUTS_INTEGRALS_OBJECTIVE:
          {
-             //gradient = outputs_integrals_objective_pointer->calculate_gradient(parameters);
+             first_order_objective = outputs_integrals_objective_pointer->calculate_performance_and_gradient();
          }
          break;
 
          case SOLUTIONS_ERROR_OBJECTIVE:
          {
-             gradient = solutions_error_objective_pointer->calculate_gradient(parameters);
+             first_order_objective = solutions_error_objective_pointer->calculate_performance_and_gradient();
          }
          break;
 
          case FINAL_SOLUTIONS_ERROR_OBJECTIVE:
          {
-             gradient = final_solutions_error_objective_pointer->calculate_gradient(parameters);
+             first_order_objective = final_solutions_error_objective_pointer->calculate_performance_and_gradient();
          }
          break;
 
          case INDEPENDENT_PARAMETERS_ERROR_OBJECTIVE:
          {
-             //gradient = independent_parameters_error_objective_pointer->calculate_gradient(parameters);
+             first_order_objective = independent_parameters_error_objective_pointer->calculate_performance_and_gradient();
          }
          break;
 
          case INVERSE_SUM_SQUARED_ERROR_OBJECTIVE:
          {
-             gradient = inverse_sum_squared_error_objective_pointer->calculate_gradient(parameters);
+             first_order_objective = inverse_sum_squared_error_objective_pointer->calculate_performance_and_gradient();
          }
          break;
 
          case USER_OBJECTIVE:
          {
-             gradient = user_objective_pointer->calculate_gradient(parameters);
+             first_order_objective = user_objective_pointer->calculate_performance_and_gradient();
          }
          break;
 
@@ -4109,7 +4213,7 @@ Vector<double> PerformanceFunctional::calculate_objective_gradient(const Vector<
              std::ostringstream buffer;
 
              buffer << "OpenNN Exception: PerformanceFunctional class.\n"
-                    << "Vector<double> calculate_objective_gradient(const Vector<double>&) const method.\n"
+                    << "FirstOrderPerformance calculate_objective_performance_and_gradient(void) const method.\n"
                     << "Unknown objective type.\n";
 
              throw std::logic_error(buffer.str());
@@ -4117,17 +4221,17 @@ Vector<double> PerformanceFunctional::calculate_objective_gradient(const Vector<
          break;
      }
 
-     return(gradient);
+     return(first_order_objective);
 }
 
 
-// Vector<double> calculate_regularization_gradient(void) const method
+// SecondOrderTerms calculate_objective_second_order_terms(void) const method
 
-/// Returns the gradient of the regularization, according to the regularization type.
-/// That gradient is the vector of partial derivatives of the regularization with respect to the parameters.
-/// The size is thus the number of parameters.
+/// Returns the sum of squares of the objective terms, and the products of the transposed objective terms Jacobian 
+/// with the terms and with itself, according to the objective type.
+/// Error terms accumulate the products by batches of instances, without building the terms Jacobian.
 
-Vector<double> PerformanceFunctional::calculate_regularization_gradient(void) const
+PerformanceTerm::SecondOrderTerms PerformanceFunctional::calculate_objective_second_order_terms(void) const
 {
     // Control sentence (if debug)
 
@@ -4139,98 +4243,91 @@ Vector<double> PerformanceFunctional::calculate_regularization_gradient(void) co
 
     const size_t parameters_number = neural_network_pointer->count_parameters_number();
 
-    Vector<double> gradient(parameters_number, 0.0);
+    PerformanceTerm::SecondOrderTerms second_order_objective;
 
-    // Regularization
+    second_order_objective.performance = 0.0;
+    second_order_objective.JacobianT_dot_terms.set(parameters_number, 0.0);
+    second_order_objective.JacobianT_dot_Jacobian.set(parameters_number, parameters_number, 0.0);
 
-     switch(regularization_type)
+    // Objective
+
+     switch(objective_type)
      {
-         case NO_REGULARIZATION:
+         case NO_OBJECTIVE:
          {
              // Do nothing
          }
          break;
 
-         case NEURAL_PARAMETERS_NORM_REGULARIZATION:
+         case SUM_SQUARED_ERROR_OBJECTIVE:
          {
-             gradient = neural_parameters_norm_regularization_pointer->calculate_gradient();
+             second_order_objective = sum_squared_error_objective_pointer->calculate_second_order_terms();
          }
          break;
 
-         case OUTPUTS_INTEGRALS_REGULARIZATION:
+         case MEAN_SQUARED_ERROR_OBJECTIVE:
          {
-             gradient = outputs_integrals_regularization_pointer->calculate_gradient();
+             second_order_objective = mean_squared_error_objective_pointer->calculate_second_order_terms();
          }
          break;
 
-         case USER_REGULARIZATION:
+         case ROOT_MEAN_SQUARED_ERROR_OBJECTIVE:
          {
-             gradient = user_regularization_pointer->calculate_gradient();
+             second_order_objective = root_mean_squared_error_objective_pointer->calculate_second_order_terms();
          }
          break;
 
-         default:
+         case NORMALIZED_SQUARED_ERROR_OBJECTIVE:
          {
-             std::ostringstream buffer;
-
-             buffer << "OpenNN Exception: PerformanceFunctional class.\n"
-                    << "Vector<double> calculate_regularization_gradient(void) const method.\n"
-                    << "Unknown regularization type.\n";
-
-             throw std::logic_error(buffer.str());
+             second_order_objective = normalized_squared_error_objective_pointer->calculate_second_order_terms();
          }
          break;
-     }
-
-    return(gradient);
-}
-
-
-// Vector<double> calculate_regularization_gradient(const Vector<double>&) const method
-
-/// Returns the gradient of the regularization, according to the regularization type.
-/// That gradient is the vector of partial derivatives of the regularization with respect to the parameters.
-/// The size is thus the number of parameters.
-
-Vector<double> PerformanceFunctional::calculate_regularization_gradient(const Vector<double>& parameters) const
-{
-    // Control sentence (if debug)
-
-    #ifdef __OPENNN_DEBUG__
-
-    check_neural_network();
 
-    #endif
+         case MINKOWSKI_ERROR_OBJECTIVE:
+         {
+             second_order_objective = Minkowski_error_objective_pointer->calculate_second_order_terms();
+         }
+         break;
 
-    const size_t parameters_number = neural_network_pointer->count_parameters_number();
+         case CROSS_ENTROPY_ERROR_OBJECTIVE:
+         {
+             second_order_objective = cross_entropy_error_objective_pointer->calculate_second_order_terms();
+         }
+         break;
 
-    Vector<double> gradient(parameters_number, 0.0);
+         case OUTPUTS_INTEGRALS_OBJECTIVE:
+         {
+             second_order_objective = outputs_integrals_objective_pointer->calculate_second_order_terms();
+         }
+         break;
 
-    // Regularization
+         case SOLUTIONS_ERROR_OBJECTIVE:
+         {
+             second_order_objective = solutions_error_objective_pointer->calculate_second_order_terms();
+         }
+         break;
 
-     switch(regularization_type)
-     {
-         case NO_REGULARIZATION:
+         case FINAL_SOLUTIONS_ERROR_OBJECTIVE:
          {
-             // Do nothing
+             second_order_objective = final_solutions_error_objective_pointer->calculate_second_order_terms();
          }
          break;
 
-         case NEURAL_PARAMETERS_NORM_REGULARIZATION:
+         case INDEPENDENT_PARAMETERS_ERROR_OBJECTIVE:
          {
-             //gradient = neural_parameters_norm_regularization_pointer->calculate_gradient(parameters);
+             second_order_objective = independent_parameters_error_objective_pointer->calculate_second_order_terms();
          }
          break;
 
-         case OUTPUTS_INTEGRALS_REGULARIZATION:
+         case INVERSE_SUM_SQUARED_ERROR_OBJECTIVE:
          {
-             //gradient = outputs_integrals_regularization_pointer->calculate_gradient(parameters);
+             second_order_objective = inverse_sum_squared_error_objective_pointer->calculate_second_order_terms();
          }
          break;
 
-         case USER_REGULARIZATION:
+         case USER_OBJECTIVE:
          {
-             gradient = user_regularization_pointer->calculate_gradient(parameters);
+             second_order_objective = user_objective_pointer->calculate_second_order_terms();
          }
          break;
 
@@ -4239,25 +4336,25 @@ Vector<double> PerformanceFunctional::calculate_regularization_gradient(const Ve
              std::ostringstream buffer;
 
              buffer << "OpenNN Exception: PerformanceFunctional class.\n"
-                    << "Vector<double> calculate_regularization_gradient(const Vector<double>&) const method.\n"
-                    << "Unknown regularization type.\n";
+                    << "SecondOrderTerms calculate_objective_second_order_terms(void) const method.\n"
+                    << "Unknown objective type.\n";
 
              throw std::logic_error(buffer.str());
          }
          break;
      }
 
-    return(gradient);
+     return(second_order_objective);
 }
 
 
-// Vector<double> calculate_constraints_gradient(void) const method
+// Vector<double> calculate_objective_gradient(const Vector<double>&) const method
 
-/// Returns the gradient of the constraints, according to the objective type.
-/// That gradient is the vector of partial derivatives of the constraints with respect to the parameters.
+/// Returns the gradient of the objective, according to the objective type.
+/// That gradient is the vector of partial derivatives of the objective with respect to the parameters.
 /// The size is thus the number of parameters.
 
-Vector<double> PerformanceFunctional::calculate_constraints_gradient(void) const
+Vector<double> PerformanceFunctional::calculate_objective_gradient(const Vector<double>& parameters) const
 {
     // Control sentence (if debug)
 
@@ -4271,64 +4368,313 @@ Vector<double> PerformanceFunctional::calculate_constraints_gradient(void) const
 
     Vector<double> gradient(parameters_number, 0.0);
 
-    // Constraints
+    // Objective
 
-     switch(constraints_type)
+     switch(objective_type)
      {
-         case NO_CONSTRAINTS:
+         case NO_OBJECTIVE:
          {
              // Do nothing
          }
          break;
 
-         case OUTPUTS_INTEGRALS_CONSTRAINTS:
+         case SUM_SQUARED_ERROR_OBJECTIVE:
          {
-             gradient = outputs_integrals_constraints_pointer->calculate_gradient();
+             //gradient = sum_squared_error_objective_pointer->calculate_gradient(parameters);
          }
          break;
 
-         case SOLUTIONS_ERROR_CONSTRAINTS:
+         case MEAN_SQUARED_ERROR_OBJECTIVE:
          {
-             gradient = solutions_error_constraints_pointer->calculate_gradient();
+             //gradient = mean_squared_error_objective_pointer->calculate_gradient(parameters);
          }
          break;
 
-         case FINAL_SOLUTIONS_ERROR_CONSTRAINTS:
+         case ROOT_MEAN_SQUARED_ERROR_OBJECTIVE:
          {
-             gradient = final_solutions_error_constraints_pointer->calculate_gradient();
+             //gradient = root_mean_squared_error_objective_pointer->calculate_gradient(parameters);
          }
          break;
 
-         case INDEPENDENT_PARAMETERS_ERROR_CONSTRAINTS:
+         case NORMALIZED_SQUARED_ERROR_OBJECTIVE:
          {
-             gradient = independent_parameters_error_constraints_pointer->calculate_gradient();
+             //gradient = normalized_squared_error_objective_pointer->calculate_gradient(parameters);
          }
          break;
 
-         case USER_CONSTRAINTS:
+         case MINKOWSKI_ERROR_OBJECTIVE:
          {
-             gradient = user_constraints_pointer->calculate_gradient();
+             //gradient = Minkowski_error_objective_pointer->calculate_gradient(parameters);
          }
          break;
 
-         default:
+         case CROSS_ENTROPY_ERROR_OBJECTIVE:
          {
-             std::ostringstream buffer;
-
-             buffer << "OpenNN Exception: PerformanceFunctional class.\n"
-                    << "Vector<double> calculate_constraints_gradient(void) const method.\n"
-                    << "Unknown constraints type.\n";
-
-             throw std::logic_error(buffer.str());
+             //gradient = cross_entropy_error_objective_pointer->calculate_gradient(parameters);
          }
          break;
-     }
 
-     return(gradient);
-}
+         case OUTPUTS_INTEGRALS_OBJECTIVE:
+         {
+             //gradient = outputs_integrals_objective_pointer->calculate_gradient(parameters);
+         }
+         break;
 
+         case SOLUTIONS_ERROR_OBJECTIVE:
+         {
+             gradient = solutions_error_objective_pointer->calculate_gradient(parameters);
+         }
+         break;
 
-// Vector<double> calculate_constraints_gradient(const Vector<double>&) const method
+         case FINAL_SOLUTIONS_ERROR_OBJECTIVE:
+         {
+             gradient = final_solutions_error_objective_pointer->calculate_gradient(parameters);
+         }
+         break;
+
+         case INDEPENDENT_PARAMETERS_ERROR_OBJECTIVE:
+         {
+             //gradient = independent_parameters_error_objective_pointer->calculate_gradient(parameters);
+         }
+         break;
+
+         case INVERSE_SUM_SQUARED_ERROR_OBJECTIVE:
+         {
+             gradient = inverse_sum_squared_error_objective_pointer->calculate_gradient(parameters);
+         }
+         break;
+
+         case USER_OBJECTIVE:
+         {
+             gradient = user_objective_pointer->calculate_gradient(parameters);
+         }
+         break;
+
+         default:
+         {
+             std::ostringstream buffer;
+
+             buffer << "OpenNN Exception: PerformanceFunctional class.\n"
+                    << "Vector<double> calculate_objective_gradient(const Vector<double>&) const method.\n"
+                    << "Unknown objective type.\n";
+
+             throw std::logic_error(buffer.str());
+         }
+         break;
+     }
+
+     return(gradient);
+}
+
+
+// Vector<double> calculate_regularization_gradient(void) const method
+
+/// Returns the gradient of the regularization, according to the regularization type.
+/// That gradient is the vector of partial derivatives of the regularization with respect to the parameters.
+/// The size is thus the number of parameters.
+
+Vector<double> PerformanceFunctional::calculate_regularization_gradient(void) const
+{
+    // Control sentence (if debug)
+
+    #ifdef __OPENNN_DEBUG__
+
+    check_neural_network();
+
+    #endif
+
+    const size_t parameters_number = neural_network_pointer->count_parameters_number();
+
+    Vector<double> gradient(parameters_number, 0.0);
+
+    // Regularization
+
+     switch(regularization_type)
+     {
+         case NO_REGULARIZATION:
+         {
+             // Do nothing
+         }
+         break;
+
+         case NEURAL_PARAMETERS_NORM_REGULARIZATION:
+         {
+             gradient = neural_parameters_norm_regularization_pointer->calculate_gradient();
+         }
+         break;
+
+         case OUTPUTS_INTEGRALS_REGULARIZATION:
+         {
+             gradient = outputs_integrals_regularization_pointer->calculate_gradient();
+         }
+         break;
+
+         case USER_REGULARIZATION:
+         {
+             gradient = user_regularization_pointer->calculate_gradient();
+         }
+         break;
+
+         default:
+         {
+             std::ostringstream buffer;
+
+             buffer << "OpenNN Exception: PerformanceFunctional class.\n"
+                    << "Vector<double> calculate_regularization_gradient(void) const method.\n"
+                    << "Unknown regularization type.\n";
+
+             throw std::logic_error(buffer.str());
+         }
+         break;
+     }
+
+    return(gradient);
+}
+
+
+// Vector<double> calculate_regularization_gradient(const Vector<double>&) const method
+
+/// Returns the gradient of the regularization, according to the regularization type.
+/// That gradient is the vector of partial derivatives of the regularization with respect to the parameters.
+/// The size is thus the number of parameters.
+
+Vector<double> PerformanceFunctional::calculate_regularization_gradient(const Vector<double>& parameters) const
+{
+    // Control sentence (if debug)
+
+    #ifdef __OPENNN_DEBUG__
+
+    check_neural_network();
+
+    #endif
+
+    const size_t parameters_number = neural_network_pointer->count_parameters_number();
+
+    Vector<double> gradient(parameters_number, 0.0);
+
+    // Regularization
+
+     switch(regularization_type)
+     {
+         case NO_REGULARIZATION:
+         {
+             // Do nothing
+         }
+         break;
+
+         case NEURAL_PARAMETERS_NORM_REGULARIZATION:
+         {
+             //gradient = neural_parameters_norm_regularization_pointer->calculate_gradient(parameters);
+         }
+         break;
+
+         case OUTPUTS_INTEGRALS_REGULARIZATION:
+         {
+             //gradient = outputs_integrals_regularization_pointer->calculate_gradient(parameters);
+         }
+         break;
+
+         case USER_REGULARIZATION:
+         {
+             gradient = user_regularization_pointer->calculate_gradient(parameters);
+         }
+         break;
+
+         default:
+         {
+             std::ostringstream buffer;
+
+             buffer << "OpenNN Exception: PerformanceFunctional class.\n"
+                    << "Vector<double> calculate_regularization_gradient(const Vector<double>&) const method.\n"
+                    << "Unknown regularization type.\n";
+
+             throw std::logic_error(buffer.str());
+         }
+         break;
+     }
+
+    return(gradient);
+}
+
+
+// Vector<double> calculate_constraints_gradient(void) const method
+
+/// Returns the gradient of the constraints, according to the objective type.
+/// That gradient is the vector of partial derivatives of the constraints with respect to the parameters.
+/// The size is thus the number of parameters.
+
+Vector<double> PerformanceFunctional::calculate_constraints_gradient(void) const
+{
+    // Control sentence (if debug)
+
+    #ifdef __OPENNN_DEBUG__
+
+    check_neural_network();
+
+    #endif
+
+    const size_t parameters_number = neural_network_pointer->count_parameters_number();
+
+    Vector<double> gradient(parameters_number, 0.0);
+
+    // Constraints
+
+     switch(constraints_type)
+     {
+         case NO_CONSTRAINTS:
+         {
+             // Do nothing
+         }
+         break;
+
+         case OUTPUTS_INTEGRALS_CONSTRAINTS:
+         {
+             gradient = outputs_integrals_constraints_pointer->calculate_gradient();
+         }
+         break;
+
+         case SOLUTIONS_ERROR_CONSTRAINTS:
+         {
+             gradient = solutions_error_constraints_pointer->calculate_gradient();
+         }
+         break;
+
+         case FINAL_SOLUTIONS_ERROR_CONSTRAINTS:
+         {
+             gradient = final_solutions_error_constraints_pointer->calculate_gradient();
+         }
+         break;
+
+         case INDEPENDENT_PARAMETERS_ERROR_CONSTRAINTS:
+         {
+             gradient = independent_parameters_error_constraints_pointer->calculate_gradient();
+         }
+         break;
+
+         case USER_CONSTRAINTS:
+         {
+             gradient = user_constraints_pointer->calculate_gradient();
+         }
+         break;
+
+         default:
+         {
+             std::ostringstream buffer;
+
+             buffer << "OpenNN Exception: PerformanceFunctional class.\n"
+                    << "Vector<double> calculate_constraints_gradient(void) const method.\n"
+                    << "Unknown constraints type.\n";
+
+             throw std::logic_error(buffer.str());
+         }
+         break;
+     }
+
+     return(gradient);
+}
+
+
+// Vector<double> calculate_constraints_gradient(const Vector<double>&) const method
 
 /// Returns the gradient of the constraints, according to the objective type.
 /// That gradient is the vector of partial derivatives of the constraints with respect to the parameters.
@@ -4930,6 +5276,267 @@ Matrix<double> PerformanceFunctional::calculate_constraints_Hessian(const Vector
 }
 
 
+// Vector<double> calculate_objective_vector_dot_Hessian(const Vector<double>&) const method
+
+/// Returns the product of the objective Hessian with a vector, according to the objective type.
+/// Each performance term computes it in its own way, and error terms do it without forming the Hessian matrix.
+/// @param vector Vector in the dot product, with size the number of parameters. 
+
+Vector<double> PerformanceFunctional::calculate_objective_vector_dot_Hessian(const Vector<double>& vector) const
+{
+    // Control sentence (if debug)
+
+    #ifdef __OPENNN_DEBUG__
+
+    check_neural_network();
+
+    #endif
+
+    const size_t parameters_number = neural_network_pointer->count_parameters_number();
+
+    Vector<double> vector_Hessian_product(parameters_number, 0.0);
+
+    // Objective
+
+     switch(objective_type)
+     {
+         case NO_OBJECTIVE:
+         {
+             // Do nothing
+         }
+         break;
+
+         case SUM_SQUARED_ERROR_OBJECTIVE:
+         {
+             vector_Hessian_product = sum_squared_error_objective_pointer->calculate_vector_dot_Hessian(vector);
+         }
+         break;
+
+         case MEAN_SQUARED_ERROR_OBJECTIVE:
+         {
+             vector_Hessian_product = mean_squared_error_objective_pointer->calculate_vector_dot_Hessian(vector);
+         }
+         break;
+
+         case ROOT_MEAN_SQUARED_ERROR_OBJECTIVE:
+         {
+             vector_Hessian_product = root_mean_squared_error_objective_pointer->calculate_vector_dot_Hessian(vector);
+         }
+         break;
+
+         case NORMALIZED_SQUARED_ERROR_OBJECTIVE:
+         {
+             vector_Hessian_product = normalized_squared_error_objective_pointer->calculate_vector_dot_Hessian(vector);
+         }
+         break;
+
+         case MINKOWSKI_ERROR_OBJECTIVE:
+         {
+             vector_Hessian_product = Minkowski_error_objective_pointer->calculate_vector_dot_Hessian(vector);
+         }
+         break;
+
+         case CROSS_ENTROPY_ERROR_OBJECTIVE:
+         {
+             vector_Hessian_product = cross_entropy_error_objective_pointer->calculate_vector_dot_Hessian(vector);
+         }
+         break;
+
+         case OUTPUTS_INTEGRALS_OBJECTIVE:
+         {
+             vector_Hessian_product = outputs_integrals_objective_pointer->calculate_vector_dot_Hessian(vector);
+         }
+         break;
+
+         case SOLUTIONS_ERROR_OBJECTIVE:
+         {
+             vector_Hessian_product = solutions_error_objective_pointer->calculate_vector_dot_Hessian(vector);
+         }
+         break;
+
+         case FINAL_SOLUTIONS_ERROR_OBJECTIVE:
+         {
+             vector_Hessian_product = final_solutions_error_objective_pointer->calculate_vector_dot_Hessian(vector);
+         }
+         break;
+
+         case INDEPENDENT_PARAMETERS_ERROR_OBJECTIVE:
+         {
+             vector_Hessian_product = independent_parameters_error_objective_pointer->calculate_vector_dot_Hessian(vector);
+         }
+         break;
+
+         case INVERSE_SUM_SQUARED_ERROR_OBJECTIVE:
+         {
+             vector_Hessian_product = inverse_sum_squared_error_objective_pointer->calculate_vector_dot_Hessian(vector);
+         }
+         break;
+
+         case USER_OBJECTIVE:
+         {
+             vector_Hessian_product = user_objective_pointer->calculate_vector_dot_Hessian(vector);
+         }
+         break;
+
+         default:
+         {
+             std::ostringstream buffer;
+
+             buffer << "OpenNN Exception: PerformanceFunctional class.\n"
+                    << "Vector<double> calculate_objective_vector_dot_Hessian(const Vector<double>&) const method.\n"
+                    << "Unknown objective type.\n";
+
+             throw std::logic_error(buffer.str());
+         }
+         break;
+     }
+
+    return(vector_Hessian_product);
+}
+
+
+// Vector<double> calculate_regularization_vector_dot_Hessian(const Vector<double>&) const method
+
+/// Returns the product of the regularization Hessian with a vector, according to the regularization type.
+/// Each performance term computes it in its own way, and error terms do it without forming the Hessian matrix.
+/// @param vector Vector in the dot product, with size the number of parameters. 
+
+Vector<double> PerformanceFunctional::calculate_regularization_vector_dot_Hessian(const Vector<double>& vector) const
+{
+    // Control sentence (if debug)
+
+    #ifdef __OPENNN_DEBUG__
+
+    check_neural_network();
+
+    #endif
+
+    const size_t parameters_number = neural_network_pointer->count_parameters_number();
+
+    Vector<double> vector_Hessian_product(parameters_number, 0.0);
+
+    // Regularization
+
+     switch(regularization_type)
+     {
+         case NO_REGULARIZATION:
+         {
+             // Do nothing
+         }
+         break;
+
+         case NEURAL_PARAMETERS_NORM_REGULARIZATION:
+         {
+             vector_Hessian_product = neural_parameters_norm_regularization_pointer->calculate_vector_dot_Hessian(vector);
+         }
+         break;
+
+         case OUTPUTS_INTEGRALS_REGULARIZATION:
+         {
+             vector_Hessian_product = outputs_integrals_regularization_pointer->calculate_vector_dot_Hessian(vector);
+         }
+         break;
+
+         case USER_REGULARIZATION:
+         {
+             vector_Hessian_product = user_regularization_pointer->calculate_vector_dot_Hessian(vector);
+         }
+         break;
+
+         default:
+         {
+             std::ostringstream buffer;
+
+             buffer << "OpenNN Exception: PerformanceFunctional class.\n"
+                    << "Vector<double> calculate_regularization_vector_dot_Hessian(const Vector<double>&) const method.\n"
+                    << "Unknown regularization type.\n";
+
+             throw std::logic_error(buffer.str());
+         }
+         break;
+     }
+
+     return(vector_Hessian_product);
+}
+
+
+// Vector<double> calculate_constraints_vector_dot_Hessian(const Vector<double>&) const method
+
+/// Returns the product of the constraints Hessian with a vector, according to the constraints type.
+/// Each performance term computes it in its own way, and error terms do it without forming the Hessian matrix.
+/// @param vector Vector in the dot product, with size the number of parameters. 
+
+Vector<double> PerformanceFunctional::calculate_constraints_vector_dot_Hessian(const Vector<double>& vector) const
+{
+    // Control sentence (if debug)
+
+    #ifdef __OPENNN_DEBUG__
+
+    check_neural_network();
+
+    #endif
+
+    const size_t parameters_number = neural_network_pointer->count_parameters_number();
+
+    Vector<double> vector_Hessian_product(parameters_number, 0.0);
+
+    // Constraints
+
+     switch(constraints_type)
+     {
+         case NO_CONSTRAINTS:
+         {
+             // Do nothing
+         }
+         break;
+
+         case OUTPUTS_INTEGRALS_CONSTRAINTS:
+         {
+             vector_Hessian_product = outputs_integrals_constraints_pointer->calculate_vector_dot_Hessian(vector);
+         }
+         break;
+
+         case SOLUTIONS_ERROR_CONSTRAINTS:
+         {
+             vector_Hessian_product = solutions_error_constraints_pointer->calculate_vector_dot_Hessian(vector);
+         }
+         break;
+
+         case FINAL_SOLUTIONS_ERROR_CONSTRAINTS:
+         {
+             vector_Hessian_product = final_solutions_error_constraints_pointer->calculate_vector_dot_Hessian(vector);
+         }
+         break;
+
+         case INDEPENDENT_PARAMETERS_ERROR_CONSTRAINTS:
+         {
+             vector_Hessian_product = independent_parameters_error_constraints_pointer->calculate_vector_dot_Hessian(vector);
+         }
+         break;
+
+         case USER_CONSTRAINTS:
+         {
+             vector_Hessian_product = user_constraints_pointer->calculate_vector_dot_Hessian(vector);
+         }
+         break;
+
+         default:
+         {
+             std::ostringstream buffer;
+
+             buffer << "OpenNN Exception: PerformanceFunctional class.\n"
+                    << "Vector<double> calculate_constraints_vector_dot_Hessian(const Vector<double>&) const method.\n"
+                    << "Unknown constraints type.\n";
+
+             throw std::logic_error(buffer.str());
+         }
+         break;
+     }
+
+     return(vector_Hessian_product);
+}
+
+
 // double calculate_performance(void) const method
 
 /// Calculates the evaluation value of the performance functional,
@@ -5253,6 +5860,35 @@ Vector<double> PerformanceFunctional::calculate_gradient(void) const
 }
 
 
+// FirstOrderperformance calculate_performance_and_gradient(void) const method
+
+/// Returns the performance and the gradient of the performance functional. 
+/// The objective term evaluates both quantities from the same pass over the data, 
+/// so this is cheaper than calling calculate_performance() and calculate_gradient() separately.
+
+PerformanceFunctional::FirstOrderperformance PerformanceFunctional::calculate_performance_and_gradient(void) const
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__ 
+
+    check_neural_network();
+
+    check_performance_terms();
+
+   #endif
+
+   const PerformanceTerm::FirstOrderPerformance first_order_objective = calculate_objective_performance_and_gradient();
+
+   FirstOrderperformance first_order_performance;
+
+   first_order_performance.performance = first_order_objective.performance + calculate_regularization() + calculate_constraints();
+   first_order_performance.gradient = first_order_objective.gradient + calculate_regularization_gradient() + calculate_constraints_gradient();
+
+   return(first_order_performance);
+}
+
+
 // Vector<double> calculate_gradient(const Vector<double>&) const method
 
 /// Returns the performance gradient for a given vector of parameters.
@@ -5410,22 +6046,36 @@ Matrix<double> PerformanceFunctional::calculate_terms_Jacobian(void) const
 }
 
 
+// PerformanceTerm::SecondOrderTerms calculate_second_order_terms(void) const method
+
+/// Returns the sum of squares of the performance terms, and the products of the transposed terms Jacobian with the terms and with itself. 
+/// As in calculate_terms_Jacobian(), only the objective terms are considered. 
+/// This is all that the Levenberg-Marquardt algorithm needs, and it takes memory proportional to the squared number of parameters only.
+
+PerformanceTerm::SecondOrderTerms PerformanceFunctional::calculate_second_order_terms(void) const
+{
+    // Control sentence (if debug)
+
+    #ifdef __OPENNN_DEBUG__
+
+     check_neural_network();
+
+     check_performance_terms();
+
+    #endif
+
+    return(calculate_objective_second_order_terms());
+}
+
+
 // Matrix<double> calculate_inverse_Hessian(void) const method
 
 /// Returns inverse matrix of the Hessian.
-/// It first computes the Hessian matrix and then computes its inverse. 
-/// @todo
+/// It first computes the Hessian matrix and then inverts it through a LDLT factorization, 
+/// which exploits symmetry and also exists for indefinite Hessians.
 
 Matrix<double> PerformanceFunctional::calculate_inverse_Hessian(void) const
 {  
-   std::ostringstream buffer;
-
-   buffer << "OpenNN Exception: PerformanceFunctional class.\n"
-          << "Matrix<double> calculate_inverse_Hessian(void) const method.\n"
-          << "This method is not yet implemented.\n";
-
-   throw std::logic_error(buffer.str());	  
-
    // Control sentence (if debug)
 
    #ifdef __OPENNN_DEBUG__
@@ -5436,18 +6086,21 @@ Matrix<double> PerformanceFunctional::calculate_inverse_Hessian(void) const
 
    #endif
 
-//   const Matrix<double> Hessian = calculate_Hessian();
-         
-//   return(Hessian.calculate_inverse());
+   const Matrix<double> Hessian = calculate_Hessian();
+
+   const LDLTFactorization<double> Hessian_factorization(Hessian);
+
+   return(Hessian_factorization.calculate_inverse());
 }
 
 
 // Vector<double> calculate_vector_dot_Hessian(Vector<double>) const method
 
-/// Returns the default product of some vector with the objective function Hessian matrix, which is
-/// computed using numerical differentiation.
+/// Returns the product of some vector with the performance functional Hessian matrix, 
+/// as the sum of the products with the objective, regularization and constraints Hessians. 
+/// The error terms compute their product with the R-operator of Pearlmutter, 
+/// which costs about two gradient evaluations and does not form the Hessian matrix.
 /// @param vector Vector in the dot product. 
-/// @todo
 
 Vector<double> PerformanceFunctional::calculate_vector_dot_Hessian(const Vector<double>& vector) const
 {
@@ -5481,9 +6134,9 @@ Vector<double> PerformanceFunctional::calculate_vector_dot_Hessian(const Vector<
 
    // Calculate vector Hessian product
 
-   Vector<double> vector_Hessian_product(parameters_number);
-
-   return(vector_Hessian_product);
+   return(calculate_objective_vector_dot_Hessian(vector)
+        + calculate_regularization_vector_dot_Hessian(vector)
+        + calculate_constraints_vector_dot_Hessian(vector));
 }
 
 
@@ -5507,12 +6160,7 @@ PerformanceFunctional::ZeroOrderperformance PerformanceFunctional::calculate_zer
 
 PerformanceFunctional::FirstOrderperformance PerformanceFunctional::calculate_first_order_performance(void) const
 {
-   FirstOrderperformance first_order_performance;
-
-   first_order_performance.performance = calculate_performance();
-   first_order_performance.gradient = calculate_gradient();
-
-   return(first_order_performance);
+   return(calculate_performance_and_gradient());
 }
 
 
@@ -5638,9 +6286,9 @@ double PerformanceFunctional::calculate_second_order_Taylor_approximation(const
 double PerformanceFunctional::calculate_performance(const Vector<double>& direction, const double& rate) const
 {
    const Vector<double> parameters = neural_network_pointer->arrange_parameters();
-   const Vector<double> increment = direction*rate;
+   const Vector<double> potential_parameters = parameters.lazy() + direction.lazy()*rate;
 
-   return(calculate_performance(parameters + increment));
+   return(calculate_performance(potential_parameters));
 }
 
 
@@ -5658,7 +6306,7 @@ double PerformanceFunctional::calculate_performance_derivative(const Vector<doub
     }
 
     const Vector<double> parameters = neural_network_pointer->arrange_parameters();
-    const Vector<double> potential_parameters = parameters + direction*rate;
+    const Vector<double> potential_parameters = parameters.lazy() + direction.lazy()*rate;
 
    const Vector<double> gradient = calculate_gradient(potential_parameters);
 
@@ -5682,7 +6330,7 @@ double PerformanceFunctional::calculate_performance_second_derivative(const Vect
     }
 
     const Vector<double> parameters = neural_network_pointer->arrange_parameters();
-    const Vector<double> potential_parameters = parameters + direction*rate;
+    const Vector<double> potential_parameters = parameters.lazy() + direction.lazy()*rate;
 
    const Matrix<double> Hessian = calculate_Hessian(potential_parameters);
 
@@ -295,6 +295,8 @@ public:
    InverseSumSquaredError* get_inverse_sum_squared_error_objective_pointer(void) const;
    PerformanceTerm* get_user_objective_pointer(void) const;
 
+   PerformanceTerm* get_objective_term_pointer(void) const;
+
    // Regularization terms
 
    NeuralParametersNorm* get_neural_parameters_norm_regularization_pointer(void) const;
@@ -381,6 +383,8 @@ public:
    Vector<double> calculate_constraints_gradient(void) const;
 
    Vector<double> calculate_objective_gradient(const Vector<double>&) const;
+
+   PerformanceTerm::FirstOrderPerformance calculate_objective_performance_and_gradient(void) const;
    Vector<double> calculate_regularization_gradient(const Vector<double>&) const;
    Vector<double> calculate_constraints_gradient(const Vector<double>&) const;
 
@@ -388,10 +392,16 @@ public:
    Matrix<double> calculate_regularization_Hessian(void) const;
    Matrix<double> calculate_constraints_Hessian(void) const;
 
+   PerformanceTerm::SecondOrderTerms calculate_objective_second_order_terms(void) const;
+
    Matrix<double> calculate_objective_Hessian(const Vector<double>&) const;
    Matrix<double> calculate_regularization_Hessian(const Vector<double>&) const;
    Matrix<double> calculate_constraints_Hessian(const Vector<double>&) const;
 
+   Vector<double> calculate_objective_vector_dot_Hessian(const Vector<double>&) const;
+   Vector<double> calculate_regularization_vector_dot_Hessian(const Vector<double>&) const;
+   Vector<double> calculate_constraints_vector_dot_Hessian(const Vector<double>&) const;
+
    double calculate_performance(void) const;
    Vector<double> calculate_gradient(void) const;
    Matrix<double> calculate_Hessian(void) const;
@@ -400,6 +410,8 @@ public:
    Vector<double> calculate_gradient(const Vector<double>&) const;
    Matrix<double> calculate_Hessian(const Vector<double>&) const;
 
+   FirstOrderperformance calculate_performance_and_gradient(void) const;
+
    virtual Matrix<double> calculate_inverse_Hessian(void) const;
 
    virtual Vector<double> calculate_vector_dot_Hessian(const Vector<double>&) const;
@@ -407,6 +419,8 @@ public:
    Vector<double> calculate_terms(void) const;
    Matrix<double> calculate_terms_Jacobian(void) const;
 
+   PerformanceTerm::SecondOrderTerms calculate_second_order_terms(void) const;
+
    virtual ZeroOrderperformance calculate_zero_order_performance(void) const;
    virtual FirstOrderperformance calculate_first_order_performance(void) const;
    virtual SecondOrderperformance calculate_second_order_performance(void) const;
@@ -11,6 +11,12 @@
 /*                                                                                                              */
 /****************************************************************************************************************/
 
+// System includes
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 // OpenNN includes
 
 #include "performance_term.h"
@@ -188,6 +194,8 @@ PerformanceTerm::PerformanceTerm(const PerformanceTerm& other_performance_term)
    }
 
    display = other_performance_term.display;  
+
+   batch_instances_number = other_performance_term.batch_instances_number;
 }
 
 
@@ -232,6 +240,8 @@ PerformanceTerm& PerformanceTerm::operator = (const PerformanceTerm& other_perfo
       }
 
       display = other_performance_term.display;
+
+      batch_instances_number = other_performance_term.batch_instances_number;
    }
 
    return(*this);
@@ -291,6 +301,16 @@ const bool& PerformanceTerm::get_display(void) const
 }
 
 
+// const size_t& get_batch_instances_number(void) const method
+
+/// Returns the number of instances which are propagated together by the parallel reduction methods.
+
+const size_t& PerformanceTerm::get_batch_instances_number(void) const
+{
+   return(batch_instances_number);
+}
+
+
 // bool has_neural_network(void) const method
 
 /// Returns true if this performance term has a neural network associated,
@@ -507,6 +527,8 @@ void PerformanceTerm::set(const PerformanceTerm& other_performance_term)
    }
 
    display = other_performance_term.display;  
+
+   batch_instances_number = other_performance_term.batch_instances_number;
 }
 
 
@@ -557,11 +579,14 @@ void PerformanceTerm::set_numerical_differentiation_pointer(NumericalDifferentia
 /// Sets the members of the performance term to their default values:
 /// <ul>
 /// <li> Display: true.
+/// <li> Batch instances number: 1000.
 /// </ul>
 
 void PerformanceTerm::set_default(void)
 {
    display = true;
+
+   batch_instances_number = 1000;
 }
 
 
@@ -578,6 +603,34 @@ void PerformanceTerm::set_display(const bool& new_display)
 }
 
 
+// void set_batch_instances_number(const size_t&) method
+
+/// Sets the number of instances which are propagated together by the parallel reduction methods.
+/// @param new_batch_instances_number Number of instances in each batch.
+
+void PerformanceTerm::set_batch_instances_number(const size_t& new_batch_instances_number)
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_batch_instances_number == 0)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: PerformanceTerm class.\n"
+             << "void set_batch_instances_number(const size_t&) method.\n"
+             << "Batch instances number must be greater than zero.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   batch_instances_number = new_batch_instances_number;
+}
+
+
 // void construct_numerical_differentiation(void) method
 
 /// This method constructs the numerical differentiation object which composes the performance term class. 
@@ -1077,7 +1130,7 @@ double PerformanceTerm::calculate_performance_output_combinations(const Vector<d
 
 //    const Variables& variables = data_set_pointer->get_variables();
 
-//    const Vector<size_t> targets_indices = variables.arrange_targets_indices();
+//    const Vector<size_t>& targets_indices = variables.arrange_targets_indices();
 
 //    targets = data_set_pointer->get_instance(0, targets_indices);
 
@@ -1542,7 +1595,8 @@ Vector<double> PerformanceTerm::calculate_gradient(const Vector<double>& paramet
 
 // Matrix<double> calculate_Hessian(void) const method
 
-/// @todo
+/// Returns the default Hessian matrix of the performance term.
+/// It uses numerical differentiation.
 
 Matrix<double> PerformanceTerm::calculate_Hessian(void) const
 {
@@ -1556,13 +1610,15 @@ Matrix<double> PerformanceTerm::calculate_Hessian(void) const
 
    const Vector<double> parameters = neural_network_pointer->arrange_parameters();
 
-   return(numerical_differentiation_pointer->calculate_Hessian(*this, &PerformanceTerm::calculate_performance, parameters));
+   return(calculate_Hessian(parameters));
 }
 
 
 // Matrix<double> calculate_Hessian(const Vector<double>&) const method
 
-/// @todo
+/// Returns the default Hessian matrix of the performance term for a hypothetical vector of parameters.
+/// It uses numerical differentiation, with default settings if the numerical differentiation object has not been constructed.
+/// @param parameters Vector of potential parameters for the neural network associated to the performance term.
 
 Matrix<double> PerformanceTerm::calculate_Hessian(const Vector<double>& parameters) const
 {
@@ -1574,74 +1630,1039 @@ Matrix<double> PerformanceTerm::calculate_Hessian(const Vector<double>& paramete
 
    #endif
 
-   return(numerical_differentiation_pointer->calculate_Hessian(*this, &PerformanceTerm::calculate_performance, parameters));
+   if(numerical_differentiation_pointer)
+   {
+      return(numerical_differentiation_pointer->calculate_Hessian(*this, &PerformanceTerm::calculate_performance, parameters));
+   }
+
+   const NumericalDifferentiation numerical_differentiation;
+
+   return(numerical_differentiation.calculate_Hessian(*this, &PerformanceTerm::calculate_performance, parameters));
 }
 
 
-// Vector<double> calculate_terms(void) const method 
+// FirstOrderPerformance calculate_performance_and_gradient(void) const method
 
-/// Returns the performance of all the subterms composing the performance term.
+/// Returns the performance and the gradient of the performance term in a single structure. 
+/// By default, they are computed separately. 
+/// Error terms override this method so that both quantities come from the same pass over the data.
 
-Vector<double> PerformanceTerm::calculate_terms(void) const
+PerformanceTerm::FirstOrderPerformance PerformanceTerm::calculate_performance_and_gradient(void) const
+{
+   FirstOrderPerformance first_order_performance;
+
+   first_order_performance.performance = calculate_performance();
+   first_order_performance.gradient = calculate_gradient();
+
+   return(first_order_performance);
+}
+
+
+// Vector<double> calculate_vector_dot_Hessian(const Vector<double>&) const method
+
+/// Returns the product of the Hessian matrix of the performance term with a vector. 
+/// By default, the Hessian matrix is formed. 
+/// Error terms which provide the calculate_batch_output_Hessian_dot() kernel override this method 
+/// with an exact product which never forms that matrix.
+/// @param vector Vector in the dot product, with size the number of parameters. 
+
+Vector<double> PerformanceTerm::calculate_vector_dot_Hessian(const Vector<double>& vector) const
+{
+   return(calculate_Hessian().dot(vector));
+}
+
+
+// double calculate_error_normalization_coefficient(void) const method
+
+/// Returns the coefficient which divides the sum of the errors of the training instances to give this performance term. 
+/// Training algorithms which evaluate subsets of instances with calculate_error_sum_and_gradient_sum() 
+/// use it to scale those sums as the whole term. 
+/// Error terms which use the parallel reduction methods must override it.
+
+double PerformanceTerm::calculate_error_normalization_coefficient(void) const
 {
     std::ostringstream buffer;
 
     buffer << "OpenNN Exception: PerformanceTerm class.\n"
-           << "Vector<double> calculate_terms(void) const method.\n"
-           << "The terms function is not defined for this performance term.\n";
+           << "double calculate_error_normalization_coefficient(void) const method.\n"
+           << "The error normalization coefficient is not defined for this performance term.\n";
 
     throw std::logic_error(buffer.str());
 }
 
 
-// Vector<double> calculate_terms(const Vector<double>&) const method 
+// double calculate_batch_error(const Matrix<double>&, const Matrix<double>&) const method
 
-/// Returns the performance of all the subterms composing the performance term.
+/// Returns the error of a batch of instances, as the sum of the errors of each instance. 
+/// This is the value kernel of the parallel reduction methods, and error terms which use them must override it.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
 
-Vector<double> PerformanceTerm::calculate_terms(const Vector<double>&) const
+double PerformanceTerm::calculate_batch_error(const Matrix<double>&, const Matrix<double>&) const
 {
     std::ostringstream buffer;
 
     buffer << "OpenNN Exception: PerformanceTerm class.\n"
-           << "Vector<double> calculate_terms(const Vector<double>&) const method.\n"
-           << "The terms function is not defined for this performance term.\n";
+           << "double calculate_batch_error(const Matrix<double>&, const Matrix<double>&) const method.\n"
+           << "The batch error is not defined for this performance term.\n";
 
     throw std::logic_error(buffer.str());
 }
 
 
-// Matrix<double> calculate_terms_Jacobian(void) const method 
+// Matrix<double> calculate_batch_output_gradient(const Matrix<double>&, const Matrix<double>&) const method
 
-/// Returns the Jacobian matrix of the subterms composing the performance term.
+/// Returns the derivatives of the error of each instance in a batch with respect to its outputs. 
+/// This is the gradient kernel of the parallel reduction methods, and error terms which use them must override it.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
 
-Matrix<double> PerformanceTerm::calculate_terms_Jacobian(void) const
+Matrix<double> PerformanceTerm::calculate_batch_output_gradient(const Matrix<double>&, const Matrix<double>&) const
 {
     std::ostringstream buffer;
 
     buffer << "OpenNN Exception: PerformanceTerm class.\n"
-           << "Matrix<double> calculate_terms_Jacobian(void) const method.\n"
-           << "The terms function is not defined for this performance term.\n";
+           << "Matrix<double> calculate_batch_output_gradient(const Matrix<double>&, const Matrix<double>&) const method.\n"
+           << "The batch output gradient is not defined for this performance term.\n";
 
     throw std::logic_error(buffer.str());
 }
 
 
-// PerformanceTerm::FirstOrderTerms calculate_first_order_terms(void) const
+// Matrix<double> calculate_batch_terms_output_gradient(const Matrix<double>&, const Matrix<double>&) const method
 
-/// Returns the performance of all the subterms composing the performance term.
+/// Returns the derivatives of the term of each instance in a batch with respect to its outputs. 
+/// This is the Jacobian row kernel of the parallel reduction methods, and error terms which use them must override it.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
 
-PerformanceTerm::FirstOrderTerms PerformanceTerm::calculate_first_order_terms(void) const
+Matrix<double> PerformanceTerm::calculate_batch_terms_output_gradient(const Matrix<double>&, const Matrix<double>&) const
 {
     std::ostringstream buffer;
 
     buffer << "OpenNN Exception: PerformanceTerm class.\n"
-           << "Vector<double> calculate_terms(void) const method.\n"
-           << "The terms function is not defined for this performance term.\n";
+           << "Matrix<double> calculate_batch_terms_output_gradient(const Matrix<double>&, const Matrix<double>&) const method.\n"
+           << "The batch terms output gradient is not defined for this performance term.\n";
+
+    throw std::logic_error(buffer.str());
+}
+
+
+// Vector<double> calculate_batch_terms(const Matrix<double>&, const Matrix<double>&) const method
+
+/// Returns the term of each instance in a batch. 
+/// This is the terms kernel of the parallel reduction methods, and error terms which use them must override it.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
+
+Vector<double> PerformanceTerm::calculate_batch_terms(const Matrix<double>&, const Matrix<double>&) const
+{
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: PerformanceTerm class.\n"
+           << "Vector<double> calculate_batch_terms(const Matrix<double>&, const Matrix<double>&) const method.\n"
+           << "The batch terms are not defined for this performance term.\n";
+
+    throw std::logic_error(buffer.str());
+}
+
+
+// Matrix<double> calculate_batch_output_Hessian_dot(const Matrix<double>&, const Matrix<double>&, const Matrix<double>&) const method
+
+/// Returns the product of the Hessian of the error of each instance in a batch with respect to its outputs 
+/// with a direction in the outputs space. 
+/// This is the kernel of calculate_error_vector_dot_Hessian_sum(), and error terms which use it must override it.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
+/// @param outputs_direction Direction of each instance in the outputs space, with one instance per row.
+
+Matrix<double> PerformanceTerm::calculate_batch_output_Hessian_dot(const Matrix<double>&, const Matrix<double>&, const Matrix<double>&) const
+{
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: PerformanceTerm class.\n"
+           << "Matrix<double> calculate_batch_output_Hessian_dot(const Matrix<double>&, const Matrix<double>&, const Matrix<double>&) const method.\n"
+           << "The batch output Hessian is not defined for this performance term.\n";
 
     throw std::logic_error(buffer.str());
 }
 
 
+// Vector< Vector<size_t> > arrange_batches_positions(const Vector<size_t>&) const method
+
+/// Splits a list of instances into the batches processed by the parallel reduction methods. 
+/// Instances with missing values are left out.
+/// Each batch contains the positions in the given list of at most batch_instances_number instances.
+/// If the data set is backed by a binary data file, consecutive instances of the same block go to the same batches,
+/// and a new batch is started whenever the block changes.
+/// @param instances_indices Indices of the instances in the data set.
+
+Vector< Vector<size_t> > PerformanceTerm::arrange_batches_positions(const Vector<size_t>& instances_indices) const
+{
+   const MissingValues& missing_values = data_set_pointer->get_missing_values();
+
+   const size_t instances_number = instances_indices.size();
+
+   Vector<size_t> complete_positions;
+   complete_positions.reserve(instances_number);
+
+   for(size_t i = 0; i < instances_number; i++)
+   {
+      if(!missing_values.has_missing_values(instances_indices[i]))
+      {
+         complete_positions.push_back(i);
+      }
+   }
+
+   const size_t complete_instances_number = complete_positions.size();
+
+   const DataBlocks* data_blocks_pointer = data_set_pointer->get_data_blocks_pointer();
+
+   if(data_blocks_pointer != NULL)
+   {
+      Vector< Vector<size_t> > batches_positions;
+
+      size_t batch_begin = 0;
+
+      while(batch_begin < complete_instances_number)
+      {
+         const size_t block_index = data_blocks_pointer->get_block_index(instances_indices[complete_positions[batch_begin]]);
+
+         size_t batch_end = batch_begin + 1;
+
+         while(batch_end < complete_instances_number
+            && batch_end - batch_begin < batch_instances_number
+            && data_blocks_pointer->get_block_index(instances_indices[complete_positions[batch_end]]) == block_index)
+         {
+            batch_end++;
+         }
+
+         batches_positions.push_back(complete_positions.take_out(batch_begin, batch_end - batch_begin));
+
+         batch_begin = batch_end;
+      }
+
+      return(batches_positions);
+   }
+
+   const size_t batches_number = (complete_instances_number + batch_instances_number - 1)/batch_instances_number;
+
+   Vector< Vector<size_t> > batches_positions(batches_number);
+
+   for(size_t i = 0; i < batches_number; i++)
+   {
+      const size_t batch_begin = i*batch_instances_number;
+      const size_t batch_size = std::min(batch_instances_number, complete_instances_number - batch_begin);
+
+      batches_positions[i] = complete_positions.take_out(batch_begin, batch_size);
+   }
+
+   return(batches_positions);
+}
+
+
+// Vector<size_t> arrange_batches_blocks(const Vector<size_t>&, const Vector< Vector<size_t> >&) const method
+
+/// Groups the batches of a list of instances by the block of the binary data file which contains them.
+/// It returns the index of the first batch of each group, followed by the number of batches.
+/// The groups are processed one after the other, so that only a window of blocks needs to be resident.
+/// If the data set is not backed by a binary data file, all the batches form a single group.
+/// @param instances_indices Indices of the instances in the data set.
+/// @param batches_positions Positions in the list of the instances of each batch, as given by arrange_batches_positions().
+
+Vector<size_t> PerformanceTerm::arrange_batches_blocks(const Vector<size_t>& instances_indices, const Vector< Vector<size_t> >& batches_positions) const
+{
+   const size_t batches_number = batches_positions.size();
+
+   const DataBlocks* data_blocks_pointer = data_set_pointer->get_data_blocks_pointer();
+
+   Vector<size_t> blocks_batches(1, 0);
+
+   if(data_blocks_pointer != NULL)
+   {
+      for(size_t i = 1; i < batches_number; i++)
+      {
+         if(data_blocks_pointer->get_block_index(instances_indices[batches_positions[i][0]])
+         != data_blocks_pointer->get_block_index(instances_indices[batches_positions[i-1][0]]))
+         {
+            blocks_batches.push_back(i);
+         }
+      }
+   }
+
+   blocks_batches.push_back(batches_number);
+
+   return(blocks_batches);
+}
+
+
+// double calculate_error_sum(const Vector<size_t>&) const method
+
+/// Returns the sum of the errors of a list of instances, as given by the calculate_batch_error() kernel. 
+/// The instances are propagated in batches, which are distributed among the threads.
+/// Instances with missing values are not taken into account.
+/// @param instances_indices Indices of the instances in the data set.
+
+double PerformanceTerm::calculate_error_sum(const Vector<size_t>& instances_indices) const
+{
+   #ifdef __OPENNN_DEBUG__
+
+   check();
+
+   #endif
+
+   // Neural network stuff
+
+   const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
+
+   const bool has_conditions_layer = neural_network_pointer->has_conditions_layer();
+
+   const ConditionsLayer* conditions_layer_pointer = has_conditions_layer ? neural_network_pointer->get_conditions_layer_pointer() : NULL;
+
+   // Data set stuff
+
+   const Variables& variables = data_set_pointer->get_variables();
+
+   const Vector<size_t>& inputs_indices = variables.arrange_inputs_indices();
+   const Vector<size_t>& targets_indices = variables.arrange_targets_indices();
+
+   const Vector< Vector<size_t> > batches_positions = arrange_batches_positions(instances_indices);
+
+   const size_t batches_number = batches_positions.size();
+
+   // Each batch writes its own error, so that no synchronization is needed
+
+   Vector<double> batches_error(batches_number, 0.0);
+
+   Vector<size_t> batch_indices;
+
+   Matrix<double> batch_inputs;
+   Matrix<double> batch_targets;
+   Matrix<double> batch_outputs;
+
+   const DataBlocks* data_blocks_pointer = data_set_pointer->get_data_blocks_pointer();
+
+   const Vector<size_t> blocks_batches = arrange_batches_blocks(instances_indices, batches_positions);
+
+   const size_t blocks_number = blocks_batches.size() - 1;
+
+   int i;
+
+   for(size_t j = 0; j < blocks_number; j++)
+   {
+      // The next block is read in the background while the batches of this one are processed
+
+      if(data_blocks_pointer != NULL && j+1 < blocks_number)
+      {
+         data_blocks_pointer->prefetch_block(data_blocks_pointer->get_block_index(instances_indices[batches_positions[blocks_batches[j+1]][0]]));
+      }
+
+      #pragma omp parallel for private(i, batch_indices, batch_inputs, batch_targets, batch_outputs) schedule(dynamic)
+
+      for(i = (int)blocks_batches[j]; i < (int)blocks_batches[j+1]; i++)
+      {
+         batch_indices = instances_indices.arrange_subvector(batches_positions[i]);
+
+         batch_inputs = data_set_pointer->arrange_data_submatrix(batch_indices, inputs_indices);
+         batch_targets = data_set_pointer->arrange_data_submatrix(batch_indices, targets_indices);
+
+         batch_outputs = multilayer_perceptron_pointer->calculate_outputs(batch_inputs);
+
+         if(has_conditions_layer)
+         {
+            batch_outputs = conditions_layer_pointer->calculate_particular_solution(batch_inputs)
+                          + conditions_layer_pointer->calculate_homogeneous_solution(batch_inputs)*batch_outputs;
+         }
+
+         batches_error[i] = calculate_batch_error(batch_outputs, batch_targets);
+      }
+
+      if(data_blocks_pointer != NULL && blocks_batches[j] < blocks_batches[j+1])
+      {
+         data_blocks_pointer->release_block(data_blocks_pointer->get_block_index(instances_indices[batches_positions[blocks_batches[j]][0]]));
+      }
+   }
+
+   return(batches_error.calculate_sum());
+}
+
+
+// Vector<double> calculate_error_gradient_sum(const Vector<size_t>&) const method
+
+/// Returns the sum of the error gradients of a list of instances with respect to the neural parameters. 
+/// See calculate_error_sum_and_gradient_sum() for the details of the reduction.
+/// @param instances_indices Indices of the instances in the data set.
+
+Vector<double> PerformanceTerm::calculate_error_gradient_sum(const Vector<size_t>& instances_indices) const
+{
+   return(calculate_error_sum_and_gradient_sum(instances_indices).gradient);
+}
+
+
+// FirstOrderPerformance calculate_error_sum_and_gradient_sum(const Vector<size_t>&) const method
+
+/// Returns both the sum of the errors and the sum of the error gradients of a list of instances, 
+/// computed from a single forward propagation of each batch. 
+/// The output gradients are given by the calculate_batch_output_gradient() kernel, and back-propagated through the multilayer perceptron. 
+/// The batches are distributed among the threads, which accumulate their errors and gradients separately. 
+/// These partial gradients are finally combined with a tree reduction, so that no critical section is needed.
+/// Instances with missing values are not taken into account.
+/// @param instances_indices Indices of the instances in the data set.
+
+PerformanceTerm::FirstOrderPerformance PerformanceTerm::calculate_error_sum_and_gradient_sum(const Vector<size_t>& instances_indices) const
+{
+   #ifdef __OPENNN_DEBUG__
+
+   check();
+
+   #endif
+
+   // Neural network stuff
+
+   const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
+
+   const size_t layers_number = multilayer_perceptron_pointer->get_layers_number();
+
+   const size_t parameters_number = multilayer_perceptron_pointer->count_parameters_number();
+
+   const bool has_conditions_layer = neural_network_pointer->has_conditions_layer();
+
+   const ConditionsLayer* conditions_layer_pointer = has_conditions_layer ? neural_network_pointer->get_conditions_layer_pointer() : NULL;
+
+   // Data set stuff
+
+   const Variables& variables = data_set_pointer->get_variables();
+
+   const Vector<size_t>& inputs_indices = variables.arrange_inputs_indices();
+   const Vector<size_t>& targets_indices = variables.arrange_targets_indices();
+
+   const Vector< Vector<size_t> > batches_positions = arrange_batches_positions(instances_indices);
+
+   // Thread local accumulators
+
+   #ifdef _OPENMP
+
+   const size_t threads_number = (size_t)omp_get_max_threads();
+
+   #else
+
+   const size_t threads_number = 1;
+
+   #endif
+
+   Vector<double> threads_error(threads_number, 0.0);
+   Vector< Vector<double> > threads_gradient(threads_number, Vector<double>(parameters_number, 0.0));
+
+   Vector<size_t> batch_indices;
+
+   Matrix<double> batch_inputs;
+   Matrix<double> batch_targets;
+   Matrix<double> batch_outputs;
+   Matrix<double> batch_homogeneous_solution;
+
+   Vector< Vector< Matrix<double> > > batch_forward_propagation;
+
+   Matrix<double> batch_outputs_gradient;
+
+   size_t thread_index;
+
+   const DataBlocks* data_blocks_pointer = data_set_pointer->get_data_blocks_pointer();
+
+   const Vector<size_t> blocks_batches = arrange_batches_blocks(instances_indices, batches_positions);
+
+   const size_t blocks_number = blocks_batches.size() - 1;
+
+   int i;
+
+   for(size_t j = 0; j < blocks_number; j++)
+   {
+      // The next block is read in the background while the batches of this one are processed
+
+      if(data_blocks_pointer != NULL && j+1 < blocks_number)
+      {
+         data_blocks_pointer->prefetch_block(data_blocks_pointer->get_block_index(instances_indices[batches_positions[blocks_batches[j+1]][0]]));
+      }
+
+      #pragma omp parallel for private(i, thread_index, batch_indices, batch_inputs, batch_targets, batch_outputs, batch_homogeneous_solution, \
+       batch_forward_propagation, batch_outputs_gradient) schedule(dynamic)
+
+      for(i = (int)blocks_batches[j]; i < (int)blocks_batches[j+1]; i++)
+      {
+         #ifdef _OPENMP
+
+         thread_index = (size_t)omp_get_thread_num();
+
+         #else
+
+         thread_index = 0;
+
+         #endif
+
+         batch_indices = instances_indices.arrange_subvector(batches_positions[i]);
+
+         batch_inputs = data_set_pointer->arrange_data_submatrix(batch_indices, inputs_indices);
+         batch_targets = data_set_pointer->arrange_data_submatrix(batch_indices, targets_indices);
+
+         batch_forward_propagation = multilayer_perceptron_pointer->calculate_first_order_forward_propagation(batch_inputs);
+
+         if(!has_conditions_layer)
+         {
+            const Matrix<double>& outputs = batch_forward_propagation[0][layers_number-1];
+
+            threads_error[thread_index] += calculate_batch_error(outputs, batch_targets);
+
+            batch_outputs_gradient = calculate_batch_output_gradient(outputs, batch_targets);
+         }
+         else
+         {
+            batch_homogeneous_solution = conditions_layer_pointer->calculate_homogeneous_solution(batch_inputs);
+
+            batch_outputs = conditions_layer_pointer->calculate_particular_solution(batch_inputs)
+                          + batch_homogeneous_solution*batch_forward_propagation[0][layers_number-1];
+
+            threads_error[thread_index] += calculate_batch_error(batch_outputs, batch_targets);
+
+            batch_outputs_gradient = batch_homogeneous_solution*calculate_batch_output_gradient(batch_outputs, batch_targets);
+         }
+
+         threads_gradient[thread_index] += multilayer_perceptron_pointer->calculate_error_gradient(batch_inputs, batch_forward_propagation, batch_outputs_gradient);
+      }
+
+      if(data_blocks_pointer != NULL && blocks_batches[j] < blocks_batches[j+1])
+      {
+         data_blocks_pointer->release_block(data_blocks_pointer->get_block_index(instances_indices[batches_positions[blocks_batches[j]][0]]));
+      }
+   }
+
+   FirstOrderPerformance first_order_performance;
+
+   first_order_performance.performance = threads_error.calculate_sum();
+   first_order_performance.gradient = calculate_tree_sum(threads_gradient);
+
+   return(first_order_performance);
+}
+
+
+// Matrix<double> calculate_error_terms_Jacobian(const Vector<size_t>&) const method
+
+/// Returns the Jacobian of the error terms of a list of instances with respect to the neural parameters. 
+/// The derivatives of each term with respect to the outputs are given by the calculate_batch_terms_output_gradient() kernel.
+/// Row i of the result corresponds to instance_indices[i]; the rows of instances with missing values are zero. 
+/// Each batch writes its own rows, so that the threads do not need to synchronize.
+/// @param instances_indices Indices of the instances in the data set.
+
+Matrix<double> PerformanceTerm::calculate_error_terms_Jacobian(const Vector<size_t>& instances_indices) const
+{
+   #ifdef __OPENNN_DEBUG__
+
+   check();
+
+   #endif
+
+   // Neural network stuff
+
+   const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
+
+   const size_t layers_number = multilayer_perceptron_pointer->get_layers_number();
+
+   const size_t parameters_number = multilayer_perceptron_pointer->count_parameters_number();
+
+   const bool has_conditions_layer = neural_network_pointer->has_conditions_layer();
+
+   const ConditionsLayer* conditions_layer_pointer = has_conditions_layer ? neural_network_pointer->get_conditions_layer_pointer() : NULL;
+
+   // Data set stuff
+
+   const Variables& variables = data_set_pointer->get_variables();
+
+   const Vector<size_t>& inputs_indices = variables.arrange_inputs_indices();
+   const Vector<size_t>& targets_indices = variables.arrange_targets_indices();
+
+   const Vector< Vector<size_t> > batches_positions = arrange_batches_positions(instances_indices);
+
+   const size_t batches_number = batches_positions.size();
+
+   Matrix<double> terms_Jacobian(instances_indices.size(), parameters_number, 0.0);
+
+   Vector<size_t> batch_indices;
+
+   Matrix<double> batch_inputs;
+   Matrix<double> batch_targets;
+   Matrix<double> batch_outputs;
+   Matrix<double> batch_homogeneous_solution;
+
+   Vector< Vector< Matrix<double> > > batch_forward_propagation;
+
+   Matrix<double> batch_outputs_gradient;
+
+   Matrix<double> batch_Jacobian;
+
+   int i;
+
+   #pragma omp parallel for private(i, batch_indices, batch_inputs, batch_targets, batch_outputs, batch_homogeneous_solution, \
+    batch_forward_propagation, batch_outputs_gradient, batch_Jacobian) schedule(dynamic)
+
+   for(i = 0; i < (int)batches_number; i++)
+   {
+      batch_indices = instances_indices.arrange_subvector(batches_positions[i]);
+
+      batch_inputs = data_set_pointer->arrange_data_submatrix(batch_indices, inputs_indices);
+      batch_targets = data_set_pointer->arrange_data_submatrix(batch_indices, targets_indices);
+
+      batch_forward_propagation = multilayer_perceptron_pointer->calculate_first_order_forward_propagation(batch_inputs);
+
+      if(!has_conditions_layer)
+      {
+         batch_outputs_gradient = calculate_batch_terms_output_gradient(batch_forward_propagation[0][layers_number-1], batch_targets);
+      }
+      else
+      {
+         batch_homogeneous_solution = conditions_layer_pointer->calculate_homogeneous_solution(batch_inputs);
+
+         batch_outputs = conditions_layer_pointer->calculate_particular_solution(batch_inputs)
+                       + batch_homogeneous_solution*batch_forward_propagation[0][layers_number-1];
+
+         batch_outputs_gradient = batch_homogeneous_solution*calculate_batch_terms_output_gradient(batch_outputs, batch_targets);
+      }
+
+      batch_Jacobian = multilayer_perceptron_pointer->calculate_error_Jacobian(batch_inputs, batch_forward_propagation, batch_outputs_gradient);
+
+      for(size_t j = 0; j < batches_positions[i].size(); j++)
+      {
+         terms_Jacobian.set_row(batches_positions[i][j], batch_Jacobian.arrange_row(j));
+      }
+   }
+
+   return(terms_Jacobian);
+}
+
+
+// SecondOrderTerms calculate_error_second_order_terms(const Vector<size_t>&) const method
+
+/// Accumulates the products of the transposed error terms Jacobian of a list of instances with the terms and with itself. 
+/// The batches are processed in rounds of one batch per thread, and each batch builds only its own block of Jacobian rows. 
+/// The blocks of a round are then added to a single shared product by a symmetric rank-k update, 
+/// in which every thread updates its own blocks of columns of the lower triangle. 
+/// Memory therefore grows with the square of the number of parameters, and not with the number of instances or threads. 
+/// The terms and their derivatives with respect to the outputs are given by the calculate_batch_terms() and 
+/// calculate_batch_terms_output_gradient() kernels.
+/// @param instances_indices Indices of the instances in the data set.
+
+PerformanceTerm::SecondOrderTerms PerformanceTerm::calculate_error_second_order_terms(const Vector<size_t>& instances_indices) const
+{
+   #ifdef __OPENNN_DEBUG__
+
+   check();
+
+   #endif
+
+   // Neural network stuff
+
+   const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
+
+   const size_t layers_number = multilayer_perceptron_pointer->get_layers_number();
+
+   const size_t parameters_number = multilayer_perceptron_pointer->count_parameters_number();
+
+   const bool has_conditions_layer = neural_network_pointer->has_conditions_layer();
+
+   const ConditionsLayer* conditions_layer_pointer = has_conditions_layer ? neural_network_pointer->get_conditions_layer_pointer() : NULL;
+
+   // Data set stuff
+
+   const Variables& variables = data_set_pointer->get_variables();
+
+   const Vector<size_t>& inputs_indices = variables.arrange_inputs_indices();
+   const Vector<size_t>& targets_indices = variables.arrange_targets_indices();
+
+   const Vector< Vector<size_t> > batches_positions = arrange_batches_positions(instances_indices);
+
+   const size_t batches_number = batches_positions.size();
+
+   // Thread local accumulators of the performance and of the gradient, and shared product of the Jacobian with itself
+
+   #ifdef _OPENMP
+
+   const size_t threads_number = std::min((size_t)omp_get_max_threads(), std::max(batches_number, (size_t)1));
+
+   #else
+
+   const size_t threads_number = 1;
+
+   #endif
+
+   Vector<double> threads_performance(threads_number, 0.0);
+   Vector< Vector<double> > threads_JacobianT_dot_terms(threads_number, Vector<double>(parameters_number, 0.0));
+
+   SecondOrderTerms second_order_terms;
+
+   second_order_terms.JacobianT_dot_Jacobian.set(parameters_number, parameters_number, 0.0);
+
+   // Blocks of columns of the product of the Jacobian with itself, updated by different threads
+
+   const size_t columns_block_size = 64;
+
+   const size_t columns_blocks_number = (parameters_number + columns_block_size - 1)/columns_block_size;
+
+   // Each round computes the Jacobians of one batch per thread, and then adds them to the shared product by blocks of columns
+
+   Vector< Matrix<double> > round_Jacobians(threads_number);
+
+   size_t round_size;
+
+   Vector<size_t> batch_indices;
+
+   Matrix<double> batch_inputs;
+   Matrix<double> batch_targets;
+   Matrix<double> batch_outputs;
+   Matrix<double> batch_homogeneous_solution;
+
+   Vector< Vector< Matrix<double> > > batch_forward_propagation;
+
+   Vector<double> batch_terms;
+   Matrix<double> batch_outputs_gradient;
+
+   size_t column_begin;
+   size_t column_end;
+
+   int i;
+
+   for(size_t round_begin = 0; round_begin < batches_number; round_begin += threads_number)
+   {
+      round_size = std::min(threads_number, batches_number - round_begin);
+
+      #pragma omp parallel for private(i, batch_indices, batch_inputs, batch_targets, batch_outputs, batch_homogeneous_solution, \
+       batch_forward_propagation, batch_terms, batch_outputs_gradient) num_threads(threads_number)
+
+      for(i = 0; i < (int)round_size; i++)
+      {
+         batch_indices = instances_indices.arrange_subvector(batches_positions[round_begin + i]);
+
+         batch_inputs = data_set_pointer->arrange_data_submatrix(batch_indices, inputs_indices);
+         batch_targets = data_set_pointer->arrange_data_submatrix(batch_indices, targets_indices);
+
+         batch_forward_propagation = multilayer_perceptron_pointer->calculate_first_order_forward_propagation(batch_inputs);
+
+         if(!has_conditions_layer)
+         {
+            const Matrix<double>& outputs = batch_forward_propagation[0][layers_number-1];
+
+            batch_terms = calculate_batch_terms(outputs, batch_targets);
+
+            batch_outputs_gradient = calculate_batch_terms_output_gradient(outputs, batch_targets);
+         }
+         else
+         {
+            batch_homogeneous_solution = conditions_layer_pointer->calculate_homogeneous_solution(batch_inputs);
+
+            batch_outputs = conditions_layer_pointer->calculate_particular_solution(batch_inputs)
+                          + batch_homogeneous_solution*batch_forward_propagation[0][layers_number-1];
+
+            batch_terms = calculate_batch_terms(batch_outputs, batch_targets);
+
+            batch_outputs_gradient = batch_homogeneous_solution*calculate_batch_terms_output_gradient(batch_outputs, batch_targets);
+         }
+
+         round_Jacobians[i] = multilayer_perceptron_pointer->calculate_error_Jacobian(batch_inputs, batch_forward_propagation, batch_outputs_gradient);
+
+         threads_performance[i] += batch_terms.dot(batch_terms);
+
+         threads_JacobianT_dot_terms[i] += round_Jacobians[i].calculate_transpose().dot(batch_terms);
+      }
+
+      #pragma omp parallel for private(i, column_begin, column_end) schedule(dynamic) num_threads(threads_number)
+
+      for(i = 0; i < (int)columns_blocks_number; i++)
+      {
+         column_begin = i*columns_block_size;
+         column_end = std::min(column_begin + columns_block_size, parameters_number);
+
+         for(size_t j = 0; j < round_size; j++)
+         {
+            second_order_terms.JacobianT_dot_Jacobian.sum_lower_rank_update(round_Jacobians[j], column_begin, column_end);
+         }
+      }
+   }
+
+   second_order_terms.JacobianT_dot_Jacobian.copy_lower_triangle_to_upper();
+
+   second_order_terms.performance = threads_performance.calculate_sum();
+   second_order_terms.JacobianT_dot_terms = calculate_tree_sum(threads_JacobianT_dot_terms);
+
+   return(second_order_terms);
+}
+
+
+// Vector<double> calculate_error_vector_dot_Hessian_sum(const Vector<size_t>&, const Vector<double>&) const method
+
+/// Returns the product of the Hessian of the sum of the errors of a list of instances with a vector, 
+/// without forming the Hessian matrix. 
+/// It applies the R-operator of Pearlmutter: each batch is propagated forward together with the directional derivatives 
+/// of its combinations, the calculate_batch_output_Hessian_dot() kernel gives the directional derivatives of the output gradients, 
+/// and both are back-propagated through the multilayer perceptron. 
+/// The cost is about that of two gradient evaluations. 
+/// The batches are distributed among the threads, whose partial products are combined with a tree reduction.
+/// Instances with missing values are not taken into account.
+/// @param instances_indices Indices of the instances in the data set.
+/// @param vector Vector in the dot product, with size the number of parameters. 
+
+Vector<double> PerformanceTerm::calculate_error_vector_dot_Hessian_sum(const Vector<size_t>& instances_indices, const Vector<double>& vector) const
+{
+   #ifdef __OPENNN_DEBUG__
+
+   check();
+
+   #endif
+
+   // Neural network stuff
+
+   const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
+
+   const size_t layers_number = multilayer_perceptron_pointer->get_layers_number();
+
+   const size_t parameters_number = multilayer_perceptron_pointer->count_parameters_number();
+
+   const bool has_conditions_layer = neural_network_pointer->has_conditions_layer();
+
+   const ConditionsLayer* conditions_layer_pointer = has_conditions_layer ? neural_network_pointer->get_conditions_layer_pointer() : NULL;
+
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   const size_t size = vector.size();
+
+   if(size != parameters_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: PerformanceTerm class.\n"
+             << "Vector<double> calculate_error_vector_dot_Hessian_sum(const Vector<size_t>&, const Vector<double>&) const method.\n"
+             << "Size of vector (" << size << ") must be equal to number of parameters (" << parameters_number << ").\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   // Data set stuff
+
+   const Variables& variables = data_set_pointer->get_variables();
+
+   const Vector<size_t>& inputs_indices = variables.arrange_inputs_indices();
+   const Vector<size_t>& targets_indices = variables.arrange_targets_indices();
+
+   const Vector< Vector<size_t> > batches_positions = arrange_batches_positions(instances_indices);
+
+   const size_t batches_number = batches_positions.size();
+
+   // Thread local accumulators
+
+   #ifdef _OPENMP
+
+   const size_t threads_number = (size_t)omp_get_max_threads();
+
+   #else
+
+   const size_t threads_number = 1;
+
+   #endif
+
+   Vector< Vector<double> > threads_vector_Hessian_product(threads_number, Vector<double>(parameters_number, 0.0));
+
+   Vector<size_t> batch_indices;
+
+   Matrix<double> batch_inputs;
+   Matrix<double> batch_targets;
+   Matrix<double> batch_outputs;
+   Matrix<double> batch_outputs_direction;
+   Matrix<double> batch_homogeneous_solution;
+
+   Vector< Vector< Matrix<double> > > batch_forward_propagation;
+   Vector< Matrix<double> > batch_combinations_direction;
+
+   Matrix<double> batch_outputs_gradient;
+   Matrix<double> batch_outputs_gradient_direction;
+
+   size_t thread_index;
+
+   int i;
+
+   #pragma omp parallel for private(i, thread_index, batch_indices, batch_inputs, batch_targets, batch_outputs, batch_outputs_direction, \
+    batch_homogeneous_solution, batch_forward_propagation, batch_combinations_direction, batch_outputs_gradient, batch_outputs_gradient_direction) schedule(dynamic)
+
+   for(i = 0; i < (int)batches_number; i++)
+   {
+      #ifdef _OPENMP
+
+      thread_index = (size_t)omp_get_thread_num();
+
+      #else
+
+      thread_index = 0;
+
+      #endif
+
+      batch_indices = instances_indices.arrange_subvector(batches_positions[i]);
+
+      batch_inputs = data_set_pointer->arrange_data_submatrix(batch_indices, inputs_indices);
+      batch_targets = data_set_pointer->arrange_data_submatrix(batch_indices, targets_indices);
+
+      batch_forward_propagation = multilayer_perceptron_pointer->calculate_second_order_forward_propagation(batch_inputs);
+
+      batch_combinations_direction = multilayer_perceptron_pointer->calculate_layers_combinations_direction(batch_inputs, batch_forward_propagation, vector);
+
+      batch_outputs_direction = batch_forward_propagation[1][layers_number-1]*batch_combinations_direction[layers_number-1];
+
+      if(!has_conditions_layer)
+      {
+         const Matrix<double>& outputs = batch_forward_propagation[0][layers_number-1];
+
+         batch_outputs_gradient = calculate_batch_output_gradient(outputs, batch_targets);
+
+         batch_outputs_gradient_direction = calculate_batch_output_Hessian_dot(outputs, batch_targets, batch_outputs_direction);
+      }
+      else
+      {
+         batch_homogeneous_solution = conditions_layer_pointer->calculate_homogeneous_solution(batch_inputs);
+
+         batch_outputs = conditions_layer_pointer->calculate_particular_solution(batch_inputs)
+                       + batch_homogeneous_solution*batch_forward_propagation[0][layers_number-1];
+
+         batch_outputs_gradient = batch_homogeneous_solution*calculate_batch_output_gradient(batch_outputs, batch_targets);
+
+         batch_outputs_gradient_direction = batch_homogeneous_solution
+                                           *calculate_batch_output_Hessian_dot(batch_outputs, batch_targets, batch_homogeneous_solution*batch_outputs_direction);
+      }
+
+      threads_vector_Hessian_product[thread_index] += multilayer_perceptron_pointer->calculate_error_vector_dot_Hessian(batch_inputs, batch_forward_propagation, batch_combinations_direction,
+                                                                                                                    batch_outputs_gradient, batch_outputs_gradient_direction, vector);
+   }
+
+   return(calculate_tree_sum(threads_vector_Hessian_product));
+}
+
+
+// Vector<double> calculate_tree_sum(Vector< Vector<double> >&) const method
+
+/// Adds up the partial gradients accumulated by the threads. 
+/// The vectors are summed pairwise, halving their number at each level, and the levels are computed in parallel.
+/// The contents of the argument are overwritten.
+/// @param partial_sums Partial sums to be combined.
+
+Vector<double> PerformanceTerm::calculate_tree_sum(Vector< Vector<double> >& partial_sums) const
+{
+   const size_t partial_sums_number = partial_sums.size();
+
+   int i;
+
+   for(size_t stride = 1; stride < partial_sums_number; stride *= 2)
+   {
+      const size_t pairs_number = (partial_sums_number + 2*stride - 1)/(2*stride);
+
+      #pragma omp parallel for private(i)
+
+      for(i = 0; i < (int)pairs_number; i++)
+      {
+         const size_t index = 2*stride*(size_t)i;
+
+         if(index + stride < partial_sums_number)
+         {
+            partial_sums[index] += partial_sums[index + stride];
+         }
+      }
+   }
+
+   return(partial_sums[0]);
+}
+
+
+// Vector<double> calculate_terms(void) const method 
+
+/// Returns the performance of all the subterms composing the performance term.
+
+Vector<double> PerformanceTerm::calculate_terms(void) const
+{
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: PerformanceTerm class.\n"
+           << "Vector<double> calculate_terms(void) const method.\n"
+           << "The terms function is not defined for this performance term.\n";
+
+    throw std::logic_error(buffer.str());
+}
+
+
+// Vector<double> calculate_terms(const Vector<double>&) const method 
+
+/// Returns the performance of all the subterms composing the performance term.
+
+Vector<double> PerformanceTerm::calculate_terms(const Vector<double>&) const
+{
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: PerformanceTerm class.\n"
+           << "Vector<double> calculate_terms(const Vector<double>&) const method.\n"
+           << "The terms function is not defined for this performance term.\n";
+
+    throw std::logic_error(buffer.str());
+}
+
+
+// Matrix<double> calculate_terms_Jacobian(void) const method 
+
+/// Returns the Jacobian matrix of the subterms composing the performance term.
+
+Matrix<double> PerformanceTerm::calculate_terms_Jacobian(void) const
+{
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: PerformanceTerm class.\n"
+           << "Matrix<double> calculate_terms_Jacobian(void) const method.\n"
+           << "The terms function is not defined for this performance term.\n";
+
+    throw std::logic_error(buffer.str());
+}
+
+
+// PerformanceTerm::FirstOrderTerms calculate_first_order_terms(void) const
+
+/// Returns the performance of all the subterms composing the performance term.
+
+PerformanceTerm::FirstOrderTerms PerformanceTerm::calculate_first_order_terms(void) const
+{
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: PerformanceTerm class.\n"
+           << "Vector<double> calculate_terms(void) const method.\n"
+           << "The terms function is not defined for this performance term.\n";
+
+    throw std::logic_error(buffer.str());
+}
+
+
+// PerformanceTerm::SecondOrderTerms calculate_second_order_terms(void) const
+
+/// Returns the sum of squares of the subterms, and the products of the transposed subterms Jacobian with the subterms and with itself. 
+/// This default implementation builds the whole subterms Jacobian. 
+/// Error terms which provide the batch terms kernels override it to accumulate the products by blocks of instances.
+
+PerformanceTerm::SecondOrderTerms PerformanceTerm::calculate_second_order_terms(void) const
+{
+    const Vector<double> terms = calculate_terms();
+
+    const Matrix<double> terms_Jacobian = calculate_terms_Jacobian();
+
+    SecondOrderTerms second_order_terms;
+
+    second_order_terms.performance = terms.dot(terms);
+    second_order_terms.JacobianT_dot_terms = terms_Jacobian.calculate_transpose().dot(terms);
+    second_order_terms.JacobianT_dot_Jacobian = terms_Jacobian.calculate_transpose_dot(terms_Jacobian);
+
+    return(second_order_terms);
+}
+
+
 // std::string write_performance_term_type(void) const method
 
 /// Returns a string with the default type of performance term, "USER_PERFORMANCE_TERM".
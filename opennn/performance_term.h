@@ -167,6 +167,25 @@ public:
       Matrix<double> Jacobian;
    };
 
+   /// Products of the transpose of the subterms Jacobian with the subterms vector and with itself, 
+   /// together with the sum of squares of the subterms. 
+   /// They can be accumulated by blocks of instances, so that the subterms Jacobian is never stored. 
+
+   struct SecondOrderTerms
+   {
+      /// Sum of squares of the subterms. 
+
+      double performance;
+
+      /// Transpose of the subterms Jacobian times the subterms vector. 
+
+      Vector<double> JacobianT_dot_terms;
+
+      /// Transpose of the subterms Jacobian times the subterms Jacobian. 
+
+      Matrix<double> JacobianT_dot_Jacobian;
+   };
+
 
    // METHODS
 
@@ -266,6 +285,8 @@ public:
 
    const bool& get_display(void) const;
 
+   const size_t& get_batch_instances_number(void) const;
+
    bool has_neural_network(void) const;
    bool has_mathematical_model(void) const;
    bool has_data_set(void) const;
@@ -295,6 +316,8 @@ public:
 
    void set_display(const bool&);
 
+   void set_batch_instances_number(const size_t&);
+
    // Pointer methods
 
    void construct_numerical_differentiation(void);
@@ -368,6 +391,32 @@ public:
 
    virtual Matrix<double> calculate_Hessian(const Vector<double>&) const;
 
+   virtual FirstOrderPerformance calculate_performance_and_gradient(void) const;
+
+   virtual Vector<double> calculate_vector_dot_Hessian(const Vector<double>&) const;
+
+   virtual double calculate_error_normalization_coefficient(void) const;
+
+   // Batch kernel methods
+
+   virtual double calculate_batch_error(const Matrix<double>&, const Matrix<double>&) const;
+   virtual Matrix<double> calculate_batch_output_gradient(const Matrix<double>&, const Matrix<double>&) const;
+   virtual Matrix<double> calculate_batch_terms_output_gradient(const Matrix<double>&, const Matrix<double>&) const;
+   virtual Vector<double> calculate_batch_terms(const Matrix<double>&, const Matrix<double>&) const;
+   virtual Matrix<double> calculate_batch_output_Hessian_dot(const Matrix<double>&, const Matrix<double>&, const Matrix<double>&) const;
+
+   // Parallel reduction methods
+
+   Vector< Vector<size_t> > arrange_batches_positions(const Vector<size_t>&) const;
+   Vector<size_t> arrange_batches_blocks(const Vector<size_t>&, const Vector< Vector<size_t> >&) const;
+
+   double calculate_error_sum(const Vector<size_t>&) const;
+   Vector<double> calculate_error_gradient_sum(const Vector<size_t>&) const;
+   FirstOrderPerformance calculate_error_sum_and_gradient_sum(const Vector<size_t>&) const;
+   Matrix<double> calculate_error_terms_Jacobian(const Vector<size_t>&) const;
+   SecondOrderTerms calculate_error_second_order_terms(const Vector<size_t>&) const;
+   Vector<double> calculate_error_vector_dot_Hessian_sum(const Vector<size_t>&, const Vector<double>&) const;
+
    virtual Vector<double> calculate_terms(void) const;
    virtual Vector<double> calculate_terms(const Vector<double>&) const;
 
@@ -375,6 +424,8 @@ public:
 
    virtual PerformanceTerm::FirstOrderTerms calculate_first_order_terms(void) const;
 
+   virtual PerformanceTerm::SecondOrderTerms calculate_second_order_terms(void) const;
+
    virtual std::string write_performance_term_type(void) const;
 
    virtual std::string write_information(void) const;
@@ -409,6 +460,14 @@ protected:
    /// Display messages to screen. 
 
    bool display;  
+
+   /// Number of instances which are propagated together by the parallel reduction methods. 
+
+   size_t batch_instances_number;
+
+private:
+
+   Vector<double> calculate_tree_sum(Vector< Vector<double> >&) const;
 };
 
 }
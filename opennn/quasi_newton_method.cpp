@@ -126,6 +126,12 @@ std::string QuasiNewtonMethod::write_inverse_Hessian_approximation_method(void)
 	  }
       break;
 
+      case LBFGS:
+      {
+         return("L-BFGS");
+	  }
+      break;
+
 	  default:
       {
          std::ostringstream buffer;
@@ -141,6 +147,17 @@ std::string QuasiNewtonMethod::write_inverse_Hessian_approximation_method(void)
 }
 
 
+// const size_t& get_limited_memory_size(void) const method
+
+/// Returns the number of parameters and gradient difference pairs which the limited memory BFGS method stores
+/// in order to build the training direction. 
+
+const size_t& QuasiNewtonMethod::get_limited_memory_size(void) const
+{
+   return(limited_memory_size);
+}
+
+
 // const double& get_warning_parameters_norm(void) const method
 
 /// Returns the minimum value for the norm of the parameters vector at wich a warning message is written to the screen. 
@@ -410,6 +427,7 @@ new_inverse_Hessian_approximation_method)
 /// <ul>
 /// <li> "DFP"
 /// <li> "BFGS"
+/// <li> "L-BFGS"
 /// </ul>
 /// @param new_inverse_Hessian_approximation_method_name Name of inverse Hessian approximation method.  
 
@@ -423,6 +441,10 @@ void QuasiNewtonMethod::set_inverse_Hessian_approximation_method(const std::stri
    {
       inverse_Hessian_approximation_method = BFGS;
    }
+   else if(new_inverse_Hessian_approximation_method_name == "L-BFGS")
+   {
+      inverse_Hessian_approximation_method = LBFGS;
+   }
    else
    {
       std::ostringstream buffer;
@@ -461,6 +483,8 @@ void QuasiNewtonMethod::set_default(void)
 {
    inverse_Hessian_approximation_method = BFGS;
 
+   limited_memory_size = 10;
+
    training_rate_algorithm.set_default();
 
    // TRAINING PARAMETERS
@@ -995,6 +1019,34 @@ void QuasiNewtonMethod::set_display_period(const size_t& new_display_period)
 }
 
 
+// void set_limited_memory_size(const size_t&) method
+
+/// Sets a new number of parameters and gradient difference pairs to be stored by the limited memory BFGS method. 
+/// @param new_limited_memory_size Number of difference pairs kept in memory. 
+
+void QuasiNewtonMethod::set_limited_memory_size(const size_t& new_limited_memory_size)
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__ 
+     
+   if(new_limited_memory_size == 0)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: QuasiNewtonMethod class.\n"
+             << "void set_limited_memory_size(const size_t&) method.\n"
+             << "Limited memory size must be greater than 0.\n";
+
+      throw std::logic_error(buffer.str());	  
+   }
+
+   #endif
+
+   limited_memory_size = new_limited_memory_size;
+}
+
+
 // Vector<double> calculate_inverse_Hessian_approximation(
 // const Vector<double>&, const Vector<double>&, 
 // const Vector<double>&, const Vector<double>&, 
@@ -1024,6 +1076,18 @@ const Matrix<double>& old_inverse_Hessian) const
       {
          return(calculate_BFGS_inverse_Hessian(old_parameters, parameters, old_gradient, gradient, old_inverse_Hessian));
       }
+      break;
+
+      case LBFGS:
+      {
+         std::ostringstream buffer;
+
+         buffer << "OpenNN Exception: QuasiNewtonMethod class.\n"
+                << "Vector<double> calculate_inverse_Hessian_approximation(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, const Matrix<double>&) method.\n"
+                << "Limited memory BFGS method does not build an inverse Hessian approximation matrix.\n";
+
+         throw std::logic_error(buffer.str());
+      }
       break;
 
 	  default:
@@ -1053,6 +1117,82 @@ Vector<double> QuasiNewtonMethod::calculate_training_direction(const Vector<doub
 }
 
 
+// Vector<double> calculate_limited_memory_training_direction(const Vector<double>&, const Vector< Vector<double> >&, const Vector< Vector<double> >&) const method
+
+/// Returns the limited memory BFGS training direction, which has been previously normalized.
+/// The product of the inverse Hessian approximation with the gradient is obtained with the two loop recursion, 
+/// so that the inverse Hessian approximation matrix is never formed. 
+/// The initial inverse Hessian approximation is the identity scaled by s*y/y*y of the most recent pair. 
+/// @param gradient Gradient vector. 
+/// @param parameters_differences Stored parameters differences, from the oldest to the most recent. 
+/// @param gradient_differences Stored gradient differences, from the oldest to the most recent. 
+
+Vector<double> QuasiNewtonMethod::calculate_limited_memory_training_direction(const Vector<double>& gradient,
+const Vector< Vector<double> >& parameters_differences, 
+const Vector< Vector<double> >& gradient_differences) const
+{
+   const size_t pairs_number = parameters_differences.size();
+
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__ 
+
+   if(gradient_differences.size() != pairs_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: QuasiNewtonMethod class.\n"
+             << "Vector<double> calculate_limited_memory_training_direction(const Vector<double>&, const Vector< Vector<double> >&, const Vector< Vector<double> >&) const method.\n"
+             << "Number of parameters differences (" << pairs_number << ") must be equal to number of gradient differences (" << gradient_differences.size() << ").\n";
+
+      throw std::logic_error(buffer.str());	  
+   }
+
+   #endif
+
+   if(pairs_number == 0)
+   {
+      return(calculate_gradient_descent_training_direction(gradient));
+   }
+
+   Vector<double> rho(pairs_number);
+   Vector<double> alpha(pairs_number);
+
+   Vector<double> direction(gradient);
+
+   // First loop, from the most recent pair to the oldest one
+
+   for(size_t i = pairs_number; i-- > 0;)
+   {
+      rho[i] = 1.0/gradient_differences[i].dot(parameters_differences[i]);
+
+      alpha[i] = rho[i]*parameters_differences[i].dot(direction);
+
+      direction -= gradient_differences[i]*alpha[i];
+   }
+
+   // Initial inverse Hessian approximation
+
+   const Vector<double>& last_parameters_difference = parameters_differences[pairs_number-1];
+   const Vector<double>& last_gradient_difference = gradient_differences[pairs_number-1];
+
+   direction *= last_parameters_difference.dot(last_gradient_difference)/last_gradient_difference.dot(last_gradient_difference);
+
+   // Second loop, from the oldest pair to the most recent one
+
+   double beta;
+
+   for(size_t i = 0; i < pairs_number; i++)
+   {
+      beta = rho[i]*gradient_differences[i].dot(direction);
+
+      direction += parameters_differences[i]*(alpha[i] - beta);
+   }
+
+   return((direction*(-1.0)).calculate_normalized());
+}
+
+
 // Vector<double> calculate_gradient_descent_training_direction(const Vector<double>&) const method
 
 /// Returns the gradient descent training direction, which is the negative of the normalized gradient. 
@@ -1703,6 +1843,8 @@ Matrix<std::string> QuasiNewtonMethod::QuasiNewtonMethodResults::write_final_res
 
 /// Trains a neural network with an associated performance functional according to the quasi-Newton method.
 /// Training occurs according to the training operators, training parameters and stopping criteria.
+/// With the limited memory BFGS method no inverse Hessian approximation is formed, 
+/// so the inverse Hessian history is left empty.
 
 QuasiNewtonMethod::QuasiNewtonMethodResults* QuasiNewtonMethod::perform_training(void)
 {
@@ -1745,11 +1887,29 @@ QuasiNewtonMethod::QuasiNewtonMethodResults* QuasiNewtonMethod::perform_training
    double performance_increase = 0.0;
 
    Vector<double> gradient(parameters_number);
+
+   PerformanceFunctional::FirstOrderperformance first_order_performance;
    Vector<double> old_gradient(parameters_number);
    double gradient_norm;
 
-   Matrix<double> inverse_Hessian(parameters_number, parameters_number);
-   Matrix<double> old_inverse_Hessian(parameters_number, parameters_number);
+   Matrix<double> inverse_Hessian;
+   Matrix<double> old_inverse_Hessian;
+
+   // Limited memory BFGS stores difference pairs instead of the inverse Hessian approximation
+
+   const bool limited_memory = (inverse_Hessian_approximation_method == LBFGS);
+
+   Vector< Vector<double> > parameters_differences;
+   Vector< Vector<double> > gradient_differences;
+
+   Vector<double> parameters_difference;
+   Vector<double> gradient_difference;
+
+   if(!limited_memory)
+   {
+      inverse_Hessian.set(parameters_number, parameters_number);
+      old_inverse_Hessian.set(parameters_number, parameters_number);
+   }
 
    double generalization_performance = 0.0; 
    double old_generalization_performance = 0.0;
@@ -1798,19 +1958,20 @@ QuasiNewtonMethod::QuasiNewtonMethodResults* QuasiNewtonMethod::perform_training
 
       // Performance functional stuff
 
+      first_order_performance = performance_functional_pointer->calculate_performance_and_gradient();
+
+      performance = first_order_performance.performance;
+      gradient = first_order_performance.gradient;
+
       if(iteration == 0)
       {
-         performance = performance_functional_pointer->calculate_performance();
-         performance_increase = 0.0; 
+         performance_increase = 0.0;
       }
       else
       {
-         performance = directional_point[1];
          performance_increase = old_performance - performance; 
       }
 
-      gradient = performance_functional_pointer->calculate_gradient();
-
       gradient_norm = gradient.calculate_norm();
 
       if(display && gradient_norm >= warning_gradient_norm)
@@ -1818,7 +1979,29 @@ QuasiNewtonMethod::QuasiNewtonMethodResults* QuasiNewtonMethod::perform_training
          std::cout << "OpenNN Warning: Gradient norm is " << gradient_norm << ".\n";          
       }
 
-      if(iteration == 0
+      if(limited_memory)
+      {
+         if(iteration != 0)
+         {
+            parameters_difference = parameters - old_parameters;
+            gradient_difference = gradient - old_gradient;
+
+            // Keep only pairs which satisfy the curvature condition
+
+            if(parameters_difference.dot(gradient_difference) > 1.0e-99)
+            {
+               parameters_differences.push_back(parameters_difference);
+               gradient_differences.push_back(gradient_difference);
+
+               if(parameters_differences.size() > limited_memory_size)
+               {
+                  parameters_differences.erase(parameters_differences.begin());
+                  gradient_differences.erase(gradient_differences.begin());
+               }
+            }
+         }
+      }
+      else if(iteration == 0
       || (old_parameters - parameters).calculate_absolute_value() < 1.0e-99
       || (old_gradient - gradient).calculate_absolute_value() < 1.0e-99)
       {
@@ -1838,7 +2021,14 @@ QuasiNewtonMethod::QuasiNewtonMethodResults* QuasiNewtonMethod::perform_training
 
       // Training algorithm 
 
-      training_direction = calculate_training_direction(gradient, inverse_Hessian);          
+      if(limited_memory)
+      {
+         training_direction = calculate_limited_memory_training_direction(gradient, parameters_differences, gradient_differences);
+      }
+      else
+      {
+         training_direction = calculate_training_direction(gradient, inverse_Hessian);
+      }
 
       // Calculate performance training slope
 
@@ -2169,6 +2359,18 @@ tinyxml2::XMLDocument* QuasiNewtonMethod::to_XML(void) const
        element->LinkEndChild(text);
    }
 
+   // Limited memory size
+   {
+       element = document->NewElement("LimitedMemorySize");
+       root_element->LinkEndChild(element);
+
+       buffer.str("");
+       buffer << limited_memory_size;
+
+       text = document->NewText(buffer.str().c_str());
+       element->LinkEndChild(text);
+   }
+
 
    // Training rate algorithm
    {
@@ -2553,6 +2755,18 @@ Matrix<std::string> QuasiNewtonMethod::to_string_matrix(void) const
 
     values.push_back(inverse_Hessian_approximation_method_string);
 
+    // Limited memory size
+
+    if(inverse_Hessian_approximation_method == LBFGS)
+    {
+       labels.push_back("Limited memory size");
+
+       buffer.str("");
+       buffer << limited_memory_size;
+
+       values.push_back(buffer.str());
+    }
+
    // Training rate method
 
    labels.push_back("Training rate method");
@@ -2761,6 +2975,25 @@ void QuasiNewtonMethod::from_XML(const tinyxml2::XMLDocument& document)
        }
    }
 
+   // Limited memory size
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("LimitedMemorySize");
+
+       if(element)
+       {
+          const size_t new_limited_memory_size = atoi(element->GetText());
+
+          try
+          {
+             set_limited_memory_size(new_limited_memory_size);
+          }
+          catch(const std::logic_error& e)
+          {
+             std::cout << e.what() << std::endl;
+          }
+       }
+   }
+
 
    // Training rate algorithm
    {
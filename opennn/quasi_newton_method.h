@@ -53,7 +53,7 @@ public:
 
    /// Enumeration of the available training operators for obtaining the approximation to the inverse Hessian.
 
-   enum InverseHessianApproximationMethod{DFP, BFGS};
+   enum InverseHessianApproximationMethod{DFP, BFGS, LBFGS};
 
 
    // DEFAULT CONSTRUCTOR
@@ -219,6 +219,8 @@ public:
    const InverseHessianApproximationMethod& get_inverse_Hessian_approximation_method(void) const;
    std::string write_inverse_Hessian_approximation_method(void) const;
 
+   const size_t& get_limited_memory_size(void) const;
+
    // Training parameters
 
    const double& get_warning_parameters_norm(void) const;
@@ -306,6 +308,8 @@ public:
 
    void set_display_period(const size_t&);
 
+   void set_limited_memory_size(const size_t&);
+
    // Training methods
 
    Vector<double> calculate_gradient_descent_training_direction(const Vector<double>&) const;
@@ -320,6 +324,9 @@ public:
 
    Vector<double> calculate_training_direction(const Vector<double>&, const Matrix<double>&) const;
 
+   Vector<double> calculate_limited_memory_training_direction
+   (const Vector<double>&, const Vector< Vector<double> >&, const Vector< Vector<double> >&) const;
+
    QuasiNewtonMethodResults* perform_training(void);
 
    // Training history methods
@@ -349,6 +356,10 @@ private:
 
    InverseHessianApproximationMethod inverse_Hessian_approximation_method;
 
+   /// Number of parameters and gradient difference pairs stored by the limited memory BFGS method. 
+
+   size_t limited_memory_size;
+
 
    /// Value for the parameters norm at which a warning message is written to the screen. 
 
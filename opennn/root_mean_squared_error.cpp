@@ -202,73 +202,17 @@ double RootMeanSquaredError::calculate_performance(void) const
 
    #endif
 
-   // Neural network stuff
-
-   const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
-
-   const size_t inputs_number = multilayer_perceptron_pointer->get_inputs_number();
-   const size_t outputs_number = multilayer_perceptron_pointer->get_outputs_number();
-
    // Data set stuff
 
-   const Matrix<double>& data = data_set_pointer->get_data();
-
    const Instances& instances = data_set_pointer->get_instances();
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
-   const MissingValues& missing_values = data_set_pointer->get_missing_values();
+   const Vector<size_t>& training_indices = instances.arrange_training_indices();
 
    // Root mean squared error
 
-   Vector<double> inputs(inputs_number);
-   Vector<double> outputs(outputs_number);
-   Vector<double> targets(outputs_number);
-
-   double sum_squared_error = 0.0;
-
-   int i = 0;
-
-   #pragma omp parallel for private(i, training_index, inputs, outputs, targets) reduction(+:sum_squared_error)
-
-   for(i = 0; i < (int)training_instances_number; i++)
-   {
-       training_index = training_indices[i];
-
-       if(missing_values.has_missing_values(training_index))
-       {
-           continue;
-       }
-
-      // Input vector
-
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
-
-      // Output vector
-
-      outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
-
-      // Target vector
-
-//      targets = data_set_pointer->get_instance(training_index, targets_indices);
-
-      // Sum squaresd error
-
-//	  sum_squared_error += outputs.calculate_sum_squared_error(targets);
-      sum_squared_error += outputs.calculate_sum_squared_error(data, training_index, targets_indices);
-
-   }
-
-   return(sqrt(sum_squared_error/(double)training_instances_number));
+   return(sqrt(calculate_error_sum(training_indices)/(double)training_instances_number));
 }
 
 
@@ -321,16 +265,7 @@ double RootMeanSquaredError::calculate_performance(const Vector<double>& paramet
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
-   const MissingValues& missing_values = data_set_pointer->get_missing_values();
+   const size_t complete_training_instances_number = data_set_pointer->count_training_rows_number();
 
    // Root mean squared error
 
@@ -342,29 +277,18 @@ double RootMeanSquaredError::calculate_performance(const Vector<double>& paramet
 
    int i = 0;
 
-   #pragma omp parallel for private(i, training_index, inputs, outputs, targets) reduction(+:sum_squared_error)
+   #pragma omp parallel for private(i, inputs, outputs, targets) reduction(+:sum_squared_error)
 
-   for(i = 0; i < (int)training_instances_number; i++)
+   for(i = 0; i < (int)complete_training_instances_number; i++)
    {
-       training_index = training_indices[i];
-
-       if(missing_values.has_missing_values(training_index))
-       {
-           continue;
-       }
-
-      // Input vector
+      // Input and target vectors
 
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+      data_set_pointer->arrange_training_row(i, inputs, targets);
 
       // Output vector
 
       outputs = multilayer_perceptron_pointer->calculate_outputs(inputs, parameters);
 
-      // Target vector
-
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
-
       // Sum squaresd error
 
       sum_squared_error += outputs.calculate_sum_squared_error(targets);
@@ -374,41 +298,45 @@ double RootMeanSquaredError::calculate_performance(const Vector<double>& paramet
 }
 
 
-// Vector<double> calculate_gradient(void) const method
+// double calculate_batch_error(const Matrix<double>&, const Matrix<double>&) const method
 
-/// Calculates the gradient the root mean squared error funcion by means of the back-propagation algorithm.
+/// Returns the sum squared error of a batch of instances. 
+/// The mean and the square root are taken once all the batches have been added up.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
 
-Vector<double> RootMeanSquaredError::calculate_gradient(void) const
+double RootMeanSquaredError::calculate_batch_error(const Matrix<double>& outputs, const Matrix<double>& targets) const
 {
-   // Control sentence
-
-   #ifdef __OPENNN_DEBUG__ 
-
-   check();
+   return(outputs.calculate_sum_squared_error(targets));
+}
 
-   #endif
 
-   // Neural network stuff
+// Matrix<double> calculate_batch_output_gradient(const Matrix<double>&, const Matrix<double>&) const method
 
-   const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
+/// Returns the errors of each instance in a batch.
+/// Scaled by the number of instances and the root mean squared error, they are the derivatives of the error with respect to the outputs.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
 
-   const size_t inputs_number = multilayer_perceptron_pointer->get_inputs_number();
-   const size_t outputs_number = multilayer_perceptron_pointer->get_outputs_number();
+Matrix<double> RootMeanSquaredError::calculate_batch_output_gradient(const Matrix<double>& outputs, const Matrix<double>& targets) const
+{
+   return(outputs-targets);
+}
 
-   const size_t layers_number = multilayer_perceptron_pointer->get_layers_number();
 
-   const size_t parameters_number = multilayer_perceptron_pointer->count_parameters_number();
+// Vector<double> calculate_gradient(void) const method
 
-   // Data set stuff
+/// Calculates the gradient the root mean squared error funcion by means of the back-propagation algorithm.
 
-   Vector< Vector< Vector<double> > > first_order_forward_propagation(2); 
+Vector<double> RootMeanSquaredError::calculate_gradient(void) const
+{
+   // Control sentence
 
-   const bool has_conditions_layer = neural_network_pointer->has_conditions_layer();
+   #ifdef __OPENNN_DEBUG__ 
 
-   const ConditionsLayer* conditions_layer_pointer = has_conditions_layer ? neural_network_pointer->get_conditions_layer_pointer() : NULL;
+   check();
 
-   Vector<double> particular_solution;
-   Vector<double> homogeneous_solution;
+   #endif
 
    // Data set stuff
 
@@ -416,81 +344,46 @@ Vector<double> RootMeanSquaredError::calculate_gradient(void) const
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
-   const MissingValues& missing_values = data_set_pointer->get_missing_values();
-
-   Vector<double> inputs(inputs_number);
-   Vector<double> targets(outputs_number);
+   const Vector<size_t>& training_indices = instances.arrange_training_indices();
 
    // Performance functional stuff
 
    const double performance = calculate_performance();
 
-   Vector< Vector<double> > layers_delta; 
-
-   Vector<double> output_gradient(outputs_number);
-
-   Vector<double> point_gradient(parameters_number, 0.0);
-
-   // Main loop
-
-   Vector<double> gradient(parameters_number, 0.0);
-
-   int i = 0;
+   return(calculate_error_gradient_sum(training_indices)/(training_instances_number*performance));
+}
 
-   #pragma omp parallel for private(i, training_index, inputs, targets, first_order_forward_propagation, output_gradient, \
-    layers_delta, particular_solution, homogeneous_solution, point_gradient)
 
-   for(i = 0; i < (int)training_instances_number; i++)
-   {
-       training_index = training_indices[i];
+// FirstOrderPerformance calculate_performance_and_gradient(void) const method
 
-       if(missing_values.has_missing_values(training_index))
-       {
-           continue;
-       }
+/// Returns the root mean squared error and its gradient, computed from a single forward propagation of the training instances.
 
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+PerformanceTerm::FirstOrderPerformance RootMeanSquaredError::calculate_performance_and_gradient(void) const
+{
+   // Control sentence
 
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
+   #ifdef __OPENNN_DEBUG__ 
 
-      first_order_forward_propagation = multilayer_perceptron_pointer->calculate_first_order_forward_propagation(inputs);
+   check();
 
-	  const Vector< Vector<double> >& layers_activation = first_order_forward_propagation[0];
-      const Vector< Vector<double> >& layers_activation_derivative = first_order_forward_propagation[1];
+   #endif
 
-      if(!has_conditions_layer)
-      {
-         output_gradient = (layers_activation[layers_number-1]-targets)/(training_instances_number*performance);
+   // Data set stuff
 
-         layers_delta = calculate_layers_delta(layers_activation_derivative, output_gradient);
-      }
-      else
-      {
-         particular_solution = conditions_layer_pointer->calculate_particular_solution(inputs);
-         homogeneous_solution = conditions_layer_pointer->calculate_homogeneous_solution(inputs);
+   const Instances& instances = data_set_pointer->get_instances();
 
-         output_gradient = (particular_solution+homogeneous_solution*layers_activation[layers_number-1] - targets)/(training_instances_number*performance);
+   const size_t training_instances_number = instances.count_training_instances_number();
 
-         layers_delta = calculate_layers_delta(layers_activation_derivative, homogeneous_solution, output_gradient);
-      }
+   const Vector<size_t>& training_indices = instances.arrange_training_indices();
 
-      point_gradient = calculate_point_gradient(inputs, layers_activation, layers_delta);
+   // Root mean squared error stuff
 
-      #pragma omp critical
+   FirstOrderPerformance first_order_performance = calculate_error_sum_and_gradient_sum(training_indices);
 
-      gradient += point_gradient;
-   }
+   first_order_performance.performance = sqrt(first_order_performance.performance/(double)training_instances_number);
+   first_order_performance.gradient /= training_instances_number*first_order_performance.performance;
 
-   return(gradient);
+   return(first_order_performance);
 }
 
 
@@ -508,16 +401,10 @@ double RootMeanSquaredError::calculate_generalization_performance(void) const
 
    #endif
 
-   // Neural network staff
-
-   const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
-
-   const size_t inputs_number = multilayer_perceptron_pointer->get_inputs_number();
-   const size_t outputs_number = multilayer_perceptron_pointer->get_outputs_number();
-
    // Data set stuff
 
    const Instances& instances = data_set_pointer->get_instances();
+
    const size_t generalization_instances_number = instances.count_generalization_instances_number();
 
    if(generalization_instances_number == 0)
@@ -525,54 +412,11 @@ double RootMeanSquaredError::calculate_generalization_performance(void) const
       return(0.0);
    }
 
-   const Vector<size_t> generalization_indices = instances.arrange_generalization_indices();
-
-   size_t generalization_index;
-
-   const MissingValues& missing_values = data_set_pointer->get_missing_values();
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
-   Vector<double> inputs(inputs_number);
-   Vector<double> outputs(outputs_number);
-   Vector<double> targets(outputs_number);
-
-   int i = 0;
-
-   double generalization_performance = 0.0;
-
-   #pragma omp parallel for private(i, generalization_index, inputs, outputs, targets) reduction(+ : generalization_performance)
-
-   for(i = 0; i < (int)generalization_instances_number; i++)
-   {
-       generalization_index = generalization_indices[i];
-
-       if(missing_values.has_missing_values(generalization_index))
-       {
-           continue;
-       }
-
-      // Input vector
-
-      inputs = data_set_pointer->get_instance(generalization_index, inputs_indices);
+   const Vector<size_t>& generalization_indices = instances.arrange_generalization_indices();
 
-      // Output vector
-
-      outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
-
-      // Target vector
-
-      targets = data_set_pointer->get_instance(generalization_index, targets_indices);
-
-      // Sum of squares error
-
-      generalization_performance += outputs.calculate_sum_squared_error(targets);
-   }
+   // Root mean squared error
 
-   return(sqrt(generalization_performance/(double)generalization_instances_number));
+   return(sqrt(calculate_error_sum(generalization_indices)/(double)generalization_instances_number));
 }
 
 
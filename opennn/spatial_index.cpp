@@ -0,0 +1,593 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.artelnics.com/opennn                                                                                   */
+/*                                                                                                              */
+/*   S P A T I A L   I N D E X   C L A S S                                                                      */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   Artelnics - Making intelligent use of data                                                                 */
+/*   robertolopez@artelnics.com                                                                                 */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// OpenNN includes
+
+#include "spatial_index.h"
+
+namespace OpenNN
+{
+
+// DEFAULT CONSTRUCTOR
+
+/// Default constructor.
+/// It creates a spatial index without points.
+
+SpatialIndex::SpatialIndex(void)
+{
+   set();
+}
+
+
+// POINTS CONSTRUCTOR
+
+/// Points constructor.
+/// It creates a spatial index over the rows of a matrix.
+/// @param new_points Matrix of points, with one point per row.
+
+SpatialIndex::SpatialIndex(const Matrix<double>& new_points)
+{
+   set(new_points);
+}
+
+
+// DESTRUCTOR
+
+/// Destructor.
+
+SpatialIndex::~SpatialIndex(void)
+{
+}
+
+
+// METHODS
+
+// const size_t& get_points_number(void) const method
+
+/// Returns the number of points in the index.
+
+const size_t& SpatialIndex::get_points_number(void) const
+{
+   return(points_number);
+}
+
+
+// const size_t& get_dimensions_number(void) const method
+
+/// Returns the number of coordinates of each point.
+
+const size_t& SpatialIndex::get_dimensions_number(void) const
+{
+   return(dimensions_number);
+}
+
+
+// const SearchMethod& get_search_method(void) const method
+
+/// Returns the method used for searching the nearest neighbors.
+
+const SpatialIndex::SearchMethod& SpatialIndex::get_search_method(void) const
+{
+   return(search_method);
+}
+
+
+// std::string write_search_method(void) const method
+
+/// Returns a string with the name of the method used for searching the nearest neighbors.
+
+std::string SpatialIndex::write_search_method(void) const
+{
+   if(search_method == KDTree)
+   {
+      return("KDTree");
+   }
+   else if(search_method == BruteForce)
+   {
+      return("BruteForce");
+   }
+   else
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: SpatialIndex class.\n"
+             << "std::string write_search_method(void) const method.\n"
+             << "Unknown search method.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+}
+
+
+// const size_t& get_leaf_size(void) const method
+
+/// Returns the maximum number of points in a leaf of the KD-tree.
+
+const size_t& SpatialIndex::get_leaf_size(void) const
+{
+   return(leaf_size);
+}
+
+
+// size_t count_nodes_number(void) const method
+
+/// Returns the number of nodes of the KD-tree, which is zero if the brute force search method is used.
+
+size_t SpatialIndex::count_nodes_number(void) const
+{
+   return(nodes_begin.size());
+}
+
+
+// void set(void) method
+
+/// Removes all the points from the index.
+
+void SpatialIndex::set(void)
+{
+   points_number = 0;
+   dimensions_number = 0;
+
+   points.set();
+
+   search_method = KDTree;
+
+   leaf_size = 16;
+
+   build_tree();
+}
+
+
+// void set(const Matrix<double>&) method
+
+/// Sets new points for the index, and builds the KD-tree if it is to be used.
+/// The KD-tree is chosen for up to twelve dimensions, and the brute force search for more.
+/// @param new_points Matrix of points, with one point per row.
+
+void SpatialIndex::set(const Matrix<double>& new_points)
+{
+   points_number = new_points.get_rows_number();
+   dimensions_number = new_points.get_columns_number();
+
+   points.set(points_number*dimensions_number);
+
+   for(size_t j = 0; j < dimensions_number; j++)
+   {
+      for(size_t i = 0; i < points_number; i++)
+      {
+         points[i*dimensions_number + j] = new_points(i,j);
+      }
+   }
+
+   if(dimensions_number <= 12)
+   {
+      search_method = KDTree;
+   }
+   else
+   {
+      search_method = BruteForce;
+   }
+
+   leaf_size = 16;
+
+   build_tree();
+}
+
+
+// void set_search_method(const SearchMethod&) method
+
+/// Sets a new method for searching the nearest neighbors.
+/// The KD-tree is built or removed accordingly.
+/// @param new_search_method Search method.
+
+void SpatialIndex::set_search_method(const SearchMethod& new_search_method)
+{
+   search_method = new_search_method;
+
+   build_tree();
+}
+
+
+// void set_leaf_size(const size_t&) method
+
+/// Sets a new maximum number of points in the leaves of the KD-tree, and builds the tree again.
+/// @param new_leaf_size Maximum number of points in a leaf.
+
+void SpatialIndex::set_leaf_size(const size_t& new_leaf_size)
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_leaf_size == 0)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: SpatialIndex class.\n"
+             << "void set_leaf_size(const size_t&) method.\n"
+             << "Leaf size must be greater than zero.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   leaf_size = new_leaf_size;
+
+   build_tree();
+}
+
+
+// void calculate_nearest_neighbors(const size_t&, Matrix<size_t>&, Matrix<double>&) const method
+
+/// Calculates the nearest neighbors of every point in the index, not counting the point itself.
+/// The neighbors of each point are sorted by increasing distance.
+/// @param nearest_neighbors_number Number of neighbors of each point, which must be less than the number of points.
+/// @param nearest_neighbors Matrix where the indices of the neighbors are returned, with one row per point.
+/// @param nearest_distances Matrix where the Euclidean distances to the neighbors are returned, with one row per point.
+
+void SpatialIndex::calculate_nearest_neighbors(const size_t& nearest_neighbors_number,
+                                               Matrix<size_t>& nearest_neighbors,
+                                               Matrix<double>& nearest_distances) const
+{
+   // The neighbor search relies on this condition, so it is checked also in release builds
+
+   if(nearest_neighbors_number == 0 || nearest_neighbors_number >= points_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: SpatialIndex class.\n"
+             << "void calculate_nearest_neighbors(const size_t&, Matrix<size_t>&, Matrix<double>&) const method.\n"
+             << "Number of nearest neighbors (" << nearest_neighbors_number << ") must be greater than zero and less than number of points (" << points_number << ").\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   nearest_neighbors.set(points_number, nearest_neighbors_number);
+   nearest_distances.set(points_number, nearest_neighbors_number);
+
+   const size_t block_size = 256;
+
+   const size_t blocks_number = (points_number + block_size - 1)/block_size;
+
+   Vector< Vector<size_t> > best_indices;
+   Vector< Vector<double> > best_distances;
+
+   int i = 0;
+
+   #pragma omp parallel for private(i, best_indices, best_distances) schedule(dynamic)
+
+   for(i = 0; i < (int)blocks_number; i++)
+   {
+      const size_t query_begin = i*block_size;
+      const size_t query_end = std::min(query_begin + block_size, points_number);
+
+      best_indices.set(query_end - query_begin);
+      best_distances.set(query_end - query_begin);
+
+      for(size_t q = 0; q < query_end - query_begin; q++)
+      {
+         best_indices[q].set(nearest_neighbors_number, points_number);
+         best_distances[q].set(nearest_neighbors_number, std::numeric_limits<double>::max());
+      }
+
+      if(search_method == KDTree)
+      {
+         for(size_t q = query_begin; q < query_end; q++)
+         {
+            search_node(0, q, best_indices[q-query_begin], best_distances[q-query_begin]);
+         }
+      }
+      else
+      {
+         search_brute_force(query_begin, query_end, best_indices, best_distances);
+      }
+
+      for(size_t q = query_begin; q < query_end; q++)
+      {
+         for(size_t j = 0; j < nearest_neighbors_number; j++)
+         {
+            nearest_neighbors(q,j) = best_indices[q-query_begin][j];
+            nearest_distances(q,j) = sqrt(calculate_squared_distance(q, best_indices[q-query_begin][j]));
+         }
+      }
+   }
+}
+
+
+// void build_tree(void) method
+
+/// Builds the KD-tree over the points if the search method is the KD-tree, and removes it otherwise.
+
+void SpatialIndex::build_tree(void)
+{
+   permutation.set();
+
+   nodes_begin.set();
+   nodes_end.set();
+   nodes_split_dimension.set();
+   nodes_split_value.set();
+   nodes_left.set();
+   nodes_right.set();
+
+   if(search_method != KDTree || points_number == 0)
+   {
+      return;
+   }
+
+   permutation.set(points_number);
+   permutation.initialize_sequential();
+
+   Vector< std::pair<double, size_t> > values_indices;
+
+   build_node(0, points_number, values_indices);
+}
+
+
+// size_t build_node(const size_t&, const size_t&, Vector< std::pair<double, size_t> >&) method
+
+/// Builds a node of the KD-tree for the points between two positions of the permutation, together with its descendants.
+/// The points are split at the median of the coordinate with the largest spread.
+/// It returns the index of the node.
+/// @param begin Position in the permutation of the first point of the node.
+/// @param end Position in the permutation after the last point of the node.
+/// @param values_indices Work space for sorting the points of the node.
+
+size_t SpatialIndex::build_node(const size_t& begin, const size_t& end, Vector< std::pair<double, size_t> >& values_indices)
+{
+   const size_t node = nodes_begin.size();
+
+   nodes_begin.push_back(begin);
+   nodes_end.push_back(end);
+   nodes_split_dimension.push_back(0);
+   nodes_split_value.push_back(0.0);
+   nodes_left.push_back(0);
+   nodes_right.push_back(0);
+
+   if(end - begin <= leaf_size)
+   {
+      return(node);
+   }
+
+   size_t split_dimension = 0;
+   double maximum_spread = 0.0;
+
+   for(size_t j = 0; j < dimensions_number; j++)
+   {
+      double minimum = points[permutation[begin]*dimensions_number + j];
+      double maximum = minimum;
+
+      for(size_t k = begin+1; k < end; k++)
+      {
+         const double value = points[permutation[k]*dimensions_number + j];
+
+         if(value < minimum)
+         {
+            minimum = value;
+         }
+         else if(value > maximum)
+         {
+            maximum = value;
+         }
+      }
+
+      if(maximum - minimum > maximum_spread)
+      {
+         maximum_spread = maximum - minimum;
+         split_dimension = j;
+      }
+   }
+
+   // All the points of the node are equal
+
+   if(maximum_spread == 0.0)
+   {
+      return(node);
+   }
+
+   values_indices.set(end - begin);
+
+   for(size_t k = begin; k < end; k++)
+   {
+      values_indices[k-begin] = std::make_pair(points[permutation[k]*dimensions_number + split_dimension], permutation[k]);
+   }
+
+   const size_t middle = begin + (end - begin)/2;
+
+   std::nth_element(values_indices.begin(), values_indices.begin() + (middle - begin), values_indices.end());
+
+   for(size_t k = begin; k < end; k++)
+   {
+      permutation[k] = values_indices[k-begin].second;
+   }
+
+   nodes_split_dimension[node] = split_dimension;
+   nodes_split_value[node] = values_indices[middle-begin].first;
+
+   const size_t left = build_node(begin, middle, values_indices);
+   const size_t right = build_node(middle, end, values_indices);
+
+   nodes_left[node] = left;
+   nodes_right[node] = right;
+
+   return(node);
+}
+
+
+// void search_node(const size_t&, const size_t&, Vector<size_t>&, Vector<double>&) const method
+
+/// Searches a node of the KD-tree and its descendants for neighbors of a point which are closer than those already found.
+/// The child on the side of the point is searched first, and the other child only if the splitting plane is closer than the furthest neighbor.
+/// @param node Index of the node.
+/// @param query_index Index of the point whose neighbors are searched.
+/// @param best_indices Indices of the neighbors found so far, sorted by increasing distance.
+/// @param best_distances Squared distances to the neighbors found so far.
+
+void SpatialIndex::search_node(const size_t& node, const size_t& query_index, Vector<size_t>& best_indices, Vector<double>& best_distances) const
+{
+   if(nodes_left[node] == 0)
+   {
+      for(size_t k = nodes_begin[node]; k < nodes_end[node]; k++)
+      {
+         const size_t point_index = permutation[k];
+
+         if(point_index != query_index)
+         {
+            insert_neighbor(point_index, calculate_squared_distance(query_index, point_index), best_indices, best_distances);
+         }
+      }
+
+      return;
+   }
+
+   const double difference = points[query_index*dimensions_number + nodes_split_dimension[node]] - nodes_split_value[node];
+
+   const size_t near_child = (difference < 0.0) ? nodes_left[node] : nodes_right[node];
+   const size_t far_child = (difference < 0.0) ? nodes_right[node] : nodes_left[node];
+
+   search_node(near_child, query_index, best_indices, best_distances);
+
+   if(difference*difference < best_distances[best_distances.size()-1])
+   {
+      search_node(far_child, query_index, best_indices, best_distances);
+   }
+}
+
+
+// void search_brute_force(const size_t&, const size_t&, Vector< Vector<size_t> >&, Vector< Vector<double> >&) const method
+
+/// Searches the neighbors of a block of consecutive points by computing their distances to all the points.
+/// The points are compared by blocks, and the squared distances are obtained from the products of the coordinates
+/// of both blocks, as the sum of the squared norms minus twice the dot products.
+/// @param query_begin Index of the first point of the block.
+/// @param query_end Index after the last point of the block.
+/// @param best_indices Indices of the neighbors of every point of the block, sorted by increasing distance.
+/// @param best_distances Squared distances to the neighbors of every point of the block.
+
+void SpatialIndex::search_brute_force(const size_t& query_begin, const size_t& query_end,
+                                      Vector< Vector<size_t> >& best_indices, Vector< Vector<double> >& best_distances) const
+{
+   typedef Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> RowMajorMatrix;
+
+   const size_t queries_number = query_end - query_begin;
+
+   const size_t block_size = 1024;
+
+   const Eigen::Map<const RowMajorMatrix> queries_eigen(&points[query_begin*dimensions_number], queries_number, dimensions_number);
+
+   const Eigen::VectorXd queries_norms = queries_eigen.rowwise().squaredNorm();
+
+   Eigen::MatrixXd products;
+
+   for(size_t block_begin = 0; block_begin < points_number; block_begin += block_size)
+   {
+      const size_t block_end = std::min(block_begin + block_size, points_number);
+
+      const Eigen::Map<const RowMajorMatrix> block_eigen(&points[block_begin*dimensions_number], block_end - block_begin, dimensions_number);
+
+      const Eigen::VectorXd block_norms = block_eigen.rowwise().squaredNorm();
+
+      products.noalias() = queries_eigen*block_eigen.transpose();
+
+      for(size_t q = 0; q < queries_number; q++)
+      {
+         for(size_t k = block_begin; k < block_end; k++)
+         {
+            if(k == query_begin + q)
+            {
+               continue;
+            }
+
+            const double squared_distance = std::max(queries_norms(q) + block_norms(k-block_begin) - 2.0*products(q, k-block_begin), 0.0);
+
+            insert_neighbor(k, squared_distance, best_indices[q], best_distances[q]);
+         }
+      }
+   }
+}
+
+
+// void insert_neighbor(const size_t&, const double&, Vector<size_t>&, Vector<double>&) const method
+
+/// Inserts a point in a list of neighbors sorted by increasing distance, if it is closer than the furthest one,
+/// which is then dropped from the list.
+/// @param point_index Index of the point.
+/// @param squared_distance Squared distance to the point.
+/// @param best_indices Indices of the neighbors.
+/// @param best_distances Squared distances to the neighbors.
+
+void SpatialIndex::insert_neighbor(const size_t& point_index, const double& squared_distance,
+                                   Vector<size_t>& best_indices, Vector<double>& best_distances) const
+{
+   size_t position = best_distances.size();
+
+   if(squared_distance >= best_distances[position-1])
+   {
+      return;
+   }
+
+   position--;
+
+   while(position > 0 && best_distances[position-1] > squared_distance)
+   {
+      best_distances[position] = best_distances[position-1];
+      best_indices[position] = best_indices[position-1];
+
+      position--;
+   }
+
+   best_distances[position] = squared_distance;
+   best_indices[position] = point_index;
+}
+
+
+// double calculate_squared_distance(const size_t&, const size_t&) const method
+
+/// Returns the squared Euclidean distance between two points.
+/// @param i Index of the first point.
+/// @param j Index of the second point.
+
+double SpatialIndex::calculate_squared_distance(const size_t& i, const size_t& j) const
+{
+   const double* point_i = &points[i*dimensions_number];
+   const double* point_j = &points[j*dimensions_number];
+
+   double squared_distance = 0.0;
+
+   for(size_t k = 0; k < dimensions_number; k++)
+   {
+      squared_distance += (point_i[k] - point_j[k])*(point_i[k] - point_j[k]);
+   }
+
+   return(squared_distance);
+}
+
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (c) 2005-2015 Roberto Lopez.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -0,0 +1,177 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.artelnics.com/opennn                                                                                   */
+/*                                                                                                              */
+/*   S P A T I A L   I N D E X   C L A S S   H E A D E R                                                        */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   Artelnics - Making intelligent use of data                                                                 */
+/*   robertolopez@artelnics.com                                                                                 */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __SPATIALINDEX_H__
+#define __SPATIALINDEX_H__
+
+// System includes
+
+#include <iostream>
+#include <string>
+#include <sstream>
+#include <stdexcept>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <utility>
+
+// OpenNN includes
+
+#include "vector.h"
+#include "matrix.h"
+
+namespace OpenNN
+{
+
+/// This class answers nearest neighbors queries over a set of points, such as the used instances of a data set.
+/// For a small number of dimensions the points are organized in a KD-tree,
+/// whose branches are discarded when they are further than the neighbors already found.
+/// For a large number of dimensions, where trees degrade to exhaustive search,
+/// the distances are computed by blocks of points as matrix products.
+/// The queries of different points are answered in parallel.
+
+class SpatialIndex
+{
+
+public:
+
+   // DEFAULT CONSTRUCTOR
+
+   explicit SpatialIndex(void);
+
+   // POINTS CONSTRUCTOR
+
+   explicit SpatialIndex(const Matrix<double>&);
+
+   // DESTRUCTOR
+
+   virtual ~SpatialIndex(void);
+
+   // ENUMERATIONS
+
+   /// Enumeration of the available methods for searching the nearest neighbors.
+
+   enum SearchMethod{KDTree, BruteForce};
+
+   // GET METHODS
+
+   const size_t& get_points_number(void) const;
+   const size_t& get_dimensions_number(void) const;
+
+   const SearchMethod& get_search_method(void) const;
+   std::string write_search_method(void) const;
+
+   const size_t& get_leaf_size(void) const;
+
+   size_t count_nodes_number(void) const;
+
+   // SET METHODS
+
+   void set(void);
+   void set(const Matrix<double>&);
+
+   void set_search_method(const SearchMethod&);
+   void set_leaf_size(const size_t&);
+
+   // NEAREST NEIGHBORS METHODS
+
+   void calculate_nearest_neighbors(const size_t&, Matrix<size_t>&, Matrix<double>&) const;
+
+private:
+
+   // METHODS
+
+   void build_tree(void);
+   size_t build_node(const size_t&, const size_t&, Vector< std::pair<double, size_t> >&);
+
+   void search_node(const size_t&, const size_t&, Vector<size_t>&, Vector<double>&) const;
+
+   void search_brute_force(const size_t&, const size_t&, Vector< Vector<size_t> >&, Vector< Vector<double> >&) const;
+
+   void insert_neighbor(const size_t&, const double&, Vector<size_t>&, Vector<double>&) const;
+
+   double calculate_squared_distance(const size_t&, const size_t&) const;
+
+   // MEMBERS
+
+   /// Number of points.
+
+   size_t points_number;
+
+   /// Number of coordinates of each point.
+
+   size_t dimensions_number;
+
+   /// Coordinates of the points, stored one point after another.
+
+   Vector<double> points;
+
+   /// Method used for searching the nearest neighbors.
+
+   SearchMethod search_method;
+
+   /// Maximum number of points in a leaf of the KD-tree.
+
+   size_t leaf_size;
+
+   /// Indices of the points, ordered so that the points of every node of the KD-tree are consecutive.
+
+   Vector<size_t> permutation;
+
+   /// Position in the permutation of the first point of each node.
+
+   Vector<size_t> nodes_begin;
+
+   /// Position in the permutation after the last point of each node.
+
+   Vector<size_t> nodes_end;
+
+   /// Coordinate along which each node is split.
+
+   Vector<size_t> nodes_split_dimension;
+
+   /// Value of the coordinate at which each node is split.
+   /// The points of the left child are not greater than it, and those of the right child are not less.
+
+   Vector<double> nodes_split_value;
+
+   /// Index of the left child of each node, or zero if the node is a leaf.
+
+   Vector<size_t> nodes_left;
+
+   /// Index of the right child of each node, or zero if the node is a leaf.
+
+   Vector<size_t> nodes_right;
+};
+
+}
+
+#endif
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (c) 2005-2015 Roberto Lopez.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
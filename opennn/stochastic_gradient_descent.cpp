@@ -0,0 +1,1657 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.artelnics.com/opennn                                                                                   */
+/*                                                                                                              */
+/*   S T O C H A S T I C   G R A D I E N T   D E S C E N T   C L A S S                                          */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   Artelnics - Making intelligent use of data                                                                 */
+/*   robertolopez@artelnics.com                                                                                 */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// Open NN includes
+
+#include "stochastic_gradient_descent.h"
+
+namespace OpenNN
+{
+
+// DEFAULT CONSTRUCTOR
+
+/// Default constructor.
+/// It creates a stochastic gradient descent training algorithm not associated to any performance functional object.
+/// It also initializes the class members to their default values.
+
+StochasticGradientDescent::StochasticGradientDescent(void)
+ : TrainingAlgorithm()
+{
+   set_default();
+}
+
+
+// PERFORMANCE FUNCTIONAL CONSTRUCTOR
+
+/// Performance functional constructor.
+/// It creates a stochastic gradient descent training algorithm associated to a performance functional.
+/// It also initializes the class members to their default values.
+/// @param new_performance_functional_pointer Pointer to a performance functional object.
+
+StochasticGradientDescent::StochasticGradientDescent(PerformanceFunctional* new_performance_functional_pointer)
+: TrainingAlgorithm(new_performance_functional_pointer)
+{
+   set_default();
+}
+
+
+// XML CONSTRUCTOR
+
+/// XML constructor.
+/// It creates a stochastic gradient descent training algorithm not associated to any performance functional object.
+/// It also loads the class members from a XML document.
+/// @param document TinyXML document with the members of a stochastic gradient descent object.
+
+StochasticGradientDescent::StochasticGradientDescent(const tinyxml2::XMLDocument& document) : TrainingAlgorithm(document)
+{
+   set_default();
+
+   from_XML(document);
+}
+
+
+// DESTRUCTOR
+
+/// Destructor.
+
+StochasticGradientDescent::~StochasticGradientDescent(void)
+{
+}
+
+
+// METHODS
+
+// const UpdateMethod& get_update_method(void) const method
+
+/// Returns the rule used to update the parameters from each mini-batch gradient.
+
+const StochasticGradientDescent::UpdateMethod& StochasticGradientDescent::get_update_method(void) const
+{
+   return(update_method);
+}
+
+
+// std::string write_update_method(void) const method
+
+/// Returns a string with the name of the rule used to update the parameters.
+
+std::string StochasticGradientDescent::write_update_method(void) const
+{
+   switch(update_method)
+   {
+      case Momentum:
+      {
+         return("Momentum");
+      }
+      break;
+
+      case Nesterov:
+      {
+         return("Nesterov");
+      }
+      break;
+
+      case Adam:
+      {
+         return("Adam");
+      }
+      break;
+
+      default:
+      {
+         std::ostringstream buffer;
+
+         buffer << "OpenNN Exception: StochasticGradientDescent class.\n"
+                << "std::string write_update_method(void) const method.\n"
+                << "Unknown update method.\n";
+
+         throw std::logic_error(buffer.str());
+      }
+      break;
+   }
+}
+
+
+// const size_t& get_batch_size(void) const method
+
+/// Returns the number of training instances in each mini-batch.
+
+const size_t& StochasticGradientDescent::get_batch_size(void) const
+{
+   return(batch_size);
+}
+
+
+// const size_t& get_random_seed(void) const method
+
+/// Returns the seed of the generator which shuffles the training instances into mini-batches.
+
+const size_t& StochasticGradientDescent::get_random_seed(void) const
+{
+   return(random_seed);
+}
+
+
+// const double& get_learning_rate(void) const method
+
+/// Returns the step size which multiplies the mini-batch gradient in the parameters update.
+
+const double& StochasticGradientDescent::get_learning_rate(void) const
+{
+   return(learning_rate);
+}
+
+
+// const double& get_momentum(void) const method
+
+/// Returns the fraction of the previous parameters increment which is added to the current one
+/// in the momentum and Nesterov updates.
+
+const double& StochasticGradientDescent::get_momentum(void) const
+{
+   return(momentum);
+}
+
+
+// const double& get_beta_1(void) const method
+
+/// Returns the exponential decay rate for the first moment estimates of the Adam update.
+
+const double& StochasticGradientDescent::get_beta_1(void) const
+{
+   return(beta_1);
+}
+
+
+// const double& get_beta_2(void) const method
+
+/// Returns the exponential decay rate for the second moment estimates of the Adam update.
+
+const double& StochasticGradientDescent::get_beta_2(void) const
+{
+   return(beta_2);
+}
+
+
+// const double& get_epsilon(void) const method
+
+/// Returns the small value which prevents divisions by zero in the Adam update.
+
+const double& StochasticGradientDescent::get_epsilon(void) const
+{
+   return(epsilon);
+}
+
+
+// const double& get_minimum_performance_increase(void) const method
+
+/// Returns the minimum performance improvement during training.
+
+const double& StochasticGradientDescent::get_minimum_performance_increase(void) const
+{
+   return(minimum_performance_increase);
+}
+
+
+// const double& get_performance_goal(void) const method
+
+/// Returns the goal value for the performance.
+/// This is used as a stopping criterion when training a multilayer perceptron
+
+const double& StochasticGradientDescent::get_performance_goal(void) const
+{
+   return(performance_goal);
+}
+
+
+// const size_t& get_maximum_generalization_performance_decreases(void) const method
+
+/// Returns the maximum number of selection failures during the training process.
+
+const size_t& StochasticGradientDescent::get_maximum_generalization_performance_decreases(void) const
+{
+   return(maximum_generalization_performance_decreases);
+}
+
+
+// const size_t& get_maximum_epochs_number(void) const method
+
+/// Returns the maximum number of passes over the training instances.
+
+const size_t& StochasticGradientDescent::get_maximum_epochs_number(void) const
+{
+   return(maximum_epochs_number);
+}
+
+
+// const double& get_maximum_time(void) const method
+
+/// Returns the maximum training time.
+
+const double& StochasticGradientDescent::get_maximum_time(void) const
+{
+   return(maximum_time);
+}
+
+
+// const bool& get_reserve_parameters_history(void) const method
+
+/// Returns true if the parameters history matrix is to be reserved, and false otherwise.
+
+const bool& StochasticGradientDescent::get_reserve_parameters_history(void) const
+{
+   return(reserve_parameters_history);
+}
+
+
+// void set_default(void) method
+
+void StochasticGradientDescent::set_default(void)
+{
+   // TRAINING OPERATORS
+
+   update_method = Adam;
+
+   // TRAINING PARAMETERS
+
+   batch_size = 32;
+   random_seed = 1;
+
+   learning_rate = 0.001;
+   momentum = 0.9;
+
+   beta_1 = 0.9;
+   beta_2 = 0.999;
+   epsilon = 1.0e-8;
+
+   // STOPPING CRITERIA
+
+   minimum_performance_increase = 0.0;
+   performance_goal = -1.0e99;
+   maximum_generalization_performance_decreases = 1000000;
+
+   maximum_epochs_number = 100;
+   maximum_time = 1000.0;
+
+   // TRAINING HISTORY
+
+   reserve_parameters_history = false;
+
+   // UTILITIES
+
+   display = true;
+   display_period = 5;
+}
+
+
+// void set_update_method(const UpdateMethod&) method
+
+/// Sets a new rule for updating the parameters from each mini-batch gradient.
+/// @param new_update_method Update method value.
+
+void StochasticGradientDescent::set_update_method(const UpdateMethod& new_update_method)
+{
+   update_method = new_update_method;
+}
+
+
+// void set_update_method(const std::string&) method
+
+/// Sets a new rule for updating the parameters from a string containing the name.
+/// Possible values are:
+/// <ul>
+/// <li> "Momentum"
+/// <li> "Nesterov"
+/// <li> "Adam"
+/// </ul>
+/// @param new_update_method_name Name of the update method.
+
+void StochasticGradientDescent::set_update_method(const std::string& new_update_method_name)
+{
+   if(new_update_method_name == "Momentum")
+   {
+      update_method = Momentum;
+   }
+   else if(new_update_method_name == "Nesterov")
+   {
+      update_method = Nesterov;
+   }
+   else if(new_update_method_name == "Adam")
+   {
+      update_method = Adam;
+   }
+   else
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: StochasticGradientDescent class.\n"
+             << "void set_update_method(const std::string&) method.\n"
+             << "Unknown update method: " << new_update_method_name << ".\n";
+
+      throw std::logic_error(buffer.str());
+   }
+}
+
+
+// void set_batch_size(const size_t&) method
+
+/// Sets a new number of training instances in each mini-batch.
+/// @param new_batch_size Number of instances per mini-batch.
+
+void StochasticGradientDescent::set_batch_size(const size_t& new_batch_size)
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_batch_size == 0)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: StochasticGradientDescent class.\n"
+             << "void set_batch_size(const size_t&) method.\n"
+             << "Batch size must be greater than 0.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   batch_size = new_batch_size;
+}
+
+
+// void set_random_seed(const size_t&) method
+
+/// Sets a new seed for the generator which shuffles the training instances into mini-batches.
+/// Each call to perform_training() starts the generator from this seed.
+/// @param new_random_seed Seed of the random number generator.
+
+void StochasticGradientDescent::set_random_seed(const size_t& new_random_seed)
+{
+   random_seed = new_random_seed;
+}
+
+
+// void set_learning_rate(const double&) method
+
+/// Sets a new step size for the parameters update.
+/// @param new_learning_rate Learning rate value.
+
+void StochasticGradientDescent::set_learning_rate(const double& new_learning_rate)
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_learning_rate <= 0.0)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: StochasticGradientDescent class.\n"
+             << "void set_learning_rate(const double&) method.\n"
+             << "Learning rate must be greater than 0.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   learning_rate = new_learning_rate;
+}
+
+
+// void set_momentum(const double&) method
+
+/// Sets a new fraction of the previous parameters increment to be added to the current one.
+/// A value of zero gives plain stochastic gradient descent.
+/// @param new_momentum Momentum value, between 0 and 1.
+
+void StochasticGradientDescent::set_momentum(const double& new_momentum)
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_momentum < 0.0 || new_momentum >= 1.0)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: StochasticGradientDescent class.\n"
+             << "void set_momentum(const double&) method.\n"
+             << "Momentum must be equal or greater than 0 and less than 1.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   momentum = new_momentum;
+}
+
+
+// void set_beta_1(const double&) method
+
+/// Sets a new exponential decay rate for the first moment estimates of the Adam update.
+/// @param new_beta_1 Decay rate, between 0 and 1.
+
+void StochasticGradientDescent::set_beta_1(const double& new_beta_1)
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_beta_1 < 0.0 || new_beta_1 >= 1.0)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: StochasticGradientDescent class.\n"
+             << "void set_beta_1(const double&) method.\n"
+             << "Beta 1 must be equal or greater than 0 and less than 1.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   beta_1 = new_beta_1;
+}
+
+
+// void set_beta_2(const double&) method
+
+/// Sets a new exponential decay rate for the second moment estimates of the Adam update.
+/// @param new_beta_2 Decay rate, between 0 and 1.
+
+void StochasticGradientDescent::set_beta_2(const double& new_beta_2)
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_beta_2 < 0.0 || new_beta_2 >= 1.0)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: StochasticGradientDescent class.\n"
+             << "void set_beta_2(const double&) method.\n"
+             << "Beta 2 must be equal or greater than 0 and less than 1.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   beta_2 = new_beta_2;
+}
+
+
+// void set_epsilon(const double&) method
+
+/// Sets a new value for preventing divisions by zero in the Adam update.
+/// @param new_epsilon Small positive value.
+
+void StochasticGradientDescent::set_epsilon(const double& new_epsilon)
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_epsilon <= 0.0)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: StochasticGradientDescent class.\n"
+             << "void set_epsilon(const double&) method.\n"
+             << "Epsilon must be greater than 0.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   epsilon = new_epsilon;
+}
+
+
+// void set_minimum_performance_increase(const double&) method
+
+/// Sets a new minimum performance improvement between two epochs.
+/// Since the performance of an epoch is estimated from the mini-batches, it might increase from one epoch to the next.
+/// Training stops when the absolute value of the change is equal or less than this value.
+/// @param new_minimum_performance_increase Minimum improvement in the performance between two epochs.
+
+void StochasticGradientDescent::set_minimum_performance_increase(const double& new_minimum_performance_increase)
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_minimum_performance_increase < 0.0)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: StochasticGradientDescent class.\n"
+             << "void set_minimum_performance_increase(const double&) method.\n"
+             << "Minimum performance improvement must be equal or greater than 0.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   minimum_performance_increase = new_minimum_performance_increase;
+}
+
+
+// void set_performance_goal(const double&) method
+
+/// Sets a new goal value for the performance.
+/// This is used as a stopping criterion when training a multilayer perceptron
+/// @param new_performance_goal Goal value for the performance.
+
+void StochasticGradientDescent::set_performance_goal(const double& new_performance_goal)
+{
+   performance_goal = new_performance_goal;
+}
+
+
+// void set_maximum_generalization_performance_decreases(const size_t&) method
+
+/// Sets a new maximum number of generalization failures.
+/// @param new_maximum_generalization_performance_decreases Maximum number of epochs in which the generalization evalutation decreases.
+
+void StochasticGradientDescent::set_maximum_generalization_performance_decreases(const size_t& new_maximum_generalization_performance_decreases)
+{
+   maximum_generalization_performance_decreases = new_maximum_generalization_performance_decreases;
+}
+
+
+// void set_maximum_epochs_number(const size_t&) method
+
+/// Sets a maximum number of passes over the training instances.
+/// @param new_maximum_epochs_number Maximum number of epochs for training.
+
+void StochasticGradientDescent::set_maximum_epochs_number(const size_t& new_maximum_epochs_number)
+{
+   maximum_epochs_number = new_maximum_epochs_number;
+}
+
+
+// void set_maximum_time(const double&) method
+
+/// Sets a new maximum training time.
+/// @param new_maximum_time Maximum training time.
+
+void StochasticGradientDescent::set_maximum_time(const double& new_maximum_time)
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_maximum_time < 0.0)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: StochasticGradientDescent class.\n"
+             << "void set_maximum_time(const double&) method.\n"
+             << "Maximum time must be equal or greater than 0.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   maximum_time = new_maximum_time;
+}
+
+
+// void set_reserve_parameters_history(bool) method
+
+/// Makes the parameters history vector of vectors to be reseved or not in memory.
+/// @param new_reserve_parameters_history True if the parameters history vector of vectors is to be reserved, false otherwise.
+
+void StochasticGradientDescent::set_reserve_parameters_history(const bool& new_reserve_parameters_history)
+{
+   reserve_parameters_history = new_reserve_parameters_history;
+}
+
+
+// Vector< Vector<size_t> > arrange_mini_batches(const Vector<size_t>&) const method
+
+/// Splits a list of instances indices into consecutive mini-batches of batch_size instances.
+/// The last mini-batch holds the remaining instances, and it might be smaller.
+/// @param instances_indices Indices of the instances, in the order in which they are to be visited.
+
+Vector< Vector<size_t> > StochasticGradientDescent::arrange_mini_batches(const Vector<size_t>& instances_indices) const
+{
+   const size_t instances_number = instances_indices.size();
+
+   const size_t mini_batches_number = (instances_number + batch_size - 1)/batch_size;
+
+   Vector< Vector<size_t> > mini_batches(mini_batches_number);
+
+   size_t mini_batch_begin;
+
+   for(size_t i = 0; i < mini_batches_number; i++)
+   {
+      mini_batch_begin = i*batch_size;
+
+      mini_batches[i] = instances_indices.take_out(mini_batch_begin, std::min(batch_size, instances_number - mini_batch_begin));
+   }
+
+   return(mini_batches);
+}
+
+
+// PerformanceFunctional::FirstOrderperformance calculate_mini_batch_performance_and_gradient(const Vector<size_t>&, const double&) const method
+
+/// Returns estimates of the performance and the gradient of the performance functional from a mini-batch of instances.
+/// The error sums of the objective term over the mini-batch are multiplied by a scaling factor,
+/// so that they estimate the objective term over the whole training set.
+/// The regularization and constraints terms do not depend on the instances and are added as they are.
+/// @param mini_batch_indices Indices of the instances in the mini-batch.
+/// @param objective_scaling Number of training instances divided by the size of the mini-batch
+/// and by the error normalization coefficient of the objective term.
+
+PerformanceFunctional::FirstOrderperformance StochasticGradientDescent::calculate_mini_batch_performance_and_gradient
+(const Vector<size_t>& mini_batch_indices, const double& objective_scaling) const
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   check();
+
+   #endif
+
+   const PerformanceTerm* objective_term_pointer = performance_functional_pointer->get_objective_term_pointer();
+
+   PerformanceFunctional::FirstOrderperformance first_order_performance;
+
+   first_order_performance.performance = performance_functional_pointer->calculate_regularization()
+                                       + performance_functional_pointer->calculate_constraints();
+
+   first_order_performance.gradient = performance_functional_pointer->calculate_regularization_gradient()
+                                    + performance_functional_pointer->calculate_constraints_gradient();
+
+   if(objective_term_pointer)
+   {
+      const PerformanceTerm::FirstOrderPerformance first_order_objective
+      = objective_term_pointer->calculate_error_sum_and_gradient_sum(mini_batch_indices);
+
+      first_order_performance.performance += first_order_objective.performance*objective_scaling;
+      first_order_performance.gradient += first_order_objective.gradient*objective_scaling;
+   }
+
+   return(first_order_performance);
+}
+
+
+// Vector<double> calculate_momentum_parameters_increment(const Vector<double>&, Vector<double>&) const method
+
+/// Returns the parameters increment of the momentum update, v = momentum*v - learning_rate*g.
+/// @param gradient Mini-batch gradient.
+/// @param velocity Previous parameters increment. It is overwritten with the new one.
+
+Vector<double> StochasticGradientDescent::calculate_momentum_parameters_increment(const Vector<double>& gradient, Vector<double>& velocity) const
+{
+   velocity = velocity*momentum - gradient*learning_rate;
+
+   return(velocity);
+}
+
+
+// Vector<double> calculate_Nesterov_parameters_increment(const Vector<double>&, Vector<double>&) const method
+
+/// Returns the parameters increment of the Nesterov accelerated gradient update.
+/// The parameters of the neural network are kept at the look-ahead point,
+/// so that the gradient is always evaluated at the current parameters.
+/// The increment is then (1+momentum)*v - momentum*v_old, with v = momentum*v_old - learning_rate*g.
+/// @param gradient Mini-batch gradient at the look-ahead point.
+/// @param velocity Previous velocity. It is overwritten with the new one.
+
+Vector<double> StochasticGradientDescent::calculate_Nesterov_parameters_increment(const Vector<double>& gradient, Vector<double>& velocity) const
+{
+   const Vector<double> old_velocity(velocity);
+
+   velocity = velocity*momentum - gradient*learning_rate;
+
+   return(velocity*(1.0 + momentum) - old_velocity*momentum);
+}
+
+
+// Vector<double> calculate_Adam_parameters_increment(const Vector<double>&, Vector<double>&, Vector<double>&, const size_t&) const method
+
+/// Returns the parameters increment of the Adam update,
+/// which scales each parameter step with bias corrected estimates of the first and second moments of the gradient.
+/// @param gradient Mini-batch gradient.
+/// @param first_moment Exponential average of the gradients. It is updated with the new gradient.
+/// @param second_moment Exponential average of the squared gradients. It is updated with the new gradient.
+/// @param step Number of updates performed so far, including this one.
+
+Vector<double> StochasticGradientDescent::calculate_Adam_parameters_increment(const Vector<double>& gradient,
+Vector<double>& first_moment, Vector<double>& second_moment, const size_t& step) const
+{
+   const size_t parameters_number = gradient.size();
+
+   const double first_moment_correction = 1.0 - pow(beta_1, (double)step);
+   const double second_moment_correction = 1.0 - pow(beta_2, (double)step);
+
+   Vector<double> parameters_increment(parameters_number);
+
+   for(size_t i = 0; i < parameters_number; i++)
+   {
+      first_moment[i] = beta_1*first_moment[i] + (1.0 - beta_1)*gradient[i];
+      second_moment[i] = beta_2*second_moment[i] + (1.0 - beta_2)*gradient[i]*gradient[i];
+
+      parameters_increment[i] = -learning_rate*(first_moment[i]/first_moment_correction)
+                              /(sqrt(second_moment[i]/second_moment_correction) + epsilon);
+   }
+
+   return(parameters_increment);
+}
+
+
+// std::string StochasticGradientDescentResults::to_string(void) const method
+
+std::string StochasticGradientDescent::StochasticGradientDescentResults::to_string(void) const
+{
+   std::ostringstream buffer;
+
+   // Parameters history
+
+   if(!parameters_history.empty())
+   {
+      if(!parameters_history[0].empty())
+      {
+          buffer << "% Parameters history:\n"
+                 << parameters_history << "\n";
+      }
+   }
+
+   // Parameters norm history
+
+   if(!parameters_norm_history.empty())
+   {
+       buffer << "% Parameters norm history:\n"
+              << parameters_norm_history << "\n";
+   }
+
+   // Performance history
+
+   if(!performance_history.empty())
+   {
+       buffer << "% Performance history:\n"
+              << performance_history << "\n";
+   }
+
+   // Selection performance history
+
+   if(!generalization_performance_history.empty())
+   {
+       buffer << "% Selection performance history:\n"
+              << generalization_performance_history << "\n";
+   }
+
+   // Gradient norm history
+
+   if(!gradient_norm_history.empty())
+   {
+       buffer << "% Gradient norm history:\n"
+              << gradient_norm_history << "\n";
+   }
+
+   // Elapsed time history
+
+   if(!elapsed_time_history.empty())
+   {
+       buffer << "% Elapsed time history:\n"
+              << elapsed_time_history << "\n";
+   }
+
+   // Stopping criterion
+
+   if(!stopping_criterion.empty())
+   {
+       buffer << "% Stopping criterion:\n"
+              << stopping_criterion << "\n";
+   }
+
+   return(buffer.str());
+}
+
+
+// Matrix<std::string> write_final_results(const size_t& precision) const method
+
+Matrix<std::string> StochasticGradientDescent::StochasticGradientDescentResults::write_final_results(const size_t& precision) const
+{
+   std::ostringstream buffer;
+
+   Vector<std::string> names;
+   Vector<std::string> values;
+
+   // Final parameters norm
+
+   names.push_back("Final parameters norm");
+
+   buffer.str("");
+   buffer << std::setprecision(precision) << final_parameters_norm;
+
+   values.push_back(buffer.str());
+
+   // Final performance
+
+   names.push_back("Final performance");
+
+   buffer.str("");
+   buffer << std::setprecision(precision) << final_performance;
+
+   values.push_back(buffer.str());
+
+   // Final selection performance
+
+   const PerformanceFunctional* performance_functional_pointer = stochastic_gradient_descent_pointer->get_performance_functional_pointer();
+
+   if(performance_functional_pointer->has_generalization())
+   {
+       names.push_back("Final selection performance");
+
+       buffer.str("");
+       buffer << std::setprecision(precision) << final_generalization_performance;
+
+       values.push_back(buffer.str());
+    }
+
+   // Final gradient norm
+
+   names.push_back("Final gradient norm");
+
+   buffer.str("");
+   buffer << std::setprecision(precision) << final_gradient_norm;
+
+   values.push_back(buffer.str());
+
+   // Epochs number
+
+   names.push_back("Epochs number");
+
+   buffer.str("");
+   buffer << epochs_number;
+
+   values.push_back(buffer.str());
+
+   // Elapsed time
+
+   names.push_back("Elapsed time");
+
+   buffer.str("");
+   buffer << elapsed_time;
+
+   values.push_back(buffer.str());
+
+   const size_t rows_number = names.size();
+   const size_t columns_number = 2;
+
+   Matrix<std::string> final_results(rows_number, columns_number);
+
+   final_results.set_column(0, names);
+   final_results.set_column(1, values);
+
+   return(final_results);
+}
+
+
+// void StochasticGradientDescentResults::resize_training_history(const size_t&) method
+
+/// Resizes the training history variables.
+/// The parameters history is only resized if it is to be reserved, since it holds a whole parameters vector per epoch.
+/// @param new_size Size of training history variables.
+
+void StochasticGradientDescent::StochasticGradientDescentResults::resize_training_history(const size_t& new_size)
+{
+    // Control sentence (if debug)
+
+    #ifdef __OPENNN_DEBUG__
+
+    if(stochastic_gradient_descent_pointer == NULL)
+    {
+       std::ostringstream buffer;
+
+       buffer << "OpenNN Exception: StochasticGradientDescentResults structure.\n"
+              << "void resize_training_history(const size_t&) method.\n"
+              << "Stochastic gradient descent pointer is NULL.\n";
+
+       throw std::logic_error(buffer.str());
+    }
+
+    #endif
+
+    if(stochastic_gradient_descent_pointer->get_reserve_parameters_history())
+    {
+        parameters_history.resize(new_size);
+    }
+
+    parameters_norm_history.resize(new_size);
+    performance_history.resize(new_size);
+    generalization_performance_history.resize(new_size);
+    gradient_norm_history.resize(new_size);
+    elapsed_time_history.resize(new_size);
+}
+
+
+// StochasticGradientDescentResults* perform_training(void) method
+
+/// Trains a neural network with an associated performance functional,
+/// according to the stochastic gradient descent method.
+/// Each epoch shuffles the training instances and updates the parameters once per mini-batch.
+/// The performance of an epoch is the mean of its mini-batch performances,
+/// and the selection performance is evaluated once at the end of each epoch.
+/// The objective term must provide the parallel reduction methods of the error terms.
+/// The root mean squared error is not supported, because its mini-batch values do not add up to the training value.
+/// It returns a results structure with the history and the final values of the reserved variables.
+
+StochasticGradientDescent::StochasticGradientDescentResults* StochasticGradientDescent::perform_training(void)
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   check();
+
+   #endif
+
+   // Control sentence
+
+   if(performance_functional_pointer->get_objective_type() == PerformanceFunctional::ROOT_MEAN_SQUARED_ERROR_OBJECTIVE)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: StochasticGradientDescent class.\n"
+             << "StochasticGradientDescentResults* perform_training(void) method.\n"
+             << "The root mean squared error is not a sum over the training instances and cannot be estimated from mini-batches.\n"
+             << "Use the mean squared error objective instead.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   StochasticGradientDescentResults* results_pointer = new StochasticGradientDescentResults(this);
+
+   // Start training
+
+   if(display)
+   {
+      std::cout << "Training with stochastic gradient descent...\n";
+   }
+
+   // Neural network stuff
+
+   NeuralNetwork* neural_network_pointer = performance_functional_pointer->get_neural_network_pointer();
+
+   const size_t parameters_number = neural_network_pointer->count_parameters_number();
+
+   Vector<double> parameters = neural_network_pointer->arrange_parameters();
+   double parameters_norm = parameters.calculate_norm();
+
+   Vector<double> parameters_increment(parameters_number);
+
+   // Data set stuff
+
+   const DataSet* data_set_pointer = performance_functional_pointer->get_data_set_pointer();
+
+   const Instances& instances = data_set_pointer->get_instances();
+
+   Vector<size_t> training_indices = instances.arrange_training_indices();
+
+   const size_t training_instances_number = training_indices.size();
+
+   // Performance functional stuff
+
+   const PerformanceTerm* objective_term_pointer = performance_functional_pointer->get_objective_term_pointer();
+
+   const double error_normalization_coefficient
+   = objective_term_pointer ? objective_term_pointer->calculate_error_normalization_coefficient() : 1.0;
+
+   double generalization_performance = 0.0;
+   double old_generalization_performance = 0.0;
+
+   double performance = 0.0;
+   double old_performance = 0.0;
+   double performance_increase = 0.0;
+
+   Vector<double> gradient(parameters_number);
+   double gradient_norm = 0.0;
+
+   PerformanceFunctional::FirstOrderperformance first_order_performance;
+
+   // Training algorithm stuff
+
+   size_t generalization_failures = 0;
+
+   std::mt19937 random_generator((unsigned)random_seed);
+
+   Vector< Vector<size_t> > mini_batches;
+   size_t mini_batches_number;
+
+   double objective_scaling;
+
+   Vector<double> velocity(parameters_number, 0.0);
+
+   Vector<double> first_moment(parameters_number, 0.0);
+   Vector<double> second_moment(parameters_number, 0.0);
+
+   size_t step = 0;
+
+   bool stop_training = false;
+
+   time_t beginning_time, current_time;
+   time(&beginning_time);
+   double elapsed_time;
+
+   results_pointer->resize_training_history(maximum_epochs_number+1);
+
+   // Main loop
+
+   for(size_t epoch = 0; epoch <= maximum_epochs_number; epoch++)
+   {
+      // Mini-batches stuff
+
+      std::shuffle(training_indices.begin(), training_indices.end(), random_generator);
+
+      mini_batches = arrange_mini_batches(training_indices);
+
+      mini_batches_number = mini_batches.size();
+
+      performance = 0.0;
+      gradient.initialize(0.0);
+
+      for(size_t i = 0; i < mini_batches_number; i++)
+      {
+         objective_scaling = (double)training_instances_number/((double)mini_batches[i].size()*error_normalization_coefficient);
+
+         first_order_performance = calculate_mini_batch_performance_and_gradient(mini_batches[i], objective_scaling);
+
+         performance += first_order_performance.performance*mini_batches[i].size();
+         gradient += first_order_performance.gradient*(double)mini_batches[i].size();
+
+         // Update parameters
+
+         step++;
+
+         switch(update_method)
+         {
+            case Momentum:
+            {
+               parameters_increment = calculate_momentum_parameters_increment(first_order_performance.gradient, velocity);
+            }
+            break;
+
+            case Nesterov:
+            {
+               parameters_increment = calculate_Nesterov_parameters_increment(first_order_performance.gradient, velocity);
+            }
+            break;
+
+            case Adam:
+            {
+               parameters_increment = calculate_Adam_parameters_increment(first_order_performance.gradient, first_moment, second_moment, step);
+            }
+            break;
+
+            default:
+            {
+               std::ostringstream buffer;
+
+               buffer << "OpenNN Exception: StochasticGradientDescent class.\n"
+                      << "StochasticGradientDescentResults* perform_training(void) method.\n"
+                      << "Unknown update method.\n";
+
+               throw std::logic_error(buffer.str());
+            }
+            break;
+         }
+
+         parameters += parameters_increment;
+
+         neural_network_pointer->set_parameters(parameters);
+      }
+
+      if(training_instances_number != 0)
+      {
+         performance /= (double)training_instances_number;
+         gradient /= (double)training_instances_number;
+      }
+
+      gradient_norm = gradient.calculate_norm();
+
+      parameters_norm = parameters.calculate_norm();
+
+      if(epoch == 0)
+      {
+         performance_increase = 1.0e99;
+      }
+      else
+      {
+         performance_increase = old_performance - performance;
+      }
+
+      generalization_performance = performance_functional_pointer->calculate_generalization_performance();
+
+      if(epoch != 0 && generalization_performance > old_generalization_performance)
+      {
+         generalization_failures++;
+      }
+
+      // Elapsed time
+
+      time(&current_time);
+      elapsed_time = difftime(current_time, beginning_time);
+
+      // Training history neural network
+
+      if(reserve_parameters_history)
+      {
+         results_pointer->parameters_history[epoch] = parameters;
+      }
+
+      results_pointer->parameters_norm_history[epoch] = parameters_norm;
+
+      // Training history performance functional
+
+      results_pointer->performance_history[epoch] = performance;
+      results_pointer->gradient_norm_history[epoch] = gradient_norm;
+      results_pointer->generalization_performance_history[epoch] = generalization_performance;
+
+      // Training history training algorithm
+
+      results_pointer->elapsed_time_history[epoch] = elapsed_time;
+
+      // Stopping Criteria
+
+      if(epoch != 0 && fabs(performance_increase) <= minimum_performance_increase)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Minimum performance increase reached.\n"
+                      << "Performance increase: " << performance_increase << std::endl;
+         }
+
+         results_pointer->stopping_criterion = "Minimum performance increase";
+
+         stop_training = true;
+      }
+
+      else if(performance <= performance_goal)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Performance goal reached.\n";
+         }
+
+         results_pointer->stopping_criterion = "Performance goal";
+
+         stop_training = true;
+      }
+
+      else if(generalization_failures >= maximum_generalization_performance_decreases)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Maximum generalization failures reached.\n"
+                      << "Generalization failures: " << generalization_failures << std::endl;
+         }
+
+         results_pointer->stopping_criterion = "Maximum generalization failures";
+
+         stop_training = true;
+      }
+
+      else if(epoch == maximum_epochs_number)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Maximum number of epochs reached.\n";
+         }
+
+         results_pointer->stopping_criterion = "Maximum number of epochs";
+
+         stop_training = true;
+      }
+
+      else if(elapsed_time >= maximum_time)
+      {
+         if(display)
+         {
+            std::cout << "Epoch " << epoch << ": Maximum training time reached.\n";
+         }
+
+         results_pointer->stopping_criterion = "Maximum training time";
+
+         stop_training = true;
+      }
+
+      if(epoch != 0 && epoch % save_period == 0)
+      {
+            neural_network_pointer->save(neural_network_file_name);
+      }
+
+      if(stop_training)
+      {
+         if(display)
+         {
+            std::cout << "Parameters norm: " << parameters_norm << "\n"
+                      << "Performance: " << performance << "\n"
+                      << "Gradient norm: " << gradient_norm << "\n"
+                      << performance_functional_pointer->write_information()
+                      << "Elapsed time: " << elapsed_time << std::endl;
+
+            if(generalization_performance != 0)
+            {
+               std::cout << "Selection performance: " << generalization_performance << std::endl;
+            }
+         }
+
+         results_pointer->resize_training_history(1+epoch);
+
+         results_pointer->final_parameters = parameters;
+
+         results_pointer->final_parameters_norm = parameters_norm;
+
+         results_pointer->final_performance = performance;
+
+         results_pointer->final_generalization_performance = generalization_performance;
+
+         results_pointer->final_gradient_norm = gradient_norm;
+
+         results_pointer->elapsed_time = elapsed_time;
+
+         results_pointer->epochs_number = epoch;
+
+         break;
+      }
+      else if(display && epoch % display_period == 0)
+      {
+         std::cout << "Epoch " << epoch << ";\n"
+                   << "Parameters norm: " << parameters_norm << "\n"
+                   << "Performance: " << performance << "\n"
+                   << "Gradient norm: " << gradient_norm << "\n"
+                   << performance_functional_pointer->write_information()
+                   << "Elapsed time: " << elapsed_time << std::endl;
+
+         if(generalization_performance != 0)
+         {
+            std::cout << "Selection performance: " << generalization_performance << std::endl;
+         }
+      }
+
+      // Update stuff
+
+      old_performance = performance;
+      old_generalization_performance = generalization_performance;
+   }
+
+   return(results_pointer);
+}
+
+
+// std::string write_training_algorithm_type(void) const method
+
+std::string StochasticGradientDescent::write_training_algorithm_type(void) const
+{
+   return("STOCHASTIC_GRADIENT_DESCENT");
+}
+
+
+// Matrix<std::string> to_string_matrix(void) const method
+
+// the most representative
+
+Matrix<std::string> StochasticGradientDescent::to_string_matrix(void) const
+{
+   std::ostringstream buffer;
+
+   Vector<std::string> labels;
+   Vector<std::string> values;
+
+   // Update method
+
+   labels.push_back("Update method");
+
+   values.push_back(write_update_method());
+
+   // Batch size
+
+   labels.push_back("Batch size");
+
+   buffer.str("");
+   buffer << batch_size;
+
+   values.push_back(buffer.str());
+
+   // Learning rate
+
+   labels.push_back("Learning rate");
+
+   buffer.str("");
+   buffer << learning_rate;
+
+   values.push_back(buffer.str());
+
+   // Momentum
+
+   if(update_method == Momentum || update_method == Nesterov)
+   {
+      labels.push_back("Momentum");
+
+      buffer.str("");
+      buffer << momentum;
+
+      values.push_back(buffer.str());
+   }
+
+   // Minimum performance increase
+
+   labels.push_back("Minimum performance increase");
+
+   buffer.str("");
+   buffer << minimum_performance_increase;
+
+   values.push_back(buffer.str());
+
+   // Performance goal
+
+   labels.push_back("Performance goal");
+
+   buffer.str("");
+   buffer << performance_goal;
+
+   values.push_back(buffer.str());
+
+   // Maximum generalization failures
+
+   labels.push_back("Maximum generalization failures");
+
+   buffer.str("");
+   buffer << maximum_generalization_performance_decreases;
+
+   values.push_back(buffer.str());
+
+   // Maximum epochs number
+
+   labels.push_back("Maximum epochs number");
+
+   buffer.str("");
+   buffer << maximum_epochs_number;
+
+   values.push_back(buffer.str());
+
+   // Maximum time
+
+   labels.push_back("Maximum time");
+
+   buffer.str("");
+   buffer << maximum_time;
+
+   values.push_back(buffer.str());
+
+   // Reserve parameters history
+
+   labels.push_back("Reserve parameters history");
+
+   buffer.str("");
+   buffer << reserve_parameters_history;
+
+   values.push_back(buffer.str());
+
+   const size_t rows_number = labels.size();
+   const size_t columns_number = 2;
+
+   Matrix<std::string> string_matrix(rows_number, columns_number);
+
+   string_matrix.set_column(0, labels);
+   string_matrix.set_column(1, values);
+
+   return(string_matrix);
+}
+
+
+// tinyxml2::XMLDocument* to_XML(void) const method
+
+/// Serializes the training operators, the training parameters, the stopping criteria and other user stuff
+/// concerning the stochastic gradient descent object.
+
+tinyxml2::XMLDocument* StochasticGradientDescent::to_XML(void) const
+{
+   std::ostringstream buffer;
+
+   Vector<std::string> names;
+   Vector<std::string> values;
+
+   // Training operators
+
+   names.push_back("UpdateMethod");
+   values.push_back(write_update_method());
+
+   // Training parameters
+
+   names.push_back("BatchSize");
+   buffer.str(""); buffer << batch_size; values.push_back(buffer.str());
+
+   names.push_back("RandomSeed");
+   buffer.str(""); buffer << random_seed; values.push_back(buffer.str());
+
+   names.push_back("LearningRate");
+   buffer.str(""); buffer << learning_rate; values.push_back(buffer.str());
+
+   names.push_back("Momentum");
+   buffer.str(""); buffer << momentum; values.push_back(buffer.str());
+
+   names.push_back("Beta1");
+   buffer.str(""); buffer << beta_1; values.push_back(buffer.str());
+
+   names.push_back("Beta2");
+   buffer.str(""); buffer << beta_2; values.push_back(buffer.str());
+
+   names.push_back("Epsilon");
+   buffer.str(""); buffer << epsilon; values.push_back(buffer.str());
+
+   // Stopping criteria
+
+   names.push_back("MinimumPerformanceIncrease");
+   buffer.str(""); buffer << minimum_performance_increase; values.push_back(buffer.str());
+
+   names.push_back("PerformanceGoal");
+   buffer.str(""); buffer << performance_goal; values.push_back(buffer.str());
+
+   names.push_back("MaximumSelectionPerformanceDecreases");
+   buffer.str(""); buffer << maximum_generalization_performance_decreases; values.push_back(buffer.str());
+
+   names.push_back("MaximumEpochsNumber");
+   buffer.str(""); buffer << maximum_epochs_number; values.push_back(buffer.str());
+
+   names.push_back("MaximumTime");
+   buffer.str(""); buffer << maximum_time; values.push_back(buffer.str());
+
+   // Training history
+
+   names.push_back("ReserveParametersHistory");
+   buffer.str(""); buffer << reserve_parameters_history; values.push_back(buffer.str());
+
+   // Utilities
+
+   names.push_back("DisplayPeriod");
+   buffer.str(""); buffer << display_period; values.push_back(buffer.str());
+
+   names.push_back("SavePeriod");
+   buffer.str(""); buffer << save_period; values.push_back(buffer.str());
+
+   names.push_back("NeuralNetworkFileName");
+   values.push_back(neural_network_file_name);
+
+   names.push_back("Display");
+   buffer.str(""); buffer << display; values.push_back(buffer.str());
+
+   // Document
+
+   tinyxml2::XMLDocument* document = new tinyxml2::XMLDocument;
+
+   tinyxml2::XMLElement* root_element = document->NewElement("StochasticGradientDescent");
+
+   document->InsertFirstChild(root_element);
+
+   tinyxml2::XMLElement* element = NULL;
+   tinyxml2::XMLText* text = NULL;
+
+   for(size_t i = 0; i < names.size(); i++)
+   {
+      element = document->NewElement(names[i].c_str());
+      root_element->LinkEndChild(element);
+
+      text = document->NewText(values[i].c_str());
+      element->LinkEndChild(text);
+   }
+
+   return(document);
+}
+
+
+// void from_XML(const tinyxml2::XMLDocument&) method
+
+/// Loads a stochastic gradient descent object from a XML document.
+/// Elements which are not recognized are ignored, and invalid values are reported without stopping the load.
+/// @param document TinyXML document with the members of a stochastic gradient descent object.
+
+void StochasticGradientDescent::from_XML(const tinyxml2::XMLDocument& document)
+{
+   const tinyxml2::XMLElement* root_element = document.FirstChildElement("StochasticGradientDescent");
+
+   if(!root_element)
+   {
+       std::ostringstream buffer;
+
+       buffer << "OpenNN Exception: StochasticGradientDescent class.\n"
+              << "void from_XML(const tinyxml2::XMLDocument&) method.\n"
+              << "Stochastic gradient descent element is NULL.\n";
+
+       throw std::logic_error(buffer.str());
+   }
+
+   std::string name;
+   std::string text;
+
+   for(const tinyxml2::XMLElement* element = root_element->FirstChildElement(); element; element = element->NextSiblingElement())
+   {
+      name = element->Name();
+      text = element->GetText() ? element->GetText() : "";
+
+      try
+      {
+         if(name == "UpdateMethod")
+         {
+            set_update_method(text);
+         }
+         else if(name == "BatchSize")
+         {
+            set_batch_size(atoi(text.c_str()));
+         }
+         else if(name == "RandomSeed")
+         {
+            set_random_seed(atoi(text.c_str()));
+         }
+         else if(name == "LearningRate")
+         {
+            set_learning_rate(atof(text.c_str()));
+         }
+         else if(name == "Momentum")
+         {
+            set_momentum(atof(text.c_str()));
+         }
+         else if(name == "Beta1")
+         {
+            set_beta_1(atof(text.c_str()));
+         }
+         else if(name == "Beta2")
+         {
+            set_beta_2(atof(text.c_str()));
+         }
+         else if(name == "Epsilon")
+         {
+            set_epsilon(atof(text.c_str()));
+         }
+         else if(name == "MinimumPerformanceIncrease")
+         {
+            set_minimum_performance_increase(atof(text.c_str()));
+         }
+         else if(name == "PerformanceGoal")
+         {
+            set_performance_goal(atof(text.c_str()));
+         }
+         else if(name == "MaximumSelectionPerformanceDecreases")
+         {
+            set_maximum_generalization_performance_decreases(atoi(text.c_str()));
+         }
+         else if(name == "MaximumEpochsNumber")
+         {
+            set_maximum_epochs_number(atoi(text.c_str()));
+         }
+         else if(name == "MaximumTime")
+         {
+            set_maximum_time(atof(text.c_str()));
+         }
+         else if(name == "ReserveParametersHistory")
+         {
+            set_reserve_parameters_history(text != "0");
+         }
+         else if(name == "DisplayPeriod")
+         {
+            set_display_period(atoi(text.c_str()));
+         }
+         else if(name == "SavePeriod")
+         {
+            set_save_period(atoi(text.c_str()));
+         }
+         else if(name == "NeuralNetworkFileName")
+         {
+            set_neural_network_file_name(text);
+         }
+         else if(name == "Display")
+         {
+            set_display(text != "0");
+         }
+      }
+      catch(const std::logic_error& e)
+      {
+         std::cout << e.what() << std::endl;
+      }
+   }
+}
+
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (c) 2005-2015 Roberto Lopez.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
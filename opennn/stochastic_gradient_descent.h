@@ -0,0 +1,351 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.artelnics.com/opennn                                                                                   */
+/*                                                                                                              */
+/*   S T O C H A S T I C   G R A D I E N T   D E S C E N T   C L A S S   H E A D E R                            */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   Artelnics - Making intelligent use of data                                                                 */
+/*   robertolopez@artelnics.com                                                                                 */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __STOCHASTICGRADIENTDESCENT_H__
+#define __STOCHASTICGRADIENTDESCENT_H__
+
+// System includes
+
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <cmath>
+#include <ctime>
+#include <random>
+
+// OpenNN includes
+
+#include "performance_functional.h"
+
+#include "training_algorithm.h"
+
+
+namespace OpenNN
+{
+
+/// This concrete class represents the stochastic gradient descent training algorithm for
+/// a performance functional of a neural network.
+/// The parameters are updated once per mini-batch of shuffled training instances,
+/// with the momentum, Nesterov momentum or Adam update rules.
+
+class StochasticGradientDescent : public TrainingAlgorithm
+{
+
+public:
+
+   // ENUMERATIONS
+
+   /// Enumeration of the available rules for updating the parameters from the mini-batch gradient.
+
+   enum UpdateMethod{Momentum, Nesterov, Adam};
+
+
+   // DEFAULT CONSTRUCTOR
+
+   explicit StochasticGradientDescent(void);
+
+   // PERFORMANCE FUNCTIONAL CONSTRUCTOR
+
+   explicit StochasticGradientDescent(PerformanceFunctional*);
+
+   // XML CONSTRUCTOR
+
+   explicit StochasticGradientDescent(const tinyxml2::XMLDocument&);
+
+
+   // DESTRUCTOR
+
+   virtual ~StochasticGradientDescent(void);
+
+   // STRUCTURES
+
+   ///
+   /// This structure contains the training results for the stochastic gradient descent.
+   /// The training history has one entry per epoch, and the parameters history is only filled if it is reserved.
+   ///
+
+   struct StochasticGradientDescentResults : public TrainingAlgorithm::TrainingAlgorithmResults
+   {
+       /// Default constructor.
+
+       StochasticGradientDescentResults(void)
+       {
+           stochastic_gradient_descent_pointer = NULL;
+       }
+
+       /// Stochastic gradient descent constructor.
+
+       StochasticGradientDescentResults(StochasticGradientDescent* new_stochastic_gradient_descent_pointer)
+       {
+           stochastic_gradient_descent_pointer = new_stochastic_gradient_descent_pointer;
+       }
+
+       /// Destructor.
+
+       virtual ~StochasticGradientDescentResults(void)
+       {
+       }
+
+       /// Pointer to the stochastic gradient descent object for which the training results are to be stored.
+
+      StochasticGradientDescent* stochastic_gradient_descent_pointer;
+
+      // Training history
+
+      /// History of the neural network parameters over the training epochs.
+
+      Vector< Vector<double> > parameters_history;
+
+      /// History of the parameters norm over the training epochs.
+
+      Vector<double> parameters_norm_history;
+
+      /// History of the mean of the mini-batch performances over the training epochs.
+
+      Vector<double> performance_history;
+
+      /// History of the selection performance over the training epochs.
+
+      Vector<double> generalization_performance_history;
+
+      /// History of the norm of the mean mini-batch gradient over the training epochs.
+
+      Vector<double> gradient_norm_history;
+
+      /// History of the elapsed time over the training epochs.
+
+      Vector<double> elapsed_time_history;
+
+      // Final values
+
+      /// Final neural network parameters vector.
+
+      Vector<double> final_parameters;
+
+      /// Final neural network parameters norm.
+
+      double final_parameters_norm;
+
+      /// Final performance function evaluation.
+
+      double final_performance;
+
+      /// Final selection performance.
+
+      double final_generalization_performance;
+
+      /// Final norm of the mean mini-batch gradient.
+
+      double final_gradient_norm;
+
+      /// Elapsed time of the training process.
+
+      double elapsed_time;
+
+      /// Number of training epochs.
+
+      size_t epochs_number;
+
+      /// Stopping criterion
+
+      std::string stopping_criterion;
+
+      void resize_training_history(const size_t&);
+
+      std::string to_string(void) const;
+
+      Matrix<std::string> write_final_results(const size_t& precision = 3) const;
+   };
+
+   // METHODS
+
+   // Training operators
+
+   const UpdateMethod& get_update_method(void) const;
+   std::string write_update_method(void) const;
+
+   // Training parameters
+
+   const size_t& get_batch_size(void) const;
+   const size_t& get_random_seed(void) const;
+
+   const double& get_learning_rate(void) const;
+   const double& get_momentum(void) const;
+
+   const double& get_beta_1(void) const;
+   const double& get_beta_2(void) const;
+   const double& get_epsilon(void) const;
+
+   // Stopping criteria
+
+   const double& get_minimum_performance_increase(void) const;
+   const double& get_performance_goal(void) const;
+   const size_t& get_maximum_generalization_performance_decreases(void) const;
+
+   const size_t& get_maximum_epochs_number(void) const;
+   const double& get_maximum_time(void) const;
+
+   // Reserve training history
+
+   const bool& get_reserve_parameters_history(void) const;
+
+   // Set methods
+
+   void set_default(void);
+
+   // Training operators
+
+   void set_update_method(const UpdateMethod&);
+   void set_update_method(const std::string&);
+
+   // Training parameters
+
+   void set_batch_size(const size_t&);
+   void set_random_seed(const size_t&);
+
+   void set_learning_rate(const double&);
+   void set_momentum(const double&);
+
+   void set_beta_1(const double&);
+   void set_beta_2(const double&);
+   void set_epsilon(const double&);
+
+   // Stopping criteria
+
+   void set_minimum_performance_increase(const double&);
+   void set_performance_goal(const double&);
+   void set_maximum_generalization_performance_decreases(const size_t&);
+
+   void set_maximum_epochs_number(const size_t&);
+   void set_maximum_time(const double&);
+
+   // Reserve training history
+
+   void set_reserve_parameters_history(const bool&);
+
+   // Training methods
+
+   Vector< Vector<size_t> > arrange_mini_batches(const Vector<size_t>&) const;
+
+   PerformanceFunctional::FirstOrderperformance calculate_mini_batch_performance_and_gradient(const Vector<size_t>&, const double&) const;
+
+   Vector<double> calculate_momentum_parameters_increment(const Vector<double>&, Vector<double>&) const;
+   Vector<double> calculate_Nesterov_parameters_increment(const Vector<double>&, Vector<double>&) const;
+   Vector<double> calculate_Adam_parameters_increment(const Vector<double>&, Vector<double>&, Vector<double>&, const size_t&) const;
+
+   StochasticGradientDescentResults* perform_training(void);
+
+   std::string write_training_algorithm_type(void) const;
+
+   // Serialization methods
+
+   Matrix<std::string> to_string_matrix(void) const;
+
+   tinyxml2::XMLDocument* to_XML(void) const;
+   void from_XML(const tinyxml2::XMLDocument&);
+
+private:
+
+   // TRAINING OPERATORS
+
+   /// Rule used to update the parameters from each mini-batch gradient.
+
+   UpdateMethod update_method;
+
+   // TRAINING PARAMETERS
+
+   /// Number of training instances in each mini-batch.
+
+   size_t batch_size;
+
+   /// Seed of the generator which shuffles the training instances into mini-batches at each epoch.
+   /// Trainings with the same seed and the same initial parameters give the same results.
+
+   size_t random_seed;
+
+   /// Step size which multiplies the mini-batch gradient in the parameters update.
+
+   double learning_rate;
+
+   /// Fraction of the previous parameters increment which is added to the current one in the momentum and Nesterov updates.
+
+   double momentum;
+
+   /// Exponential decay rate for the first moment estimates of the Adam update.
+
+   double beta_1;
+
+   /// Exponential decay rate for the second moment estimates of the Adam update.
+
+   double beta_2;
+
+   /// Small value which prevents divisions by zero in the Adam update.
+
+   double epsilon;
+
+   // STOPPING CRITERIA
+
+   /// Minimum absolute performance change between two successive epochs. It is used as a stopping criterion.
+
+   double minimum_performance_increase;
+
+   /// Goal value for the performance. It is used as a stopping criterion.
+
+   double performance_goal;
+
+   /// Maximum number of epochs at which the selection performance increases.
+   /// This is an early stopping method for improving generalization.
+
+   size_t maximum_generalization_performance_decreases;
+
+   /// Maximum number of passes over the training instances. It is used as a stopping criterion.
+
+   size_t maximum_epochs_number;
+
+   /// Maximum training time. It is used as a stopping criterion.
+
+   double maximum_time;
+
+   // TRAINING HISTORY
+
+   /// True if the parameters history matrix is to be reserved, false otherwise.
+   /// The other histories hold a single number per epoch, and they are always reserved.
+
+   bool reserve_parameters_history;
+};
+
+}
+
+#endif
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (c) 2005-2015 Roberto Lopez.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
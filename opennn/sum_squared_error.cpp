@@ -194,68 +194,15 @@ double SumSquaredError::calculate_performance(void) const
 
    #endif
 
-   // Neural network stuff
-
-   const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
-
-   const size_t inputs_number = multilayer_perceptron_pointer->get_inputs_number();
-   const size_t outputs_number = multilayer_perceptron_pointer->get_outputs_number();
-
    // Data set stuff
 
    const Instances& instances = data_set_pointer->get_instances();
 
-   const size_t training_instances_number = instances.count_training_instances_number();
-
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
-   const MissingValues& missing_values = data_set_pointer->get_missing_values();
-
-   // Sum squared error stuff
-
-   Vector<double> inputs(inputs_number);
-   Vector<double> outputs(outputs_number);
-   Vector<double> targets(outputs_number);
-
-   int i = 0;
-   double sum_squared_error = 0.0;
-
-   #pragma omp parallel for private(i, training_index, inputs, outputs, targets) reduction(+ : sum_squared_error)
-
-   for(i = 0; i < (int)training_instances_number; i++)
-   {
-       training_index = training_indices[i];
-
-       if(missing_values.has_missing_values(training_index))
-       {
-           continue;
-       }
-
-      // Input vector
+   const Vector<size_t>& training_indices = instances.arrange_training_indices();
 
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
-
-      // Target vector
-
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
-
-      // Output vector
-
-      outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
-
-      // Sum squared error
-
-      sum_squared_error += outputs.calculate_sum_squared_error(targets);
-   }
+   // Sum squared error
 
-   return(sum_squared_error);
+   return(calculate_error_sum(training_indices));
 }
 
 
@@ -305,20 +252,7 @@ double SumSquaredError::calculate_performance(const Vector<double>& parameters)
 
    // Data set stuff
 
-   const Instances& instances = data_set_pointer->get_instances();
-
-   const size_t training_instances_number = instances.count_training_instances_number();
-
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
-   const MissingValues& missing_values = data_set_pointer->get_missing_values();
+   const size_t training_instances_number = data_set_pointer->count_training_rows_number();
 
    // Sum squared error stuff
 
@@ -330,29 +264,18 @@ double SumSquaredError::calculate_performance(const Vector<double>& parameters)
 
    double sum_squared_error = 0.0;
 
-   #pragma omp parallel for private(i, training_index, inputs, outputs, targets) reduction(+ : sum_squared_error)
+   #pragma omp parallel for private(i, inputs, outputs, targets) reduction(+ : sum_squared_error)
 
    for(i = 0; i < (int)training_instances_number; i++)
    {
-       training_index = training_indices[i];
+      // Input and target vectors
 
-       if(missing_values.has_missing_values(training_index))
-       {
-           continue;
-       }
-
-      // Input vector
-
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+      data_set_pointer->arrange_training_row(i, inputs, targets);
 
       // Output vector
 
       outputs = multilayer_perceptron_pointer->calculate_outputs(inputs, parameters);
 
-      // Target vector
-
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
-
       // Sum squared error
 
       sum_squared_error += outputs.calculate_sum_squared_error(targets);
@@ -368,7 +291,7 @@ double SumSquaredError::calculate_performance_combinations(const size_t& index,
 {
     const Variables& variables = data_set_pointer->get_variables();
 
-    const Vector<size_t> targets_indices = variables.arrange_targets_indices();
+    const Vector<size_t>& targets_indices = variables.arrange_targets_indices();
 
     const Vector<double> targets = data_set_pointer->get_instance(0, targets_indices);
 
@@ -386,7 +309,7 @@ double SumSquaredError::calculate_performance_combinations(const size_t& index_1
 
     const size_t layers_number = neural_network_pointer->get_multilayer_perceptron_pointer()->get_layers_number();
 
-    const Vector<size_t> targets_indices = variables.arrange_targets_indices();
+    const Vector<size_t>& targets_indices = variables.arrange_targets_indices();
 
     const Vector<double> targets = data_set_pointer->get_instance(0, targets_indices);
 
@@ -416,78 +339,110 @@ double SumSquaredError::calculate_generalization_performance(void) const
 
    #endif
 
-   // Neural network stuff
+   // Data set stuff
 
-   const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
+   const Instances& instances = data_set_pointer->get_instances();
 
-   const size_t inputs_number = multilayer_perceptron_pointer->get_inputs_number();
-   const size_t outputs_number = multilayer_perceptron_pointer->get_outputs_number();
+   const Vector<size_t>& generalization_indices = instances.arrange_generalization_indices();
 
-   // Data set stuff
+   // Sum squared error
 
-   const Instances& instances = data_set_pointer->get_instances();
-   const size_t generalization_instances_number = instances.count_generalization_instances_number();
+   return(calculate_error_sum(generalization_indices));
+}
 
-   const Vector<size_t> generalization_indices = instances.arrange_generalization_indices();
 
-   size_t generalization_index;
+// Vector<double> calculate_output_gradient(const Vector<double>&, const Vector<double>&) const method
 
-   const Variables& variables = data_set_pointer->get_variables();
+Vector<double> SumSquaredError::calculate_output_gradient(const Vector<double>& output, const Vector<double>& target) const
+{
+    const Vector<double> output_gradient = (output.lazy() - target.lazy())*2.0;
 
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
+    return(output_gradient);
+}
 
-   const MissingValues& missing_values = data_set_pointer->get_missing_values();
 
-   // Sum squared error stuff
+// double calculate_batch_error(const Matrix<double>&, const Matrix<double>&) const method
 
-   Vector<double> inputs(inputs_number);
-   Vector<double> outputs(outputs_number);
-   Vector<double> targets(outputs_number);
+/// Returns the sum squared error of a batch of instances.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
 
-   double generalization_performance = 0.0;
+double SumSquaredError::calculate_batch_error(const Matrix<double>& outputs, const Matrix<double>& targets) const
+{
+   return(outputs.calculate_sum_squared_error(targets));
+}
 
-   int i = 0;
 
-   #pragma omp parallel for private(i, generalization_index, inputs, outputs, targets) reduction(+ : generalization_performance)
+// Matrix<double> calculate_batch_output_gradient(const Matrix<double>&, const Matrix<double>&) const method
 
-   for(i = 0; i < (int)generalization_instances_number; i++)
-   {
-       generalization_index = generalization_indices[i];
+/// Returns the derivatives of the squared error of each instance in a batch with respect to its outputs.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
 
-       if(missing_values.has_missing_values(generalization_index))
-       {
-           continue;
-       }
+Matrix<double> SumSquaredError::calculate_batch_output_gradient(const Matrix<double>& outputs, const Matrix<double>& targets) const
+{
+   return((outputs.lazy() - targets.lazy())*2.0);
+}
 
-      // Input vector
 
-      inputs = data_set_pointer->get_instance(generalization_index, inputs_indices);
+// Matrix<double> calculate_batch_terms_output_gradient(const Matrix<double>&, const Matrix<double>&) const method
 
-      // Output vector
+/// Returns the derivatives of the error term of each instance in a batch, which is the norm of its errors, with respect to its outputs.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
 
-      outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
+Matrix<double> SumSquaredError::calculate_batch_terms_output_gradient(const Matrix<double>& outputs, const Matrix<double>& targets) const
+{
+   const size_t instances_number = outputs.get_rows_number();
+   const size_t outputs_number = outputs.get_columns_number();
 
-      // Target vector
+   Matrix<double> terms_output_gradient = outputs-targets;
+
+   double term_norm;
 
-      targets = data_set_pointer->get_instance(generalization_index, targets_indices);
+   for(size_t i = 0; i < instances_number; i++)
+   {
+      term_norm = 0.0;
+
+      for(size_t j = 0; j < outputs_number; j++)
+      {
+         term_norm += terms_output_gradient(i,j)*terms_output_gradient(i,j);
+      }
 
-      // Sum of squares error
+      term_norm = sqrt(term_norm);
 
-      generalization_performance += outputs.calculate_sum_squared_error(targets);
+      for(size_t j = 0; j < outputs_number; j++)
+      {
+         terms_output_gradient(i,j) = (term_norm == 0.0) ? 0.0 : terms_output_gradient(i,j)/term_norm;
+      }
    }
 
-   return(generalization_performance);
+   return(terms_output_gradient);
 }
 
 
-// Vector<double> calculate_output_gradient(const Vector<double>&, const Vector<double>&) const method
+// Vector<double> calculate_batch_terms(const Matrix<double>&, const Matrix<double>&) const method
 
-Vector<double> SumSquaredError::calculate_output_gradient(const Vector<double>& output, const Vector<double>& target) const
+/// Returns the norm of the errors of each instance in a batch.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
+
+Vector<double> SumSquaredError::calculate_batch_terms(const Matrix<double>& outputs, const Matrix<double>& targets) const
 {
-    const Vector<double> output_gradient = (output-target)*2.0;
+   return((outputs-targets).calculate_rows_norm());
+}
 
-    return(output_gradient);
+
+// Matrix<double> calculate_batch_output_Hessian_dot(const Matrix<double>&, const Matrix<double>&, const Matrix<double>&) const method
+
+/// Returns the product of the Hessian of the squared error of each instance in a batch with respect to its outputs 
+/// with a direction in the outputs space. 
+/// That Hessian is twice the identity, so the targets are not needed.
+/// @param outputs_direction Direction of each instance in the outputs space, with one instance per row.
+
+Matrix<double> SumSquaredError::calculate_batch_output_Hessian_dot(const Matrix<double>&, const Matrix<double>&, const Matrix<double>& outputs_direction) const
+{
+   return(outputs_direction*2.0);
 }
 
 
@@ -495,6 +450,7 @@ Vector<double> SumSquaredError::calculate_output_gradient(const Vector<double>&
 
 /// Calculates the performance term gradient by means of the back-propagation algorithm, 
 /// and returns it in a single vector of size the number of neural network parameters. 
+/// The training instances are propagated in batches, which are reduced in parallel by calculate_error_gradient_sum().
 
 Vector<double> SumSquaredError::calculate_gradient(void) const
 {
@@ -504,111 +460,75 @@ Vector<double> SumSquaredError::calculate_gradient(void) const
 
    #endif
 
-   // Neural network stuff
-
-   const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
-
-   // Neural network stuff
-
-   const bool has_conditions_layer = neural_network_pointer->has_conditions_layer();
-
-   const ConditionsLayer* conditions_layer_pointer = has_conditions_layer ? neural_network_pointer->get_conditions_layer_pointer() : NULL;
-
-   const size_t inputs_number = multilayer_perceptron_pointer->get_inputs_number();
-   const size_t outputs_number = multilayer_perceptron_pointer->get_outputs_number();
-
-   const size_t layers_number = multilayer_perceptron_pointer->get_layers_number();
-
-   const size_t neural_parameters_number = multilayer_perceptron_pointer->count_parameters_number();
-
-   Vector< Vector< Vector<double> > > first_order_forward_propagation(2); 
-
-   Vector<double> particular_solution;
-   Vector<double> homogeneous_solution;
-
    // Data set stuff
 
    const Instances& instances = data_set_pointer->get_instances();
 
-   const size_t training_instances_number = instances.count_training_instances_number();
+   const Vector<size_t>& training_indices = instances.arrange_training_indices();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
+   // Sum squared error stuff
 
-   size_t training_index;
+   return(calculate_error_gradient_sum(training_indices));
+}
 
-   const Variables& variables = data_set_pointer->get_variables();
 
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
+// FirstOrderPerformance calculate_performance_and_gradient(void) const method
 
-   Vector<double> inputs(inputs_number);
-   Vector<double> targets(outputs_number);
+/// Returns the sum squared error and its gradient, computed from a single forward propagation of the training instances.
 
-   const MissingValues& missing_values = data_set_pointer->get_missing_values();
-
-   // Sum squared error stuff
+PerformanceTerm::FirstOrderPerformance SumSquaredError::calculate_performance_and_gradient(void) const
+{
+   #ifdef __OPENNN_DEBUG__
 
-   Vector<double> output_gradient(outputs_number);
+   check();
 
-   Vector< Matrix<double> > layers_combination_parameters_Jacobian; 
+   #endif
 
-   Vector< Vector<double> > layers_inputs(layers_number); 
-   Vector< Vector<double> > layers_delta; 
+   // Data set stuff
 
-   Vector<double> point_gradient(neural_parameters_number, 0.0);
+   const Instances& instances = data_set_pointer->get_instances();
 
-   Vector<double> gradient(neural_parameters_number, 0.0);
+   const Vector<size_t>& training_indices = instances.arrange_training_indices();
 
-   int i;
+   // Sum squared error stuff
 
-   #pragma omp parallel for private(i, training_index, inputs, targets, first_order_forward_propagation, layers_inputs, layers_combination_parameters_Jacobian,\
-    output_gradient, layers_delta, particular_solution, homogeneous_solution, point_gradient)
+   return(calculate_error_sum_and_gradient_sum(training_indices));
+}
 
-   for(i = 0; i < (int)training_instances_number; i++)
-   {
-       training_index = training_indices[i];
 
-       if(missing_values.has_missing_values(training_index))
-       {
-           continue;
-       }
+// Vector<double> calculate_vector_dot_Hessian(const Vector<double>&) const method
 
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+/// Returns the product of the sum squared error Hessian with a vector, without forming the Hessian matrix.
+/// It uses the R-operator on the training instances, whose cost is about that of two gradient evaluations.
+/// @param vector Vector in the dot product, with size the number of parameters. 
 
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
+Vector<double> SumSquaredError::calculate_vector_dot_Hessian(const Vector<double>& vector) const
+{
+   #ifdef __OPENNN_DEBUG__
 
-      first_order_forward_propagation = multilayer_perceptron_pointer->calculate_first_order_forward_propagation(inputs);
+   check();
 
-      const Vector< Vector<double> >& layers_activation = first_order_forward_propagation[0];
-      const Vector< Vector<double> >& layers_activation_derivative = first_order_forward_propagation[1];
+   #endif
 
-      layers_inputs = multilayer_perceptron_pointer->arrange_layers_input(inputs, layers_activation);
+   // Data set stuff
 
-      layers_combination_parameters_Jacobian = multilayer_perceptron_pointer->calculate_layers_combination_parameters_Jacobian(layers_inputs);
+   const Instances& instances = data_set_pointer->get_instances();
 
-      if(!has_conditions_layer)
-      {
-          output_gradient = calculate_output_gradient(layers_activation[layers_number-1], targets);
+   const Vector<size_t>& training_indices = instances.arrange_training_indices();
 
-          layers_delta = calculate_layers_delta(layers_activation_derivative, output_gradient);
-      }
-      else
-      {
-         particular_solution = conditions_layer_pointer->calculate_particular_solution(inputs);
-         homogeneous_solution = conditions_layer_pointer->calculate_homogeneous_solution(inputs);
+   // Sum squared error stuff
 
-         output_gradient = (particular_solution+homogeneous_solution*layers_activation[layers_number-1] - targets)*2.0;
+   return(calculate_error_vector_dot_Hessian_sum(training_indices, vector));
+}
 
-         layers_delta = calculate_layers_delta(layers_activation_derivative, homogeneous_solution, output_gradient);
-      }
 
-      point_gradient = calculate_point_gradient(layers_combination_parameters_Jacobian, layers_delta);
+// double calculate_error_normalization_coefficient(void) const method
 
-      #pragma omp critical
-      gradient += point_gradient;
-   }
+/// Returns the coefficient which divides the sum of the training errors to give the sum squared error, which is one.
 
-   return(gradient);
+double SumSquaredError::calculate_error_normalization_coefficient(void) const
+{
+   return(1.0);
 }
 
 
@@ -665,20 +585,7 @@ Matrix<double> SumSquaredError::calculate_Hessian(void) const
 
    // Data set stuff
 
-   const Instances& instances = data_set_pointer->get_instances();
-
-   const size_t training_instances_number = instances.count_training_instances_number();
-
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const MissingValues& missing_values = data_set_pointer->get_missing_values();
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
+   const size_t training_instances_number = data_set_pointer->count_training_rows_number();
 
    Vector<double> inputs(inputs_number);
    Vector<double> targets(outputs_number);
@@ -695,16 +602,7 @@ Matrix<double> SumSquaredError::calculate_Hessian(void) const
 
    for(size_t i = 0; i < training_instances_number; i++)
    {
-       training_index = training_indices[i];
-
-       if(missing_values.has_missing_values(training_index))
-       {
-           continue;
-       }
-
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
-
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
+      data_set_pointer->arrange_training_row(i, inputs, targets);
 
       second_order_forward_propagation = multilayer_perceptron_pointer->calculate_second_order_forward_propagation(inputs);
 	  
@@ -739,7 +637,7 @@ Matrix<double> SumSquaredError::calculate_Hessian(void) const
          particular_solution = conditions_layer_pointer->calculate_particular_solution(inputs);
          homogeneous_solution = conditions_layer_pointer->calculate_homogeneous_solution(inputs);
 
-         output_gradient = (particular_solution+homogeneous_solution*layers_activation[layers_number-1] - targets)*2.0;
+         output_gradient = (particular_solution.lazy() + homogeneous_solution.lazy()*layers_activation[layers_number-1].lazy() - targets.lazy())*2.0;
 
          layers_delta = calculate_layers_delta(layers_activation_derivative, homogeneous_solution, output_gradient);
       }
@@ -790,7 +688,7 @@ Matrix<double> SumSquaredError::calculate_single_hidden_layer_Hessian(void) cons
 
     const size_t training_instances_number = instances.count_training_instances_number();
 
-    const Vector<size_t> training_indices = instances.arrange_training_indices();
+    const Vector<size_t>& training_indices = instances.arrange_training_indices();
 
     size_t training_index;
 
@@ -798,8 +696,8 @@ Matrix<double> SumSquaredError::calculate_single_hidden_layer_Hessian(void) cons
 
     const Variables& variables = data_set_pointer->get_variables();
 
-    const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-    const Vector<size_t> targets_indices = variables.arrange_targets_indices();
+    const Vector<size_t>& inputs_indices = variables.arrange_inputs_indices();
+    const Vector<size_t>& targets_indices = variables.arrange_targets_indices();
 
     Vector<double> inputs(inputs_number);
     Vector<double> targets(outputs_number);
@@ -850,8 +748,8 @@ Matrix<double> SumSquaredError::calculate_single_hidden_layer_Hessian(void) cons
 
        layers_delta = calculate_layers_delta(layers_activation_derivative, output_gradient);
 
-       const size_t first_layer_perceptrons_number = multilayer_perceptron_pointer->get_layer(0).get_perceptrons().size();
-       const size_t second_layer_perceptrons_number = multilayer_perceptron_pointer->get_layer(1).get_perceptrons().size();
+       const size_t first_layer_perceptrons_number = multilayer_perceptron_pointer->get_layer(0).get_perceptrons_number();
+       const size_t second_layer_perceptrons_number = multilayer_perceptron_pointer->get_layer(1).get_perceptrons_number();
        const size_t first_layer_parameters_number = multilayer_perceptron_pointer->get_layer(0).arrange_parameters().size();
        const size_t second_layer_parameters_number = multilayer_perceptron_pointer->get_layer(1).arrange_parameters().size();
        // Inputs number
@@ -1083,14 +981,14 @@ Vector<double> SumSquaredError::calculate_terms(void) const
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
+   const Vector<size_t>& training_indices = instances.arrange_training_indices();
 
    size_t training_index;
 
    const Variables& variables = data_set_pointer->get_variables();
 
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
+   const Vector<size_t>& inputs_indices = variables.arrange_inputs_indices();
+   const Vector<size_t>& targets_indices = variables.arrange_targets_indices();
 
    const MissingValues& missing_values = data_set_pointer->get_missing_values();
 
@@ -1197,149 +1095,57 @@ Matrix<double> SumSquaredError::calculate_terms_Jacobian(void) const
 
    #endif 
 
-   const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
-
-   const size_t inputs_number = multilayer_perceptron_pointer->get_inputs_number();
-   const size_t outputs_number = multilayer_perceptron_pointer->get_outputs_number();
-   const size_t layers_number = multilayer_perceptron_pointer->get_layers_number();
-
-   const size_t neural_parameters_number = multilayer_perceptron_pointer->count_parameters_number();
-
-   Vector< Vector< Vector<double> > > first_order_forward_propagation(2);
-
-   Vector< Vector<double> > layers_inputs(layers_number);
-   Vector< Matrix<double> > layers_combination_parameters_Jacobian(layers_number);
-
-   Vector<double> particular_solution;
-   Vector<double> homogeneous_solution;
-
-   const bool has_conditions_layer = neural_network_pointer->has_conditions_layer();
-
-   const ConditionsLayer* conditions_layer_pointer = has_conditions_layer ? neural_network_pointer->get_conditions_layer_pointer() : NULL;
-
-   // Data set
+   // Data set stuff
 
    const Instances& instances = data_set_pointer->get_instances();
 
-   const size_t training_instances_number = instances.count_training_instances_number();
-
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
-   const MissingValues missing_values = data_set_pointer->get_missing_values();
-
-   Vector<double> inputs(inputs_number);
-   Vector<double> targets(outputs_number);
-
-   // Performance functional
-
-   Vector<double> term(outputs_number);
-   double term_norm;
-
-   Vector<double> output_gradient(outputs_number);
-
-   Vector< Vector<double> > layers_delta(layers_number);
-   Vector<double> point_gradient(neural_parameters_number);
-
-   Matrix<double> terms_Jacobian(training_instances_number, neural_parameters_number);
-
-   // Main loop
-
-   int i = 0;
-
-   #pragma omp parallel for private(i, training_index, inputs, targets, first_order_forward_propagation, layers_inputs, \
-    layers_combination_parameters_Jacobian, term, term_norm, output_gradient, layers_delta, particular_solution, homogeneous_solution, point_gradient)
-
-   for(i = 0; i < (int)training_instances_number; i++)
-   {
-       training_index = training_indices[i];
-
-       if(missing_values.has_missing_values(training_index))
-       {
-           continue;
-       }
-
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
-
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
-
-      first_order_forward_propagation = multilayer_perceptron_pointer->calculate_first_order_forward_propagation(inputs);
-
-      layers_inputs = multilayer_perceptron_pointer->arrange_layers_input(inputs, first_order_forward_propagation);
+   const Vector<size_t>& training_indices = instances.arrange_training_indices();
 
-      //      const Vector< Vector<double> >& layers_activation_derivative = first_order_forward_propagation[1];
+   // Sum squared error stuff
 
-      layers_combination_parameters_Jacobian = multilayer_perceptron_pointer->calculate_layers_combination_parameters_Jacobian(layers_inputs);
+   return(calculate_error_terms_Jacobian(training_indices));
+}
 
-      if(!has_conditions_layer)
-      {
-         //const Vector<double>& outputs = first_order_forward_propagation[0][layers_number-1];
 
-         term = first_order_forward_propagation[0][layers_number-1] - targets;
-         term_norm = term.calculate_norm();
+// FirstOrderTerms calculate_first_order_terms(void) const method
 
-         if(term_norm == 0.0)
-   	     {
-             output_gradient.set(outputs_number, 0.0);
-	     }
-         else
-	     {
-            output_gradient = term/term_norm;
-	     }
+/// Returns the first order performance of the terms performance function.
+/// This is a structure containing the performance terms vector and the performance terms Jacobian.
 
-         layers_delta = calculate_layers_delta(first_order_forward_propagation[1], output_gradient);
-      }
-      else
-      {
+PerformanceTerm::FirstOrderTerms SumSquaredError::calculate_first_order_terms(void) const
+{
+   FirstOrderTerms first_order_terms;
 
-         particular_solution = conditions_layer_pointer->calculate_particular_solution(inputs);
-         homogeneous_solution = conditions_layer_pointer->calculate_homogeneous_solution(inputs);
+   first_order_terms.terms = calculate_terms();
+   first_order_terms.Jacobian = calculate_terms_Jacobian();
 
-         //const Vector<double>& output_layer_activation = first_order_forward_propagation[0][layers_number-1];
+   return(first_order_terms);
+}
 
-         term = (particular_solution+homogeneous_solution*first_order_forward_propagation[0][layers_number-1] - targets);
-         term_norm = term.calculate_norm();
 
-         if(term_norm == 0.0)
-   	     {
-             output_gradient.set(outputs_number, 0.0);
-         }
-	     else
-	     {
-            output_gradient = term/term_norm;
-	     }
+// SecondOrderTerms calculate_second_order_terms(void) const method
 
-         layers_delta = calculate_layers_delta(first_order_forward_propagation[1], homogeneous_solution, output_gradient);
-      }
+/// Returns the sum squared error of the training instances, together with the products of the transposed terms Jacobian 
+/// with the terms and with itself. 
+/// The products are accumulated by batches of instances, so the terms Jacobian is never built.
 
-      point_gradient = calculate_point_gradient(layers_combination_parameters_Jacobian, layers_delta);
-
-      terms_Jacobian.set_row(i, point_gradient);
-  }
+PerformanceTerm::SecondOrderTerms SumSquaredError::calculate_second_order_terms(void) const
+{
+   #ifdef __OPENNN_DEBUG__
 
-   return(terms_Jacobian);
-}
+   check();
 
+   #endif 
 
-// FirstOrderTerms calculate_first_order_terms(void) const method
+   // Data set stuff
 
-/// Returns the first order performance of the terms performance function.
-/// This is a structure containing the performance terms vector and the performance terms Jacobian.
+   const Instances& instances = data_set_pointer->get_instances();
 
-PerformanceTerm::FirstOrderTerms SumSquaredError::calculate_first_order_terms(void) const
-{
-   FirstOrderTerms first_order_terms;
+   const Vector<size_t>& training_indices = instances.arrange_training_indices();
 
-   first_order_terms.terms = calculate_terms();
-   first_order_terms.Jacobian = calculate_terms_Jacobian();
+   // Sum squared error stuff
 
-   return(first_order_terms);
+   return(calculate_error_second_order_terms(training_indices));
 }
 
 
@@ -1370,14 +1176,14 @@ Vector<double> SumSquaredError::calculate_squared_errors(void) const
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
+   const Vector<size_t>& training_indices = instances.arrange_training_indices();
 
    size_t training_index;
 
    const Variables& variables = data_set_pointer->get_variables();
 
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
+   const Vector<size_t>& inputs_indices = variables.arrange_inputs_indices();
+   const Vector<size_t>& targets_indices = variables.arrange_targets_indices();
 
    const MissingValues missing_values = data_set_pointer->get_missing_values();
 
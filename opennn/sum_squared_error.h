@@ -92,6 +92,12 @@ public:
 
    Vector<double> calculate_gradient(void) const;
 
+   FirstOrderPerformance calculate_performance_and_gradient(void) const;
+
+   Vector<double> calculate_vector_dot_Hessian(const Vector<double>&) const;
+
+   double calculate_error_normalization_coefficient(void) const;
+
    Matrix<double> calculate_Hessian(void) const;
 
    Matrix<double> calculate_single_hidden_layer_Hessian(void) const;
@@ -107,6 +113,14 @@ public:
 
    Matrix<double> calculate_Hessian(const Vector<double>&) const;
 
+   // Batch kernel methods
+
+   double calculate_batch_error(const Matrix<double>&, const Matrix<double>&) const;
+   Matrix<double> calculate_batch_output_gradient(const Matrix<double>&, const Matrix<double>&) const;
+   Matrix<double> calculate_batch_terms_output_gradient(const Matrix<double>&, const Matrix<double>&) const;
+   Vector<double> calculate_batch_terms(const Matrix<double>&, const Matrix<double>&) const;
+   Matrix<double> calculate_batch_output_Hessian_dot(const Matrix<double>&, const Matrix<double>&, const Matrix<double>&) const;
+
    // Objective terms methods
 
    Vector<double> calculate_terms(void) const;
@@ -116,6 +130,8 @@ public:
 
    PerformanceTerm::FirstOrderTerms calculate_first_order_terms(void) const;
 
+   PerformanceTerm::SecondOrderTerms calculate_second_order_terms(void) const;
+
    // Squared errors methods
 
    Vector<double> calculate_squared_errors(void) const;
@@ -357,6 +357,106 @@ void TestingAnalysis::check(void) const
 }
 
 
+// void calculate_testing_target_output_data(Matrix<double>&, Matrix<double>&) const method
+
+/// Computes the targets and the neural network outputs of the testing instances in the data set.
+/// Each row of the matrices corresponds to a testing instance. 
+/// If the data set is backed by a binary data file, the testing instances are processed block by block. 
+/// The next block is prefetched while the current one is evaluated, and blocks left behind are released, 
+/// so that only a window of blocks stays resident.
+/// @param target_data Matrix where the testing target data is written.
+/// @param output_data Matrix where the neural network outputs for the testing instances are written.
+
+void TestingAnalysis::calculate_testing_target_output_data(Matrix<double>& target_data, Matrix<double>& output_data) const
+{
+   const DataBlocks* data_blocks_pointer = data_set_pointer->get_data_blocks_pointer();
+
+   if(data_blocks_pointer == NULL)
+   {
+      target_data = data_set_pointer->arrange_testing_target_data();
+
+      output_data = neural_network_pointer->calculate_output_data(data_set_pointer->arrange_testing_input_data());
+
+      return;
+   }
+
+   // Data set stuff
+
+   const Instances& instances = data_set_pointer->get_instances();
+
+   const Vector<size_t> testing_indices = instances.arrange_testing_indices();
+
+   const size_t testing_instances_number = testing_indices.size();
+
+   const Variables& variables = data_set_pointer->get_variables();
+
+   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
+   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
+
+   const size_t targets_number = targets_indices.size();
+
+   // Neural network stuff
+
+   const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
+
+   const size_t outputs_number = multilayer_perceptron_pointer->get_outputs_number();
+
+   target_data.set(testing_instances_number, targets_number);
+   output_data.set(testing_instances_number, outputs_number);
+
+   Vector<size_t> group_indices;
+
+   Matrix<double> group_targets;
+   Matrix<double> group_outputs;
+
+   size_t group_begin = 0;
+
+   while(group_begin < testing_instances_number)
+   {
+      // Testing instances in the same block
+
+      const size_t block_index = data_blocks_pointer->get_block_index(testing_indices[group_begin]);
+
+      size_t group_end = group_begin + 1;
+
+      while(group_end < testing_instances_number
+         && data_blocks_pointer->get_block_index(testing_indices[group_end]) == block_index)
+      {
+         group_end++;
+      }
+
+      // The next block is read in the background while this one is processed
+
+      if(group_end < testing_instances_number)
+      {
+         data_blocks_pointer->prefetch_block(data_blocks_pointer->get_block_index(testing_indices[group_end]));
+      }
+
+      group_indices = testing_indices.take_out(group_begin, group_end - group_begin);
+
+      group_targets = data_set_pointer->arrange_data_submatrix(group_indices, targets_indices);
+      group_outputs = neural_network_pointer->calculate_output_data(data_set_pointer->arrange_data_submatrix(group_indices, inputs_indices));
+
+      for(size_t i = group_begin; i < group_end; i++)
+      {
+         for(size_t j = 0; j < targets_number; j++)
+         {
+            target_data(i,j) = group_targets(i-group_begin,j);
+         }
+
+         for(size_t j = 0; j < outputs_number; j++)
+         {
+            output_data(i,j) = group_outputs(i-group_begin,j);
+         }
+      }
+
+      data_blocks_pointer->release_block(block_index);
+
+      group_begin = group_end;
+   }
+}
+
+
 // Vector< Matrix<double> > calculate_target_output_data(void) const method
 
 /// Returns a vector of matrices with number of rows equal to number of testing instances and
@@ -378,9 +478,10 @@ Vector< Matrix<double> > TestingAnalysis::calculate_target_output_data(void) con
 
    const size_t testing_instances_number = instances.count_testing_instances_number();
 
-   const Matrix<double> testing_input_data = data_set_pointer->arrange_testing_input_data();
+   Matrix<double> target_data;
+   Matrix<double> output_data;
 
-   const Matrix<double> target_data = data_set_pointer->arrange_testing_target_data();
+   calculate_testing_target_output_data(target_data, output_data);
 
    // Neural network stuff
 
@@ -388,8 +489,6 @@ Vector< Matrix<double> > TestingAnalysis::calculate_target_output_data(void) con
 
    const size_t outputs_number = multilayer_perceptron_pointer->get_outputs_number();
 
-   const Matrix<double> output_data = neural_network_pointer->calculate_output_data(testing_input_data);
-
    // Function regression testing stuff
 
    Vector< Matrix<double> > target_output_data(outputs_number);
@@ -455,9 +554,10 @@ Vector< LinearRegressionParameters<double> > TestingAnalysis::calculate_linear_r
 
    // Calculate regression parameters
 
-   const Matrix<double> input_data = data_set_pointer->arrange_testing_input_data();
-   const Matrix<double> target_data = data_set_pointer->arrange_testing_target_data();
-   const Matrix<double> output_data = neural_network_pointer->calculate_output_data(input_data);
+   Matrix<double> target_data;
+   Matrix<double> output_data;
+
+   calculate_testing_target_output_data(target_data, output_data);
 
    Vector<double> target_variable(testing_instances_number);
    Vector<double> output_variable(testing_instances_number);
@@ -466,8 +566,8 @@ Vector< LinearRegressionParameters<double> > TestingAnalysis::calculate_linear_r
 
    for(size_t i = 0; i < outputs_number; i++)
    {
-       target_variable = target_data.arrange_column(i);
-       output_variable = output_data.arrange_column(i);
+       target_variable = target_data.view_column(i);
+       output_variable = output_data.view_column(i);
 
        linear_regression_parameters[i] = output_variable.calculate_linear_regression_parameters(target_variable);
    }
@@ -570,13 +670,10 @@ Vector< Matrix<double> > TestingAnalysis::calculate_error_data(void) const
     #endif
 
 
-   const Matrix<double> input_data = data_set_pointer->arrange_testing_input_data();
+   Matrix<double> target_data;
+   Matrix<double> output_data;
 
-   const Matrix<double> target_data = data_set_pointer->arrange_testing_target_data();
-
-   // Neural network stuff
-
-   const Matrix<double> output_data = neural_network_pointer->calculate_output_data(input_data);
+   calculate_testing_target_output_data(target_data, output_data);
 
    const UnscalingLayer* unscaling_layer_pointer = neural_network_pointer->get_unscaling_layer_pointer();
 
@@ -611,8 +708,8 @@ Vector< Matrix<double> > TestingAnalysis::calculate_error_data(void) const
 
        // Absolute error
 
-       targets = target_data.arrange_column(i);
-       outputs = output_data.arrange_column(i);
+       targets = target_data.view_column(i);
+       outputs = output_data.view_column(i);
 
        error_data[i].set_column(0, (targets - outputs).calculate_absolute_value());
 
@@ -811,8 +908,8 @@ Matrix<size_t> TestingAnalysis::calculate_confusion_multiple_classification(cons
 
     for(size_t i = 0; i < rows_number; i++)
     {
-        target_index = target_data.arrange_row(i).calculate_maximal_index();
-        output_index = output_data.arrange_row(i).calculate_maximal_index();
+        target_index = target_data.view_row(i).calculate_maximal_index();
+        output_index = output_data.view_row(i).calculate_maximal_index();
 
         confusion(target_index,output_index)++;
     }
@@ -908,10 +1005,10 @@ Matrix<size_t> TestingAnalysis::calculate_confusion(void) const
 
    #endif
 
-    const Matrix<double> input_data = data_set_pointer->arrange_testing_input_data();
-    const Matrix<double> target_data = data_set_pointer->arrange_testing_target_data();
+    Matrix<double> target_data;
+    Matrix<double> output_data;
 
-    const Matrix<double> output_data = neural_network_pointer->calculate_output_data(input_data);
+    calculate_testing_target_output_data(target_data, output_data);
 
     if(outputs_number == 1)
     {
@@ -1004,10 +1101,10 @@ TestingAnalysis::RocAnalysisResults TestingAnalysis::perform_roc_analysis (void)
 
     #endif
 
-     const Matrix<double> input_data = data_set_pointer->arrange_testing_input_data();
-     const Matrix<double> target_data = data_set_pointer->arrange_testing_target_data();
+     Matrix<double> target_data;
+     Matrix<double> output_data;
 
-     const Matrix<double> output_data = neural_network_pointer->calculate_output_data(input_data);
+     calculate_testing_target_output_data(target_data, output_data);
 
      RocAnalysisResults roc_analysis_results;
 
@@ -1302,10 +1399,10 @@ Matrix<double> TestingAnalysis::perform_cumulative_gain_analysis(void) const
 
     #endif
 
-     const Matrix<double> input_data = data_set_pointer->arrange_testing_input_data();
-     const Matrix<double> target_data = data_set_pointer->arrange_testing_target_data();
+     Matrix<double> target_data;
+     Matrix<double> output_data;
 
-     const Matrix<double> output_data = neural_network_pointer->calculate_output_data(input_data);
+     calculate_testing_target_output_data(target_data, output_data);
 
      const Matrix<double> cumulative_gain = calculate_cumulative_gain(target_data, output_data);
 
@@ -1446,10 +1543,10 @@ Matrix<double> TestingAnalysis::perform_lift_chart_analysis(void) const
 
     #endif
 
-     const Matrix<double> input_data = data_set_pointer->arrange_testing_input_data();
-     const Matrix<double> target_data = data_set_pointer->arrange_testing_target_data();
+     Matrix<double> target_data;
+     Matrix<double> output_data;
 
-     const Matrix<double> output_data = neural_network_pointer->calculate_output_data(input_data);
+     calculate_testing_target_output_data(target_data, output_data);
 
      const Matrix<double> cumulative_gain = calculate_cumulative_gain(target_data, output_data);
      const Matrix<double> lift_chart = calculate_lift_chart(cumulative_gain);
@@ -1544,10 +1641,10 @@ Matrix<double> TestingAnalysis::perform_calibration_plot_analysis(void) const
 
     #endif
 
-    const Matrix<double> input_data = data_set_pointer->arrange_testing_input_data();
-    const Matrix<double> target_data = data_set_pointer->arrange_testing_target_data();
+    Matrix<double> target_data;
+    Matrix<double> output_data;
 
-    const Matrix<double> output_data = neural_network_pointer->calculate_output_data(input_data);
+    calculate_testing_target_output_data(target_data, output_data);
 
     const Matrix<double> calibration_plot = calculate_calibration_plot(target_data, output_data);
 
@@ -1718,10 +1815,10 @@ TestingAnalysis::BinaryClassifcationRates TestingAnalysis::calculate_binary_clas
 
     #endif
 
-    const Matrix<double> input_data = data_set_pointer->arrange_testing_input_data();
-    const Matrix<double> target_data = data_set_pointer->arrange_testing_target_data();
+    Matrix<double> target_data;
+    Matrix<double> output_data;
 
-    const Matrix<double> output_data = neural_network_pointer->calculate_output_data(input_data);
+    calculate_testing_target_output_data(target_data, output_data);
 
     const Vector<size_t> testing_indices = data_set_pointer->get_instances().arrange_testing_indices();
 
@@ -1918,10 +2015,10 @@ Matrix< Vector<size_t> > TestingAnalysis::calculate_multiple_classification_rate
 
     #endif
 
-    const Matrix<double> input_data = data_set_pointer->arrange_testing_input_data();
-    const Matrix<double> target_data = data_set_pointer->arrange_testing_target_data();
+    Matrix<double> target_data;
+    Matrix<double> output_data;
 
-    const Matrix<double> output_data = neural_network_pointer->calculate_output_data(input_data);
+    calculate_testing_target_output_data(target_data, output_data);
 
     const Vector<size_t> testing_indices = data_set_pointer->get_instances().arrange_testing_indices();
 
@@ -1947,8 +2044,8 @@ Matrix< Vector<size_t> > TestingAnalysis::calculate_multiple_classification_rate
 
     for(size_t i = 0; i < rows_number; i++)
     {
-        target_index = target_data.arrange_row(i).calculate_maximal_index();
-        output_index = output_data.arrange_row(i).calculate_maximal_index();
+        target_index = target_data.view_row(i).calculate_maximal_index();
+        output_index = output_data.view_row(i).calculate_maximal_index();
 
         multiple_classification_rates(target_index, output_index).push_back(testing_indices[i]);
     }
@@ -2024,10 +2121,10 @@ Vector< Vector<double> > TestingAnalysis::calculate_error_autocorrelation(const
 
     #endif
 
-    const Matrix<double> input_data = data_set_pointer->arrange_testing_input_data();
-    const Matrix<double> target_data = data_set_pointer->arrange_testing_target_data();
+    Matrix<double> target_data;
+    Matrix<double> output_data;
 
-    const Matrix<double> output_data = neural_network_pointer->calculate_output_data(input_data);
+    calculate_testing_target_output_data(target_data, output_data);
 
     const size_t targets_number = target_data.get_columns_number();
 
@@ -2111,10 +2208,12 @@ Vector< Vector<double> > TestingAnalysis::calculate_input_error_cross_correlatio
 
     #endif
 
-    const Matrix<double> input_data = data_set_pointer->arrange_testing_input_data();
-    const Matrix<double> target_data = data_set_pointer->arrange_testing_target_data();
+    Matrix<double> target_data;
+    Matrix<double> output_data;
+
+    calculate_testing_target_output_data(target_data, output_data);
 
-    const Matrix<double> output_data = neural_network_pointer->calculate_output_data(input_data);
+    const Matrix<double> input_data = data_set_pointer->arrange_testing_input_data();
 
     const size_t targets_number = target_data.get_columns_number();
 
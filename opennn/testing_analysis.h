@@ -188,6 +188,8 @@ public:
 
    // Target and output data methods
 
+   void calculate_testing_target_output_data(Matrix<double>&, Matrix<double>&) const;
+
    Vector< Matrix<double> > calculate_target_output_data(void) const;
 
    // Error data methods
@@ -32,6 +32,7 @@ TrainingStrategy::TrainingStrategy(void)
  , conjugate_gradient_pointer(NULL)
  , quasi_Newton_method_pointer(NULL)
  , Levenberg_Marquardt_algorithm_pointer(NULL)
+ , stochastic_gradient_descent_pointer(NULL)
  , Newton_method_pointer(NULL)
 {
     set_initialization_type(NO_INITIALIZATION);
@@ -57,6 +58,7 @@ TrainingStrategy::TrainingStrategy(PerformanceFunctional* new_performance_functi
  , conjugate_gradient_pointer(NULL)
  , quasi_Newton_method_pointer(NULL)
  , Levenberg_Marquardt_algorithm_pointer(NULL)
+ , stochastic_gradient_descent_pointer(NULL)
  , Newton_method_pointer(NULL)
 {
     set_initialization_type(NO_INITIALIZATION);
@@ -82,6 +84,7 @@ TrainingStrategy::TrainingStrategy(const tinyxml2::XMLDocument& document)
  , conjugate_gradient_pointer(NULL)
  , quasi_Newton_method_pointer(NULL)
  , Levenberg_Marquardt_algorithm_pointer(NULL)
+ , stochastic_gradient_descent_pointer(NULL)
  , Newton_method_pointer(NULL)
 {
     set_initialization_type(NO_INITIALIZATION);
@@ -109,6 +112,7 @@ TrainingStrategy::TrainingStrategy(const std::string& file_name)
  , conjugate_gradient_pointer(NULL)
  , quasi_Newton_method_pointer(NULL)
  , Levenberg_Marquardt_algorithm_pointer(NULL)
+ , stochastic_gradient_descent_pointer(NULL)
  , Newton_method_pointer(NULL)
 {
     set_initialization_type(NO_INITIALIZATION);
@@ -135,6 +139,7 @@ TrainingStrategy::~TrainingStrategy(void)
     delete conjugate_gradient_pointer;
     delete quasi_Newton_method_pointer;
     delete Levenberg_Marquardt_algorithm_pointer;
+    delete stochastic_gradient_descent_pointer;
 
     delete Newton_method_pointer;
 }
@@ -396,6 +401,28 @@ LevenbergMarquardtAlgorithm* TrainingStrategy::get_Levenberg_Marquardt_algorithm
 }
 
 
+// StochasticGradientDescent* get_stochastic_gradient_descent_pointer(void) const method
+
+/// Returns a pointer to the stochastic gradient descent main algorithm.
+/// It also throws an exception if that pointer is NULL.
+
+StochasticGradientDescent* TrainingStrategy::get_stochastic_gradient_descent_pointer(void) const
+{
+    if(!stochastic_gradient_descent_pointer)
+    {
+        std::ostringstream buffer;
+
+        buffer << "OpenNN Exception: TrainingStrategy class.\n"
+               << "StochasticGradientDescent* get_stochastic_gradient_descent_pointer(void) const method.\n"
+               << "Stochastic gradient descent pointer is NULL.\n";
+
+        throw std::logic_error(buffer.str());
+    }
+
+    return(stochastic_gradient_descent_pointer);
+}
+
+
 // NewtonMethod* get_Newton_method_pointer(void) const method
 
 /// Returns a pointer to the Newton method refinement algorithm.
@@ -509,6 +536,10 @@ std::string TrainingStrategy::write_main_type(void) const
    {
       return("LEVENBERG_MARQUARDT_ALGORITHM");
    }
+   else if(main_type == STOCHASTIC_GRADIENT_DESCENT)
+   {
+      return("STOCHASTIC_GRADIENT_DESCENT");
+   }
    else if(main_type == USER_MAIN)
    {
       return("USER_MAIN");
@@ -618,6 +649,10 @@ std::string TrainingStrategy::write_main_type_text(void) const
    {
       return("Levenberg-Marquardt algorithm");
    }
+   else if(main_type == STOCHASTIC_GRADIENT_DESCENT)
+   {
+      return("stochastic gradient descent");
+   }
    else if(main_type == USER_MAIN)
    {
       return("user defined");
@@ -809,6 +844,12 @@ void TrainingStrategy::set_main_type(const MainType& new_main_type)
       }
       break;
 
+      case STOCHASTIC_GRADIENT_DESCENT:
+      {
+         stochastic_gradient_descent_pointer = new StochasticGradientDescent(performance_functional_pointer);
+      }
+      break;
+
       case USER_MAIN:
       {
          // do nothing
@@ -940,6 +981,10 @@ void TrainingStrategy::set_main_type(const std::string& new_main_type)
    {
       set_main_type(LEVENBERG_MARQUARDT_ALGORITHM);
    }
+   else if(new_main_type == "STOCHASTIC_GRADIENT_DESCENT")
+   {
+      set_main_type(STOCHASTIC_GRADIENT_DESCENT);
+   }
    else if(new_main_type == "USER_MAIN")
    {
       set_main_type(USER_MAIN);
@@ -1074,6 +1119,12 @@ void TrainingStrategy::set_performance_functional_pointer(PerformanceFunctional*
       }
       break;
 
+      case STOCHASTIC_GRADIENT_DESCENT:
+      {
+         stochastic_gradient_descent_pointer->set_performance_functional_pointer(new_performance_functional_pointer);
+      }
+      break;
+
       case USER_MAIN:
       {
          // do nothing
@@ -1214,6 +1265,12 @@ void TrainingStrategy::set_display(const bool& new_display)
       }
       break;
 
+      case STOCHASTIC_GRADIENT_DESCENT:
+      {
+           stochastic_gradient_descent_pointer->set_display(display);
+      }
+      break;
+
       case USER_MAIN:
       {
          // do nothing
@@ -1312,11 +1369,13 @@ void TrainingStrategy::destruct_main(void)
     delete conjugate_gradient_pointer;
     delete quasi_Newton_method_pointer;
     delete Levenberg_Marquardt_algorithm_pointer;
+    delete stochastic_gradient_descent_pointer;
 
     gradient_descent_pointer = NULL;
     conjugate_gradient_pointer = NULL;
     quasi_Newton_method_pointer = NULL;
     Levenberg_Marquardt_algorithm_pointer = NULL;
+    stochastic_gradient_descent_pointer = NULL;
 
    main_type = NO_MAIN;
 }
@@ -1534,6 +1593,15 @@ TrainingStrategy::Results TrainingStrategy::perform_training(void)
       }
       break;
 
+      case STOCHASTIC_GRADIENT_DESCENT:
+      {
+           stochastic_gradient_descent_pointer->set_display(display);
+
+           training_strategy_results.stochastic_gradient_descent_results_pointer
+           = stochastic_gradient_descent_pointer->perform_training();
+      }
+      break;
+
       case USER_MAIN:
       {
          // do nothing
@@ -1686,6 +1754,12 @@ std::string TrainingStrategy::to_string(void) const
       }
       break;
 
+      case STOCHASTIC_GRADIENT_DESCENT:
+      {
+           buffer << stochastic_gradient_descent_pointer->to_string();
+      }
+      break;
+
       case USER_MAIN:
       {
          // do nothing
@@ -1923,6 +1997,23 @@ tinyxml2::XMLDocument* TrainingStrategy::to_XML(void) const
       }
       break;
 
+      case STOCHASTIC_GRADIENT_DESCENT:
+      {
+           tinyxml2::XMLElement* main_element = document->NewElement("Main");
+           training_strategy_element->LinkEndChild(main_element);
+
+           main_element->SetAttribute("Type", "STOCHASTIC_GRADIENT_DESCENT");
+
+           const tinyxml2::XMLDocument* stochastic_gradient_descent_document = stochastic_gradient_descent_pointer->to_XML();
+
+           const tinyxml2::XMLElement* stochastic_gradient_descent_element = stochastic_gradient_descent_document->FirstChildElement("StochasticGradientDescent");
+
+           DeepClone(main_element, stochastic_gradient_descent_element, document, NULL);
+
+           delete stochastic_gradient_descent_document;
+      }
+      break;
+
       case USER_MAIN:
       {
          // do nothing
@@ -2157,6 +2248,19 @@ void TrainingStrategy::from_XML(const tinyxml2::XMLDocument& document)
              }
              break;
 
+             case STOCHASTIC_GRADIENT_DESCENT:
+             {
+                  tinyxml2::XMLDocument new_document;
+
+                  tinyxml2::XMLElement* element_clone = new_document.NewElement("StochasticGradientDescent");
+                  new_document.InsertFirstChild(element_clone);
+
+                  DeepClone(element_clone, element, &new_document, NULL);
+
+                  stochastic_gradient_descent_pointer->from_XML(new_document);
+             }
+             break;
+
              case USER_MAIN:
              {
                 // do nothing
@@ -2310,6 +2414,8 @@ TrainingStrategy::Results::Results(void)
 
     Levenberg_Marquardt_algorithm_results_pointer = NULL;
 
+    stochastic_gradient_descent_results_pointer = NULL;
+
     Newton_method_results_pointer = NULL;
 }
 
@@ -2330,6 +2436,8 @@ TrainingStrategy::Results::~Results(void)
 
 //    delete Levenberg_Marquardt_algorithm_results_pointer;
 
+//    delete stochastic_gradient_descent_results_pointer;
+
 //    delete Newton_method_results_pointer;
 
 }
@@ -2374,6 +2482,11 @@ void TrainingStrategy::Results::save(const std::string& file_name) const
       file << Levenberg_Marquardt_algorithm_results_pointer->to_string();
    }
 
+   if(stochastic_gradient_descent_results_pointer)
+   {
+      file << stochastic_gradient_descent_results_pointer->to_string();
+   }
+
    if(Newton_method_results_pointer)
    {
       file << Newton_method_results_pointer->to_string();
@@ -34,6 +34,7 @@
 #include "evolutionary_algorithm.h"
 
 #include "gradient_descent.h"
+#include "stochastic_gradient_descent.h"
 #include "conjugate_gradient.h"
 #include "quasi_newton_method.h"
 #include "levenberg_marquardt_algorithm.h"
@@ -101,6 +102,7 @@ public:
        CONJUGATE_GRADIENT,
        QUASI_NEWTON_METHOD,
        LEVENBERG_MARQUARDT_ALGORITHM,
+       STOCHASTIC_GRADIENT_DESCENT,
        USER_MAIN
     };
 
@@ -155,6 +157,10 @@ public:
 
         LevenbergMarquardtAlgorithm::LevenbergMarquardtAlgorithmResults* Levenberg_Marquardt_algorithm_results_pointer;
 
+        /// Pointer to a structure with the results from the stochastic gradient descent training algorithm.
+
+        StochasticGradientDescent::StochasticGradientDescentResults* stochastic_gradient_descent_results_pointer;
+
         /// Pointer to a structure with results from the Newton method training algorithm.
 
         NewtonMethod::NewtonMethodResults* Newton_method_results_pointer;
@@ -185,6 +191,7 @@ public:
    ConjugateGradient* get_conjugate_gradient_pointer(void) const;
    QuasiNewtonMethod* get_quasi_Newton_method_pointer(void) const;
    LevenbergMarquardtAlgorithm* get_Levenberg_Marquardt_algorithm_pointer(void) const;
+   StochasticGradientDescent* get_stochastic_gradient_descent_pointer(void) const;
 
    NewtonMethod* get_Newton_method_pointer(void) const;
 
@@ -276,6 +283,10 @@ protected:
 
     LevenbergMarquardtAlgorithm* Levenberg_Marquardt_algorithm_pointer;
 
+    /// Pointer to a stochastic gradient descent object to be used as a main training algorithm.
+
+    StochasticGradientDescent* stochastic_gradient_descent_pointer;
+
     /// Pointer to a Newton method object to be used for refinement in the training strategy.
 
     NewtonMethod* Newton_method_pointer;
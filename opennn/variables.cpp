@@ -30,6 +30,9 @@ namespace OpenNN
 
 Variables::Variables(void)
 {
+   modifications_number = 1;
+   indices_modifications_number = 0;
+
    set();  
 }
 
@@ -44,6 +47,9 @@ Variables::Variables(void)
 
 Variables::Variables(const size_t& new_variables_number)
 {
+   modifications_number = 1;
+   indices_modifications_number = 0;
+
    set(new_variables_number);
 }
 
@@ -58,6 +64,9 @@ Variables::Variables(const size_t& new_variables_number)
 
 Variables::Variables(const size_t& new_inputs_number, const size_t& new_targets_number)
 {
+   modifications_number = 1;
+   indices_modifications_number = 0;
+
    set(new_inputs_number, new_targets_number);
 }
 
@@ -70,6 +79,9 @@ Variables::Variables(const size_t& new_inputs_number, const size_t& new_targets_
 
 Variables::Variables(const tinyxml2::XMLDocument& variables_document)
 {
+   modifications_number = 1;
+   indices_modifications_number = 0;
+
    set(variables_document);
 }
 
@@ -82,6 +94,9 @@ Variables::Variables(const tinyxml2::XMLDocument& variables_document)
 
 Variables::Variables(const Variables& other_variables)
 {
+   modifications_number = 1;
+   indices_modifications_number = 0;
+
    // Items
 
    items = other_variables.items;
@@ -115,6 +130,8 @@ Variables& Variables::operator=(const Variables& other_variables)
 
       items = other_variables.items;
 
+      modifications_number++;
+
       // Utilities
 
       display = other_variables.display;
@@ -212,11 +229,9 @@ bool Variables::empty(void) const
 
 size_t Variables::count_used_variables_number(void) const
 {
-    const size_t variables_number = get_variables_number();
-
-    const size_t unused_variables_number = count_unused_variables_number();
+    update_indices();
 
-    return(variables_number - unused_variables_number);
+    return(used_indices.size());
 }
 
 
@@ -226,19 +241,9 @@ size_t Variables::count_used_variables_number(void) const
 
 size_t Variables::count_unused_variables_number(void) const
 {
-   const size_t variables_number = get_variables_number();
-
-   size_t count = 0;
-
-   for(size_t i = 0; i < variables_number; i++)
-   {
-      if(items[i].use == Unused)
-	  {
-	     count++;
-	  }
-   }
+   update_indices();
 
-   return(count);
+   return(unused_indices.size());
 }
 
 
@@ -248,19 +253,9 @@ size_t Variables::count_unused_variables_number(void) const
 
 size_t Variables::count_inputs_number(void) const
 {
-   const size_t variables_number = get_variables_number();
-
-   size_t count = 0;
+   update_indices();
 
-   for(size_t i = 0; i < variables_number; i++)
-   {
-      if(items[i].use == Input)
-	  {
-	     count++;
-	  }
-   }
-
-   return(count);
+   return(inputs_indices.size());
 }
 
 
@@ -270,19 +265,9 @@ size_t Variables::count_inputs_number(void) const
 
 size_t Variables::count_targets_number(void) const
 {
-   const size_t variables_number = get_variables_number();
-
-   size_t count = 0;
-
-   for(size_t i = 0; i < variables_number; i++)
-   {
-      if(items[i].use == Target)
-	  {
-	     count++;
-	  }
-   }
+   update_indices();
 
-   return(count);
+   return(targets_indices.size());
 }
 
 
@@ -294,25 +279,13 @@ size_t Variables::count_targets_number(void) const
 
 Vector<size_t> Variables::count_uses(void) const
 {
-    Vector<size_t> count(3, 0);
+    update_indices();
 
-    const size_t variables_number = get_variables_number();
+    Vector<size_t> count(3);
 
-    for(size_t i = 0; i < variables_number; i++)
-    {
-        if(items[i].use == Input)
-        {
-           count[0]++;
-        }
-        else if(items[i].use == Target)
-        {
-           count[1]++;
-        }
-        else
-        {
-           count[2]++;
-        }
-    }
+    count[0] = inputs_indices.size();
+    count[1] = targets_indices.size();
+    count[2] = unused_indices.size();
 
     return(count);
 }
@@ -486,109 +459,111 @@ Matrix<std::string> Variables::arrange_information(void) const
 }
 
 
-// Vector<size_t> arrange_used_indices(void) const method
+// const Vector<size_t>& arrange_used_indices(void) const method
 
 /// Returns the indices of the used variables (those which are not set unused).
 
-Vector<size_t> Variables::arrange_used_indices(void) const
+const Vector<size_t>& Variables::arrange_used_indices(void) const
 {
-    const size_t variables_number = get_variables_number();
-
-    const size_t used_variables_number = count_used_variables_number();
-
-    Vector<size_t> used_indices(used_variables_number);
-
-    size_t index = 0;
-
-    for(size_t i = 0; i < variables_number; i++)
-    {
-        if(items[i].use == Input
-        || items[i].use == Target)
-        {
-            used_indices[index] = i;
-            index++;
-        }
-    }
+    update_indices();
 
     return(used_indices);
 }
 
 
-// Vector<size_t> arrange_inputs_indices(void) const method
+// const Vector<size_t>& arrange_inputs_indices(void) const method
 
 /// Returns the indices of the input variables.
 
-Vector<size_t> Variables::arrange_inputs_indices(void) const
+const Vector<size_t>& Variables::arrange_inputs_indices(void) const
 {
-   const size_t variables_number = get_variables_number();
-   const size_t inputs_number = count_inputs_number();
-
-   Vector<size_t> inputs_indices(inputs_number);
-
-   size_t index = 0;
-
-   for(size_t i = 0; i < variables_number; i++)
-   {
-      if(items[i].use == Input)
-	  {
-	     inputs_indices[index] = i;
-		 index++;
-	  }
-   }
+   update_indices();
 
    return(inputs_indices);
 }
 
 
-// Vector<size_t> arrange_targets_indices(void) const method
+// const Vector<size_t>& arrange_targets_indices(void) const method
 
 /// Returns the indices of the target variables.
 
-Vector<size_t> Variables::arrange_targets_indices(void) const
+const Vector<size_t>& Variables::arrange_targets_indices(void) const
 {
-   const size_t variables_number = get_variables_number();
-   const size_t targets_number = count_targets_number();
+   update_indices();
 
-   Vector<size_t> targets_indices(targets_number);
+   return(targets_indices);
+}
 
-   size_t index = 0;
 
-   for(size_t i = 0; i < variables_number; i++)
-   {
-      if(items[i].use == Target)
-	  {
-	     targets_indices[index] = i;
-		 index++;
-	  }
-   }
+// const Vector<size_t>& arrange_unused_indices(void) const method
 
-   return(targets_indices);
+/// Returns the indices of the unused variables.
+
+const Vector<size_t>& Variables::arrange_unused_indices(void) const
+{
+   update_indices();
+
+   return(unused_indices);
 }
 
 
-// Vector<size_t> arrange_unused_indices(void) const method
+// const size_t& get_modifications_number(void) const method
 
-/// Returns the indices of the unused variables.
+/// Returns the number of times that the uses of the variables have been modified.
+/// It changes whenever the number of variables or any of their uses is set.
 
-Vector<size_t> Variables::arrange_unused_indices(void) const
+const size_t& Variables::get_modifications_number(void) const
 {
-   const size_t variables_number = get_variables_number();
-   const size_t unused_number = count_unused_variables_number();
+   return(modifications_number);
+}
 
-   Vector<size_t> unused_indices(unused_number);
 
-   size_t index = 0;
+// void update_indices(void) const method
 
-   for(size_t i = 0; i < variables_number; i++)
+/// Arranges again the cached indices of the used, input, target and unused variables,
+/// if the uses have been modified since they were last arranged.
+/// This is done in a critical section, so that the indices can be requested from parallel regions.
+/// The uses must not be modified while a parallel region is requesting the indices.
+
+void Variables::update_indices(void) const
+{
+   if(indices_modifications_number.load(std::memory_order_acquire) == modifications_number)
    {
-      if(items[i].use == Unused)
+      return;
+   }
+
+   #pragma omp critical(Variables_update_indices)
+   {
+      if(indices_modifications_number.load(std::memory_order_relaxed) != modifications_number)
       {
-         unused_indices[index] = i;
-         index++;
+         const size_t variables_number = get_variables_number();
+
+         used_indices.clear();
+         inputs_indices.clear();
+         targets_indices.clear();
+         unused_indices.clear();
+
+         for(size_t i = 0; i < variables_number; i++)
+         {
+            if(items[i].use == Input)
+            {
+               inputs_indices.push_back(i);
+               used_indices.push_back(i);
+            }
+            else if(items[i].use == Target)
+            {
+               targets_indices.push_back(i);
+               used_indices.push_back(i);
+            }
+            else
+            {
+               unused_indices.push_back(i);
+            }
+         }
+
+         indices_modifications_number.store(modifications_number, std::memory_order_release);
       }
    }
-
-   return(unused_indices);
 }
 
 
@@ -1057,6 +1032,8 @@ void Variables::set(const size_t& inputs_number, const size_t& targets_number)
       items[i].use = Target;
    }
 
+   modifications_number++;
+
    set_default();
 }
 
@@ -1095,6 +1072,8 @@ void Variables::set_default(void)
 void Variables::set_items(const Vector<Item>& new_items)
 {
     items = new_items;
+
+    modifications_number++;
 }
 
 
@@ -1112,6 +1091,8 @@ void Variables::set_uses(const Vector<Variables::Use>& new_uses)
     {
         items[i].use = new_uses[i];
     }
+
+    modifications_number++;
 }
 
 
@@ -1150,6 +1131,8 @@ void Variables::set_uses(const Vector<std::string>& new_uses)
 	     throw std::logic_error(buffer.str());
 	  }
    }   
+
+   modifications_number++;
 }
 
 
@@ -1181,6 +1164,8 @@ void Variables::set_use(const size_t& i, const Use& new_use)
     #endif
 
     items[i].use = new_use;
+
+    modifications_number++;
 }
 
 
@@ -1234,6 +1219,8 @@ void Variables::set_use(const size_t& i, const std::string& new_use)
 
        throw std::logic_error(buffer.str());
     }
+
+    modifications_number++;
 }
 
 
@@ -1249,6 +1236,8 @@ void Variables::set_input(void)
     {
         items[i].use = Input;
     }
+
+    modifications_number++;
 }
 
 
@@ -1264,6 +1253,8 @@ void Variables::set_target(void)
     {
         items[i].use = Target;
     }
+
+    modifications_number++;
 }
 
 
@@ -1293,6 +1284,8 @@ void Variables::set_default_uses(void)
 
        items[variables_number-1].use = Target;
    }
+
+   modifications_number++;
 }
 
 
@@ -1700,6 +1693,9 @@ void Variables::convert_autoassociation(void)
 void Variables::set_variables_number(const size_t& new_variables_number)
 {
    items.set(new_variables_number);
+
+   modifications_number++;
+
    set_default_uses();
 }
 
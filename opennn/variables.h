@@ -26,6 +26,7 @@
 #include <stdexcept>
 #include <ctime>
 #include <exception>
+#include <atomic>
 
 // OpenNN includes
 
@@ -147,10 +148,12 @@ public:
 
    bool is_used(const size_t&) const;
 
-   Vector<size_t> arrange_used_indices(void) const;
-   Vector<size_t> arrange_inputs_indices(void) const;
-   Vector<size_t> arrange_targets_indices(void) const;
-   Vector<size_t> arrange_unused_indices(void) const;
+   const Vector<size_t>& arrange_used_indices(void) const;
+   const Vector<size_t>& arrange_inputs_indices(void) const;
+   const Vector<size_t>& arrange_targets_indices(void) const;
+   const Vector<size_t>& arrange_unused_indices(void) const;
+
+   const size_t& get_modifications_number(void) const;
 
    // Information methods
 
@@ -240,6 +243,7 @@ private:
    static std::string unsigned_to_string(const size_t&);
    static std::string prepend(const std::string&, const std::string&);
 
+   void update_indices(void) const;
 
    // MEMBERS
 
@@ -248,6 +252,33 @@ private:
 
    Vector<Item> items;
 
+   /// Number of times that the uses of the variables have been modified.
+   /// Objects which cache information depending on the uses can compare this number to know whether it is still valid.
+
+   size_t modifications_number;
+
+   /// Modifications number for which the cached indices below were arranged.
+   /// It is stored with release semantics once the indices are complete, and read with acquire semantics, 
+   /// so that a thread which sees it up to date also sees the cached indices.
+
+   mutable std::atomic<size_t> indices_modifications_number;
+
+   /// Cached indices of the used variables.
+
+   mutable Vector<size_t> used_indices;
+
+   /// Cached indices of the input variables.
+
+   mutable Vector<size_t> inputs_indices;
+
+   /// Cached indices of the target variables.
+
+   mutable Vector<size_t> targets_indices;
+
+   /// Cached indices of the unused variables.
+
+   mutable Vector<size_t> unused_indices;
+
    /// Display messages to screen.
    
    bool display;
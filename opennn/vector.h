@@ -32,6 +32,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 #include<limits>
 #include<climits>
@@ -40,6 +41,10 @@
 
 #include "../eigen/Eigen"
 
+// OpenNN includes
+
+#include "vector_kernels.h"
+
 
 namespace OpenNN
 {
@@ -56,8 +61,14 @@ T calculate_random_normal(const T& = 0.0, const T& = 1.0);
 
 template<class T> struct Histogram;
 template<class T> struct Statistics;
+template<class T> struct RunningStatistics;
 template<class T> struct LinearRegressionParameters;
 template<class T> struct LogisticRegressionParameters;
+template<class T> struct IndexLess;
+template<class T> struct IndexGreater;
+template<class E> struct VectorExpression;
+template<class T> struct ExpressionTerminal;
+template<class T> class VectorView;
 
 /// This template represents an array of any kind of numbers or objects.
 /// It inherits from the vector of the standard library, and implements additional utilities.
@@ -98,10 +109,28 @@ public:
 
     Vector(const Vector<T>&);
 
+    // Move constructor.
+
+    Vector(Vector<T>&&) noexcept;
+
+    // Expression constructor.
+
+    template<class E>
+    Vector(const VectorExpression<E>&);
+
     // DESTRUCTOR
 
     virtual ~Vector(void);
 
+    // ASSIGNMENT OPERATORS
+
+    Vector<T>& operator = (const Vector<T>&);
+
+    Vector<T>& operator = (Vector<T>&&) noexcept;
+
+    template<class E>
+    Vector<T>& operator = (const VectorExpression<E>&);
+
     // OPERATORS
 
     bool operator == (const T&) const;
@@ -334,35 +363,57 @@ public:
 
     // Rank methods
 
+    Vector<size_t> sort_less_indices(void) const;
+
+    Vector<size_t> sort_greater_indices(void) const;
+
     Vector<size_t> calculate_less_rank(void) const;
 
     Vector<size_t> calculate_greater_rank(void) const;
 
     // Mathematical operators
 
-    inline Vector<T> operator + (const T&) const;
+    inline Vector<T> operator + (const T&) const &;
+    inline Vector<T> operator + (const T&) &&;
 
-    inline Vector<T> operator + (const Vector<T>&) const;
+    inline Vector<T> operator + (const Vector<T>&) const &;
+    inline Vector<T> operator + (const Vector<T>&) &&;
+    inline Vector<T> operator + (Vector<T>&&) const &;
+    inline Vector<T> operator + (Vector<T>&&) &&;
 
-    inline Vector<T> operator - (const T&) const;
+    inline Vector<T> operator - (const T&) const &;
+    inline Vector<T> operator - (const T&) &&;
 
-    inline Vector<T> operator - (const Vector<T>&) const;
+    inline Vector<T> operator - (const Vector<T>&) const &;
+    inline Vector<T> operator - (const Vector<T>&) &&;
+    inline Vector<T> operator - (Vector<T>&&) const &;
+    inline Vector<T> operator - (Vector<T>&&) &&;
 
-    inline Vector<T> operator * (const T&) const;
+    inline Vector<T> operator * (const T&) const &;
+    inline Vector<T> operator * (const T&) &&;
 
-    inline Vector<T> operator * (const Vector<T>&) const;
+    inline Vector<T> operator * (const Vector<T>&) const &;
+    inline Vector<T> operator * (const Vector<T>&) &&;
+    inline Vector<T> operator * (Vector<T>&&) const &;
+    inline Vector<T> operator * (Vector<T>&&) &&;
 
     inline Matrix<T> operator * (const Matrix<T>&) const;
 
     inline double dot(const Vector<double>&) const;
 
+    double dot(const VectorView<double>&) const;
+
     Vector<double> dot(const Matrix<T>&) const;
 
     Matrix<T> direct(const Vector<T>&) const;
 
-    Vector<T> operator / (const T&) const;
+    Vector<T> operator / (const T&) const &;
+    Vector<T> operator / (const T&) &&;
 
-    Vector<T> operator / (const Vector<T>&) const;
+    Vector<T> operator / (const Vector<T>&) const &;
+    Vector<T> operator / (const Vector<T>&) &&;
+    Vector<T> operator / (Vector<T>&&) const &;
+    Vector<T> operator / (Vector<T>&&) &&;
 
     void operator += (const T&);
 
@@ -380,6 +431,16 @@ public:
 
     void operator /= (const Vector<T>&);
 
+    template<class E>
+    void operator += (const VectorExpression<E>&);
+
+    template<class E>
+    void operator -= (const VectorExpression<E>&);
+
+    // Expression methods
+
+    ExpressionTerminal<T> lazy(void) const;
+
     // Filtering methods
 
     void filter_positive(void);
@@ -521,6 +582,17 @@ Vector<T>::Vector(InputIterator first, InputIterator last) : std::vector<T>(firs
 }
 
 
+/// Expression constructor. It evaluates a lazy element-wise expression into a new vector.
+/// @param expression Expression to be evaluated, built from the lazy() terminals of vectors or matrices.
+
+template<class T>
+template<class E>
+Vector<T>::Vector(const VectorExpression<E>& expression) : std::vector<T>()
+{
+    (*this) = expression;
+}
+
+
 /// Copy constructor. It creates a copy of an existing Vector.
 /// @param other_vector Vector to be copied.
 
@@ -530,6 +602,15 @@ Vector<T>::Vector(const Vector<T>& other_vector) : std::vector<T>(other_vector)
 }
 
 
+/// Move constructor. It takes the elements of an expiring vector without copying them.
+/// @param other_vector Vector to be moved. It is left empty.
+
+template <class T>
+Vector<T>::Vector(Vector<T>&& other_vector) noexcept : std::vector<T>(std::move(other_vector))
+{
+}
+
+
 // DESTRUCTOR
 
 /// Destructor.
@@ -539,6 +620,61 @@ Vector<T>::~Vector(void)
 }
 
 
+// ASSIGNMENT OPERATORS
+
+/// Assignment operator. It assigns to self a copy of an existing vector.
+/// @param other_vector Vector to be assigned.
+
+template <class T>
+Vector<T>& Vector<T>::operator = (const Vector<T>& other_vector)
+{
+    std::vector<T>::operator = (other_vector);
+
+    return(*this);
+}
+
+
+/// Move assignment operator. It takes the elements of an expiring vector, releasing the previous ones.
+/// @param other_vector Vector to be moved. It is left empty.
+
+template <class T>
+Vector<T>& Vector<T>::operator = (Vector<T>&& other_vector) noexcept
+{
+    std::vector<T>::operator = (std::move(other_vector));
+
+    return(*this);
+}
+
+
+/// Expression assignment operator.
+/// It evaluates a lazy element-wise expression in a single loop, without intermediate vectors.
+/// This vector might appear in the expression, since each element is read before it is written.
+/// @param expression Expression to be assigned.
+
+template <class T>
+template <class E>
+Vector<T>& Vector<T>::operator = (const VectorExpression<E>& expression)
+{
+    const E& expression_node = expression.derived();
+
+    const size_t expression_size = expression_node.size();
+
+    if(this->size() != expression_size)
+    {
+        this->resize(expression_size);
+    }
+
+    T* this_data = this->data();
+
+    for(size_t i = 0; i < expression_size; i++)
+    {
+        this_data[i] = expression_node[i];
+    }
+
+    return(*this);
+}
+
+
 // bool  == (const T&) const
 
 /// Equal to operator between this vector and a Type value.
@@ -1735,7 +1871,10 @@ size_t Vector<T>::calculate_maximal_index(void) const
 
 // Vector<size_t> calculate_minimal_indices(const size_t&) const method
 
-/// Returns the indices of the smallest elements in the vector.
+/// Returns the indices of the smallest elements in the vector, from the smallest to the largest.
+/// Equal elements are taken in the order in which they appear in the vector.
+/// The elements are partitioned around the last one to be selected, and only the selected ones are sorted,
+/// so that the cost is linear in the size of the vector.
 /// @param number Number of minimal indices to be computed.
 
 template <class T>
@@ -1743,20 +1882,20 @@ Vector<size_t> Vector<T>::calculate_minimal_indices(const size_t& number) const
 {
    const size_t this_size = this->size();
 
-   const Vector<size_t> rank = calculate_less_rank();
+   const size_t selected_number = std::min(number, this_size);
 
-   Vector<size_t> minimal_indices(number);
+   Vector<size_t> indices(this_size);
+   indices.initialize_sequential();
 
-   for(size_t i = 0; i < this_size; i++)
-   {
-       for(size_t j = 0; j < number; j++)
-       {
-           if(rank[i] == j)
-           {
-               minimal_indices[j] = i;
-           }
-       }
-   }
+   const IndexLess<T> index_less(*this);
+
+   std::nth_element(indices.begin(), indices.begin() + selected_number, indices.end(), index_less);
+
+   std::sort(indices.begin(), indices.begin() + selected_number, index_less);
+
+   Vector<size_t> minimal_indices(number, 0);
+
+   std::copy(indices.begin(), indices.begin() + selected_number, minimal_indices.begin());
 
    return(minimal_indices);
 }
@@ -1764,7 +1903,9 @@ Vector<size_t> Vector<T>::calculate_minimal_indices(const size_t& number) const
 
 // Vector<size_t> calculate_maximal_indices(const size_t&) const method
 
-/// Returns the indices of the largest elements in the vector.
+/// Returns the indices of the largest elements in the vector, from the largest to the smallest.
+/// Equal elements are taken in the order in which they appear in the vector.
+/// As with the minimal indices, only the selected elements are sorted.
 /// @param number Number of maximal indices to be computed.
 
 template <class T>
@@ -1772,20 +1913,20 @@ Vector<size_t> Vector<T>::calculate_maximal_indices(const size_t& number) const
 {
     const size_t this_size = this->size();
 
-    const Vector<size_t> rank = calculate_greater_rank();
+    const size_t selected_number = std::min(number, this_size);
 
-    Vector<size_t> maximal_indices(number);
+    Vector<size_t> indices(this_size);
+    indices.initialize_sequential();
 
-    for(size_t i = 0; i < this_size; i++)
-    {
-        for(size_t j = 0; j < number; j++)
-        {
-            if(rank[i] == j)
-            {
-                maximal_indices[j] = i;
-            }
-        }
-    }
+    const IndexGreater<T> index_greater(*this);
+
+    std::nth_element(indices.begin(), indices.begin() + selected_number, indices.end(), index_greater);
+
+    std::sort(indices.begin(), indices.begin() + selected_number, index_greater);
+
+    Vector<size_t> maximal_indices(number, 0);
+
+    std::copy(indices.begin(), indices.begin() + selected_number, maximal_indices.begin());
 
    return(maximal_indices);
 }
@@ -2075,16 +2216,7 @@ size_t Vector<T>::calculate_closest_index(const T& value) const
 template <class T>
 T Vector<T>::calculate_sum(void) const
 {
-   const size_t this_size = this->size();
-
-   T sum = 0;
-
-   for(size_t i = 0; i < this_size; i++)
-   {
-      sum += (*this)[i];
-   }
-
-   return(sum);
+   return(calculate_sum_kernel(this->data(), this->size()));
 }
 
 
@@ -2702,6 +2834,7 @@ double Vector<T>::calculate_kurtosis_missing_values(const Vector<size_t>& missin
 // Statistics<T> calculate_statistics(void) const method
 
 /// Returns the minimum, maximum, mean and standard deviation of the elements in the vector.
+/// They are all computed in a single pass over the elements.
 
 template <class T>
 Statistics<T> Vector<T>::calculate_statistics(void) const
@@ -2725,20 +2858,18 @@ Statistics<T> Vector<T>::calculate_statistics(void) const
 
    #endif
 
-   Statistics<T> statistics;
+   RunningStatistics<T> running_statistics;
 
-   statistics.minimum = calculate_minimum();
-   statistics.maximum = calculate_maximum();
-   statistics.mean = calculate_mean();
-   statistics.standard_deviation = calculate_standard_deviation();
+   running_statistics.update(this->data(), this->size());
 
-   return(statistics);
+   return(running_statistics.calculate_statistics());
 }
 
 
 // Statistics<T> calculate_statistics_missing_values(const Vector<size_t>&) const method
 
-/// Returns the minimum, maximum, mean and standard deviation of the elements in the vector.
+/// Returns the minimum, maximum, mean and standard deviation of the elements in the vector which are not missing.
+/// @param missing_indices Vector with the indices of the missing elements.
 
 template <class T>
 Statistics<T> Vector<T>::calculate_statistics_missing_values(const Vector<size_t>& missing_indices) const
@@ -2762,14 +2893,24 @@ Statistics<T> Vector<T>::calculate_statistics_missing_values(const Vector<size_t
 
    #endif
 
-   Statistics<T> statistics;
+   Vector<bool> missing(this->size(), false);
+
+   for(size_t i = 0; i < missing_indices.size(); i++)
+   {
+      missing[missing_indices[i]] = true;
+   }
+
+   RunningStatistics<T> running_statistics;
 
-   statistics.minimum = calculate_minimum_missing_values(missing_indices);
-   statistics.maximum = calculate_maximum_missing_values(missing_indices);
-   statistics.mean = calculate_mean_missing_values(missing_indices);
-   statistics.standard_deviation = calculate_standard_deviation_missing_values(missing_indices);
+   for(size_t i = 0; i < this->size(); i++)
+   {
+      if(!missing[i])
+      {
+         running_statistics.update((*this)[i]);
+      }
+   }
 
-   return(statistics);
+   return(running_statistics.calculate_statistics());
 }
 
 
@@ -2873,18 +3014,7 @@ double Vector<T>::calculate_norm(void) const
 {
    const size_t this_size = this->size();
 
-   // Control sentence (if debug)
-
-   double norm = 0.0;
-
-   for(size_t i = 0; i < this_size; i++)
-   {
-      norm += (*this)[i]*(*this)[i];
-   }
-
-   norm = sqrt(norm);
-
-   return(norm);
+   return(sqrt(calculate_squared_sum_kernel(this->data(), this_size)));
 }
 
 
@@ -3103,17 +3233,7 @@ double Vector<T>::calculate_sum_squared_error(const Vector<double>& other_vector
 
    #endif
 
-   double sum_squared_error = 0.0;
-   double error;
-
-   for(size_t i = 0; i < this_size; i++)
-   {
-        error = (*this)[i] - other_vector[i];
-
-        sum_squared_error += error*error;
-   }
-
-   return(sum_squared_error);
+   return(calculate_squared_distance_kernel(this->data(), other_vector.data(), this_size));
 }
 
 
@@ -3212,16 +3332,18 @@ double Vector<T>::calculate_Minkowski_error(const Vector<double>& other_vector,
 
    #endif
 
-   double Minkowski_error = 0.0;
+   const double Minkowski_sum = calculate_Minkowski_kernel(this->data(), other_vector.data(), this_size, Minkowski_parameter);
 
-   for(size_t i = 0; i < this_size; i++)
+   if(Minkowski_parameter == 1.0)
    {
-      Minkowski_error += pow(fabs((*this)[i] - other_vector[i]), Minkowski_parameter);
+      return(Minkowski_sum);
+   }
+   else if(Minkowski_parameter == 2.0)
+   {
+      return(sqrt(Minkowski_sum));
    }
 
-   Minkowski_error = pow(Minkowski_error, 1.0/Minkowski_parameter);
-
-   return(Minkowski_error);
+   return(pow(Minkowski_sum, 1.0/Minkowski_parameter));
 }
 
 
@@ -3996,46 +4118,60 @@ void Vector<T>::apply_lower_upper_bounds(const Vector<T>& lower_bound, const Vec
 }
 
 
+// Vector<size_t> sort_less_indices(void) const method
+
+/// Returns the indices of the elements of this vector sorted in ascending order of their values.
+/// Equal elements keep the order in which they appear in the vector.
+
+template <class T>
+Vector<size_t> Vector<T>::sort_less_indices(void) const
+{
+    Vector<size_t> indices(this->size());
+    indices.initialize_sequential();
+
+    std::sort(indices.begin(), indices.end(), IndexLess<T>(*this));
+
+    return(indices);
+}
+
+
+// Vector<size_t> sort_greater_indices(void) const method
+
+/// Returns the indices of the elements of this vector sorted in descending order of their values.
+/// Equal elements keep the order in which they appear in the vector.
+
+template <class T>
+Vector<size_t> Vector<T>::sort_greater_indices(void) const
+{
+    Vector<size_t> indices(this->size());
+    indices.initialize_sequential();
+
+    std::sort(indices.begin(), indices.end(), IndexGreater<T>(*this));
+
+    return(indices);
+}
+
+
 // Vector<size_t> calculate_less_rank(void) const method
 
 /// Returns a vector with the rank of the elements of this vector.
 /// The smallest element will have rank 0, and the greatest element will have size-1.
 /// That is, small values correspond with small ranks.
+/// Equal elements get consecutive ranks, in the order in which they appear in the vector.
 
 template <class T>
 Vector<size_t> Vector<T>::calculate_less_rank(void) const
 {
     const size_t this_size = this->size();
 
-    Vector<size_t> rank(this_size);
-
-    Vector<T> sorted_vector(*this);
-
-    std::sort(sorted_vector.begin(), sorted_vector.end(), std::less<double>());
+    const Vector<size_t> sorted_indices = sort_less_indices();
 
-    Vector<size_t> previous_rank;
-    previous_rank.set(this_size, -1);
+    Vector<size_t> rank(this_size);
 
     for(size_t i = 0; i < this_size; i++)
     {
-       for(size_t j = 0; j < this_size; j++)
-       {
-          if(previous_rank.contains(j))
-          {
-              continue;
-          }
-
-          if((*this) [i] == sorted_vector[j])
-          {
-              rank[i] = j;
-
-              previous_rank[i] = j;
-
-              break;
-          }
-
-        }
-     }
+        rank[sorted_indices[i]] = i;
+    }
 
     return(rank);
 }
@@ -4046,72 +4182,69 @@ Vector<size_t> Vector<T>::calculate_less_rank(void) const
 /// Returns a vector with the rank of the elements of this vector.
 /// The smallest element will have rank size-1, and the greatest element will have 0.
 /// That is, small values correspond to big ranks.
+/// Equal elements get consecutive ranks, in the order in which they appear in the vector.
 
 template <class T>
 Vector<size_t> Vector<T>::calculate_greater_rank(void) const
 {
     const size_t this_size = this->size();
 
-    Vector<size_t> rank(this_size);
-
-    Vector<T> sorted_vector(*this);
-
-    std::sort(sorted_vector.begin(), sorted_vector.end(), std::greater<double>());
+    const Vector<size_t> sorted_indices = sort_greater_indices();
 
-    Vector<size_t> previous_rank;
-    previous_rank.set(this_size, -1);
+    Vector<size_t> rank(this_size);
 
     for(size_t i = 0; i < this_size; i++)
     {
-       for(size_t j = 0; j < this_size; j++)
-       {
-          if(previous_rank.contains(j))
-          {
-              continue;
-          }
-
-          if((*this)[i] == sorted_vector[j])
-          {
-              rank[i] = j;
-
-              previous_rank[i] = j;
-
-              break;
-          }
-       }
+        rank[sorted_indices[i]] = i;
     }
 
     return(rank);
 }
 
 
-// Vector<T> operator + (const T&) const method
+// Vector<T> operator + (const T&) const & method
 
 /// Sum vector+scalar arithmetic operator.
 /// @param scalar Scalar value to be added to this vector.
 
 template <class T>
-inline Vector<T> Vector<T>::operator + (const T& scalar) const
+inline Vector<T> Vector<T>::operator + (const T& scalar) const &
 {
    const size_t this_size = this->size();
 
    Vector<T> sum(this_size);
 
-   std::transform(this->begin(), this->end(),
-                  sum.begin(),
-                  std::bind2nd(std::plus<T>(), scalar) );
+   for(size_t i = 0; i < this_size; i++)
+   {
+      sum[i] = (*this)[i] + scalar;
+   }
 
    return(sum);
 }
 
 
-// Vector<T> operator + (const Vector<T>&) const method
+// Vector<T> operator + (const T&) && method
+
+/// Sum vector+scalar arithmetic operator for an expiring vector.
+/// The result is computed in the elements of this vector, which are then moved to it.
+/// @param scalar Scalar value to be added to this vector.
+
+template <class T>
+inline Vector<T> Vector<T>::operator + (const T& scalar) &&
+{
+   (*this) += scalar;
+
+   return(std::move(*this));
+}
+
+
+// Vector<T> operator + (const Vector<T>&) const & method
 
 /// Sum vector+vector arithmetic operator.
 /// @param other_vector Vector to be added to this vector.
 
 template <class T>
-inline Vector<T> Vector<T>::operator + (const Vector<T>& other_vector) const
+inline Vector<T> Vector<T>::operator + (const Vector<T>& other_vector) const &
 {
    const size_t this_size = this->size();
 
@@ -4143,38 +4276,36 @@ inline Vector<T> Vector<T>::operator + (const Vector<T>& other_vector) const
 }
 
 
-//Vector<T> operator - (const T&) const method
+// Vector<T> operator + (const Vector<T>&) && method
 
-/// Difference vector-scalar arithmetic operator.
-/// @param scalar Scalar value to be subtracted to this vector.
+/// Sum vector+vector arithmetic operator for an expiring vector.
+/// The result is computed in the elements of this vector, which are then moved to it.
+/// @param other_vector Vector to be added to this vector.
 
 template <class T>
-inline Vector<T> Vector<T>::operator - (const T& scalar) const
+inline Vector<T> Vector<T>::operator + (const Vector<T>& other_vector) &&
 {
-   const size_t this_size = this->size();
-
-   Vector<T> difference(this_size);
-
-   std::transform(this->begin(), this->end(), difference.begin(), std::bind2nd(std::minus<T>(), scalar));
+   (*this) += other_vector;
 
-   return(difference);
+   return(std::move(*this));
 }
 
 
-// Vector<T> operator - (const Vector<T>&) const method
+// Vector<T> operator + (Vector<T>&&) const & method
 
-/// Difference vector-vector arithmetic operator.
-/// @param other_vector vector to be subtracted to this vector.
+/// Sum vector+vector arithmetic operator for an expiring right hand side vector.
+/// The result is computed in the elements of the other vector, which are then moved to it.
+/// @param other_vector Vector to be added to this vector.
 
 template <class T>
-inline Vector<T> Vector<T>::operator - (const Vector<T>& other_vector) const
+inline Vector<T> Vector<T>::operator + (Vector<T>&& other_vector) const &
 {
-   const size_t this_size = this->size();
-
    // Control sentence (if debug)
 
    #ifdef __OPENNN_DEBUG__
 
+   const size_t this_size = this->size();
+
    const size_t other_size = other_vector.size();
 
    if(other_size != this_size)
@@ -4182,7 +4313,7 @@ inline Vector<T> Vector<T>::operator - (const Vector<T>& other_vector) const
       std::ostringstream buffer;
 
       buffer << "OpenNN Exception: Vector Template.\n"
-             << "Vector<T> operator - (const Vector<T>&) const.\n"
+             << "Vector<T> operator + (Vector<T>&&) const &.\n"
              << "Size of vectors is " << this_size << " and " << other_size << " and they must be the same.\n";
 
       throw std::logic_error(buffer.str());
@@ -4190,39 +4321,70 @@ inline Vector<T> Vector<T>::operator - (const Vector<T>& other_vector) const
 
    #endif
 
-   Vector<T> difference(this_size);
+   std::transform(this->begin(), this->end(), other_vector.begin(), other_vector.begin(), std::plus<T>());
 
-   std::transform( this->begin(), this->end(), other_vector.begin(), difference.begin(), std::minus<T>());
+   return(std::move(other_vector));
+}
 
-   return(difference);
+
+// Vector<T> operator + (Vector<T>&&) && method
+
+/// Sum vector+vector arithmetic operator when both vectors are expiring.
+/// The elements of this vector are reused for the result.
+/// @param other_vector Vector to be added to this vector.
+
+template <class T>
+inline Vector<T> Vector<T>::operator + (Vector<T>&& other_vector) &&
+{
+   (*this) += other_vector;
+
+   return(std::move(*this));
 }
 
 
-// Vector<T> operator * (const T&) const method
+// Vector<T> operator - (const T&) const & method
 
-/// Product vector*scalar arithmetic operator.
-/// @param scalar Scalar value to be multiplied to this vector.
+/// Difference vector-scalar arithmetic operator.
+/// @param scalar Scalar value to be subtracted to this vector.
 
 template <class T>
-Vector<T> Vector<T>::operator * (const T& scalar) const
+inline Vector<T> Vector<T>::operator - (const T& scalar) const &
 {
    const size_t this_size = this->size();
 
-   Vector<T> product(this_size);
+   Vector<T> difference(this_size);
 
-   std::transform( this->begin(), this->end(), product.begin(), std::bind2nd(std::multiplies<T>(), scalar));
+   for(size_t i = 0; i < this_size; i++)
+   {
+      difference[i] = (*this)[i] - scalar;
+   }
 
-   return(product);
+   return(difference);
 }
 
 
-// Type operator * (const Vector<T>&) const method
+// Vector<T> operator - (const T&) && method
 
-/// Element by element product vector*vector arithmetic operator.
-/// @param other_vector vector to be multiplied to this vector.
+/// Difference vector-scalar arithmetic operator for an expiring vector.
+/// The result is computed in the elements of this vector, which are then moved to it.
+/// @param scalar Scalar value to be subtracted from this vector.
+
+template <class T>
+inline Vector<T> Vector<T>::operator - (const T& scalar) &&
+{
+   (*this) -= scalar;
+
+   return(std::move(*this));
+}
+
+
+// Vector<T> operator - (const Vector<T>&) const & method
+
+/// Difference vector-vector arithmetic operator.
+/// @param other_vector vector to be subtracted to this vector.
 
 template <class T>
-inline Vector<T> Vector<T>::operator * (const Vector<T>& other_vector) const
+inline Vector<T> Vector<T>::operator - (const Vector<T>& other_vector) const &
 {
    const size_t this_size = this->size();
 
@@ -4237,40 +4399,245 @@ inline Vector<T> Vector<T>::operator * (const Vector<T>& other_vector) const
       std::ostringstream buffer;
 
       buffer << "OpenNN Exception: Vector Template.\n"
-             << "Vector<T> operator * (const Vector<T>&) const.\n"
-             << "Size of other vector (" << other_size << ") must be equal to size of this vector (" << this_size << ").\n";
+             << "Vector<T> operator - (const Vector<T>&) const.\n"
+             << "Size of vectors is " << this_size << " and " << other_size << " and they must be the same.\n";
 
       throw std::logic_error(buffer.str());
    }
 
    #endif
 
-   Vector<T> product(this_size);
+   Vector<T> difference(this_size);
 
-   std::transform(this->begin(), this->end(), other_vector.begin(), product.begin(), std::multiplies<T>());
+   std::transform( this->begin(), this->end(), other_vector.begin(), difference.begin(), std::minus<T>());
 
-   return(product);
+   return(difference);
 }
 
 
-// Matrix<T> operator * (const Matrix<T>&) const method
+// Vector<T> operator - (const Vector<T>&) && method
 
-/// Element by row product vector*matrix arithmetic operator.
-/// @param matrix matrix to be multiplied to this vector.
+/// Difference vector-vector arithmetic operator for an expiring vector.
+/// The result is computed in the elements of this vector, which are then moved to it.
+/// @param other_vector Vector to be subtracted from this vector.
 
 template <class T>
-Matrix<T> Vector<T>::operator * (const Matrix<T>& matrix) const
+inline Vector<T> Vector<T>::operator - (const Vector<T>& other_vector) &&
 {
-   const size_t rows_number = matrix.get_rows_number();
-   const size_t columns_number = matrix.get_columns_number();
+   (*this) -= other_vector;
 
-   // Control sentence (if debug)
+   return(std::move(*this));
+}
 
-   #ifdef __OPENNN_DEBUG__
 
-   const size_t this_size = this->size();
+// Vector<T> operator - (Vector<T>&&) const & method
 
-   if(rows_number != this_size)
+/// Difference vector-vector arithmetic operator for an expiring right hand side vector.
+/// The result is computed in the elements of the other vector, which are then moved to it.
+/// @param other_vector Vector to be subtracted from this vector.
+
+template <class T>
+inline Vector<T> Vector<T>::operator - (Vector<T>&& other_vector) const &
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   const size_t this_size = this->size();
+
+   const size_t other_size = other_vector.size();
+
+   if(other_size != this_size)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Vector Template.\n"
+             << "Vector<T> operator - (Vector<T>&&) const &.\n"
+             << "Size of vectors is " << this_size << " and " << other_size << " and they must be the same.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   std::transform(this->begin(), this->end(), other_vector.begin(), other_vector.begin(), std::minus<T>());
+
+   return(std::move(other_vector));
+}
+
+
+// Vector<T> operator - (Vector<T>&&) && method
+
+/// Difference vector-vector arithmetic operator when both vectors are expiring.
+/// The elements of this vector are reused for the result.
+/// @param other_vector Vector to be subtracted from this vector.
+
+template <class T>
+inline Vector<T> Vector<T>::operator - (Vector<T>&& other_vector) &&
+{
+   (*this) -= other_vector;
+
+   return(std::move(*this));
+}
+
+
+// Vector<T> operator * (const T&) const & method
+
+/// Product vector*scalar arithmetic operator.
+/// @param scalar Scalar value to be multiplied to this vector.
+
+template <class T>
+Vector<T> Vector<T>::operator * (const T& scalar) const &
+{
+   const size_t this_size = this->size();
+
+   Vector<T> product(this_size);
+
+   for(size_t i = 0; i < this_size; i++)
+   {
+      product[i] = (*this)[i] * scalar;
+   }
+
+   return(product);
+}
+
+
+// Vector<T> operator * (const T&) && method
+
+/// Product vector*scalar arithmetic operator for an expiring vector.
+/// The result is computed in the elements of this vector, which are then moved to it.
+/// @param scalar Scalar value to be multiplied by this vector.
+
+template <class T>
+Vector<T> Vector<T>::operator * (const T& scalar) &&
+{
+   (*this) *= scalar;
+
+   return(std::move(*this));
+}
+
+
+// Vector<T> operator * (const Vector<T>&) const & method
+
+/// Element by element product vector*vector arithmetic operator.
+/// @param other_vector vector to be multiplied to this vector.
+
+template <class T>
+inline Vector<T> Vector<T>::operator * (const Vector<T>& other_vector) const &
+{
+   const size_t this_size = this->size();
+
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   const size_t other_size = other_vector.size();
+
+   if(other_size != this_size)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Vector Template.\n"
+             << "Vector<T> operator * (const Vector<T>&) const.\n"
+             << "Size of other vector (" << other_size << ") must be equal to size of this vector (" << this_size << ").\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   Vector<T> product(this_size);
+
+   std::transform(this->begin(), this->end(), other_vector.begin(), product.begin(), std::multiplies<T>());
+
+   return(product);
+}
+
+
+// Vector<T> operator * (const Vector<T>&) && method
+
+/// Product vector*vector arithmetic operator for an expiring vector.
+/// The result is computed in the elements of this vector, which are then moved to it.
+/// @param other_vector Vector to be multiplied by this vector.
+
+template <class T>
+Vector<T> Vector<T>::operator * (const Vector<T>& other_vector) &&
+{
+   (*this) *= other_vector;
+
+   return(std::move(*this));
+}
+
+
+// Vector<T> operator * (Vector<T>&&) const & method
+
+/// Product vector*vector arithmetic operator for an expiring right hand side vector.
+/// The result is computed in the elements of the other vector, which are then moved to it.
+/// @param other_vector Vector to be multiplied by this vector.
+
+template <class T>
+Vector<T> Vector<T>::operator * (Vector<T>&& other_vector) const &
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   const size_t this_size = this->size();
+
+   const size_t other_size = other_vector.size();
+
+   if(other_size != this_size)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Vector Template.\n"
+             << "Vector<T> operator * (Vector<T>&&) const &.\n"
+             << "Size of vectors is " << this_size << " and " << other_size << " and they must be the same.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   std::transform(this->begin(), this->end(), other_vector.begin(), other_vector.begin(), std::multiplies<T>());
+
+   return(std::move(other_vector));
+}
+
+
+// Vector<T> operator * (Vector<T>&&) && method
+
+/// Product vector*vector arithmetic operator when both vectors are expiring.
+/// The elements of this vector are reused for the result.
+/// @param other_vector Vector to be multiplied by this vector.
+
+template <class T>
+Vector<T> Vector<T>::operator * (Vector<T>&& other_vector) &&
+{
+   (*this) *= other_vector;
+
+   return(std::move(*this));
+}
+
+
+// Matrix<T> operator * (const Matrix<T>&) const method
+
+/// Element by row product vector*matrix arithmetic operator.
+/// @param matrix matrix to be multiplied to this vector.
+
+template <class T>
+Matrix<T> Vector<T>::operator * (const Matrix<T>& matrix) const
+{
+   const size_t rows_number = matrix.get_rows_number();
+   const size_t columns_number = matrix.get_columns_number();
+
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   const size_t this_size = this->size();
+
+   if(rows_number != this_size)
    {
       std::ostringstream buffer;
 
@@ -4378,20 +4745,7 @@ inline double Vector<T>::dot(const Vector<double>& other_vector) const
 
    #endif
 
-//   const Eigen::Map<Eigen::VectorXd> this_vector_eigen((double*)this->data(), this_size);
-//   const Eigen::Map<Eigen::VectorXd> other_vector_eigen((double*)other_vector.data(), this_size);
-
-//   return(this_vector_eigen.dot(other_vector_eigen));
-
-  double dot_product = 0.0;
-
-  for(size_t i = 0; i < this_size; i++)
-  {
-     dot_product += (*this)[i]*other_vector[i];
-  }
-
-  return(dot_product);
-
+   return(calculate_dot_kernel(this->data(), other_vector.data(), this_size));
 }
 
 
@@ -4438,31 +4792,49 @@ Matrix<T> Vector<T>::direct(const Vector<T>& other_vector) const
 }
 
 
-//Vector<T> operator / (const T&) const method
+// Vector<T> operator / (const T&) const & method
 
 /// Cocient vector/scalar arithmetic operator.
 /// @param scalar Scalar value to be divided to this vector.
 
 template <class T>
-Vector<T> Vector<T>::operator / (const T& scalar) const
+Vector<T> Vector<T>::operator / (const T& scalar) const &
 {
    const size_t this_size = this->size();
 
    Vector<T> cocient(this_size);
 
-   std::transform(this->begin(), this->end(), cocient.begin(), std::bind2nd(std::divides<T>(), scalar));
+   for(size_t i = 0; i < this_size; i++)
+   {
+      cocient[i] = (*this)[i] / scalar;
+   }
 
    return(cocient);
 }
 
 
-// Vector<T> operator / (const Vector<T>&) const method
+// Vector<T> operator / (const T&) && method
+
+/// Quotient vector/scalar arithmetic operator for an expiring vector.
+/// The result is computed in the elements of this vector, which are then moved to it.
+/// @param scalar Scalar value to be divided by this vector.
+
+template <class T>
+Vector<T> Vector<T>::operator / (const T& scalar) &&
+{
+   (*this) /= scalar;
+
+   return(std::move(*this));
+}
+
+
+// Vector<T> operator / (const Vector<T>&) const & method
 
 /// Cocient vector/vector arithmetic operator.
 /// @param other_vector vector to be divided to this vector.
 
 template <class T>
-Vector<T> Vector<T>::operator / (const Vector<T>& other_vector) const
+Vector<T> Vector<T>::operator / (const Vector<T>& other_vector) const &
 {
    const size_t this_size = this->size();
 
@@ -4493,6 +4865,72 @@ Vector<T> Vector<T>::operator / (const Vector<T>& other_vector) const
 }
 
 
+// Vector<T> operator / (const Vector<T>&) && method
+
+/// Quotient vector/vector arithmetic operator for an expiring vector.
+/// The result is computed in the elements of this vector, which are then moved to it.
+/// @param other_vector Vector to be divided by this vector.
+
+template <class T>
+Vector<T> Vector<T>::operator / (const Vector<T>& other_vector) &&
+{
+   (*this) /= other_vector;
+
+   return(std::move(*this));
+}
+
+
+// Vector<T> operator / (Vector<T>&&) const & method
+
+/// Quotient vector/vector arithmetic operator for an expiring right hand side vector.
+/// The result is computed in the elements of the other vector, which are then moved to it.
+/// @param other_vector Vector to be divided by this vector.
+
+template <class T>
+Vector<T> Vector<T>::operator / (Vector<T>&& other_vector) const &
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   const size_t this_size = this->size();
+
+   const size_t other_size = other_vector.size();
+
+   if(other_size != this_size)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Vector Template.\n"
+             << "Vector<T> operator / (Vector<T>&&) const &.\n"
+             << "Size of vectors is " << this_size << " and " << other_size << " and they must be the same.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   std::transform(this->begin(), this->end(), other_vector.begin(), other_vector.begin(), std::divides<T>());
+
+   return(std::move(other_vector));
+}
+
+
+// Vector<T> operator / (Vector<T>&&) && method
+
+/// Quotient vector/vector arithmetic operator when both vectors are expiring.
+/// The elements of this vector are reused for the result.
+/// @param other_vector Vector to be divided by this vector.
+
+template <class T>
+Vector<T> Vector<T>::operator / (Vector<T>&& other_vector) &&
+{
+   (*this) /= other_vector;
+
+   return(std::move(*this));
+}
+
+
 // void operator += (const T&)
 
 /// Scalar sum and assignment operator.
@@ -4705,49 +5143,146 @@ void Vector<T>::operator /= (const Vector<T>& other_vector)
 }
 
 
-// void filter_positive(void) method
+// void operator += (const VectorExpression<E>&)
 
-/// Sets all the negative elements in the vector to zero.
+/// Sum and assignment operator with a lazy expression, which is evaluated while it is added.
+/// @param expression Expression to be added to this vector.
 
 template <class T>
-void Vector<T>::filter_positive(void)
+template <class E>
+void Vector<T>::operator += (const VectorExpression<E>& expression)
 {
-    for(size_t i = 0; i < this->size(); i++)
-    {
-        if((*this)[i] < 0)
-        {
-            (*this)[i] = 0;
-        }
-    }
-}
+   const E& expression_node = expression.derived();
 
+   const size_t this_size = this->size();
 
-// void filter_negative(void) method
+   // Control sentence (if debug)
 
-/// Sets all the positive elements in the vector to zero.
+   #ifdef __OPENNN_DEBUG__
 
-template <class T>
-void Vector<T>::filter_negative(void)
-{
-    for(size_t i = 0; i < this->size(); i++)
-    {
-        if((*this)[i] > 0)
-        {
-            (*this)[i] = 0;
-        }
-    }
-}
+   const size_t expression_size = expression_node.size();
 
-// void scale_minimum_maximum(const T&, const T&) method
+   if(expression_size != this_size)
+   {
+      std::ostringstream buffer;
 
-/// Normalizes the elements of this vector using the minimum and maximum method.
-/// @param minimum Minimum value for the scaling.
-/// @param maximum Maximum value for the scaling.
+      buffer << "OpenNN Exception: Vector Template.\n"
+             << "void operator += (const VectorExpression<E>&).\n"
+             << "Size of expression (" << expression_size << ") must be equal to size of this vector (" << this_size << ").\n";
 
-template <class T>
-void Vector<T>::scale_minimum_maximum(const T& minimum, const T& maximum)
-{
-    if(maximum - minimum < 1.0e-99)
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   T* this_data = this->data();
+
+   for(size_t i = 0; i < this_size; i++)
+   {
+      this_data[i] += expression_node[i];
+   }
+}
+
+
+// void operator -= (const VectorExpression<E>&)
+
+/// Difference and assignment operator with a lazy expression, which is evaluated while it is subtracted.
+/// @param expression Expression to be subtracted from this vector.
+
+template <class T>
+template <class E>
+void Vector<T>::operator -= (const VectorExpression<E>& expression)
+{
+   const E& expression_node = expression.derived();
+
+   const size_t this_size = this->size();
+
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   const size_t expression_size = expression_node.size();
+
+   if(expression_size != this_size)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Vector Template.\n"
+             << "void operator -= (const VectorExpression<E>&).\n"
+             << "Size of expression (" << expression_size << ") must be equal to size of this vector (" << this_size << ").\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   T* this_data = this->data();
+
+   for(size_t i = 0; i < this_size; i++)
+   {
+      this_data[i] -= expression_node[i];
+   }
+}
+
+
+// ExpressionTerminal<T> lazy(void) const method
+
+/// Returns a terminal for building lazy element-wise expressions with this vector.
+/// Arithmetic operators between terminals, and between terminals and scalars, do not compute anything.
+/// The whole expression is evaluated in a single loop when it is assigned to a vector or a matrix,
+/// as in <tt>parameters = parameters.lazy() + direction.lazy()*rate;</tt>.
+/// The vector must outlive the expressions which use it.
+
+template <class T>
+ExpressionTerminal<T> Vector<T>::lazy(void) const
+{
+   return(ExpressionTerminal<T>(this->data(), this->size(), 1));
+}
+
+
+// void filter_positive(void) method
+
+/// Sets all the negative elements in the vector to zero.
+
+template <class T>
+void Vector<T>::filter_positive(void)
+{
+    for(size_t i = 0; i < this->size(); i++)
+    {
+        if((*this)[i] < 0)
+        {
+            (*this)[i] = 0;
+        }
+    }
+}
+
+
+// void filter_negative(void) method
+
+/// Sets all the positive elements in the vector to zero.
+
+template <class T>
+void Vector<T>::filter_negative(void)
+{
+    for(size_t i = 0; i < this->size(); i++)
+    {
+        if((*this)[i] > 0)
+        {
+            (*this)[i] = 0;
+        }
+    }
+}
+
+// void scale_minimum_maximum(const T&, const T&) method
+
+/// Normalizes the elements of this vector using the minimum and maximum method.
+/// @param minimum Minimum value for the scaling.
+/// @param maximum Maximum value for the scaling.
+
+template <class T>
+void Vector<T>::scale_minimum_maximum(const T& minimum, const T& maximum)
+{
+    if(maximum - minimum < 1.0e-99)
     {
         return;
     }
@@ -6449,6 +6984,231 @@ std::ostream& operator << (std::ostream& os, const Statistics<T>& statistics)
 }
 
 
+///
+/// This template accumulates the statistics of a set in a single pass over its elements.
+/// It keeps the number of elements, the minimum, the maximum, the mean and the sum of squared deviations from the mean,
+/// which are updated with the Welford recurrences.
+/// Partial states accumulated over disjoint parts of a set can be merged, so that the parts can be processed in parallel.
+///
+
+template <class T>
+struct RunningStatistics
+{
+    // Default constructor.
+
+    RunningStatistics(void);
+
+    /// Destructor.
+
+    virtual ~RunningStatistics(void);
+
+    // METHODS
+
+    void update(const T&);
+
+    void update(const T*, const size_t&);
+
+    void merge(const RunningStatistics<T>&);
+
+    Statistics<T> calculate_statistics(void) const;
+
+    /// Number of elements accumulated.
+
+    size_t count;
+
+    /// Smallest element accumulated.
+
+    T minimum;
+
+    /// Biggest element accumulated.
+
+    T maximum;
+
+    /// Mean of the elements accumulated.
+
+    double mean;
+
+    /// Sum of the squared deviations of the elements accumulated from their mean.
+
+    double squared_deviations_sum;
+};
+
+
+/// Default constructor.
+/// It sets an empty state, in which the minimum and the maximum are the extreme values of the type.
+
+template <class T>
+RunningStatistics<T>::RunningStatistics(void)
+{
+    count = 0;
+
+    minimum = std::numeric_limits<T>::max();
+
+    if(std::numeric_limits<T>::is_signed)
+    {
+        maximum = -std::numeric_limits<T>::max();
+    }
+    else
+    {
+        maximum = 0;
+    }
+
+    mean = 0.0;
+    squared_deviations_sum = 0.0;
+}
+
+
+/// Destructor.
+
+template <class T>
+RunningStatistics<T>::~RunningStatistics(void)
+{
+}
+
+
+/// Adds an element to the state.
+/// @param value Element to be accumulated.
+
+template <class T>
+void RunningStatistics<T>::update(const T& value)
+{
+    count++;
+
+    if(value < minimum)
+    {
+        minimum = value;
+    }
+
+    if(value > maximum)
+    {
+        maximum = value;
+    }
+
+    const double delta = value - mean;
+
+    mean += delta/count;
+
+    squared_deviations_sum += delta*(value - mean);
+}
+
+
+/// Adds an array of elements to the state.
+/// The elements are taken in chunks small enough to stay in cache.
+/// The mean of each chunk is computed first, and then the squared deviations from it,
+/// so that there is no division for each element.
+/// The state of each chunk is then merged into this one.
+/// @param values Pointer to the first element.
+/// @param values_number Number of elements.
+
+template <class T>
+void RunningStatistics<T>::update(const T* values, const size_t& values_number)
+{
+    const size_t chunk_size = 256;
+
+    RunningStatistics<T> chunk_running_statistics;
+
+    for(size_t chunk_begin = 0; chunk_begin < values_number; chunk_begin += chunk_size)
+    {
+        const size_t chunk_end = std::min(chunk_begin + chunk_size, values_number);
+
+        T chunk_minimum = values[chunk_begin];
+        T chunk_maximum = values[chunk_begin];
+
+        double sum = 0.0;
+
+        for(size_t i = chunk_begin; i < chunk_end; i++)
+        {
+            chunk_minimum = values[i] < chunk_minimum ? values[i] : chunk_minimum;
+            chunk_maximum = values[i] > chunk_maximum ? values[i] : chunk_maximum;
+
+            sum += values[i];
+        }
+
+        const double chunk_mean = sum/(chunk_end - chunk_begin);
+
+        double squared_deviations = 0.0;
+
+        for(size_t i = chunk_begin; i < chunk_end; i++)
+        {
+            squared_deviations += (values[i] - chunk_mean)*(values[i] - chunk_mean);
+        }
+
+        chunk_running_statistics.count = chunk_end - chunk_begin;
+        chunk_running_statistics.minimum = chunk_minimum;
+        chunk_running_statistics.maximum = chunk_maximum;
+        chunk_running_statistics.mean = chunk_mean;
+        chunk_running_statistics.squared_deviations_sum = squared_deviations;
+
+        merge(chunk_running_statistics);
+    }
+}
+
+
+/// Adds to this state the elements accumulated in another state, as if they had been updated one by one.
+/// @param other_running_statistics State accumulated over elements different from those of this state.
+
+template <class T>
+void RunningStatistics<T>::merge(const RunningStatistics<T>& other_running_statistics)
+{
+    if(other_running_statistics.count == 0)
+    {
+        return;
+    }
+
+    if(count == 0)
+    {
+        *this = other_running_statistics;
+
+        return;
+    }
+
+    const double total_count = (double)(count + other_running_statistics.count);
+
+    const double delta = other_running_statistics.mean - mean;
+
+    mean += delta*other_running_statistics.count/total_count;
+
+    squared_deviations_sum += other_running_statistics.squared_deviations_sum + delta*delta*count*other_running_statistics.count/total_count;
+
+    count += other_running_statistics.count;
+
+    if(other_running_statistics.minimum < minimum)
+    {
+        minimum = other_running_statistics.minimum;
+    }
+
+    if(other_running_statistics.maximum > maximum)
+    {
+        maximum = other_running_statistics.maximum;
+    }
+}
+
+
+/// Returns the minimum, maximum, mean and standard deviation of the elements accumulated.
+/// The standard deviation is that of a sample, and it is zero when there are less than two elements.
+
+template <class T>
+Statistics<T> RunningStatistics<T>::calculate_statistics(void) const
+{
+    Statistics<T> statistics;
+
+    statistics.minimum = minimum;
+    statistics.maximum = maximum;
+    statistics.mean = (T)mean;
+
+    if(count <= 1)
+    {
+        statistics.standard_deviation = (T)0.0;
+    }
+    else
+    {
+        statistics.standard_deviation = (T)sqrt(squared_deviations_sum/(count - 1.0));
+    }
+
+    return(statistics);
+}
+
+
 ///
 /// This template contains the data needed to represent a histogram.
 ///
@@ -6748,6 +7508,894 @@ std::ostream& operator << (std::ostream& os, const LogisticRegressionParameters<
    return(os);
 }
 
+
+///
+/// This functor compares the indices of two elements of a vector by their values, in ascending order.
+/// Indices of equal elements are compared between themselves,
+/// so that sorting with it is deterministic and keeps the order of equal elements.
+///
+
+template <class T>
+struct IndexLess
+{
+    /// Values constructor.
+
+    explicit IndexLess(const Vector<T>& new_values) : values(new_values)
+    {
+    }
+
+    /// Returns true if the element with the first index goes before that with the second one.
+
+    bool operator () (const size_t& first_index, const size_t& second_index) const
+    {
+        if(values[first_index] < values[second_index])
+        {
+            return(true);
+        }
+        else if(values[second_index] < values[first_index])
+        {
+            return(false);
+        }
+        else
+        {
+            return(first_index < second_index);
+        }
+    }
+
+    /// Vector whose elements are compared.
+
+    const Vector<T>& values;
+};
+
+
+///
+/// This functor compares the indices of two elements of a vector by their values, in descending order.
+/// As with IndexLess, indices of equal elements keep their order.
+///
+
+template <class T>
+struct IndexGreater
+{
+    /// Values constructor.
+
+    explicit IndexGreater(const Vector<T>& new_values) : values(new_values)
+    {
+    }
+
+    /// Returns true if the element with the first index goes before that with the second one.
+
+    bool operator () (const size_t& first_index, const size_t& second_index) const
+    {
+        if(values[first_index] > values[second_index])
+        {
+            return(true);
+        }
+        else if(values[second_index] > values[first_index])
+        {
+            return(false);
+        }
+        else
+        {
+            return(first_index < second_index);
+        }
+    }
+
+    /// Vector whose elements are compared.
+
+    const Vector<T>& values;
+};
+
+
+///
+/// Base of the lazy element-wise expressions between vectors, matrices and scalars.
+/// The type of the expression which implements it is passed as template parameter,
+/// so that the operators are resolved at compile time and the evaluation loop is fully inlined.
+///
+
+template <class E>
+struct VectorExpression
+{
+    /// Returns this expression as the type which implements it.
+
+    inline const E& derived(void) const
+    {
+        return(static_cast<const E&>(*this));
+    }
+};
+
+
+///
+/// Leaf of a lazy expression. It refers to the contiguous elements of a vector or a matrix, without copying them.
+///
+
+template <class T>
+struct ExpressionTerminal : public VectorExpression< ExpressionTerminal<T> >
+{
+    /// Type of the elements.
+
+    typedef T value_type;
+
+    /// Data constructor.
+    /// @param new_data Pointer to the first element.
+    /// @param new_rows_number Number of rows, which is the size for a vector.
+    /// @param new_columns_number Number of columns, which is one for a vector.
+
+    ExpressionTerminal(const T* new_data, const size_t& new_rows_number, const size_t& new_columns_number)
+        : data(new_data), rows_number(new_rows_number), columns_number(new_columns_number)
+    {
+    }
+
+    /// Returns the number of elements.
+
+    inline size_t size(void) const
+    {
+        return(rows_number*columns_number);
+    }
+
+    /// Returns the number of rows.
+
+    inline size_t get_rows_number(void) const
+    {
+        return(rows_number);
+    }
+
+    /// Returns the number of columns.
+
+    inline size_t get_columns_number(void) const
+    {
+        return(columns_number);
+    }
+
+    /// Returns the element with the given index.
+
+    inline const T& operator [] (const size_t& i) const
+    {
+        return(data[i]);
+    }
+
+    /// Pointer to the elements.
+
+    const T* data;
+
+    /// Number of rows.
+
+    size_t rows_number;
+
+    /// Number of columns.
+
+    size_t columns_number;
+};
+
+
+///
+/// Node of a lazy expression which combines two expressions of the same dimensions element by element.
+/// The operation is a function object such as std::plus or std::multiplies.
+///
+
+template <class L, class R, class Operation>
+struct ExpressionBinary : public VectorExpression< ExpressionBinary<L, R, Operation> >
+{
+    /// Type of the elements.
+
+    typedef typename L::value_type value_type;
+
+    /// Operands constructor.
+    /// @param new_left Left operand.
+    /// @param new_right Right operand.
+
+    ExpressionBinary(const L& new_left, const R& new_right) : left(new_left), right(new_right)
+    {
+        // Control sentence (if debug)
+
+        #ifdef __OPENNN_DEBUG__
+
+        if(left.get_rows_number() != right.get_rows_number() || left.get_columns_number() != right.get_columns_number())
+        {
+           std::ostringstream buffer;
+
+           buffer << "OpenNN Exception: ExpressionBinary Template.\n"
+                  << "ExpressionBinary(const L&, const R&) constructor.\n"
+                  << "Dimensions of left operand (" << left.get_rows_number() << "," << left.get_columns_number() << ") "
+                  << "must be equal to dimensions of right operand (" << right.get_rows_number() << "," << right.get_columns_number() << ").\n";
+
+           throw std::logic_error(buffer.str());
+        }
+
+        #endif
+    }
+
+    /// Returns the number of elements.
+
+    inline size_t size(void) const
+    {
+        return(left.size());
+    }
+
+    /// Returns the number of rows.
+
+    inline size_t get_rows_number(void) const
+    {
+        return(left.get_rows_number());
+    }
+
+    /// Returns the number of columns.
+
+    inline size_t get_columns_number(void) const
+    {
+        return(left.get_columns_number());
+    }
+
+    /// Computes the element with the given index.
+
+    inline value_type operator [] (const size_t& i) const
+    {
+        return(Operation()(left[i], right[i]));
+    }
+
+    /// Left operand.
+
+    const L left;
+
+    /// Right operand.
+
+    const R right;
+};
+
+
+///
+/// Node of a lazy expression which combines each element of an expression with a scalar.
+/// The element is the first argument of the operation, and the scalar the second one.
+///
+
+template <class E, class Operation>
+struct ExpressionScalar : public VectorExpression< ExpressionScalar<E, Operation> >
+{
+    /// Type of the elements.
+
+    typedef typename E::value_type value_type;
+
+    /// Operands constructor.
+    /// @param new_expression Expression operand.
+    /// @param new_scalar Scalar operand.
+
+    ExpressionScalar(const E& new_expression, const value_type& new_scalar) : expression(new_expression), scalar(new_scalar)
+    {
+    }
+
+    /// Returns the number of elements.
+
+    inline size_t size(void) const
+    {
+        return(expression.size());
+    }
+
+    /// Returns the number of rows.
+
+    inline size_t get_rows_number(void) const
+    {
+        return(expression.get_rows_number());
+    }
+
+    /// Returns the number of columns.
+
+    inline size_t get_columns_number(void) const
+    {
+        return(expression.get_columns_number());
+    }
+
+    /// Computes the element with the given index.
+
+    inline value_type operator [] (const size_t& i) const
+    {
+        return(Operation()(expression[i], scalar));
+    }
+
+    /// Expression operand.
+
+    const E expression;
+
+    /// Scalar operand.
+
+    const value_type scalar;
+};
+
+
+// Lazy expression operators
+
+/// Element by element sum of two lazy expressions.
+
+template <class L, class R>
+inline ExpressionBinary< L, R, std::plus<typename L::value_type> > operator + (const VectorExpression<L>& left, const VectorExpression<R>& right)
+{
+    return(ExpressionBinary< L, R, std::plus<typename L::value_type> >(left.derived(), right.derived()));
+}
+
+
+/// Element by element difference of two lazy expressions.
+
+template <class L, class R>
+inline ExpressionBinary< L, R, std::minus<typename L::value_type> > operator - (const VectorExpression<L>& left, const VectorExpression<R>& right)
+{
+    return(ExpressionBinary< L, R, std::minus<typename L::value_type> >(left.derived(), right.derived()));
+}
+
+
+/// Element by element product of two lazy expressions.
+
+template <class L, class R>
+inline ExpressionBinary< L, R, std::multiplies<typename L::value_type> > operator * (const VectorExpression<L>& left, const VectorExpression<R>& right)
+{
+    return(ExpressionBinary< L, R, std::multiplies<typename L::value_type> >(left.derived(), right.derived()));
+}
+
+
+/// Element by element quotient of two lazy expressions.
+
+template <class L, class R>
+inline ExpressionBinary< L, R, std::divides<typename L::value_type> > operator / (const VectorExpression<L>& left, const VectorExpression<R>& right)
+{
+    return(ExpressionBinary< L, R, std::divides<typename L::value_type> >(left.derived(), right.derived()));
+}
+
+
+/// Sum of a lazy expression and a scalar.
+
+template <class E>
+inline ExpressionScalar< E, std::plus<typename E::value_type> > operator + (const VectorExpression<E>& expression, const typename E::value_type& scalar)
+{
+    return(ExpressionScalar< E, std::plus<typename E::value_type> >(expression.derived(), scalar));
+}
+
+
+/// Sum of a scalar and a lazy expression.
+
+template <class E>
+inline ExpressionScalar< E, std::plus<typename E::value_type> > operator + (const typename E::value_type& scalar, const VectorExpression<E>& expression)
+{
+    return(ExpressionScalar< E, std::plus<typename E::value_type> >(expression.derived(), scalar));
+}
+
+
+/// Difference of a lazy expression and a scalar.
+
+template <class E>
+inline ExpressionScalar< E, std::minus<typename E::value_type> > operator - (const VectorExpression<E>& expression, const typename E::value_type& scalar)
+{
+    return(ExpressionScalar< E, std::minus<typename E::value_type> >(expression.derived(), scalar));
+}
+
+
+/// Product of a lazy expression and a scalar.
+
+template <class E>
+inline ExpressionScalar< E, std::multiplies<typename E::value_type> > operator * (const VectorExpression<E>& expression, const typename E::value_type& scalar)
+{
+    return(ExpressionScalar< E, std::multiplies<typename E::value_type> >(expression.derived(), scalar));
+}
+
+
+/// Product of a scalar and a lazy expression.
+
+template <class E>
+inline ExpressionScalar< E, std::multiplies<typename E::value_type> > operator * (const typename E::value_type& scalar, const VectorExpression<E>& expression)
+{
+    return(ExpressionScalar< E, std::multiplies<typename E::value_type> >(expression.derived(), scalar));
+}
+
+
+/// Quotient of a lazy expression and a scalar.
+
+template <class E>
+inline ExpressionScalar< E, std::divides<typename E::value_type> > operator / (const VectorExpression<E>& expression, const typename E::value_type& scalar)
+{
+    return(ExpressionScalar< E, std::divides<typename E::value_type> >(expression.derived(), scalar));
+}
+
+
+///
+/// This template refers to a set of equally spaced elements of a vector or a matrix, such as a row, a column
+/// or a range of them, without copying or owning them.
+/// It is a lazy expression, so that it can be used in the element-wise arithmetic and assigned to vectors.
+/// The referred elements must outlive the view.
+///
+
+template <class T>
+class VectorView : public VectorExpression< VectorView<T> >
+{
+
+public:
+
+    /// Type of the elements.
+
+    typedef T value_type;
+
+    // DEFAULT CONSTRUCTOR
+
+    explicit VectorView(void);
+
+    // DATA CONSTRUCTOR
+
+    explicit VectorView(const T*, const size_t&, const size_t& = 1);
+
+    // VECTOR CONSTRUCTOR
+
+    VectorView(const Vector<T>&);
+
+    // GET METHODS
+
+    inline size_t size(void) const;
+
+    inline const T* get_data(void) const;
+
+    inline const size_t& get_stride(void) const;
+
+    inline bool is_contiguous(void) const;
+
+    inline size_t get_rows_number(void) const;
+
+    inline size_t get_columns_number(void) const;
+
+    inline const T& operator [] (const size_t&) const;
+
+    VectorView<T> view_subvector(const size_t&, const size_t&) const;
+
+    // MATHEMATICAL METHODS
+
+    T calculate_sum(void) const;
+
+    T calculate_partial_sum(const Vector<size_t>&) const;
+
+    T calculate_minimum(void) const;
+
+    T calculate_maximum(void) const;
+
+    size_t calculate_minimal_index(void) const;
+
+    size_t calculate_maximal_index(void) const;
+
+    double calculate_mean(void) const;
+
+    double calculate_norm(void) const;
+
+    Statistics<T> calculate_statistics(void) const;
+
+    double dot(const VectorView<double>&) const;
+
+private:
+
+    /// Pointer to the first element.
+
+    const T* data;
+
+    /// Number of elements.
+
+    size_t elements_number;
+
+    /// Distance between consecutive elements.
+
+    size_t stride;
+};
+
+
+// DEFAULT CONSTRUCTOR
+
+/// Default constructor. It creates a view with no elements.
+
+template <class T>
+VectorView<T>::VectorView(void) : data(NULL), elements_number(0), stride(1)
+{
+}
+
+
+// DATA CONSTRUCTOR
+
+/// Data constructor.
+/// @param new_data Pointer to the first element.
+/// @param new_elements_number Number of elements.
+/// @param new_stride Distance between consecutive elements, which is one for contiguous elements.
+
+template <class T>
+VectorView<T>::VectorView(const T* new_data, const size_t& new_elements_number, const size_t& new_stride)
+    : data(new_data), elements_number(new_elements_number), stride(new_stride)
+{
+}
+
+
+// VECTOR CONSTRUCTOR
+
+/// Vector constructor. It creates a view of all the elements of a vector,
+/// so that vectors can be passed wherever a view is expected.
+/// @param vector Vector to be referred.
+
+template <class T>
+VectorView<T>::VectorView(const Vector<T>& vector) : data(vector.data()), elements_number(vector.size()), stride(1)
+{
+}
+
+
+// size_t size(void) const method
+
+/// Returns the number of elements in the view.
+
+template <class T>
+inline size_t VectorView<T>::size(void) const
+{
+    return(elements_number);
+}
+
+
+// const T* get_data(void) const method
+
+/// Returns a pointer to the first element of the view in the underlying storage.
+
+template <class T>
+inline const T* VectorView<T>::get_data(void) const
+{
+    return(data);
+}
+
+
+// const size_t& get_stride(void) const method
+
+/// Returns the distance between consecutive elements in the underlying storage.
+
+template <class T>
+inline const size_t& VectorView<T>::get_stride(void) const
+{
+    return(stride);
+}
+
+
+// bool is_contiguous(void) const method
+
+/// Returns true if the elements are consecutive in the underlying storage, and false otherwise.
+
+template <class T>
+inline bool VectorView<T>::is_contiguous(void) const
+{
+    return(stride == 1);
+}
+
+
+// size_t get_rows_number(void) const method
+
+/// Returns the number of rows of the view as an expression, which is its size.
+
+template <class T>
+inline size_t VectorView<T>::get_rows_number(void) const
+{
+    return(elements_number);
+}
+
+
+// size_t get_columns_number(void) const method
+
+/// Returns the number of columns of the view as an expression, which is one.
+
+template <class T>
+inline size_t VectorView<T>::get_columns_number(void) const
+{
+    return(1);
+}
+
+
+// const T& operator [] (const size_t&) const method
+
+/// Returns the element with the given index in the view.
+/// @param i Index of element.
+
+template <class T>
+inline const T& VectorView<T>::operator [] (const size_t& i) const
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(i >= elements_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: VectorView Template.\n"
+             << "const T& operator [] (const size_t&) const method.\n"
+             << "Index (" << i << ") must be less than size (" << elements_number << ").\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+    return(data[i*stride]);
+}
+
+
+// VectorView<T> view_subvector(const size_t&, const size_t&) const method
+
+/// Returns a view of a range of consecutive elements of this view.
+/// @param first_index Index of the first element of the range.
+/// @param new_elements_number Number of elements in the range.
+
+template <class T>
+VectorView<T> VectorView<T>::view_subvector(const size_t& first_index, const size_t& new_elements_number) const
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(first_index + new_elements_number > elements_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: VectorView Template.\n"
+             << "VectorView<T> view_subvector(const size_t&, const size_t&) const method.\n"
+             << "Range end (" << first_index + new_elements_number << ") must be less or equal than size (" << elements_number << ").\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+    return(VectorView<T>(data + first_index*stride, new_elements_number, stride));
+}
+
+
+// T calculate_sum(void) const method
+
+/// Returns the sum of the elements in the view.
+
+template <class T>
+T VectorView<T>::calculate_sum(void) const
+{
+    T sum = 0;
+
+    for(size_t i = 0; i < elements_number; i++)
+    {
+        sum += data[i*stride];
+    }
+
+    return(sum);
+}
+
+
+// T calculate_partial_sum(const Vector<size_t>&) const method
+
+/// Returns the sum of the elements of the view with the given indices.
+/// As in the vector method, repeated indices are only counted once.
+/// @param indices Indices of the elements to be summed.
+
+template <class T>
+T VectorView<T>::calculate_partial_sum(const Vector<size_t>& indices) const
+{
+    const size_t indices_size = indices.size();
+
+    Vector<bool> summed(elements_number, false);
+
+    T sum = 0;
+
+    for(size_t i = 0; i < indices_size; i++)
+    {
+        const size_t index = indices[i];
+
+        if(index < elements_number && !summed[index])
+        {
+            summed[index] = true;
+
+            sum += data[index*stride];
+        }
+    }
+
+    return(sum);
+}
+
+
+// T calculate_minimum(void) const method
+
+/// Returns the smallest element in the view.
+
+template <class T>
+T VectorView<T>::calculate_minimum(void) const
+{
+    return((*this)[calculate_minimal_index()]);
+}
+
+
+// T calculate_maximum(void) const method
+
+/// Returns the largest element in the view.
+
+template <class T>
+T VectorView<T>::calculate_maximum(void) const
+{
+    return((*this)[calculate_maximal_index()]);
+}
+
+
+// size_t calculate_minimal_index(void) const method
+
+/// Returns the index of the smallest element in the view.
+/// If it is repeated, the first index is returned.
+
+template <class T>
+size_t VectorView<T>::calculate_minimal_index(void) const
+{
+    T minimum = data[0];
+    size_t minimal_index = 0;
+
+    for(size_t i = 1; i < elements_number; i++)
+    {
+        if(data[i*stride] < minimum)
+        {
+            minimum = data[i*stride];
+            minimal_index = i;
+        }
+    }
+
+    return(minimal_index);
+}
+
+
+// size_t calculate_maximal_index(void) const method
+
+/// Returns the index of the largest element in the view.
+/// If it is repeated, the first index is returned.
+
+template <class T>
+size_t VectorView<T>::calculate_maximal_index(void) const
+{
+    T maximum = data[0];
+    size_t maximal_index = 0;
+
+    for(size_t i = 1; i < elements_number; i++)
+    {
+        if(data[i*stride] > maximum)
+        {
+            maximum = data[i*stride];
+            maximal_index = i;
+        }
+    }
+
+    return(maximal_index);
+}
+
+
+// double calculate_mean(void) const method
+
+/// Returns the mean of the elements in the view.
+
+template <class T>
+double VectorView<T>::calculate_mean(void) const
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(elements_number == 0)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: VectorView Template.\n"
+             << "double calculate_mean(void) const method.\n"
+             << "Size must be greater than zero.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+    return(calculate_sum()/(double)elements_number);
+}
+
+
+// double calculate_norm(void) const method
+
+/// Returns the Euclidean norm of the elements in the view.
+
+template <class T>
+double VectorView<T>::calculate_norm(void) const
+{
+    double norm = 0.0;
+
+    for(size_t i = 0; i < elements_number; i++)
+    {
+        norm += data[i*stride]*data[i*stride];
+    }
+
+    return(sqrt(norm));
+}
+
+
+// Statistics<T> calculate_statistics(void) const method
+
+/// Returns the minimum, maximum, mean and standard deviation of the elements in the view.
+/// Contiguous elements are accumulated by chunks, as in the vector method.
+
+template <class T>
+Statistics<T> VectorView<T>::calculate_statistics(void) const
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(elements_number == 0)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: VectorView Template.\n"
+             << "Statistics<T> calculate_statistics(void) const method.\n"
+             << "Size must be greater than zero.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+    RunningStatistics<T> running_statistics;
+
+    if(is_contiguous())
+    {
+        running_statistics.update(data, elements_number);
+    }
+    else
+    {
+        for(size_t i = 0; i < elements_number; i++)
+        {
+            running_statistics.update(data[i*stride]);
+        }
+    }
+
+    return(running_statistics.calculate_statistics());
+}
+
+
+// double dot(const VectorView<double>&) const method
+
+/// Returns the dot product of the elements of this view and those of another one.
+/// @param other_view View of the same size.
+
+template <class T>
+double VectorView<T>::dot(const VectorView<double>& other_view) const
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(other_view.size() != elements_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: VectorView Template.\n"
+             << "double dot(const VectorView<double>&) const method.\n"
+             << "Size of other view (" << other_view.size() << ") must be equal to size of this view (" << elements_number << ").\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+    double dot_product = 0.0;
+
+    for(size_t i = 0; i < elements_number; i++)
+    {
+        dot_product += data[i*stride]*other_view[i];
+    }
+
+    return(dot_product);
+}
+
+
+// Vector methods which need the complete VectorView class template
+
+// double dot(const VectorView<double>&) const method
+
+/// Dot product of this vector with the elements referred by a view, such as a row or a column of a matrix.
+/// The elements of the view are not copied.
+/// @param other_view View of the elements to be multiplied.
+
+template <class T>
+double Vector<T>::dot(const VectorView<double>& other_view) const
+{
+   return(other_view.dot(VectorView<double>(*this)));
+}
+
 }// end namespace OpenNN
 
 #endif
@@ -0,0 +1,240 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.artelnics.com/opennn                                                                                   */
+/*                                                                                                              */
+/*   V E C T O R   B L O C K   K E R N E L S   H E A D E R                                                      */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   Artelnics - Making intelligent use of data                                                                 */
+/*   robertolopez@artelnics.com                                                                                 */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// This header has no include guard on purpose.
+// vector_kernels.h includes it once inside the namespace of each instruction set, after defining the packet
+// operations of that instruction set and the __OPENNN_KERNEL_TARGET__ attribute which allows the compiler to use it.
+
+// PacketDouble packet_power(PacketDouble, size_t) function
+
+/// Raises every element of a packet to a positive integer exponent by repeated squaring,
+/// which is much cheaper than calling pow for each element.
+/// @param base Packet to be raised.
+/// @param exponent Integer exponent, greater than zero.
+
+__OPENNN_KERNEL_TARGET__ inline PacketDouble packet_power(PacketDouble base, size_t exponent)
+{
+   PacketDouble power = packet_set(1.0);
+
+   while(exponent > 0)
+   {
+      if(exponent & 1)
+      {
+         power = packet_multiply(power, base);
+      }
+
+      base = packet_multiply(base, base);
+
+      exponent >>= 1;
+   }
+
+   return(power);
+}
+
+
+// BLOCK KERNELS
+
+// The block kernels keep four independent accumulators, so that consecutive additions do not wait for each other.
+
+// double calculate_block_sum(const double*, const size_t&) function
+
+/// Returns the sum of a block of doubles.
+/// @param data Pointer to the first element.
+/// @param size Number of elements.
+
+__OPENNN_KERNEL_TARGET__ inline double calculate_block_sum(const double* data, const size_t& size)
+{
+   PacketDouble sum_0 = packet_set(0.0);
+   PacketDouble sum_1 = packet_set(0.0);
+   PacketDouble sum_2 = packet_set(0.0);
+   PacketDouble sum_3 = packet_set(0.0);
+
+   size_t i = 0;
+
+   for(; i + 4*packet_size <= size; i += 4*packet_size)
+   {
+      sum_0 = packet_add(sum_0, packet_load(data + i));
+      sum_1 = packet_add(sum_1, packet_load(data + i + packet_size));
+      sum_2 = packet_add(sum_2, packet_load(data + i + 2*packet_size));
+      sum_3 = packet_add(sum_3, packet_load(data + i + 3*packet_size));
+   }
+
+   for(; i + packet_size <= size; i += packet_size)
+   {
+      sum_0 = packet_add(sum_0, packet_load(data + i));
+   }
+
+   double sum = packet_sum(packet_add(packet_add(sum_0, sum_1), packet_add(sum_2, sum_3)));
+
+   for(; i < size; i++)
+   {
+      sum += data[i];
+   }
+
+   return(sum);
+}
+
+
+// double calculate_block_dot(const double*, const double*, const size_t&) function
+
+/// Returns the dot product of two blocks of doubles.
+/// @param a Pointer to the first element of the first block.
+/// @param b Pointer to the first element of the second block.
+/// @param size Number of elements of each block.
+
+__OPENNN_KERNEL_TARGET__ inline double calculate_block_dot(const double* a, const double* b, const size_t& size)
+{
+   PacketDouble sum_0 = packet_set(0.0);
+   PacketDouble sum_1 = packet_set(0.0);
+   PacketDouble sum_2 = packet_set(0.0);
+   PacketDouble sum_3 = packet_set(0.0);
+
+   size_t i = 0;
+
+   for(; i + 4*packet_size <= size; i += 4*packet_size)
+   {
+      sum_0 = packet_multiply_add(packet_load(a + i), packet_load(b + i), sum_0);
+      sum_1 = packet_multiply_add(packet_load(a + i + packet_size), packet_load(b + i + packet_size), sum_1);
+      sum_2 = packet_multiply_add(packet_load(a + i + 2*packet_size), packet_load(b + i + 2*packet_size), sum_2);
+      sum_3 = packet_multiply_add(packet_load(a + i + 3*packet_size), packet_load(b + i + 3*packet_size), sum_3);
+   }
+
+   for(; i + packet_size <= size; i += packet_size)
+   {
+      sum_0 = packet_multiply_add(packet_load(a + i), packet_load(b + i), sum_0);
+   }
+
+   double sum = packet_sum(packet_add(packet_add(sum_0, sum_1), packet_add(sum_2, sum_3)));
+
+   for(; i < size; i++)
+   {
+      sum += a[i]*b[i];
+   }
+
+   return(sum);
+}
+
+
+// double calculate_block_squared_distance(const double*, const double*, const size_t&) function
+
+/// Returns the sum of the squared differences between two blocks of doubles.
+/// @param a Pointer to the first element of the first block.
+/// @param b Pointer to the first element of the second block.
+/// @param size Number of elements of each block.
+
+__OPENNN_KERNEL_TARGET__ inline double calculate_block_squared_distance(const double* a, const double* b, const size_t& size)
+{
+   PacketDouble sum_0 = packet_set(0.0);
+   PacketDouble sum_1 = packet_set(0.0);
+   PacketDouble sum_2 = packet_set(0.0);
+   PacketDouble sum_3 = packet_set(0.0);
+
+   PacketDouble difference_0;
+   PacketDouble difference_1;
+   PacketDouble difference_2;
+   PacketDouble difference_3;
+
+   size_t i = 0;
+
+   for(; i + 4*packet_size <= size; i += 4*packet_size)
+   {
+      difference_0 = packet_subtract(packet_load(a + i), packet_load(b + i));
+      difference_1 = packet_subtract(packet_load(a + i + packet_size), packet_load(b + i + packet_size));
+      difference_2 = packet_subtract(packet_load(a + i + 2*packet_size), packet_load(b + i + 2*packet_size));
+      difference_3 = packet_subtract(packet_load(a + i + 3*packet_size), packet_load(b + i + 3*packet_size));
+
+      sum_0 = packet_multiply_add(difference_0, difference_0, sum_0);
+      sum_1 = packet_multiply_add(difference_1, difference_1, sum_1);
+      sum_2 = packet_multiply_add(difference_2, difference_2, sum_2);
+      sum_3 = packet_multiply_add(difference_3, difference_3, sum_3);
+   }
+
+   for(; i + packet_size <= size; i += packet_size)
+   {
+      difference_0 = packet_subtract(packet_load(a + i), packet_load(b + i));
+
+      sum_0 = packet_multiply_add(difference_0, difference_0, sum_0);
+   }
+
+   double sum = packet_sum(packet_add(packet_add(sum_0, sum_1), packet_add(sum_2, sum_3)));
+
+   double difference;
+
+   for(; i < size; i++)
+   {
+      difference = a[i] - b[i];
+
+      sum += difference*difference;
+   }
+
+   return(sum);
+}
+
+
+// double calculate_block_Minkowski_distance(const double*, const double*, const size_t&, const size_t&) function
+
+/// Returns the sum of the absolute differences between two blocks of doubles raised to an integer exponent.
+/// @param a Pointer to the first element of the first block.
+/// @param b Pointer to the first element of the second block.
+/// @param size Number of elements of each block.
+/// @param exponent Integer Minkowski exponent, greater than zero.
+
+__OPENNN_KERNEL_TARGET__ inline double calculate_block_Minkowski_distance(const double* a, const double* b, const size_t& size, const size_t& exponent)
+{
+   PacketDouble sum_0 = packet_set(0.0);
+   PacketDouble sum_1 = packet_set(0.0);
+   PacketDouble sum_2 = packet_set(0.0);
+   PacketDouble sum_3 = packet_set(0.0);
+
+   size_t i = 0;
+
+   for(; i + 4*packet_size <= size; i += 4*packet_size)
+   {
+      sum_0 = packet_add(sum_0, packet_power(packet_absolute_value(packet_subtract(packet_load(a + i), packet_load(b + i))), exponent));
+      sum_1 = packet_add(sum_1, packet_power(packet_absolute_value(packet_subtract(packet_load(a + i + packet_size), packet_load(b + i + packet_size))), exponent));
+      sum_2 = packet_add(sum_2, packet_power(packet_absolute_value(packet_subtract(packet_load(a + i + 2*packet_size), packet_load(b + i + 2*packet_size))), exponent));
+      sum_3 = packet_add(sum_3, packet_power(packet_absolute_value(packet_subtract(packet_load(a + i + 3*packet_size), packet_load(b + i + 3*packet_size))), exponent));
+   }
+
+   for(; i + packet_size <= size; i += packet_size)
+   {
+      sum_0 = packet_add(sum_0, packet_power(packet_absolute_value(packet_subtract(packet_load(a + i), packet_load(b + i))), exponent));
+   }
+
+   double sum = packet_sum(packet_add(packet_add(sum_0, sum_1), packet_add(sum_2, sum_3)));
+
+   for(; i < size; i++)
+   {
+      sum += calculate_integer_power(fabs(a[i] - b[i]), exponent);
+   }
+
+   return(sum);
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (c) 2005-2015 Roberto Lopez.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
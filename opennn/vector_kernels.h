@@ -0,0 +1,796 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.artelnics.com/opennn                                                                                   */
+/*                                                                                                              */
+/*   V E C T O R   K E R N E L S   H E A D E R                                                                  */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   Artelnics - Making intelligent use of data                                                                 */
+/*   robertolopez@artelnics.com                                                                                 */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __VECTORKERNELS_H__
+#define __VECTORKERNELS_H__
+
+// System includes
+
+#include <cmath>
+#include <cstdlib>
+#include <numeric>
+#include <vector>
+
+// Instruction set of the vectorized kernels, chosen at compile time from the flags of the compiler
+// (for instance -mavx2 -mfma or -march=native).
+
+#if defined(__AVX512F__)
+   #define __OPENNN_AVX512__
+#elif defined(__AVX__)
+   #define __OPENNN_AVX__
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+   #define __OPENNN_SSE2__
+#endif
+
+// Unless the compiler flags already select AVX, GCC and Clang builds for x86 also compile the kernels for AVX with FMA
+// and for AVX-512, and choose among them at run time from the instruction sets supported by the processor.
+// Defining __OPENNN_NO_RUNTIME_DISPATCH__ restricts the kernels to the instruction set selected by the compiler flags.
+
+#if !defined(__OPENNN_NO_RUNTIME_DISPATCH__) && !defined(__AVX__) && (defined(__x86_64__) || defined(__i386__)) \
+ && (defined(__clang__) || (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))))
+   #define __OPENNN_RUNTIME_DISPATCH__
+#endif
+
+#if defined(__OPENNN_AVX512__) || defined(__OPENNN_AVX__) || defined(__OPENNN_RUNTIME_DISPATCH__)
+   #include <immintrin.h>
+#elif defined(__OPENNN_SSE2__)
+   #include <emmintrin.h>
+#endif
+
+namespace OpenNN
+{
+
+// double calculate_integer_power(double, size_t) function
+
+/// Raises a number to a positive integer exponent by repeated squaring.
+/// @param base Number to be raised.
+/// @param exponent Integer exponent, greater than zero.
+
+inline double calculate_integer_power(double base, size_t exponent)
+{
+   double power = 1.0;
+
+   while(exponent > 0)
+   {
+      if(exponent & 1)
+      {
+         power *= base;
+      }
+
+      base *= base;
+
+      exponent >>= 1;
+   }
+
+   return(power);
+}
+
+
+// PACKET OPERATIONS
+
+// A packet holds as many doubles as fit in a register of an instruction set.
+// The block kernels in vector_block_kernels.h are written in terms of these operations,
+// and they are compiled once in the namespace of each instruction set in use.
+// Without any instruction set the packet is a single double.
+
+#if defined(__OPENNN_AVX512__) || defined(__OPENNN_RUNTIME_DISPATCH__)
+
+namespace avx512_kernels
+{
+
+#ifdef __OPENNN_RUNTIME_DISPATCH__
+   #define __OPENNN_KERNEL_TARGET__ __attribute__((target("avx512f")))
+#else
+   #define __OPENNN_KERNEL_TARGET__
+#endif
+
+typedef __m512d PacketDouble;
+
+const size_t packet_size = 8;
+
+__OPENNN_KERNEL_TARGET__ inline PacketDouble packet_set(const double& value) { return(_mm512_set1_pd(value)); }
+__OPENNN_KERNEL_TARGET__ inline PacketDouble packet_load(const double* data) { return(_mm512_loadu_pd(data)); }
+__OPENNN_KERNEL_TARGET__ inline PacketDouble packet_add(const PacketDouble& a, const PacketDouble& b) { return(_mm512_add_pd(a, b)); }
+__OPENNN_KERNEL_TARGET__ inline PacketDouble packet_subtract(const PacketDouble& a, const PacketDouble& b) { return(_mm512_sub_pd(a, b)); }
+__OPENNN_KERNEL_TARGET__ inline PacketDouble packet_multiply(const PacketDouble& a, const PacketDouble& b) { return(_mm512_mul_pd(a, b)); }
+__OPENNN_KERNEL_TARGET__ inline PacketDouble packet_multiply_add(const PacketDouble& a, const PacketDouble& b, const PacketDouble& c) { return(_mm512_fmadd_pd(a, b, c)); }
+
+__OPENNN_KERNEL_TARGET__ inline PacketDouble packet_absolute_value(const PacketDouble& a)
+{
+   return(_mm512_castsi512_pd(_mm512_and_si512(_mm512_castpd_si512(a), _mm512_set1_epi64(0x7FFFFFFFFFFFFFFFLL))));
+}
+
+__OPENNN_KERNEL_TARGET__ inline double packet_sum(const PacketDouble& a)
+{
+   double values[8];
+
+   _mm512_storeu_pd(values, a);
+
+   return(((values[0] + values[4]) + (values[1] + values[5])) + ((values[2] + values[6]) + (values[3] + values[7])));
+}
+
+#include "vector_block_kernels.h"
+
+#undef __OPENNN_KERNEL_TARGET__
+
+}
+
+#endif
+
+#if defined(__OPENNN_AVX__) || defined(__OPENNN_RUNTIME_DISPATCH__)
+
+namespace avx_kernels
+{
+
+#ifdef __OPENNN_RUNTIME_DISPATCH__
+   #define __OPENNN_KERNEL_TARGET__ __attribute__((target("avx,fma")))
+#else
+   #define __OPENNN_KERNEL_TARGET__
+#endif
+
+typedef __m256d PacketDouble;
+
+const size_t packet_size = 4;
+
+__OPENNN_KERNEL_TARGET__ inline PacketDouble packet_set(const double& value) { return(_mm256_set1_pd(value)); }
+__OPENNN_KERNEL_TARGET__ inline PacketDouble packet_load(const double* data) { return(_mm256_loadu_pd(data)); }
+__OPENNN_KERNEL_TARGET__ inline PacketDouble packet_add(const PacketDouble& a, const PacketDouble& b) { return(_mm256_add_pd(a, b)); }
+__OPENNN_KERNEL_TARGET__ inline PacketDouble packet_subtract(const PacketDouble& a, const PacketDouble& b) { return(_mm256_sub_pd(a, b)); }
+__OPENNN_KERNEL_TARGET__ inline PacketDouble packet_multiply(const PacketDouble& a, const PacketDouble& b) { return(_mm256_mul_pd(a, b)); }
+
+#if defined(__FMA__) || defined(__OPENNN_RUNTIME_DISPATCH__)
+__OPENNN_KERNEL_TARGET__ inline PacketDouble packet_multiply_add(const PacketDouble& a, const PacketDouble& b, const PacketDouble& c) { return(_mm256_fmadd_pd(a, b, c)); }
+#else
+__OPENNN_KERNEL_TARGET__ inline PacketDouble packet_multiply_add(const PacketDouble& a, const PacketDouble& b, const PacketDouble& c) { return(_mm256_add_pd(_mm256_mul_pd(a, b), c)); }
+#endif
+
+__OPENNN_KERNEL_TARGET__ inline PacketDouble packet_absolute_value(const PacketDouble& a) { return(_mm256_andnot_pd(_mm256_set1_pd(-0.0), a)); }
+
+__OPENNN_KERNEL_TARGET__ inline double packet_sum(const PacketDouble& a)
+{
+   const __m128d half = _mm_add_pd(_mm256_castpd256_pd128(a), _mm256_extractf128_pd(a, 1));
+
+   return(_mm_cvtsd_f64(_mm_add_sd(half, _mm_unpackhi_pd(half, half))));
+}
+
+#include "vector_block_kernels.h"
+
+#undef __OPENNN_KERNEL_TARGET__
+
+}
+
+#endif
+
+#if defined(__OPENNN_SSE2__)
+
+namespace sse2_kernels
+{
+
+#define __OPENNN_KERNEL_TARGET__
+
+typedef __m128d PacketDouble;
+
+const size_t packet_size = 2;
+
+inline PacketDouble packet_set(const double& value) { return(_mm_set1_pd(value)); }
+inline PacketDouble packet_load(const double* data) { return(_mm_loadu_pd(data)); }
+inline PacketDouble packet_add(const PacketDouble& a, const PacketDouble& b) { return(_mm_add_pd(a, b)); }
+inline PacketDouble packet_subtract(const PacketDouble& a, const PacketDouble& b) { return(_mm_sub_pd(a, b)); }
+inline PacketDouble packet_multiply(const PacketDouble& a, const PacketDouble& b) { return(_mm_mul_pd(a, b)); }
+inline PacketDouble packet_multiply_add(const PacketDouble& a, const PacketDouble& b, const PacketDouble& c) { return(_mm_add_pd(_mm_mul_pd(a, b), c)); }
+inline PacketDouble packet_absolute_value(const PacketDouble& a) { return(_mm_andnot_pd(_mm_set1_pd(-0.0), a)); }
+inline double packet_sum(const PacketDouble& a) { return(_mm_cvtsd_f64(_mm_add_sd(a, _mm_unpackhi_pd(a, a)))); }
+
+#include "vector_block_kernels.h"
+
+#undef __OPENNN_KERNEL_TARGET__
+
+}
+
+#elif !defined(__OPENNN_AVX512__) && !defined(__OPENNN_AVX__)
+
+namespace scalar_kernels
+{
+
+#define __OPENNN_KERNEL_TARGET__
+
+typedef double PacketDouble;
+
+const size_t packet_size = 1;
+
+inline PacketDouble packet_set(const double& value) { return(value); }
+inline PacketDouble packet_load(const double* data) { return(*data); }
+inline PacketDouble packet_add(const PacketDouble& a, const PacketDouble& b) { return(a + b); }
+inline PacketDouble packet_subtract(const PacketDouble& a, const PacketDouble& b) { return(a - b); }
+inline PacketDouble packet_multiply(const PacketDouble& a, const PacketDouble& b) { return(a*b); }
+inline PacketDouble packet_multiply_add(const PacketDouble& a, const PacketDouble& b, const PacketDouble& c) { return(a*b + c); }
+inline PacketDouble packet_absolute_value(const PacketDouble& a) { return(fabs(a)); }
+inline double packet_sum(const PacketDouble& a) { return(a); }
+
+#include "vector_block_kernels.h"
+
+#undef __OPENNN_KERNEL_TARGET__
+
+}
+
+#endif
+
+// Kernels for the instruction set selected at compile time
+
+#if defined(__OPENNN_AVX512__)
+namespace baseline_kernels = avx512_kernels;
+#elif defined(__OPENNN_AVX__)
+namespace baseline_kernels = avx_kernels;
+#elif defined(__OPENNN_SSE2__)
+namespace baseline_kernels = sse2_kernels;
+#else
+namespace baseline_kernels = scalar_kernels;
+#endif
+
+
+// INSTRUCTION SET DISPATCH
+
+/// Enumeration of the instruction sets for which the block kernels are compiled.
+/// The baseline is the instruction set selected by the compiler flags.
+
+enum KernelsInstructionSet{BaselineKernels, AVXKernels, AVX512Kernels};
+
+
+// KernelsInstructionSet get_kernels_instruction_set(void) function
+
+/// Returns the best instruction set supported by both the build and the processor.
+/// The processor is queried only the first time.
+
+inline KernelsInstructionSet get_kernels_instruction_set(void)
+{
+#ifdef __OPENNN_RUNTIME_DISPATCH__
+
+   struct Detection
+   {
+      static KernelsInstructionSet detect(void)
+      {
+         __builtin_cpu_init();
+
+         if(__builtin_cpu_supports("avx512f"))
+         {
+            return(AVX512Kernels);
+         }
+         else if(__builtin_cpu_supports("avx") && __builtin_cpu_supports("fma"))
+         {
+            return(AVXKernels);
+         }
+
+         return(BaselineKernels);
+      }
+   };
+
+   static const KernelsInstructionSet kernels_instruction_set = Detection::detect();
+
+   return(kernels_instruction_set);
+
+#else
+
+   return(BaselineKernels);
+
+#endif
+}
+
+
+// double calculate_block_sum(const double*, const size_t&) function
+
+/// Returns the sum of a block of doubles, with the best instruction set available.
+/// @param data Pointer to the first element.
+/// @param size Number of elements.
+
+inline double calculate_block_sum(const double* data, const size_t& size)
+{
+#ifdef __OPENNN_RUNTIME_DISPATCH__
+
+   switch(get_kernels_instruction_set())
+   {
+      case AVX512Kernels: return(avx512_kernels::calculate_block_sum(data, size));
+      case AVXKernels: return(avx_kernels::calculate_block_sum(data, size));
+      default: break;
+   }
+
+#endif
+
+   return(baseline_kernels::calculate_block_sum(data, size));
+}
+
+
+// double calculate_block_dot(const double*, const double*, const size_t&) function
+
+/// Returns the dot product of two blocks of doubles, with the best instruction set available.
+/// @param a Pointer to the first element of the first block.
+/// @param b Pointer to the first element of the second block.
+/// @param size Number of elements of each block.
+
+inline double calculate_block_dot(const double* a, const double* b, const size_t& size)
+{
+#ifdef __OPENNN_RUNTIME_DISPATCH__
+
+   switch(get_kernels_instruction_set())
+   {
+      case AVX512Kernels: return(avx512_kernels::calculate_block_dot(a, b, size));
+      case AVXKernels: return(avx_kernels::calculate_block_dot(a, b, size));
+      default: break;
+   }
+
+#endif
+
+   return(baseline_kernels::calculate_block_dot(a, b, size));
+}
+
+
+// double calculate_block_squared_distance(const double*, const double*, const size_t&) function
+
+/// Returns the sum of the squared differences between two blocks of doubles, with the best instruction set available.
+/// @param a Pointer to the first element of the first block.
+/// @param b Pointer to the first element of the second block.
+/// @param size Number of elements of each block.
+
+inline double calculate_block_squared_distance(const double* a, const double* b, const size_t& size)
+{
+#ifdef __OPENNN_RUNTIME_DISPATCH__
+
+   switch(get_kernels_instruction_set())
+   {
+      case AVX512Kernels: return(avx512_kernels::calculate_block_squared_distance(a, b, size));
+      case AVXKernels: return(avx_kernels::calculate_block_squared_distance(a, b, size));
+      default: break;
+   }
+
+#endif
+
+   return(baseline_kernels::calculate_block_squared_distance(a, b, size));
+}
+
+
+// double calculate_block_Minkowski_distance(const double*, const double*, const size_t&, const size_t&) function
+
+/// Returns the sum of the absolute differences between two blocks of doubles raised to an integer exponent,
+/// with the best instruction set available.
+/// @param a Pointer to the first element of the first block.
+/// @param b Pointer to the first element of the second block.
+/// @param size Number of elements of each block.
+/// @param exponent Integer Minkowski exponent, greater than zero.
+
+inline double calculate_block_Minkowski_distance(const double* a, const double* b, const size_t& size, const size_t& exponent)
+{
+#ifdef __OPENNN_RUNTIME_DISPATCH__
+
+   switch(get_kernels_instruction_set())
+   {
+      case AVX512Kernels: return(avx512_kernels::calculate_block_Minkowski_distance(a, b, size, exponent));
+      case AVXKernels: return(avx_kernels::calculate_block_Minkowski_distance(a, b, size, exponent));
+      default: break;
+   }
+
+#endif
+
+   return(baseline_kernels::calculate_block_Minkowski_distance(a, b, size, exponent));
+}
+
+
+// PARALLEL REDUCTION
+
+/// Number of elements from which the kernels split the reduction among the threads.
+/// Below this size the cost of starting the threads is larger than the savings.
+
+const size_t parallel_reduction_size = 1048576;
+
+/// Number of elements of each of the blocks in which the parallel reductions are split.
+
+const size_t reduction_block_size = 65536;
+
+
+/// This structure computes the sum of a block of a vector, for the parallel reductions.
+
+struct SumBlock
+{
+   /// Pointer to the first element of the vector.
+
+   const double* data;
+
+   double operator()(const size_t& begin, const size_t& size) const
+   {
+      return(calculate_block_sum(data + begin, size));
+   }
+};
+
+
+/// This structure computes the dot product of a block of two vectors, for the parallel reductions.
+
+struct DotBlock
+{
+   /// Pointer to the first element of the first vector.
+
+   const double* a;
+
+   /// Pointer to the first element of the second vector.
+
+   const double* b;
+
+   double operator()(const size_t& begin, const size_t& size) const
+   {
+      return(calculate_block_dot(a + begin, b + begin, size));
+   }
+};
+
+
+/// This structure computes the squared distance of a block of two vectors, for the parallel reductions.
+
+struct SquaredDistanceBlock
+{
+   /// Pointer to the first element of the first vector.
+
+   const double* a;
+
+   /// Pointer to the first element of the second vector.
+
+   const double* b;
+
+   double operator()(const size_t& begin, const size_t& size) const
+   {
+      return(calculate_block_squared_distance(a + begin, b + begin, size));
+   }
+};
+
+
+/// This structure computes the integer Minkowski distance of a block of two vectors, for the parallel reductions.
+
+struct MinkowskiDistanceBlock
+{
+   /// Pointer to the first element of the first vector.
+
+   const double* a;
+
+   /// Pointer to the first element of the second vector.
+
+   const double* b;
+
+   /// Integer Minkowski exponent.
+
+   size_t exponent;
+
+   double operator()(const size_t& begin, const size_t& size) const
+   {
+      return(calculate_block_Minkowski_distance(a + begin, b + begin, size, exponent));
+   }
+};
+
+
+// double calculate_parallel_reduction(const Block&, const size_t&) function
+
+/// Adds the results of a block kernel over consecutive blocks of a vector.
+/// Large vectors are split among the threads, and the partial results are added always in the same order,
+/// so that the result does not depend on the number of threads.
+/// @param block Block kernel, called with the position and the size of each block.
+/// @param size Number of elements of the vector.
+
+template <class Block>
+double calculate_parallel_reduction(const Block& block, const size_t& size)
+{
+   if(size < parallel_reduction_size)
+   {
+      return(block(0, size));
+   }
+
+   const size_t blocks_number = (size + reduction_block_size - 1)/reduction_block_size;
+
+   std::vector<double> partial_results(blocks_number);
+
+   int i;
+
+   #pragma omp parallel for private(i)
+
+   for(i = 0; i < (int)blocks_number; i++)
+   {
+      const size_t begin = i*reduction_block_size;
+
+      partial_results[i] = block(begin, begin + reduction_block_size < size ? reduction_block_size : size - begin);
+   }
+
+   return(std::accumulate(partial_results.begin(), partial_results.end(), 0.0));
+}
+
+
+// KERNELS
+
+// The Vector and Matrix templates call the kernels below with the pointers to their elements.
+// The overloads for doubles are vectorized, while the templates serve the rest of types.
+
+// T calculate_sum_kernel(const T*, const size_t&) function
+
+/// Returns the sum of the elements of an array.
+/// @param data Pointer to the first element.
+/// @param size Number of elements.
+
+template <class T>
+T calculate_sum_kernel(const T* data, const size_t& size)
+{
+   T sum_0 = 0;
+   T sum_1 = 0;
+   T sum_2 = 0;
+   T sum_3 = 0;
+
+   size_t i = 0;
+
+   for(; i + 4 <= size; i += 4)
+   {
+      sum_0 += data[i];
+      sum_1 += data[i+1];
+      sum_2 += data[i+2];
+      sum_3 += data[i+3];
+   }
+
+   for(; i < size; i++)
+   {
+      sum_0 += data[i];
+   }
+
+   return((sum_0 + sum_1) + (sum_2 + sum_3));
+}
+
+
+inline double calculate_sum_kernel(const double* data, const size_t& size)
+{
+   const SumBlock block = {data};
+
+   return(calculate_parallel_reduction(block, size));
+}
+
+
+// double calculate_dot_kernel(const T*, const double*, const size_t&) function
+
+/// Returns the dot product of two arrays.
+/// @param a Pointer to the first element of the first array.
+/// @param b Pointer to the first element of the second array.
+/// @param size Number of elements of each array.
+
+template <class T>
+double calculate_dot_kernel(const T* a, const double* b, const size_t& size)
+{
+   double sum_0 = 0.0;
+   double sum_1 = 0.0;
+   double sum_2 = 0.0;
+   double sum_3 = 0.0;
+
+   size_t i = 0;
+
+   for(; i + 4 <= size; i += 4)
+   {
+      sum_0 += a[i]*b[i];
+      sum_1 += a[i+1]*b[i+1];
+      sum_2 += a[i+2]*b[i+2];
+      sum_3 += a[i+3]*b[i+3];
+   }
+
+   for(; i < size; i++)
+   {
+      sum_0 += a[i]*b[i];
+   }
+
+   return((sum_0 + sum_1) + (sum_2 + sum_3));
+}
+
+
+inline double calculate_dot_kernel(const double* a, const double* b, const size_t& size)
+{
+   const DotBlock block = {a, b};
+
+   return(calculate_parallel_reduction(block, size));
+}
+
+
+// double calculate_squared_sum_kernel(const T*, const size_t&) function
+
+/// Returns the sum of the squares of the elements of an array, which is the squared norm.
+/// @param data Pointer to the first element.
+/// @param size Number of elements.
+
+template <class T>
+double calculate_squared_sum_kernel(const T* data, const size_t& size)
+{
+   double sum_0 = 0.0;
+   double sum_1 = 0.0;
+   double sum_2 = 0.0;
+   double sum_3 = 0.0;
+
+   size_t i = 0;
+
+   for(; i + 4 <= size; i += 4)
+   {
+      sum_0 += data[i]*data[i];
+      sum_1 += data[i+1]*data[i+1];
+      sum_2 += data[i+2]*data[i+2];
+      sum_3 += data[i+3]*data[i+3];
+   }
+
+   for(; i < size; i++)
+   {
+      sum_0 += data[i]*data[i];
+   }
+
+   return((sum_0 + sum_1) + (sum_2 + sum_3));
+}
+
+
+inline double calculate_squared_sum_kernel(const double* data, const size_t& size)
+{
+   const DotBlock block = {data, data};
+
+   return(calculate_parallel_reduction(block, size));
+}
+
+
+// double calculate_squared_distance_kernel(const T*, const double*, const size_t&) function
+
+/// Returns the sum of the squared differences between two arrays, which is the squared euclidean distance.
+/// @param a Pointer to the first element of the first array.
+/// @param b Pointer to the first element of the second array.
+/// @param size Number of elements of each array.
+
+template <class T>
+double calculate_squared_distance_kernel(const T* a, const double* b, const size_t& size)
+{
+   double sum_0 = 0.0;
+   double sum_1 = 0.0;
+   double sum_2 = 0.0;
+   double sum_3 = 0.0;
+
+   size_t i = 0;
+
+   for(; i + 4 <= size; i += 4)
+   {
+      sum_0 += (a[i] - b[i])*(a[i] - b[i]);
+      sum_1 += (a[i+1] - b[i+1])*(a[i+1] - b[i+1]);
+      sum_2 += (a[i+2] - b[i+2])*(a[i+2] - b[i+2]);
+      sum_3 += (a[i+3] - b[i+3])*(a[i+3] - b[i+3]);
+   }
+
+   for(; i < size; i++)
+   {
+      sum_0 += (a[i] - b[i])*(a[i] - b[i]);
+   }
+
+   return((sum_0 + sum_1) + (sum_2 + sum_3));
+}
+
+
+inline double calculate_squared_distance_kernel(const double* a, const double* b, const size_t& size)
+{
+   const SquaredDistanceBlock block = {a, b};
+
+   return(calculate_parallel_reduction(block, size));
+}
+
+
+// double calculate_squared_distance_kernel(const T*, const T*, const size_t&, const size_t&) function
+
+/// Returns the squared euclidean distance between two arrays whose elements are a constant distance apart,
+/// such as two rows of a matrix stored by columns.
+/// The loads are not contiguous, so this kernel only keeps the four accumulators.
+/// @param a Pointer to the first element of the first array.
+/// @param b Pointer to the first element of the second array.
+/// @param size Number of elements of each array.
+/// @param stride Distance between consecutive elements of each array.
+
+template <class T>
+double calculate_squared_distance_kernel(const T* a, const T* b, const size_t& size, const size_t& stride)
+{
+   double sum_0 = 0.0;
+   double sum_1 = 0.0;
+   double sum_2 = 0.0;
+   double sum_3 = 0.0;
+
+   double difference_0;
+   double difference_1;
+   double difference_2;
+   double difference_3;
+
+   size_t i = 0;
+
+   for(; i + 4 <= size; i += 4)
+   {
+      difference_0 = (double)a[i*stride] - (double)b[i*stride];
+      difference_1 = (double)a[(i+1)*stride] - (double)b[(i+1)*stride];
+      difference_2 = (double)a[(i+2)*stride] - (double)b[(i+2)*stride];
+      difference_3 = (double)a[(i+3)*stride] - (double)b[(i+3)*stride];
+
+      sum_0 += difference_0*difference_0;
+      sum_1 += difference_1*difference_1;
+      sum_2 += difference_2*difference_2;
+      sum_3 += difference_3*difference_3;
+   }
+
+   for(; i < size; i++)
+   {
+      difference_0 = (double)a[i*stride] - (double)b[i*stride];
+
+      sum_0 += difference_0*difference_0;
+   }
+
+   return((sum_0 + sum_1) + (sum_2 + sum_3));
+}
+
+
+// double calculate_Minkowski_kernel(const T*, const double*, const size_t&, const double&) function
+
+/// Returns the sum of the absolute differences between two arrays raised to the Minkowski exponent.
+/// @param a Pointer to the first element of the first array.
+/// @param b Pointer to the first element of the second array.
+/// @param size Number of elements of each array.
+/// @param exponent Minkowski exponent.
+
+template <class T>
+double calculate_Minkowski_kernel(const T* a, const double* b, const size_t& size, const double& exponent)
+{
+   double sum = 0.0;
+
+   for(size_t i = 0; i < size; i++)
+   {
+      sum += pow(fabs(a[i] - b[i]), exponent);
+   }
+
+   return(sum);
+}
+
+
+/// Integer exponents, the most common being 1 and 2, avoid calling pow for each element.
+
+inline double calculate_Minkowski_kernel(const double* a, const double* b, const size_t& size, const double& exponent)
+{
+   if(exponent == 2.0)
+   {
+      return(calculate_squared_distance_kernel(a, b, size));
+   }
+   else if(exponent >= 1.0 && exponent <= 64.0 && exponent == floor(exponent))
+   {
+      const MinkowskiDistanceBlock block = {a, b, (size_t)exponent};
+
+      return(calculate_parallel_reduction(block, size));
+   }
+
+   double sum = 0.0;
+
+   for(size_t i = 0; i < size; i++)
+   {
+      sum += pow(fabs(a[i] - b[i]), exponent);
+   }
+
+   return(sum);
+}
+
+}
+
+#endif
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (c) 2005-2015 Roberto Lopez.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
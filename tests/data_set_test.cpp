@@ -256,6 +256,81 @@ void DataSetTest::test_get_instance(void)
 }
 
 
+void DataSetTest::test_arrange_training_row(void)
+{
+   message += "test_arrange_training_row\n";
+
+   DataSet ds;
+
+   Matrix<double> data;
+
+   Vector<double> inputs;
+   Vector<double> targets;
+
+   // Test
+
+   data.set(3, 3);
+
+   data(0,0) = 1.0;
+   data(0,1) = 2.0;
+   data(0,2) = 3.0;
+   data(1,0) = 4.0;
+   data(1,1) = 5.0;
+   data(1,2) = 6.0;
+   data(2,0) = 7.0;
+   data(2,1) = 8.0;
+   data(2,2) = 9.0;
+
+   ds.set(data);
+
+   ds.get_variables_pointer()->set_use(2, Variables::Target);
+
+   ds.get_instances_pointer()->set_training();
+
+   assert_true(ds.count_training_rows_number() == 3, LOG);
+
+   ds.arrange_training_row(1, inputs, targets);
+
+   assert_true(inputs == ds.get_instance(1, ds.get_variables().arrange_inputs_indices()), LOG);
+   assert_true(targets == ds.get_instance(1, ds.get_variables().arrange_targets_indices()), LOG);
+
+   // Test
+
+   ds.get_instances_pointer()->set_use(0, Instances::Testing);
+
+   assert_true(ds.count_training_rows_number() == 2, LOG);
+
+   ds.arrange_training_row(0, inputs, targets);
+
+   assert_true(inputs.size() == 2, LOG);
+   assert_true(inputs[0] == 4.0, LOG);
+   assert_true(inputs[1] == 5.0, LOG);
+   assert_true(targets.size() == 1, LOG);
+   assert_true(targets[0] == 6.0, LOG);
+
+   // Test
+
+   ds.get_missing_values_pointer()->append(1, 0);
+   ds.get_missing_values_pointer()->build_index();
+
+   assert_true(ds.count_training_rows_number() == 1, LOG);
+
+   ds.arrange_training_row(0, inputs, targets);
+
+   assert_true(inputs[0] == 7.0, LOG);
+   assert_true(targets[0] == 9.0, LOG);
+
+   // Test
+
+   ds.initialize_data(0.0);
+
+   ds.arrange_training_row(0, inputs, targets);
+
+   assert_true(inputs == 0.0, LOG);
+   assert_true(targets == 0.0, LOG);
+}
+
+
 void DataSetTest::test_set(void) 
 {
    message += "test_set\n";
@@ -325,6 +400,59 @@ void DataSetTest::test_set_data(void)
 }
 
 
+void DataSetTest::test_set_data_blocks_pointer(void)
+{
+   message += "test_set_data_blocks_pointer\n";
+
+#ifdef __APPLE__
+   const std::string data_file_name = "../../../../data/data.bin";
+#else
+   const std::string data_file_name = "../data/data.bin";
+#endif
+
+   DataSet ds(25, 3, 2);
+   ds.set_data_file_name(data_file_name);
+   ds.randomize_data_normal();
+
+   ds.get_instances_pointer()->split_random_indices();
+
+   ds.get_missing_values_pointer()->append(7, 4);
+
+   ds.save_data_binary();
+
+   DataBlocks data_blocks(data_file_name);
+   data_blocks.set_block_instances_number(4);
+
+   DataSet blocks_ds;
+
+   // Test
+
+   blocks_ds.set_data_blocks_pointer(&data_blocks);
+
+   assert_true(blocks_ds.has_data_blocks(), LOG);
+   assert_true(blocks_ds.get_data().empty(), LOG);
+   assert_true(!blocks_ds.empty(), LOG);
+
+   assert_true(blocks_ds.get_instances().get_instances_number() == 25, LOG);
+   assert_true(blocks_ds.get_variables().count_inputs_number() == 3, LOG);
+   assert_true(blocks_ds.get_variables().count_targets_number() == 2, LOG);
+   assert_true(blocks_ds.get_missing_values().get_missing_values_number() == 1, LOG);
+
+   assert_true(blocks_ds.get_instance(7) == ds.get_instance(7), LOG);
+
+   *blocks_ds.get_instances_pointer() = ds.get_instances();
+
+   assert_true(blocks_ds.arrange_training_input_data() == ds.arrange_training_input_data(), LOG);
+   assert_true(blocks_ds.arrange_testing_target_data() == ds.arrange_testing_target_data(), LOG);
+
+   // Test
+
+   blocks_ds.set_data_blocks_pointer(NULL);
+
+   assert_true(!blocks_ds.has_data_blocks(), LOG);
+}
+
+
 void DataSetTest::test_set_instance(void)
 {
    message += "test_set_instance\n";
@@ -450,6 +578,31 @@ void DataSetTest::test_calculate_training_instances_statistics(void)
 
    ds.calculate_training_instances_statistics();
 
+   // Test
+
+   ds.set(4, 1, 1);
+
+   instances_pointer = ds.get_instances_pointer();
+   instances_pointer->set_training();
+   instances_pointer->set_use(0, Instances::Testing);
+
+   ds.initialize_data(1.0);
+
+   ds.set_instance(0, Vector<double>(2, 5.0));
+   ds.set_instance(3, Vector<double>(2, 9.0));
+
+   ds.get_missing_values_pointer()->append(3, 0);
+
+   training_instances_statistics = ds.calculate_training_instances_statistics();
+
+   assert_true(training_instances_statistics.size() == 2, LOG);
+
+   assert_true(training_instances_statistics[0].maximum == 1.0, LOG);
+   assert_true(training_instances_statistics[0].standard_deviation == 0.0, LOG);
+
+   assert_true(training_instances_statistics[1].maximum == 9.0, LOG);
+   assert_true(fabs(training_instances_statistics[1].mean - 11.0/3.0) < 1.0e-12, LOG);
+
 }
 
 
@@ -512,6 +665,91 @@ void DataSetTest::test_calculate_targets_statistics(void)
 void DataSetTest::test_calculate_linear_correlations(void)
 {
    message += "test_calculate_linear_correlations\n";
+
+   DataSet ds;
+
+   Matrix<double> data;
+
+   Matrix<double> linear_correlations;
+
+   Vector<double> input;
+   Vector<double> target;
+
+   // Test
+
+   ds.set(50, 3, 2);
+
+   ds.randomize_data_normal();
+
+   linear_correlations = ds.calculate_linear_correlations();
+
+   assert_true(linear_correlations.get_rows_number() == 3, LOG);
+   assert_true(linear_correlations.get_columns_number() == 2, LOG);
+
+   data = ds.get_data();
+
+   for(size_t i = 0; i < 3; i++)
+   {
+      input = data.arrange_column(i);
+
+      for(size_t j = 0; j < 2; j++)
+      {
+         target = data.arrange_column(3+j);
+
+         assert_true(fabs(linear_correlations(i,j) - input.calculate_linear_correlation(target)) < 1.0e-12, LOG);
+      }
+   }
+
+   // Test
+
+   data.set_column(0, Vector<double>(50, 2.0));
+   data.set_column(1, Vector<double>(50, 0.0));
+   data.set_column(4, Vector<double>(50, 0.0));
+
+   ds.set_data(data);
+
+   linear_correlations = ds.calculate_linear_correlations();
+
+   assert_true(linear_correlations.get_rows_number() == 4, LOG);
+   assert_true(linear_correlations.get_columns_number() == 1, LOG);
+
+   assert_true(linear_correlations(0,0) == 0.0, LOG);
+   assert_true(linear_correlations(1,0) == 1.0, LOG);
+   assert_true(linear_correlations(2,0) == 0.0, LOG);
+}
+
+
+void DataSetTest::test_calculate_inputs_linear_correlations(void)
+{
+   message += "test_calculate_inputs_linear_correlations\n";
+
+   DataSet ds;
+
+   Matrix<double> data;
+
+   Matrix<double> linear_correlations;
+
+   // Test
+
+   ds.set(40, 600, 1);
+
+   ds.randomize_data_normal();
+
+   linear_correlations = ds.calculate_inputs_linear_correlations();
+
+   assert_true(linear_correlations.get_rows_number() == 600, LOG);
+   assert_true(linear_correlations.get_columns_number() == 600, LOG);
+
+   assert_true(linear_correlations == linear_correlations.calculate_transpose(), LOG);
+
+   assert_true(fabs(linear_correlations(0,0) - 1.0) < 1.0e-12, LOG);
+   assert_true(fabs(linear_correlations(599,599) - 1.0) < 1.0e-12, LOG);
+
+   data = ds.get_data();
+
+   assert_true(fabs(linear_correlations(0,599) - data.arrange_column(0).calculate_linear_correlation(data.arrange_column(599))) < 1.0e-12, LOG);
+   assert_true(fabs(linear_correlations(255,256) - data.arrange_column(255).calculate_linear_correlation(data.arrange_column(256))) < 1.0e-12, LOG);
+   assert_true(fabs(linear_correlations(520,3) - data.arrange_column(520).calculate_linear_correlation(data.arrange_column(3))) < 1.0e-12, LOG);
 }
 
 void DataSetTest::test_calculate_autocorrelation(void)
@@ -840,6 +1078,57 @@ void DataSetTest::test_subtract_constant_variables(void)
 void DataSetTest::test_subtract_repeated_instances(void)
 {
    message += "test_subtract_repeated_instances\n"; 
+
+   DataSet ds;
+
+   Matrix<double> data;
+
+   Vector<size_t> repeated_instances;
+
+   // Test
+
+   data.set(5, 2);
+
+   data(0,0) = 1.0;
+   data(0,1) = 2.0;
+   data(1,0) = 3.0;
+   data(1,1) = 4.0;
+   data(2,0) = 1.0;
+   data(2,1) = 2.0;
+   data(3,0) = 1.0;
+   data(3,1) = 3.0;
+   data(4,0) = 1.0;
+   data(4,1) = 2.0;
+
+   ds.set(data);
+
+   ds.get_instances_pointer()->set_training();
+
+   repeated_instances = ds.unuse_repeated_instances();
+
+   assert_true(repeated_instances.size() == 2, LOG);
+   assert_true(repeated_instances[0] == 2, LOG);
+   assert_true(repeated_instances[1] == 4, LOG);
+
+   assert_true(ds.get_instances().count_unused_instances_number() == 2, LOG);
+   assert_true(ds.get_instances().get_use(0) != Instances::Unused, LOG);
+   assert_true(ds.get_instances().get_use(3) != Instances::Unused, LOG);
+
+   // Test
+
+   ds.set(10, 3);
+   ds.initialize_data(0.0);
+
+   data = ds.get_data();
+   data(0,0) = -0.0;
+   ds.set_data(data);
+
+   ds.get_instances_pointer()->set_training();
+
+   repeated_instances = ds.unuse_repeated_instances();
+
+   assert_true(repeated_instances.size() == 9, LOG);
+   assert_true(ds.get_instances().get_use(0) != Instances::Unused, LOG);
 }
 
 
@@ -1238,24 +1527,99 @@ void DataSetTest::test_balance_function_regression_targets_distribution(void)
     assert_true(unused_instances.size() == 1000, LOG);
 }
 
-/*
-void DataSetTest::test_calculate_instances_distances()
+void DataSetTest::test_calculate_instances_distances(void)
 {
     message += "test_calculate_instances_distances\n";
 
     DataSet ds(5, 5, 2);
     ds.randomize_data_normal();
 
+    ds.get_instances_pointer()->set_training();
+
     Matrix<double> distances;
 
-    //distances = ds.calculate_instances_distances();
+    distances = ds.calculate_instances_distances();
 
+    assert_true(distances.get_rows_number() == 5, LOG);
+    assert_true(distances.get_columns_number() == 5, LOG);
     assert_true(distances(0, 0) == 0, LOG);
     assert_true(distances(1, 1) == 0, LOG);
     assert_true(distances(0, 1) == distances(1, 0), LOG);
+    assert_true(fabs(distances(0, 1) - ds.get_data().calculate_distance(0, 1)) < 1.0e-12, LOG);
 }
 
 
+void DataSetTest::test_calculate_local_outlier_factor(void)
+{
+    message += "test_calculate_local_outlier_factor\n";
+
+    DataSet ds(2, 1, 100);
+    ds.generate_artificial_data(100, 3);
+
+    Vector<double> instance1(3, 1.0);
+    instance1[2] = 50.0;
+
+    Vector<double> instance2(3, 1.0);
+    instance2[2] = 5.0;
+
+    Vector<double> instance3(3);
+
+    instance3[0] = 1.0;
+    instance3[1] = 1.0;
+    instance3[2] = 0.0;
+
+    Vector<double> instance4(3, 1.0);
+    instance4[2] = -10.0;
+
+    ds.set_instance(96, instance1);
+    ds.set_instance(97, instance2);
+    ds.set_instance(98, instance3);
+    ds.set_instance(99, instance4);
+
+    ds.scale_data_minimum_maximum();
+
+    ds.get_instances_pointer()->set_training();
+
+    Vector<double> local_outlier_factor = ds.calculate_local_outlier_factor(8);
+
+    // Reference value from the distances between all the instances
+
+    const Matrix<double> distances = ds.calculate_instances_distances();
+    const Matrix<size_t> nearest_neighbors = ds.calculate_nearest_neighbors(distances, 8);
+    const Vector<double> reachability_density = ds.calculate_reachability_density(distances, 8);
+
+    double reachability_densities_sum = 0.0;
+
+    for(size_t j = 0; j < 8; j++)
+    {
+        reachability_densities_sum += reachability_density[nearest_neighbors(96, j)];
+    }
+
+    const double outlier_local_outlier_factor = reachability_densities_sum/(8*reachability_density[96]);
+
+    assert_true(local_outlier_factor.size() == 100, LOG);
+    assert_true(local_outlier_factor.calculate_maximal_index() == 96, LOG);
+    assert_true(fabs(local_outlier_factor[96] - outlier_local_outlier_factor) < 1.0e-9, LOG);
+    assert_true(local_outlier_factor[96] > 1.0, LOG);
+
+    // Test
+
+    bool rejected = false;
+
+    try
+    {
+        ds.calculate_local_outlier_factor(100);
+    }
+    catch(const std::logic_error&)
+    {
+        rejected = true;
+    }
+
+    assert_true(rejected, LOG);
+}
+
+
+/*
 void DataSetTest::test_calculate_k_distances(void)
 {
     message += "test_calculate_k_distances\n";
@@ -1357,41 +1721,6 @@ void DataSetTest::test_calculate_reachability_density()
 }
 
 
-void DataSetTest::test_calculate_local_outlier_factor(void)
-{
-    message += "test_calculate_local_outlier_factor\n";
-
-    DataSet ds(2, 1, 100);
-    ds.generate_artificial_data(100, 3);
-
-    Vector<double> instance1(3, 1.0);
-    instance1[2] = 50.0;
-
-    Vector<double> instance2(3, 1.0);
-    instance2[2] = 5.0;
-
-    Vector<double> instance3(3);
-
-    instance3[0] = 1.0;
-    instance3[1] = 1.0;
-    instance3[2] = 0.0;
-
-    Vector<double> instance4(3, 1.0);
-    instance4[2] = -10.0;
-
-    ds.set_instance(96, instance1);
-    ds.set_instance(97, instance2);
-    ds.set_instance(98, instance3);
-    ds.set_instance(99, instance4);
-
-    ds.scale_data_minimum_maximum();
-
-    Vector<double> local_outlier_factor = ds.calculate_local_outlier_factor(8);
-
-    assert_true(local_outlier_factor.size() == 100, LOG);
-}
-
-
 void DataSetTest::test_clean_local_outlier_factor(void)
 {
     message += "test_clean_local_outlier_factor\n";
@@ -2030,6 +2359,139 @@ void DataSetTest::test_load_data(void)
    assert_true(data.get_rows_number() == 10, LOG);
    assert_true(data.get_columns_number() == 7, LOG);
 
+   // Test
+
+   ds.set_header_line(false);
+   ds.set_separator("Comma");
+   ds.set_missing_values_label("NaN");
+
+   file.open(data_file_name.c_str());
+
+   for(size_t i = 0; i < 100000; i++)
+   {
+      if(i%1000 == 999)
+      {
+         file << "NaN,";
+      }
+      else
+      {
+         file << i << ",";
+      }
+
+      file << i%7 << ".25,0.5e1,class_" << i%3 << "\n";
+   }
+
+   file.close();
+
+   ds.load_data();
+
+   assert_true(ds.get_instances_pointer()->get_instances_number() == 100000, LOG);
+   assert_true(ds.get_variables_pointer()->get_variables_number() == 6, LOG);
+   assert_true(ds.get_missing_values_pointer()->get_missing_values_number() == 100, LOG);
+   assert_true(ds.get_missing_values().get_item(99).instance_index == 99999, LOG);
+   assert_true(ds.get_missing_values().get_item(99).variable_index == 0, LOG);
+
+   data = ds.get_data();
+
+   assert_true(data(0,0) == 0.0, LOG);
+   assert_true(data(54321,0) == 54321.0, LOG);
+   assert_true(data(54321,1) == 1.25, LOG);
+   assert_true(data(54321,2) == 5.0, LOG);
+   assert_true(data(54321,3) == 1.0, LOG);
+   assert_true(data(54322,4) == 1.0, LOG);
+   assert_true(data(54323,5) == 1.0, LOG);
+   assert_true(data(54323,3) == 0.0, LOG);
+   assert_true(data(99999,3) == 1.0, LOG);
+}
+
+
+void DataSetTest::test_load_data_binary(void)
+{
+   message += "test_load_data_binary\n";
+
+#ifdef __APPLE__
+   const std::string data_file_name = "../../../../data/data.bin";
+#else
+   const std::string data_file_name = "../data/data.bin";
+#endif
+
+   DataSet ds;
+
+   Matrix<double> data;
+
+   // Test
+
+   ds.set(3, 2);
+   ds.set_data_file_name(data_file_name);
+
+   ds.set_display(false);
+
+   data.set(3, 2);
+   data(0,0) = 1.0;
+   data(1,0) = 2.0;
+   data(2,0) = -3.5;
+   data(0,1) = 0.25;
+   data(1,1) = 1.0e-9;
+   data(2,1) = 6.0;
+
+   ds.set_data(data);
+
+   ds.get_variables_pointer()->set_name(0, "x");
+   ds.get_variables_pointer()->set_units(1, "m");
+   ds.get_variables_pointer()->set_use(0, Variables::Unused);
+
+   ds.get_missing_values_pointer()->append(1, 1);
+
+   ds.save_data_binary();
+
+   ds.set();
+   ds.set_data_file_name(data_file_name);
+
+   ds.load_data_binary();
+
+   assert_true(ds.get_data() == data, LOG);
+
+   assert_true(ds.get_variables().get_name(0) == "x", LOG);
+   assert_true(ds.get_variables().get_unit(1) == "m", LOG);
+   assert_true(ds.get_variables().get_use(0) == Variables::Unused, LOG);
+   assert_true(ds.get_variables().get_use(1) == Variables::Target, LOG);
+
+   assert_true(ds.get_missing_values().get_missing_values_number() == 1, LOG);
+   assert_true(ds.get_missing_values().get_item(0).instance_index == 1, LOG);
+   assert_true(ds.get_missing_values().get_item(0).variable_index == 1, LOG);
+
+   // Test
+
+   ds.set(11, 3);
+   ds.set_data_file_name(data_file_name);
+
+   ds.randomize_data_normal();
+
+   data = ds.get_data();
+
+   ds.save_data_binary();
+
+   ds.set();
+   ds.set_data_file_name(data_file_name);
+
+   ds.load_data_binary();
+
+   assert_true(ds.get_data() == data, LOG);
+   assert_true(ds.get_missing_values().get_missing_values_number() == 0, LOG);
+
+   // Test
+
+   ds.set();
+   ds.set_data_file_name(data_file_name);
+
+   ds.save_data_binary();
+
+   ds.set(2, 2);
+   ds.set_data_file_name(data_file_name);
+
+   ds.load_data_binary();
+
+   assert_true(ds.get_data().empty(), LOG);
 }
 
 
@@ -2722,6 +3184,8 @@ void DataSetTest::run_test_case(void)
 
    test_get_instance();
 
+   test_arrange_training_row();
+
    // Set methods
 
    test_set();
@@ -2731,6 +3195,7 @@ void DataSetTest::run_test_case(void)
    // Data methods
 
    test_set_data();
+   test_set_data_blocks_pointer();
 
    test_set_instances_number();
    test_set_variables_number();
@@ -2765,6 +3230,7 @@ void DataSetTest::run_test_case(void)
    // Correlation methods
 
    test_calculate_linear_correlations();
+   test_calculate_inputs_linear_correlations();
    test_calculate_autocorrelation();
    test_calculate_cross_correlation();
 
@@ -2824,16 +3290,18 @@ void DataSetTest::run_test_case(void)
 
    // Outlier detection
 
-   //test_calculate_instances_distances();
+   test_calculate_instances_distances();
    //test_calculate_k_distances();
    //test_calculate_reachability_distances();
    //test_calculate_reachability_density();
-   //test_calculate_local_outlier_factor();
+   test_calculate_local_outlier_factor();
 
    //test_clean_local_outlier_factor();
    test_clean_Tukey_outliers();
 
    // Serialization methods
+
+   test_load_data_binary();
 /*
    test_to_XML();
    test_from_XML();
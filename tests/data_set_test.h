@@ -73,6 +73,8 @@ public:
 
    void test_get_instance(void);
 
+   void test_arrange_training_row(void);
+
    // Set methods
 
    void test_set(void);
@@ -85,6 +87,7 @@ public:
    // Data methods
 
    void test_set_data(void);
+   void test_set_data_blocks_pointer(void);
 
    // Instance methods
 
@@ -132,6 +135,7 @@ public:
    // Correlation methods
 
    void test_calculate_linear_correlations(void);
+   void test_calculate_inputs_linear_correlations(void);
 
    void test_calculate_autocorrelation(void);
    void test_calculate_cross_correlation(void);
@@ -196,11 +200,11 @@ public:
 
    // Outlier detection
 
-   //void test_calculate_instances_distances(void);
+   void test_calculate_instances_distances(void);
    //void test_calculate_k_distances(void);
    //void test_calculate_reachability_distances(void);
    //void test_calculate_reachability_density(void);
-   //void test_calculate_local_outlier_factor(void);
+   void test_calculate_local_outlier_factor(void);
 
    //void test_clean_local_outlier_factor(void);
    void test_clean_Tukey_outliers(void);
@@ -218,6 +222,7 @@ public:
    void test_print_data(void);
    void test_save_data(void);
    void test_load_data(void);
+   void test_load_data_binary(void);
 
    void test_get_data_statistics(void);
    void test_print_data_statistics(void);
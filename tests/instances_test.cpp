@@ -250,6 +250,65 @@ void InstancesTest::test_arrange_used_indices()
 }
 
 
+void InstancesTest::test_get_modifications_number(void)
+{
+   message += "test_get_modifications_number\n";
+
+   Instances i(4);
+
+   size_t modifications_number;
+
+   // Test
+
+   i.set_training();
+
+   assert_true(i.arrange_training_indices().size() == 4, LOG);
+   assert_true(i.count_generalization_instances_number() == 0, LOG);
+
+   modifications_number = i.get_modifications_number();
+
+   i.arrange_training_indices();
+
+   assert_true(i.get_modifications_number() == modifications_number, LOG);
+
+   // Test
+
+   i.set_use(2, Instances::Generalization);
+
+   assert_true(i.get_modifications_number() != modifications_number, LOG);
+
+   assert_true(i.arrange_training_indices().size() == 3, LOG);
+   assert_true(i.arrange_training_indices()[2] == 3, LOG);
+   assert_true(i.arrange_generalization_indices().size() == 1, LOG);
+   assert_true(i.arrange_generalization_indices()[0] == 2, LOG);
+   assert_true(i.arrange_used_indices().size() == 4, LOG);
+
+   // Test
+
+   modifications_number = i.get_modifications_number();
+
+   i.split_sequential_indices(0.5, 0.25, 0.25);
+
+   assert_true(i.get_modifications_number() != modifications_number, LOG);
+   assert_true(i.count_training_instances_number() == 2, LOG);
+   assert_true(i.arrange_testing_indices()[0] == 3, LOG);
+
+   // Test
+
+   Instances other_instances(4);
+
+   other_instances.set_testing();
+
+   modifications_number = i.get_modifications_number();
+
+   i = other_instances;
+
+   assert_true(i.get_modifications_number() != modifications_number, LOG);
+   assert_true(i.count_testing_instances_number() == 4, LOG);
+   assert_true(i.arrange_training_indices().empty(), LOG);
+}
+
+
 void InstancesTest::test_get_display(void) 
 {
    message += "test_get_display\n";
@@ -615,6 +674,8 @@ void InstancesTest::run_test_case(void)
 
    test_arrange_used_indices();
 
+   test_get_modifications_number();
+
    test_get_display();
 
    // Set methods
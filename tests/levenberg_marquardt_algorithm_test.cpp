@@ -426,6 +426,41 @@ void LevenbergMarquardtAlgorithmTest::test_perform_training(void)
    gradient_norm = gradient.calculate_norm();
 
    assert_true(gradient_norm < gradient_norm_goal, LOG);
+
+   // Accumulated and Jacobian based Hessian approximations
+
+   nn.set(2, 3, 1);
+   nn.randomize_parameters_normal();
+
+   ds.set(20, 2, 1);
+   ds.randomize_data_normal();
+
+   pf.get_normalized_squared_error_objective_pointer()->set_batch_instances_number(3);
+
+   const Vector<double> initial_parameters = nn.arrange_parameters();
+
+   lma.set_minimum_parameters_increment_norm(0.0);
+   lma.set_performance_goal(0.0);
+   lma.set_minimum_performance_increase(0.0);
+   lma.set_gradient_norm_goal(0.0);
+   lma.set_maximum_iterations_number(3);
+   lma.set_maximum_time(10.0);
+
+   lma.set_damping_parameter(1.0e-3);
+   lma.set_accumulate_Hessian_approximation(true);
+
+   lma.perform_training();
+
+   const Vector<double> accumulated_parameters = nn.arrange_parameters();
+
+   nn.set_parameters(initial_parameters);
+
+   lma.set_damping_parameter(1.0e-3);
+   lma.set_accumulate_Hessian_approximation(false);
+
+   lma.perform_training();
+
+   assert_true((nn.arrange_parameters() - accumulated_parameters).calculate_absolute_value() < 1.0e-6, LOG);
 }
 
 
@@ -34,6 +34,7 @@ int main(void)
    "variables\n"
    "instances\n"
    "missing_values\n"
+   "spatial_index\n"
    "data_set\n"
    "plug_in\n"
    "ordinary_differential_equations\n"
@@ -71,6 +72,7 @@ int main(void)
    "newton_method\n"
    "levenberg_marquardt_algorithm\n"
    "gradient_descent\n"
+   "stochastic_gradient_descent\n"
    "evolutionary_algorithm\n"
    "conjugate_gradient\n"
    "testing_analysis\n"
@@ -188,6 +190,15 @@ int main(void)
          tests_passed_count += missing_values_test.get_tests_passed_count();
          tests_failed_count += missing_values_test.get_tests_failed_count();
       }
+      else if(test == "spatial_index")
+      {
+         SpatialIndexTest spatial_index_test;
+         spatial_index_test.run_test_case();
+         message += spatial_index_test.get_message();
+         tests_count += spatial_index_test.get_tests_count();
+         tests_passed_count += spatial_index_test.get_tests_passed_count();
+         tests_failed_count += spatial_index_test.get_tests_failed_count();
+      }
       else if(test == "data_set")
       {
          DataSetTest data_set_test;
@@ -523,6 +534,15 @@ int main(void)
         tests_passed_count += gradient_descent_test.get_tests_passed_count();
         tests_failed_count += gradient_descent_test.get_tests_failed_count();
       }
+      else if(test == "stochastic_gradient_descent")
+      {
+        StochasticGradientDescentTest stochastic_gradient_descent_test;
+        stochastic_gradient_descent_test.run_test_case();
+        message += stochastic_gradient_descent_test.get_message();
+        tests_count += stochastic_gradient_descent_test.get_tests_count();
+        tests_passed_count += stochastic_gradient_descent_test.get_tests_passed_count();
+        tests_failed_count += stochastic_gradient_descent_test.get_tests_failed_count();
+      }
       else if(test == "newton_method")
       {
         NewtonMethodTest Newton_method_test;
@@ -1057,6 +1077,15 @@ int main(void)
           tests_passed_count += gradient_descent_test.get_tests_passed_count();
           tests_failed_count += gradient_descent_test.get_tests_failed_count();
 
+          // stochastic gradient descent
+
+          StochasticGradientDescentTest stochastic_gradient_descent_test;
+          stochastic_gradient_descent_test.run_test_case();
+          message += stochastic_gradient_descent_test.get_message();
+          tests_count += stochastic_gradient_descent_test.get_tests_count();
+          tests_passed_count += stochastic_gradient_descent_test.get_tests_passed_count();
+          tests_failed_count += stochastic_gradient_descent_test.get_tests_failed_count();
+
           // newton method
 
           NewtonMethodTest Newton_method_test;
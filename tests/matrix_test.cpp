@@ -154,7 +154,30 @@ void MatrixTest::test_assignment_operator(void)
    assert_true(b.get_rows_number() == 1, LOG);
    assert_true(b.get_columns_number() == 1, LOG);
    assert_true(b == 0, LOG);
-}
+
+   // Move
+
+   Matrix<int> c(2, 3, 1);
+
+   Matrix<int> d(std::move(c));
+
+   assert_true(d.get_rows_number() == 2, LOG);
+   assert_true(d.get_columns_number() == 3, LOG);
+   assert_true(d == 1, LOG);
+
+   assert_true(c.get_rows_number() == 0, LOG);
+   assert_true(c.get_columns_number() == 0, LOG);
+   assert_true(c.empty(), LOG);
+
+   b = std::move(d);
+
+   assert_true(b.get_rows_number() == 2, LOG);
+   assert_true(b.get_columns_number() == 3, LOG);
+   assert_true(b == 1, LOG);
+
+   assert_true(d.get_rows_number() == 0, LOG);
+   assert_true(d.get_columns_number() == 0, LOG);
+}
 
 
 void MatrixTest::test_reference_operator(void)
@@ -293,31 +316,139 @@ void MatrixTest::test_division_operator(void)
    assert_true(c.get_rows_number() == 1, LOG);
    assert_true(c.get_columns_number() == 1, LOG);
    assert_true(c == 1, LOG);
-}
+
+   // Test
+
+   a.set(3, 2, 6);
+   b.set(3, 2, 2);
+
+   c = a/b;
+
+   assert_true(c.get_rows_number() == 3, LOG);
+   assert_true(c.get_columns_number() == 2, LOG);
+   assert_true(c == 3, LOG);
+
+   // Expiring operands
+
+   c = (a*2)/b;
+
+   assert_true(c == 6, LOG);
+
+   c = a/(b + 1);
+
+   assert_true(c == 2, LOG);
+
+   c = (a + 6)/(b*2);
+
+   assert_true(c == 3, LOG);
+
+   c = (a - b)/2;
+
+   assert_true(c == 2, LOG);
+
+   assert_true(a == 6, LOG);
+   assert_true(b == 2, LOG);
+}
 
 
 void MatrixTest::test_sum_assignment_operator(void)
 {
    message += "test_sum_assignment_operator\n";
-}
+
+   Matrix<int> a(2, 3, 1);
+   Matrix<int> b(2, 3, 2);
+
+   // Test
+
+   a += 1;
+
+   assert_true(a.get_rows_number() == 2, LOG);
+   assert_true(a.get_columns_number() == 3, LOG);
+   assert_true(a == 2, LOG);
+
+   // Test
+
+   a += b;
+
+   assert_true(a.get_rows_number() == 2, LOG);
+   assert_true(a.get_columns_number() == 3, LOG);
+   assert_true(a == 4, LOG);
+}
 
 
 void MatrixTest::test_rest_assignment_operator(void)
 {
    message += "test_rest_assignment_operator\n";
-}
+
+   Matrix<int> a(2, 3, 5);
+   Matrix<int> b(2, 3, 2);
+
+   // Test
+
+   a -= 1;
+
+   assert_true(a.get_rows_number() == 2, LOG);
+   assert_true(a.get_columns_number() == 3, LOG);
+   assert_true(a == 4, LOG);
+
+   // Test
+
+   a -= b;
+
+   assert_true(a.get_rows_number() == 2, LOG);
+   assert_true(a.get_columns_number() == 3, LOG);
+   assert_true(a == 2, LOG);
+}
 
 
 void MatrixTest::test_multiplication_assignment_operator(void)
 {
    message += "test_multiplication_assignment_operator\n";
-}
+
+   Matrix<int> a(2, 3, 2);
+   Matrix<int> b(2, 3, 3);
+
+   // Test
+
+   a *= 2;
+
+   assert_true(a.get_rows_number() == 2, LOG);
+   assert_true(a.get_columns_number() == 3, LOG);
+   assert_true(a == 4, LOG);
+
+   // Test
+
+   a *= b;
+
+   assert_true(a.get_rows_number() == 2, LOG);
+   assert_true(a.get_columns_number() == 3, LOG);
+   assert_true(a == 12, LOG);
+}
 
 
 void MatrixTest::test_division_assignment_operator(void)
 {
    message += "test_division_assignment_operator\n";
-}
+
+   Matrix<int> a(2, 3, 12);
+   Matrix<int> b(2, 3, 2);
+
+   // Test
+
+   a /= 2;
+
+   assert_true(a.get_rows_number() == 2, LOG);
+   assert_true(a.get_columns_number() == 3, LOG);
+   assert_true(a == 6, LOG);
+
+   // Test
+
+   a /= b;
+
+   assert_true(a.get_rows_number() == 2, LOG);
+   assert_true(a.get_columns_number() == 3, LOG);
+   assert_true(a == 3, LOG);
+}
 
 
 void MatrixTest::test_equal_to_operator(void)
@@ -333,6 +464,58 @@ void MatrixTest::test_equal_to_operator(void)
 }
 
 
+void MatrixTest::test_lazy(void)
+{
+   message += "test_lazy\n";
+
+   Matrix<double> a(2, 3, 4.0);
+   Matrix<double> b(2, 3, 1.0);
+   Matrix<double> c;
+
+   // Test
+
+   c = (a.lazy() - b.lazy())*2.0;
+
+   assert_true(c.get_rows_number() == 2, LOG);
+   assert_true(c.get_columns_number() == 3, LOG);
+   assert_true(c == 6.0, LOG);
+
+   // Test
+
+   Matrix<double> d = a.lazy()/b.lazy() + 1.0;
+
+   assert_true(d.get_rows_number() == 2, LOG);
+   assert_true(d.get_columns_number() == 3, LOG);
+   assert_true(d == 5.0, LOG);
+
+   // Test
+
+   Matrix<int> e(3, 2);
+   Matrix<int> f(3, 2);
+   Matrix<int> g;
+
+   e(0,0) = 1; e(0,1) = -2;
+   e(1,0) = 3; e(1,1) = 4;
+   e(2,0) = 0; e(2,1) = 5;
+
+   f(0,0) = 2; f(0,1) = 2;
+   f(1,0) = -1; f(1,1) = 0;
+   f(2,0) = 7; f(2,1) = 3;
+
+   g = e.lazy()*f.lazy() - e.lazy();
+
+   assert_true(g == e*f - e, LOG);
+
+   g += e.lazy();
+
+   assert_true(g == e*f, LOG);
+
+   g -= e.lazy()*f.lazy();
+
+   assert_true(g == 0, LOG);
+}
+
+
 void MatrixTest::test_not_equal_to_operator(void)
 {
    message += "test_not_equal_to_operator\n";
@@ -474,6 +657,161 @@ void MatrixTest::test_arrange_column(void)
 }
 
 
+void MatrixTest::test_view_row(void)
+{
+   message += "test_view_row\n";
+
+   Matrix<double> m(3, 4);
+   m.randomize_normal();
+
+   VectorView<double> row;
+
+   Vector<double> v;
+
+   // Test
+
+   for(size_t i = 0; i < 3; i++)
+   {
+      row = m.view_row(i);
+
+      assert_true(row.size() == 4, LOG);
+      assert_true(row.get_stride() == 3, LOG);
+      assert_true(!row.is_contiguous(), LOG);
+
+      v = row;
+
+      assert_true(v == m.arrange_row(i), LOG);
+
+      assert_true(row.calculate_maximal_index() == m.arrange_row(i).calculate_maximal_index(), LOG);
+      assert_true(row.calculate_minimal_index() == m.arrange_row(i).calculate_minimal_index(), LOG);
+      assert_true(fabs(row.calculate_norm() - m.arrange_row(i).calculate_norm()) < 1.0e-12, LOG);
+      assert_true(fabs(row.calculate_sum() - m.arrange_row(i).calculate_sum()) < 1.0e-12, LOG);
+   }
+
+   // Test
+
+   m.set(2, 3);
+   m(0,0) = 1.0; m(0,1) = 2.0; m(0,2) = 3.0;
+   m(1,0) = 4.0; m(1,1) = 5.0; m(1,2) = 6.0;
+
+   v = m.view_row(0) + m.view_row(1);
+
+   assert_true(v.size() == 3, LOG);
+   assert_true(v[0] == 5.0, LOG);
+   assert_true(v[1] == 7.0, LOG);
+   assert_true(v[2] == 9.0, LOG);
+
+   assert_true(m.view_row(1).dot(m.view_row(0)) == 32.0, LOG);
+
+   v.set(3, 1.0);
+
+   assert_true(v.dot(m.view_row(1)) == 15.0, LOG);
+
+   assert_true(m.view_row(1).calculate_partial_sum(Vector<size_t>(0, 2, 2)) == 10.0, LOG);
+}
+
+
+void MatrixTest::test_view_column(void)
+{
+   message += "test_view_column\n";
+
+   Matrix<double> m(4, 3);
+   m.randomize_normal();
+
+   VectorView<double> column;
+
+   Statistics<double> statistics;
+
+   // Test
+
+   for(size_t j = 0; j < 3; j++)
+   {
+      column = m.view_column(j);
+
+      assert_true(column.size() == 4, LOG);
+      assert_true(column.is_contiguous(), LOG);
+
+      assert_true(Vector<double>(column) == m.arrange_column(j), LOG);
+
+      statistics = column.calculate_statistics();
+
+      assert_true(fabs(statistics.mean - m.arrange_column(j).calculate_mean()) < 1.0e-12, LOG);
+      assert_true(fabs(statistics.standard_deviation - m.arrange_column(j).calculate_standard_deviation()) < 1.0e-12, LOG);
+      assert_true(statistics.minimum == m.arrange_column(j).calculate_minimum(), LOG);
+      assert_true(statistics.maximum == m.arrange_column(j).calculate_maximum(), LOG);
+   }
+
+   // Test
+
+   Matrix<double> a(3, 4);
+   a.randomize_normal();
+
+   const Vector<double> product = a.dot(m.view_column(1));
+
+   assert_true(product.size() == 3, LOG);
+   assert_true((product - a.dot(m.arrange_column(1))).calculate_absolute_value() < 1.0e-12, LOG);
+
+   Matrix<double> b(2, 3);
+   b.randomize_normal();
+
+   assert_true((b.dot(m.view_row(2)) - b.dot(m.arrange_row(2))).calculate_absolute_value() < 1.0e-12, LOG);
+}
+
+
+void MatrixTest::test_view_submatrix(void)
+{
+   message += "test_view_submatrix\n";
+
+   Matrix<double> m(5, 4);
+   m.randomize_normal();
+
+   MatrixView<double> block;
+
+   // Test
+
+   block = m.view_submatrix(1, 1, 3, 2);
+
+   assert_true(block.get_rows_number() == 3, LOG);
+   assert_true(block.get_columns_number() == 2, LOG);
+   assert_true(block.get_leading_dimension() == 5, LOG);
+
+   for(size_t i = 0; i < 3; i++)
+   {
+      for(size_t j = 0; j < 2; j++)
+      {
+         assert_true(block(i,j) == m(i+1,j+1), LOG);
+      }
+   }
+
+   const Matrix<double> submatrix = block.arrange_matrix();
+
+   assert_true(submatrix.get_rows_number() == 3, LOG);
+   assert_true(submatrix.get_columns_number() == 2, LOG);
+   assert_true(submatrix == m.arrange_submatrix(Vector<size_t>(1, 1, 3), Vector<size_t>(1, 1, 2)), LOG);
+
+   assert_true(Vector<double>(block.view_row(2)) == submatrix.arrange_row(2), LOG);
+   assert_true(Vector<double>(block.view_column(1)) == submatrix.arrange_column(1), LOG);
+
+   assert_true(fabs(block.calculate_sum() - submatrix.calculate_sum()) < 1.0e-12, LOG);
+
+   // Test
+
+   Vector<double> v(2);
+   v[0] = 1.0;
+   v[1] = -2.0;
+
+   assert_true((block.dot(v) - submatrix.dot(v)).calculate_absolute_value() < 1.0e-12, LOG);
+
+   // Test
+
+   const MatrixView<double> inner_block = block.view_submatrix(1, 0, 2, 1);
+
+   assert_true(inner_block.get_rows_number() == 2, LOG);
+   assert_true(inner_block.get_columns_number() == 1, LOG);
+   assert_true(inner_block(1,0) == m(3,1), LOG);
+}
+
+
 void MatrixTest::test_arrange_submatrix(void)
 {
    message += "test_arrange_submatrix\n";
@@ -1028,6 +1366,74 @@ void MatrixTest::test_dot_matrix(void)
 }
 
 
+void MatrixTest::test_calculate_transpose_dot(void)
+{
+   message += "test_calculate_transpose_dot\n";
+
+   Matrix<double> a;
+   Matrix<double> b;
+
+   Matrix<double> c;
+
+   // Test
+
+   a.set(2, 3, 0.0);
+   b.set(2, 4, 1.0);
+
+   c = a.calculate_transpose_dot(b);
+
+   assert_true(c.get_rows_number() == 3, LOG);
+   assert_true(c.get_columns_number() == 4, LOG);
+   assert_true(c == 0.0, LOG);
+
+   // Test
+
+   a.set(5, 2);
+   a.randomize_normal();
+
+   b.set(5, 3);
+   b.randomize_normal();
+
+   c = a.calculate_transpose_dot(b);
+
+   assert_true((c - a.calculate_transpose().dot(b)).calculate_absolute_value() < 1.0e-9, LOG);
+}
+
+
+void MatrixTest::test_sum_lower_rank_update(void)
+{
+   message += "test_sum_lower_rank_update\n";
+
+   Matrix<double> a;
+
+   Matrix<double> b;
+
+   // Test
+
+   a.set(7, 10);
+   a.randomize_normal();
+
+   b.set(10, 10, 0.0);
+
+   b.sum_lower_rank_update(a, 0, 3);
+   b.sum_lower_rank_update(a, 3, 4);
+   b.sum_lower_rank_update(a, 4, 10);
+
+   b.copy_lower_triangle_to_upper();
+
+   assert_true((b - a.calculate_transpose().dot(a)).calculate_absolute_value() < 1.0e-9, LOG);
+
+   // Test
+
+   b.sum_lower_rank_update(a, 0, 10);
+
+   b.copy_lower_triangle_to_upper();
+
+   assert_true((b - a.calculate_transpose().dot(a)*2.0).calculate_absolute_value() < 1.0e-9, LOG);
+   assert_true(b.is_symmetric(), LOG);
+}
+
+
 void MatrixTest::test_direct(void)
 {
    message += "test_direct\n";
@@ -1069,6 +1475,95 @@ void MatrixTest::test_calculate_mean_standard_deviation(void)
 void MatrixTest::test_calculate_statistics(void)
 {
    message += "test_calculate_statistics\n";
+
+   Matrix<double> m;
+
+   Vector< Statistics<double> > statistics;
+
+   Vector<size_t> row_indices;
+   Vector<size_t> column_indices;
+
+   Vector< Vector<size_t> > missing_indices;
+
+   Statistics<double> column_statistics;
+
+   // Test
+
+   m.set(3, 2);
+
+   m(0,0) = 1.0; m(0,1) = 4.0;
+   m(1,0) = 2.0; m(1,1) = 4.0;
+   m(2,0) = 3.0; m(2,1) = 4.0;
+
+   statistics = m.calculate_statistics();
+
+   assert_true(statistics.size() == 2, LOG);
+
+   assert_true(statistics[0].minimum == 1.0, LOG);
+   assert_true(statistics[0].maximum == 3.0, LOG);
+   assert_true(fabs(statistics[0].mean - 2.0) < 1.0e-12, LOG);
+   assert_true(fabs(statistics[0].standard_deviation - 1.0) < 1.0e-12, LOG);
+
+   assert_true(statistics[1].minimum == 4.0, LOG);
+   assert_true(statistics[1].maximum == 4.0, LOG);
+   assert_true(fabs(statistics[1].mean - 4.0) < 1.0e-12, LOG);
+   assert_true(statistics[1].standard_deviation == 0.0, LOG);
+
+   // Test
+
+   missing_indices.set(2);
+   missing_indices[0].set(1, 2);
+
+   statistics = m.calculate_statistics_missing_values(missing_indices);
+
+   assert_true(statistics[0].maximum == 2.0, LOG);
+   assert_true(fabs(statistics[0].mean - 1.5) < 1.0e-12, LOG);
+   assert_true(fabs(statistics[0].standard_deviation - sqrt(0.5)) < 1.0e-12, LOG);
+
+   // Test
+
+   row_indices.set(2);
+   row_indices[0] = 0;
+   row_indices[1] = 2;
+
+   column_indices.set(1, 0);
+
+   statistics = m.calculate_statistics_missing_values(row_indices, column_indices, missing_indices);
+
+   assert_true(statistics.size() == 1, LOG);
+   assert_true(statistics[0].minimum == 1.0, LOG);
+   assert_true(statistics[0].maximum == 1.0, LOG);
+   assert_true(statistics[0].standard_deviation == 0.0, LOG);
+
+   // Test
+
+   m.set(200000, 3);
+   m.randomize_normal(1.0e6, 1.0);
+
+   row_indices.set(100000);
+   row_indices.initialize_sequential();
+   row_indices *= 2;
+
+   column_indices.set(3);
+   column_indices.initialize_sequential();
+
+   missing_indices.set(3, Vector<size_t>());
+   missing_indices[1].set(2);
+   missing_indices[1][0] = 0;
+   missing_indices[1][1] = 199999;
+
+   statistics = m.calculate_statistics_missing_values(row_indices, column_indices, missing_indices);
+
+   for(size_t j = 0; j < 3; j++)
+   {
+      column_statistics = m.arrange_column(j, row_indices).calculate_statistics_missing_values(j == 1 ? Vector<size_t>(1, 0) : Vector<size_t>());
+
+      assert_true(statistics[j].minimum == column_statistics.minimum, LOG);
+      assert_true(statistics[j].maximum == column_statistics.maximum, LOG);
+      assert_true(fabs(statistics[j].mean - column_statistics.mean) < 1.0e-6, LOG);
+      assert_true(fabs(statistics[j].standard_deviation - 1.0) < 1.0e-2, LOG);
+      assert_true(fabs(statistics[j].standard_deviation - column_statistics.standard_deviation) < 1.0e-9, LOG);
+   }
 }
 
 
@@ -1144,6 +1639,30 @@ void MatrixTest::test_calculate_root_mean_squared_error(void)
 }
 
 
+void MatrixTest::test_calculate_distance(void)
+{
+   message += "test_calculate_distance\n";
+
+   Matrix<double> m;
+
+   // Test
+
+   m.set(2, 3, 1.0);
+   m(1,0) = 3.0;
+   m(1,2) = -1.0;
+
+   assert_true(fabs(m.calculate_distance(0, 1) - sqrt(8.0)) < 1.0e-12, LOG);
+   assert_true(m.calculate_distance(1, 1) == 0.0, LOG);
+
+   // Test
+
+   m.set(5, 7);
+   m.randomize_normal();
+
+   assert_true(fabs(m.calculate_distance(1, 3) - m.arrange_row(1).calculate_distance(m.arrange_row(3))) < 1.0e-12, LOG);
+}
+
+
 void MatrixTest::test_calculate_minimum_maximum(void)
 {
    message += "test_calculate_minimum_maximum\n";
@@ -1307,6 +1826,142 @@ void MatrixTest::test_calculate_inverse(void)
 }
 
 
+void MatrixTest::test_calculate_LU_factorization(void)
+{
+   message += "test_calculate_LU_factorization\n";
+
+   Matrix<double> m;
+   Matrix<double> identity;
+
+   Vector<double> b;
+   Vector<double> x;
+
+   // Test
+
+   m.set(3, 3);
+
+   m(0,0) = 0.0;
+   m(0,1) = 2.0;
+   m(0,2) = 1.0;
+
+   m(1,0) = 1.0;
+   m(1,1) = 1.0;
+   m(1,2) = 1.0;
+
+   m(2,0) = 2.0;
+   m(2,1) = 1.0;
+   m(2,2) = 3.0;
+
+   LUFactorization<double> LU_factorization = m.calculate_LU_factorization();
+
+   assert_true(LU_factorization.get_size() == 3, LOG);
+   assert_true(!LU_factorization.is_singular(), LOG);
+   assert_true(fabs(LU_factorization.calculate_determinant() - m.calculate_determinant()) < 1.0e-12, LOG);
+   assert_true(fabs(LU_factorization.calculate_log_determinant() - log(fabs(m.calculate_determinant()))) < 1.0e-12, LOG);
+
+   b.set(3);
+   b[0] = 3.0;
+   b[1] = 3.0;
+   b[2] = 6.0;
+
+   x = LU_factorization.solve(b);
+
+   assert_true((m.dot(x) - b).calculate_absolute_value() < 1.0e-12, LOG);
+
+   // Test
+
+   m.set(20, 20);
+   m.randomize_normal();
+
+   identity.set(20, 20);
+   identity.initialize_identity();
+
+   LU_factorization = m.calculate_LU_factorization();
+
+   assert_true((m.dot(LU_factorization.calculate_inverse()) - identity).calculate_absolute_value() < 1.0e-9, LOG);
+   assert_true((LU_factorization.solve(m) - identity).calculate_absolute_value() < 1.0e-9, LOG);
+   assert_true((m.calculate_inverse() - LU_factorization.calculate_inverse()).calculate_absolute_value() < 1.0e-9, LOG);
+   assert_true(fabs(m.calculate_log_determinant() - LU_factorization.calculate_log_determinant()) < 1.0e-9, LOG);
+
+   // Test
+
+   b.set(20);
+   b.randomize_normal();
+
+   const Matrix<double> lower_triangular = LU_factorization.arrange_lower_triangular();
+   const Matrix<double> upper_triangular = LU_factorization.arrange_upper_triangular();
+
+   assert_true(lower_triangular(0,0) == 1.0, LOG);
+   assert_true(lower_triangular(0,19) == 0.0, LOG);
+   assert_true(upper_triangular(19,0) == 0.0, LOG);
+
+   x = lower_triangular.solve_lower_triangular(b);
+
+   assert_true((lower_triangular.dot(x) - b).calculate_absolute_value() < 1.0e-9, LOG);
+
+   x = upper_triangular.solve_upper_triangular(b);
+
+   assert_true((upper_triangular.dot(x) - b).calculate_absolute_value() < 1.0e-6, LOG);
+}
+
+
+void MatrixTest::test_calculate_Cholesky_factorization(void)
+{
+   message += "test_calculate_Cholesky_factorization\n";
+
+   Matrix<double> a;
+   Matrix<double> m;
+   Matrix<double> identity;
+
+   Vector<double> b;
+   Vector<double> x;
+
+   // Test
+
+   a.set(10, 10);
+   a.randomize_normal();
+
+   identity.set(10, 10);
+   identity.initialize_identity();
+
+   m = a.calculate_transpose().dot(a) + identity;
+
+   const CholeskyFactorization<double> Cholesky_factorization = m.calculate_Cholesky_factorization();
+
+   assert_true(Cholesky_factorization.is_positive_definite(), LOG);
+
+   const Matrix<double> lower_triangular = Cholesky_factorization.arrange_lower_triangular();
+
+   assert_true((lower_triangular.dot(lower_triangular.calculate_transpose()) - m).calculate_absolute_value() < 1.0e-9, LOG);
+
+   b.set(10);
+   b.randomize_normal();
+
+   x = Cholesky_factorization.solve(b);
+
+   assert_true((m.dot(x) - b).calculate_absolute_value() < 1.0e-9, LOG);
+   assert_true((m.dot(Cholesky_factorization.calculate_inverse()) - identity).calculate_absolute_value() < 1.0e-9, LOG);
+   assert_true(fabs(Cholesky_factorization.calculate_log_determinant() - m.calculate_log_determinant()) < 1.0e-9, LOG);
+
+   const LDLTFactorization<double> LDLT_factorization = m.calculate_LDLT_factorization();
+
+   assert_true(LDLT_factorization.is_positive_definite(), LOG);
+
+   x = LDLT_factorization.solve(b);
+
+   assert_true((m.dot(x) - b).calculate_absolute_value() < 1.0e-9, LOG);
+   assert_true(fabs(LDLT_factorization.calculate_log_determinant() - m.calculate_log_determinant()) < 1.0e-9, LOG);
+
+   // Test
+
+   m = identity*(-1.0);
+
+   assert_true(!m.calculate_Cholesky_factorization().is_positive_definite(), LOG);
+   assert_true(!m.calculate_LDLT_factorization().is_positive_definite(), LOG);
+   assert_true((m.calculate_LDLT_factorization().calculate_inverse() - m).calculate_absolute_value() < 1.0e-12, LOG);
+}
+
+
 void MatrixTest::test_is_symmetric(void)
 {
    message += "test_is_symmetric\n";
@@ -1389,6 +2044,38 @@ void MatrixTest::test_scale_columns_mean_standard_deviation(void)
 {
    message += "test_scale_columns_mean_standard_deviation\n";
 
+   Matrix<double> m;
+
+   Vector<size_t> column_indices;
+
+   Vector< Vector<size_t> > missing_indices;
+
+   Vector< Statistics<double> > statistics;
+
+   // Test
+
+   m.set(4, 3);
+   m.randomize_uniform();
+
+   m(3,1) = 1.0e3;
+
+   column_indices.set(2);
+   column_indices[0] = 0;
+   column_indices[1] = 1;
+
+   missing_indices.set(3);
+   missing_indices[1].set(1, 3);
+
+   statistics = m.scale_columns_mean_standard_deviation_missing_values(column_indices, missing_indices);
+
+   assert_true(statistics.size() == 2, LOG);
+   assert_true(statistics[1].maximum < 1.0, LOG);
+
+   statistics = m.calculate_statistics_missing_values(missing_indices);
+
+   assert_true(statistics[0].has_mean_zero_standard_deviation_one(), LOG);
+   assert_true(statistics[1].has_mean_zero_standard_deviation_one(), LOG);
+   assert_true(m(3,1) > 1.0, LOG);
 }
 
 
@@ -1417,6 +2104,32 @@ void MatrixTest::test_scale_columns_minimum_maximum(void)
 {
    message += "test_scale_columns_minimum_maximum\n";
 
+   Matrix<double> m;
+
+   Vector<size_t> column_indices;
+
+   Vector< Vector<size_t> > missing_indices;
+
+   Vector< Statistics<double> > statistics;
+
+   // Test
+
+   m.set(4, 3);
+   m.randomize_uniform(2.0, 3.0);
+
+   column_indices.set(1, 2);
+
+   missing_indices.set(3);
+
+   statistics = m.scale_columns_minimum_maximum_missing_values(column_indices, missing_indices);
+
+   assert_true(statistics.size() == 1, LOG);
+   assert_true(statistics[0].minimum >= 2.0, LOG);
+
+   statistics = m.calculate_columns_statistics(column_indices);
+
+   assert_true(statistics[0].has_minimum_minus_one_maximum_one(), LOG);
+   assert_true(m.arrange_column(0) >= 2.0, LOG);
 }
 
 
@@ -1700,6 +2413,10 @@ void MatrixTest::run_test_case(void)
    test_multiplication_assignment_operator();
    test_division_assignment_operator();
 
+   // Lazy expressions
+
+   test_lazy();
+
    // Equality and relational operators
 
    test_equal_to_operator();
@@ -1721,6 +2438,10 @@ void MatrixTest::run_test_case(void)
    test_arrange_row();
    test_arrange_column();
 
+   test_view_row();
+   test_view_column();
+   test_view_submatrix();
+
    test_arrange_submatrix();
 
    // Set methods
@@ -1769,6 +2490,10 @@ void MatrixTest::run_test_case(void)
    test_dot_vector();
    test_dot_matrix();
 
+   test_calculate_transpose_dot();
+
+   test_sum_lower_rank_update();
+
    test_direct();
 
    test_calculate_minimum_maximum();
@@ -1787,11 +2512,16 @@ void MatrixTest::run_test_case(void)
    test_calculate_mean_squared_error();
    test_calculate_root_mean_squared_error();
 
+   test_calculate_distance();
+
    test_calculate_determinant();
    test_calculate_transpose();
    test_calculate_cofactor();
    test_calculate_inverse();
 
+   test_calculate_LU_factorization();
+   test_calculate_Cholesky_factorization();
+
    test_is_symmetric();
    test_is_antisymmetric();
 
@@ -67,6 +67,10 @@ public:
    void test_multiplication_assignment_operator(void);
    void test_division_assignment_operator(void);
 
+   // Lazy expressions
+
+   void test_lazy(void);
+
    // Equality and relational operators
 
    void test_equal_to_operator(void);
@@ -90,6 +94,10 @@ public:
    void test_arrange_row(void);
    void test_arrange_column(void);
 
+   void test_view_row(void);
+   void test_view_column(void);
+   void test_view_submatrix(void);
+
    void test_arrange_submatrix(void);
 
    // Set methods
@@ -138,6 +146,10 @@ public:
    void test_dot_vector(void);
    void test_dot_matrix(void);
 
+   void test_calculate_transpose_dot(void);
+
+   void test_sum_lower_rank_update(void);
+
    void test_direct(void);
 
    void test_calculate_minimum_maximum(void);
@@ -156,11 +168,16 @@ public:
    void test_calculate_mean_squared_error(void);
    void test_calculate_root_mean_squared_error(void);
 
+   void test_calculate_distance(void);
+
    void test_calculate_determinant(void);
    void test_calculate_transpose(void);
    void test_calculate_cofactor(void);
    void test_calculate_inverse(void);
 
+   void test_calculate_LU_factorization(void);
+   void test_calculate_Cholesky_factorization(void);
+
    void test_is_symmetric(void);
    void test_is_antisymmetric(void);
 
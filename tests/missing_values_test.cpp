@@ -176,6 +176,130 @@ void MissingValuesTest::test_convert_time_series(void)
 }
 
 
+void MissingValuesTest::test_arrange_complete_instances(void)
+{
+    message += "test_arrange_complete_instances\n";
+
+    MissingValues mv;
+
+    Vector<size_t> instances_indices;
+    Vector<size_t> complete_instances;
+
+    // Test
+
+    mv.set(5, 3);
+
+    instances_indices.set(3);
+    instances_indices[0] = 4;
+    instances_indices[1] = 0;
+    instances_indices[2] = 2;
+
+    complete_instances = mv.arrange_complete_instances(instances_indices);
+
+    assert_true(complete_instances == instances_indices, LOG);
+
+    // Test
+
+    mv.append(0, 1);
+    mv.append(3, 2);
+    mv.append(0, 2);
+
+    complete_instances = mv.arrange_complete_instances(instances_indices);
+
+    assert_true(complete_instances.size() == 2, LOG);
+    assert_true(complete_instances[0] == 4, LOG);
+    assert_true(complete_instances[1] == 2, LOG);
+
+    // Test
+
+    mv.build_index();
+
+    assert_true(mv.arrange_complete_instances(instances_indices) == complete_instances, LOG);
+}
+
+
+void MissingValuesTest::test_build_index(void)
+{
+    message += "test_build_index\n";
+
+    MissingValues mv;
+
+    Vector<size_t> missing_instances;
+
+    // Test
+
+    mv.set(10, 4);
+
+    assert_true(mv.is_indexed(), LOG);
+    assert_true(!mv.has_missing_values(3), LOG);
+
+    // Test
+
+    mv.append(7, 2);
+    mv.append(3, 0);
+    mv.append(1, 2);
+    mv.append(3, 3);
+
+    assert_true(!mv.is_indexed(), LOG);
+
+    mv.build_index();
+
+    assert_true(mv.is_indexed(), LOG);
+
+    assert_true(mv.has_missing_values(1), LOG);
+    assert_true(mv.has_missing_values(3), LOG);
+    assert_true(mv.has_missing_values(7), LOG);
+    assert_true(!mv.has_missing_values(0), LOG);
+    assert_true(!mv.has_missing_values(9), LOG);
+
+    assert_true(mv.is_missing_value(3, 0), LOG);
+    assert_true(mv.is_missing_value(3, 3), LOG);
+    assert_true(!mv.is_missing_value(3, 2), LOG);
+    assert_true(!mv.is_missing_value(0, 0), LOG);
+
+    assert_true(mv.has_missing_values(3, Vector<size_t>(1, 3)), LOG);
+    assert_true(!mv.has_missing_values(7, Vector<size_t>(1, 3)), LOG);
+
+    assert_true(mv.count_missing_instances() == 3, LOG);
+
+    missing_instances = mv.arrange_missing_instances();
+
+    assert_true(missing_instances.size() == 3, LOG);
+    assert_true(missing_instances[0] == 7, LOG);
+    assert_true(missing_instances[1] == 3, LOG);
+    assert_true(missing_instances[2] == 1, LOG);
+
+    missing_instances = mv.arrange_missing_instances(2);
+
+    assert_true(missing_instances.size() == 2, LOG);
+    assert_true(missing_instances[0] == 1, LOG);
+    assert_true(missing_instances[1] == 7, LOG);
+
+    assert_true(mv.arrange_missing_instances(1).empty(), LOG);
+
+    assert_true(mv.get_missing_values_numbers()[2] == 2, LOG);
+    assert_true(mv.get_missing_values_numbers()[1] == 0, LOG);
+
+    // Test
+
+    mv.set_item(0, 8, 1);
+
+    assert_true(!mv.is_indexed(), LOG);
+    assert_true(mv.has_missing_values(8), LOG);
+    assert_true(!mv.has_missing_values(7), LOG);
+
+    // Test
+
+    mv.set_missing_values_number(1);
+    mv.set_item(0, 20, 0);
+
+    mv.build_index();
+
+    assert_true(!mv.is_indexed(), LOG);
+    assert_true(mv.has_missing_values(20), LOG);
+}
+
+
 /// @todo Complete method and tests.
 
 void MissingValuesTest::test_to_XML(void)
@@ -250,6 +374,14 @@ void MissingValuesTest::run_test_case(void)
 
    test_convert_time_series();
 
+   // Missing values methods
+
+   test_arrange_complete_instances();
+
+   // Index methods
+
+   test_build_index();
+
    // Serialization methods
 
    test_to_XML();
@@ -66,6 +66,14 @@ public:
 
    void test_convert_time_series(void);
 
+   // Missing values methods
+
+   void test_arrange_complete_instances(void);
+
+   // Index methods
+
+   void test_build_index(void);
+
    // Serialization methods
 
    void test_to_XML(void);
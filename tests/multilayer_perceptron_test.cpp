@@ -3938,6 +3938,10 @@ void MultilayerPerceptronTest::test_calculate_first_order_forward_propagation(vo
 
    Vector< Vector< Vector<double> > > first_order_forward_propagation;
 
+   Matrix<double> inputs_batch;
+
+   Vector< Vector< Matrix<double> > > batch_forward_propagation;
+
    // Test
 
    n.set(2, 4, 3);
@@ -3950,6 +3954,32 @@ void MultilayerPerceptronTest::test_calculate_first_order_forward_propagation(vo
    assert_true(first_order_forward_propagation.size() == 2, LOG);
    assert_true(first_order_forward_propagation[0].size() == 2, LOG);
    assert_true(first_order_forward_propagation[1].size() == 2, LOG);
+
+   // Test
+
+   n.set(2, 4, 3);
+   n.randomize_parameters_normal();
+
+   inputs_batch.set(5, 2);
+   inputs_batch.randomize_normal();
+
+   batch_forward_propagation = n.calculate_first_order_forward_propagation(inputs_batch);
+
+   assert_true(batch_forward_propagation.size() == 2, LOG);
+   assert_true(batch_forward_propagation[0].size() == 2, LOG);
+   assert_true(batch_forward_propagation[0][1].get_rows_number() == 5, LOG);
+   assert_true(batch_forward_propagation[0][1].get_columns_number() == 3, LOG);
+
+   for(size_t i = 0; i < 5; i++)
+   {
+      first_order_forward_propagation = n.calculate_first_order_forward_propagation(inputs_batch.arrange_row(i));
+
+      for(size_t j = 0; j < 2; j++)
+      {
+         assert_true((batch_forward_propagation[0][j].arrange_row(i) - first_order_forward_propagation[0][j]).calculate_absolute_value() < 1.0e-9, LOG);
+         assert_true((batch_forward_propagation[1][j].arrange_row(i) - first_order_forward_propagation[1][j]).calculate_absolute_value() < 1.0e-9, LOG);
+      }
+   }
 }
 
 
@@ -3979,6 +4009,80 @@ void MultilayerPerceptronTest::test_calculate_second_order_forward_propagation(v
 }
 
 
+void MultilayerPerceptronTest::test_calculate_error_gradient(void)
+{
+   message += "test_calculate_error_gradient\n";
+
+   MultilayerPerceptron n;
+
+   Matrix<double> inputs;
+   Matrix<double> outputs_gradient;
+
+   Vector< Vector< Matrix<double> > > first_order_forward_propagation;
+
+   Vector<double> error_gradient;
+   Vector<double> numerical_error_gradient;
+
+   Vector<double> parameters;
+   Vector<double> perturbed_parameters;
+
+   const double epsilon = 1.0e-6;
+
+   // Test
+
+   n.set(2, 4, 3);
+   n.initialize_parameters(0.0);
+
+   inputs.set(3, 2, 0.0);
+   outputs_gradient.set(3, 3, 0.0);
+
+   first_order_forward_propagation = n.calculate_first_order_forward_propagation(inputs);
+
+   error_gradient = n.calculate_error_gradient(inputs, first_order_forward_propagation, outputs_gradient);
+
+   assert_true(error_gradient.size() == n.count_parameters_number(), LOG);
+   assert_true(error_gradient == 0.0, LOG);
+
+   // Test
+
+   n.set(3, 2, 2);
+   n.randomize_parameters_normal();
+
+   inputs.set(4, 3);
+   inputs.randomize_normal();
+
+   outputs_gradient.set(4, 2);
+   outputs_gradient.randomize_normal();
+
+   first_order_forward_propagation = n.calculate_first_order_forward_propagation(inputs);
+
+   error_gradient = n.calculate_error_gradient(inputs, first_order_forward_propagation, outputs_gradient);
+
+   parameters = n.arrange_parameters();
+
+   numerical_error_gradient.set(parameters.size());
+
+   for(size_t i = 0; i < parameters.size(); i++)
+   {
+      perturbed_parameters = parameters;
+      perturbed_parameters[i] += epsilon;
+      n.set_parameters(perturbed_parameters);
+
+      numerical_error_gradient[i] = (n.calculate_outputs(inputs)*outputs_gradient).calculate_sum();
+
+      perturbed_parameters[i] -= 2.0*epsilon;
+      n.set_parameters(perturbed_parameters);
+
+      numerical_error_gradient[i] -= (n.calculate_outputs(inputs)*outputs_gradient).calculate_sum();
+      numerical_error_gradient[i] /= 2.0*epsilon;
+   }
+
+   n.set_parameters(parameters);
+
+   assert_true((error_gradient - numerical_error_gradient).calculate_absolute_value() < 1.0e-3, LOG);
+}
+
+
 // todo
 
 void MultilayerPerceptronTest::test_write_expression(void)
@@ -4250,6 +4354,8 @@ void MultilayerPerceptronTest::run_test_case(void)
    test_calculate_first_order_forward_propagation();
    test_calculate_second_order_forward_propagation();
 
+   test_calculate_error_gradient();
+
    // Expression methods
 
    test_write_expression();
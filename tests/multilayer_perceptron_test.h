@@ -184,6 +184,8 @@ public:
 
    void test_calculate_first_order_forward_propagation(void);
    void test_calculate_second_order_forward_propagation(void);
+
+   void test_calculate_error_gradient(void);
  
    void test_calculate_layers_Jacobian(void);
    void test_calculate_layers_Hessian_form(void);
@@ -99,15 +99,30 @@ void NewtonMethodTest::test_perform_training(void)
 
    nn.initialize_parameters(0.1);
 
-//   double old_performance = pf.calculate_performance();
+   double old_performance = pf.calculate_performance();
 
    nm.set_display(false);
    nm.set_maximum_iterations_number(1);
-//   nm.perform_training();
+   nm.perform_training();
 
-//   double performance = pf.calculate_performance();
+   double performance = pf.calculate_performance();
    
-//   assert_true(evaluation < old_performance, LOG);
+   assert_true(performance <= old_performance, LOG);
+
+   // Truncated Newton
+
+   nn.initialize_parameters(0.1);
+
+   old_performance = pf.calculate_performance();
+
+   nm.set_training_direction_method(NewtonMethod::TruncatedNewton);
+   nm.perform_training();
+
+   performance = pf.calculate_performance();
+
+   assert_true(performance <= old_performance, LOG);
+
+   nm.set_training_direction_method(NewtonMethod::FullNewton);
 
    // Minimum parameters increment norm
 
@@ -213,6 +228,22 @@ void NewtonMethodTest::test_from_XML(void)
    nm.from_XML(*document);
 
    delete document;
+
+   // Test
+
+   nm.set_training_direction_method(NewtonMethod::TruncatedNewton);
+   nm.set_maximum_conjugate_gradient_iterations_number(7);
+
+   document = nm.to_XML();
+
+   NewtonMethod nm1;
+
+   nm1.from_XML(*document);
+
+   assert_true(nm1.get_training_direction_method() == NewtonMethod::TruncatedNewton, LOG);
+   assert_true(nm1.get_maximum_conjugate_gradient_iterations_number() == 7, LOG);
+
+   delete document;
 }
 
 
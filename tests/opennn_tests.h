@@ -27,6 +27,7 @@
 #include "instances_test.h"
 #include "variables_test.h"
 #include "missing_values_test.h"
+#include "spatial_index_test.h"
 #include "data_set_test.h"
 
 #include "mathematical_model_test.h"
@@ -67,6 +68,7 @@
 #include "random_search_test.h"
 #include "evolutionary_algorithm_test.h"
 #include "gradient_descent_test.h"
+#include "stochastic_gradient_descent_test.h"
 #include "conjugate_gradient_test.h"
 #include "quasi_newton_method_test.h"
 #include "newton_method_test.h"
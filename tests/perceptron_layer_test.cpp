@@ -328,6 +328,25 @@ void PerceptronLayerTest::test_set_parameters(void)
    pl.set_parameters(parameters);
 
    assert_true(pl.arrange_parameters() == parameters, LOG);
+
+   // Test
+
+   pl.set(2, 3);
+
+   parameters.set(12);
+   parameters.initialize_sequential();
+
+   pl.set_parameters(parameters, 3);
+
+   assert_true(pl.arrange_parameters() == parameters.take_out(3, 9), LOG);
+
+   parameters.initialize(0.0);
+
+   pl.arrange_parameters(parameters, 3);
+
+   assert_true(parameters[2] == 0.0, LOG);
+   assert_true(parameters[3] == 3.0, LOG);
+   assert_true(parameters[11] == 11.0, LOG);
 }
 
 
@@ -343,6 +362,90 @@ void PerceptronLayerTest::test_set_size(void)
 }
 
 
+void PerceptronLayerTest::test_set_perceptrons(void)
+{
+   message += "test_set_perceptrons\n";
+
+   PerceptronLayer pl;
+
+   Vector<Perceptron> perceptrons(2, Perceptron(3));
+
+   // Test
+
+   perceptrons[0].set_activation_function(Perceptron::Logistic);
+   perceptrons[1].set_activation_function(Perceptron::Logistic);
+
+   perceptrons[1].set_bias(2.0);
+
+   pl.set_perceptrons(perceptrons);
+
+   assert_true(pl.get_perceptrons_number() == 2, LOG);
+   assert_true(pl.get_activation_function() == Perceptron::Logistic, LOG);
+   assert_true(pl.get_perceptron(1).get_bias() == 2.0, LOG);
+
+   // Test
+
+   perceptrons[1].set_activation_function(Perceptron::Linear);
+
+   try
+   {
+      pl.set_perceptrons(perceptrons);
+
+      assert_true(false, LOG);
+   }
+   catch(const std::logic_error&)
+   {
+      assert_true(pl.get_activation_function() == Perceptron::Logistic, LOG);
+   }
+}
+
+
+void PerceptronLayerTest::test_set_perceptron(void)
+{
+   message += "test_set_perceptron\n";
+
+   PerceptronLayer pl;
+
+   Perceptron perceptron(2);
+
+   // Test
+
+   pl.set(2, 3);
+   pl.set_activation_function(Perceptron::Logistic);
+
+   perceptron.set_activation_function(Perceptron::Logistic);
+   perceptron.set_bias(1.0);
+
+   pl.set_perceptron(1, perceptron);
+
+   assert_true(pl.get_perceptron(1).get_bias() == 1.0, LOG);
+   assert_true(pl.get_activation_function() == Perceptron::Logistic, LOG);
+
+   // Test
+
+   perceptron.set_activation_function(Perceptron::Linear);
+
+   try
+   {
+      pl.set_perceptron(1, perceptron);
+
+      assert_true(false, LOG);
+   }
+   catch(const std::logic_error&)
+   {
+      assert_true(pl.get_activation_function() == Perceptron::Logistic, LOG);
+   }
+
+   // Test
+
+   pl.set(2, 1);
+
+   pl.set_perceptron(0, perceptron);
+
+   assert_true(pl.get_activation_function() == Perceptron::Linear, LOG);
+}
+
+
 void PerceptronLayerTest::test_set_activation_function(void)
 {
    message += "test_set_activation_function\n";
@@ -708,6 +811,30 @@ void PerceptronLayerTest::test_calculate_combination(void)
 
    assert_true(pl.calculate_combinations(inputs) == pl.calculate_combinations(inputs, parameters), LOG);
 
+   // Test
+
+   pl.set(3, 4);
+
+   inputs.set(3);
+   inputs.randomize_normal();
+
+   combination = pl.calculate_combinations(inputs);
+
+   for(size_t i = 0; i < 4; i++)
+   {
+      assert_true(fabs(combination[i] - pl.get_perceptron(i).calculate_combination(inputs)) < 1.0e-12, LOG);
+   }
+
+   // Test
+
+   Perceptron perceptron(3, 0.5);
+
+   pl.set_perceptron(2, perceptron);
+
+   combination = pl.calculate_combinations(inputs);
+
+   assert_true(fabs(combination[2] - (0.5 + 0.5*inputs.calculate_sum())) < 1.0e-12, LOG);
+   assert_true(pl.get_perceptron(2).arrange_parameters() == 0.5, LOG);
 }
 
 
@@ -1838,6 +1965,9 @@ void PerceptronLayerTest::run_test_case(void)
    test_set();
    test_set_default();
 
+   test_set_perceptrons();
+   test_set_perceptron();
+
    // Perceptron layer parameters
 
    test_set_biases();
@@ -91,6 +91,9 @@ public:
 
    void test_set_size(void);
 
+   void test_set_perceptrons(void);
+   void test_set_perceptron(void);
+
    // Parameters
 
    void test_set_biases(void);
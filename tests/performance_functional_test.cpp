@@ -305,6 +305,45 @@ void PerformanceFunctionalTest::test_calculate_gradient(void)
 }
 
 
+void PerformanceFunctionalTest::test_calculate_performance_and_gradient(void)
+{
+   message += "test_calculate_performance_and_gradient\n";
+
+   NeuralNetwork nn;
+   DataSet ds;
+
+   PerformanceFunctional pf(&nn, &ds);
+
+   PerformanceFunctional::FirstOrderperformance first_order_performance;
+
+   // Test
+
+   nn.set(2, 3, 2);
+   nn.randomize_parameters_normal();
+
+   ds.set(10, 2, 2);
+   ds.randomize_data_normal();
+
+   pf.set_objective_type(PerformanceFunctional::MEAN_SQUARED_ERROR_OBJECTIVE);
+   pf.set_regularization_type(PerformanceFunctional::NEURAL_PARAMETERS_NORM_REGULARIZATION);
+
+   first_order_performance = pf.calculate_performance_and_gradient();
+
+   assert_true(fabs(first_order_performance.performance - pf.calculate_performance()) < 1.0e-9, LOG);
+   assert_true((first_order_performance.gradient - pf.calculate_gradient()).calculate_absolute_value() < 1.0e-9, LOG);
+
+   // Test
+
+   pf.set_objective_type(PerformanceFunctional::ROOT_MEAN_SQUARED_ERROR_OBJECTIVE);
+   pf.set_regularization_type(PerformanceFunctional::NO_REGULARIZATION);
+
+   first_order_performance = pf.calculate_performance_and_gradient();
+
+   assert_true(fabs(first_order_performance.performance - pf.calculate_performance()) < 1.0e-9, LOG);
+   assert_true((first_order_performance.gradient - pf.calculate_gradient()).calculate_absolute_value() < 1.0e-9, LOG);
+}
+
+
 void PerformanceFunctionalTest::test_calculate_gradient_norm(void)
 {
    message += "test_calculate_gradient_norm\n";
@@ -385,34 +424,86 @@ void PerformanceFunctionalTest::test_calculate_inverse_Hessian(void)
 {
    message += "test_calculate_inverse_Hessian\n";
 
-//   NeuralNetwork nn(1, 1);
+   DataSet ds(5, 1, 1);
+   ds.randomize_data_normal();
 
-//   PerformanceFunctional pf(&nn);
+   NeuralNetwork nn(1, 1);
+   nn.randomize_parameters_normal();
 
-//   Matrix<double> Hessian = pf.calculate_Hessian();
+   PerformanceFunctional pf(&nn, &ds);
 
-//   assert_true(pf.calculate_inverse_Hessian() == Hessian.calculate_inverse(), LOG);
+   const Matrix<double> Hessian = pf.calculate_Hessian();
 
-}
+   const Matrix<double> inverse_Hessian = pf.calculate_inverse_Hessian();
 
+   Matrix<double> identity(Hessian.get_rows_number(), Hessian.get_columns_number());
+   identity.initialize_identity();
+
+   assert_true((Hessian.dot(inverse_Hessian) - identity).calculate_absolute_value() < 1.0e-6, LOG);
+
+}
 
-// @todo
 
 void PerformanceFunctionalTest::test_calculate_vector_dot_Hessian(void)
 {
    message += "test_calculate_vector_dot_Hessian\n";
 
-//   NeuralNetwork nn(1, 1);
+   NeuralNetwork nn(2, 3, 1);
+   nn.randomize_parameters_normal();
+
+   const size_t parameters_number = nn.count_parameters_number();
+
+   DataSet ds(10, 2, 1);
+   ds.randomize_data_normal();
+
+   PerformanceFunctional pf(&nn, &ds);
+
+   const Vector<double> parameters = nn.arrange_parameters();
+
+   Vector<double> vector(parameters_number);
+   vector.randomize_normal();
+
+   const double step = 1.0e-5;
+
+   Vector<double> forward_gradient;
+   Vector<double> backward_gradient;
+
+   // Test
+
+   pf.set_objective_type(PerformanceFunctional::SUM_SQUARED_ERROR_OBJECTIVE);
+
+   nn.set_parameters(parameters + vector*step);
+   forward_gradient = pf.calculate_gradient();
+
+   nn.set_parameters(parameters - vector*step);
+   backward_gradient = pf.calculate_gradient();
+
+   nn.set_parameters(parameters);
+
+   assert_true((pf.calculate_vector_dot_Hessian(vector) - (forward_gradient - backward_gradient)/(2.0*step)).calculate_absolute_value() < 1.0e-4, LOG);
+
+   // Test
 
-//   size_t parameters_number = nn.count_parameters_number();
+   pf.set_objective_type(PerformanceFunctional::MEAN_SQUARED_ERROR_OBJECTIVE);
 
-//   PerformanceFunctional pf(&nn);
+   nn.set_parameters(parameters + vector*step);
+   forward_gradient = pf.calculate_gradient();
 
-//   Vector<double> vector(0.0, 1.0, parameters_number-1.0);
+   nn.set_parameters(parameters - vector*step);
+   backward_gradient = pf.calculate_gradient();
 
-//   Matrix<double> Hessian = pf.calculate_Hessian();
+   nn.set_parameters(parameters);
 
-//   assert_true(pf.calculate_vector_dot_Hessian(vector) == vector.dot(Hessian), LOG);
+   assert_true((pf.calculate_vector_dot_Hessian(vector) - (forward_gradient - backward_gradient)/(2.0*step)).calculate_absolute_value() < 1.0e-4, LOG);
+
+   // Test
+
+   pf.set_objective_type(PerformanceFunctional::NORMALIZED_SQUARED_ERROR_OBJECTIVE);
+   pf.set_regularization_type(PerformanceFunctional::NEURAL_PARAMETERS_NORM_REGULARIZATION);
+
+   const Vector<double> vector_Hessian_product = pf.calculate_objective_vector_dot_Hessian(vector) + pf.calculate_regularization_Hessian().dot(vector);
+
+   assert_true((pf.calculate_vector_dot_Hessian(vector) - vector_Hessian_product).calculate_absolute_value() < 1.0e-9, LOG);
 }
 
 
@@ -728,6 +819,8 @@ void PerformanceFunctionalTest::run_test_case(void)
 
    test_calculate_gradient();
 
+   test_calculate_performance_and_gradient();
+
    test_calculate_gradient_norm();
 
    test_calculate_Hessian();
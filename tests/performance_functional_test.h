@@ -82,6 +82,8 @@ public:
 
    void test_calculate_gradient(void);
 
+   void test_calculate_performance_and_gradient(void);
+
    void test_calculate_gradient_norm(void);
 
    void test_calculate_Hessian(void);
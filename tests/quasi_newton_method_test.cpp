@@ -73,6 +73,9 @@ void QuasiNewtonMethodTest::test_get_inverse_Hessian_approximation_method(void)
 
    qnm.set_inverse_Hessian_approximation_method(QuasiNewtonMethod::BFGS);
    assert_true(qnm.get_inverse_Hessian_approximation_method() == QuasiNewtonMethod::BFGS, LOG);
+
+   qnm.set_inverse_Hessian_approximation_method(QuasiNewtonMethod::LBFGS);
+   assert_true(qnm.get_inverse_Hessian_approximation_method() == QuasiNewtonMethod::LBFGS, LOG);
 }
 
 
@@ -90,6 +93,10 @@ void QuasiNewtonMethodTest::test_set_inverse_Hessian_approximation_method(void)
 
    qnm.set_inverse_Hessian_approximation_method(QuasiNewtonMethod::BFGS);
    assert_true(qnm.get_inverse_Hessian_approximation_method() == QuasiNewtonMethod::BFGS, LOG);
+
+   qnm.set_inverse_Hessian_approximation_method("L-BFGS");
+   assert_true(qnm.get_inverse_Hessian_approximation_method() == QuasiNewtonMethod::LBFGS, LOG);
+   assert_true(qnm.write_inverse_Hessian_approximation_method() == "L-BFGS", LOG);
 }
 
 
@@ -287,6 +294,64 @@ void QuasiNewtonMethodTest::test_calculate_training_direction(void)
 }
 
 
+void QuasiNewtonMethodTest::test_calculate_limited_memory_training_direction(void)
+{
+   message += "test_calculate_limited_memory_training_direction\n";
+
+   NeuralNetwork nn(1, 2);
+
+   PerformanceFunctional pf(&nn);
+
+   QuasiNewtonMethod qnm(&pf);
+
+   const size_t parameters_number = nn.count_parameters_number();
+
+   Vector<double> gradient(parameters_number);
+   gradient.randomize_normal();
+
+   Vector< Vector<double> > parameters_differences;
+   Vector< Vector<double> > gradient_differences;
+
+   Vector<double> training_direction;
+
+   // Test
+
+   training_direction = qnm.calculate_limited_memory_training_direction(gradient, parameters_differences, gradient_differences);
+
+   assert_true((training_direction - qnm.calculate_gradient_descent_training_direction(gradient)).calculate_absolute_value() < 1.0e-12, LOG);
+
+   // Test
+
+   Vector<double> Hessian_diagonal(1.0, 1.0, (double)parameters_number);
+
+   Vector<double> zero(parameters_number, 0.0);
+   Vector<double> parameters_difference(parameters_number);
+
+   for(size_t i = 0; i < 3; i++)
+   {
+      parameters_difference.randomize_normal();
+
+      parameters_differences.push_back(parameters_difference);
+      gradient_differences.push_back(parameters_difference*Hessian_diagonal);
+   }
+
+   const double scaling = parameters_differences[2].dot(gradient_differences[2])/gradient_differences[2].dot(gradient_differences[2]);
+
+   Matrix<double> inverse_Hessian(parameters_number, parameters_number);
+   inverse_Hessian.initialize_identity();
+   inverse_Hessian = inverse_Hessian*scaling;
+
+   for(size_t i = 0; i < 3; i++)
+   {
+      inverse_Hessian = qnm.calculate_BFGS_inverse_Hessian(zero, parameters_differences[i], zero, gradient_differences[i], inverse_Hessian);
+   }
+
+   training_direction = qnm.calculate_limited_memory_training_direction(gradient, parameters_differences, gradient_differences);
+
+   assert_true((training_direction - qnm.calculate_training_direction(gradient, inverse_Hessian)).calculate_absolute_value() < 1.0e-9, LOG);
+}
+
+
 void QuasiNewtonMethodTest::test_perform_training(void)
 {
    message += "test_perform_training\n";
@@ -382,6 +447,28 @@ void QuasiNewtonMethodTest::test_perform_training(void)
    double gradient_norm = pf.calculate_gradient().calculate_norm();
    assert_true(gradient_norm < gradient_norm_goal, LOG);
 
+   // Limited memory BFGS
+
+   nn.initialize_parameters(3.1415927);
+
+   old_performance = pf.calculate_performance();
+
+   qnm.set_inverse_Hessian_approximation_method(QuasiNewtonMethod::LBFGS);
+   qnm.set_limited_memory_size(3);
+
+   qnm.set_minimum_parameters_increment_norm(0.0);
+   qnm.set_performance_goal(0.0);
+   qnm.set_minimum_performance_increase(0.0);
+   qnm.set_gradient_norm_goal(0.0);
+   qnm.set_maximum_iterations_number(10);
+   qnm.set_maximum_time(1000.0);
+
+   qnm.perform_training();
+
+   performance = pf.calculate_performance();
+
+   assert_true(performance < old_performance, LOG);
+
 }
 
 
@@ -395,6 +482,22 @@ void QuasiNewtonMethodTest::test_to_XML(void)
    assert_true(document != NULL, LOG);
 
    delete document;
+
+   // Test
+
+   qnm.set_inverse_Hessian_approximation_method(QuasiNewtonMethod::LBFGS);
+   qnm.set_limited_memory_size(5);
+
+   document = qnm.to_XML();
+
+   QuasiNewtonMethod qnm_copy;
+
+   qnm_copy.from_XML(*document);
+
+   assert_true(qnm_copy.get_inverse_Hessian_approximation_method() == QuasiNewtonMethod::LBFGS, LOG);
+   assert_true(qnm_copy.get_limited_memory_size() == 5, LOG);
+
+   delete document;
 }
 
 
@@ -468,6 +571,7 @@ void QuasiNewtonMethodTest::run_test_case(void)
 
    test_calculate_inverse_Hessian_approximation();
    test_calculate_training_direction();
+   test_calculate_limited_memory_training_direction();
 
    test_perform_training();
 
@@ -64,6 +64,7 @@ public:
 
    void test_calculate_inverse_Hessian_approximation(void);
    void test_calculate_training_direction(void);
+   void test_calculate_limited_memory_training_direction(void);
 
    void test_perform_training(void);
 
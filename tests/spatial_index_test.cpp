@@ -0,0 +1,291 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.artelnics.com/opennn                                                                                   */
+/*                                                                                                              */
+/*   S P A T I A L   I N D E X   T E S T   C L A S S                                                            */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   Artelnics - Making intelligent use of data                                                                 */
+/*   robertolopez@artelnics.com                                                                                 */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// Unit testing includes
+
+#include "spatial_index_test.h"
+
+using namespace OpenNN;
+
+
+// GENERAL CONSTRUCTOR
+
+SpatialIndexTest::SpatialIndexTest(void) : UnitTesting()
+{
+}
+
+
+// DESTRUCTOR
+
+SpatialIndexTest::~SpatialIndexTest(void)
+{
+}
+
+
+// METHODS
+
+void SpatialIndexTest::test_constructor(void)
+{
+   message += "test_constructor\n";
+
+   // Default constructor
+
+   SpatialIndex si1;
+
+   assert_true(si1.get_points_number() == 0, LOG);
+   assert_true(si1.get_dimensions_number() == 0, LOG);
+   assert_true(si1.count_nodes_number() == 0, LOG);
+
+   // Points constructor
+
+   Matrix<double> points(100, 3);
+   points.randomize_uniform();
+
+   SpatialIndex si2(points);
+
+   assert_true(si2.get_points_number() == 100, LOG);
+   assert_true(si2.get_dimensions_number() == 3, LOG);
+   assert_true(si2.get_search_method() == SpatialIndex::KDTree, LOG);
+   assert_true(si2.count_nodes_number() > 1, LOG);
+}
+
+
+void SpatialIndexTest::test_destructor(void)
+{
+   message += "test_destructor\n";
+}
+
+
+void SpatialIndexTest::test_set(void)
+{
+   message += "test_set\n";
+
+   SpatialIndex si;
+
+   Matrix<double> points;
+
+   // Test
+
+   points.set(10, 20);
+   points.randomize_uniform();
+
+   si.set(points);
+
+   assert_true(si.get_points_number() == 10, LOG);
+   assert_true(si.get_dimensions_number() == 20, LOG);
+   assert_true(si.get_search_method() == SpatialIndex::BruteForce, LOG);
+   assert_true(si.count_nodes_number() == 0, LOG);
+
+   // Test
+
+   si.set();
+
+   assert_true(si.get_points_number() == 0, LOG);
+}
+
+
+void SpatialIndexTest::test_set_search_method(void)
+{
+   message += "test_set_search_method\n";
+
+   Matrix<double> points(50, 2);
+   points.randomize_uniform();
+
+   SpatialIndex si(points);
+
+   // Test
+
+   si.set_search_method(SpatialIndex::BruteForce);
+
+   assert_true(si.get_search_method() == SpatialIndex::BruteForce, LOG);
+   assert_true(si.write_search_method() == "BruteForce", LOG);
+   assert_true(si.count_nodes_number() == 0, LOG);
+
+   // Test
+
+   si.set_search_method(SpatialIndex::KDTree);
+
+   assert_true(si.get_search_method() == SpatialIndex::KDTree, LOG);
+   assert_true(si.write_search_method() == "KDTree", LOG);
+   assert_true(si.count_nodes_number() > 1, LOG);
+}
+
+
+void SpatialIndexTest::test_set_leaf_size(void)
+{
+   message += "test_set_leaf_size\n";
+
+   Matrix<double> points(64, 2);
+   points.randomize_uniform();
+
+   SpatialIndex si(points);
+
+   // Test
+
+   si.set_leaf_size(64);
+
+   assert_true(si.get_leaf_size() == 64, LOG);
+   assert_true(si.count_nodes_number() == 1, LOG);
+
+   // Test
+
+   si.set_leaf_size(1);
+
+   assert_true(si.count_nodes_number() == 127, LOG);
+}
+
+
+void SpatialIndexTest::test_calculate_nearest_neighbors(void)
+{
+   message += "test_calculate_nearest_neighbors\n";
+
+   SpatialIndex si;
+
+   Matrix<double> points;
+
+   Matrix<size_t> nearest_neighbors;
+   Matrix<double> nearest_distances;
+
+   Matrix<size_t> brute_force_neighbors;
+   Matrix<double> brute_force_distances;
+
+   // Test
+
+   points.set(4, 1);
+
+   points(0,0) = 0.0;
+   points(1,0) = 1.0;
+   points(2,0) = 3.0;
+   points(3,0) = 7.0;
+
+   si.set(points);
+
+   si.calculate_nearest_neighbors(2, nearest_neighbors, nearest_distances);
+
+   assert_true(nearest_neighbors.get_rows_number() == 4, LOG);
+   assert_true(nearest_neighbors.get_columns_number() == 2, LOG);
+
+   assert_true(nearest_neighbors(0,0) == 1, LOG);
+   assert_true(nearest_neighbors(0,1) == 2, LOG);
+   assert_true(nearest_neighbors(3,0) == 2, LOG);
+   assert_true(nearest_neighbors(3,1) == 1, LOG);
+
+   assert_true(nearest_distances(0,0) == 1.0, LOG);
+   assert_true(nearest_distances(0,1) == 3.0, LOG);
+   assert_true(nearest_distances(3,0) == 4.0, LOG);
+   assert_true(nearest_distances(3,1) == 6.0, LOG);
+
+   // Test
+
+   points.set(1000, 3);
+   points.randomize_normal();
+
+   si.set(points);
+
+   si.calculate_nearest_neighbors(5, nearest_neighbors, nearest_distances);
+
+   si.set_search_method(SpatialIndex::BruteForce);
+
+   si.calculate_nearest_neighbors(5, brute_force_neighbors, brute_force_distances);
+
+   assert_true(nearest_neighbors == brute_force_neighbors, LOG);
+   assert_true((nearest_distances - brute_force_distances).calculate_absolute_value() < 1.0e-9, LOG);
+
+   // Test
+
+   points.set(300, 20);
+   points.randomize_uniform();
+
+   si.set(points);
+
+   si.calculate_nearest_neighbors(3, nearest_neighbors, nearest_distances);
+
+   for(size_t i = 0; i < 300; i++)
+   {
+      double minimum_distance = 1.0e99;
+
+      for(size_t j = 0; j < 300; j++)
+      {
+         if(j != i && points.calculate_distance(i, j) < minimum_distance)
+         {
+            minimum_distance = points.calculate_distance(i, j);
+         }
+      }
+
+      assert_true(fabs(nearest_distances(i,0) - minimum_distance) < 1.0e-9, LOG);
+      assert_true(nearest_distances(i,0) <= nearest_distances(i,1), LOG);
+      assert_true(nearest_distances(i,1) <= nearest_distances(i,2), LOG);
+      assert_true(nearest_neighbors(i,0) != i, LOG);
+   }
+
+   // Test
+
+   points.set(4, 1, 0.0);
+
+   si.set(points);
+
+   bool rejected = false;
+
+   try
+   {
+      si.calculate_nearest_neighbors(4, nearest_neighbors, nearest_distances);
+   }
+   catch(const std::logic_error&)
+   {
+      rejected = true;
+   }
+
+   assert_true(rejected, LOG);
+}
+
+
+void SpatialIndexTest::run_test_case(void)
+{
+   message += "Running spatial index test case...\n";
+
+   // Constructor and destructor methods
+
+   test_constructor();
+   test_destructor();
+
+   // Set methods
+
+   test_set();
+
+   test_set_search_method();
+   test_set_leaf_size();
+
+   // Nearest neighbors methods
+
+   test_calculate_nearest_neighbors();
+
+   message += "End of spatial index test case.\n";
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (C) 2005-2015 Roberto Lopez.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -0,0 +1,83 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.artelnics.com/opennn                                                                                   */
+/*                                                                                                              */
+/*   S P A T I A L   I N D E X   T E S T   C L A S S   H E A D E R                                              */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   Artelnics - Making intelligent use of data                                                                 */
+/*   robertolopez@artelnics.com                                                                                 */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __SPATIALINDEXTEST_H__
+#define __SPATIALINDEXTEST_H__
+
+// Unit testing includes
+
+#include "unit_testing.h"
+
+using namespace OpenNN;
+
+class SpatialIndexTest : public UnitTesting
+{
+
+#define STRING(x) #x
+#define TOSTRING(x) STRING(x)
+#define LOG __FILE__ ":" TOSTRING(__LINE__)"\n"
+
+public:
+
+   // GENERAL CONSTRUCTOR
+
+   explicit SpatialIndexTest(void);
+
+
+   // DESTRUCTOR
+
+   virtual ~SpatialIndexTest(void);
+
+
+   // METHODS
+
+   // Constructor and destructor methods
+
+   void test_constructor(void);
+   void test_destructor(void);
+
+   // Set methods
+
+   void test_set(void);
+
+   void test_set_search_method(void);
+   void test_set_leaf_size(void);
+
+   // Nearest neighbors methods
+
+   void test_calculate_nearest_neighbors(void);
+
+   // Unit testing methods
+
+   void run_test_case(void);
+};
+
+#endif
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (C) 2005-2015 Roberto Lopez.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -0,0 +1,612 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.artelnics.com/opennn                                                                                   */
+/*                                                                                                              */
+/*   S T O C H A S T I C   G R A D I E N T   D E S C E N T   T E S T   C L A S S                                */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   Artelnics - Making intelligent use of data                                                                 */
+/*   robertolopez@artelnics.com                                                                                 */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// Unit testing includes
+
+#include "stochastic_gradient_descent_test.h"
+
+using namespace OpenNN;
+
+
+// GENERAL CONSTRUCTOR 
+
+StochasticGradientDescentTest::StochasticGradientDescentTest(void) : UnitTesting()
+{
+}
+
+
+// DESTRUCTOR
+
+StochasticGradientDescentTest::~StochasticGradientDescentTest(void)
+{
+}
+
+
+// METHODS
+
+void StochasticGradientDescentTest::test_constructor(void)
+{
+   message += "test_constructor\n"; 
+
+   PerformanceFunctional pf;
+
+   // Default constructor
+
+   StochasticGradientDescent sgd1;
+   assert_true(sgd1.has_performance_functional() == false, LOG);
+
+   // Performance functional constructor
+
+   StochasticGradientDescent sgd2(&pf);
+   assert_true(sgd2.has_performance_functional() == true, LOG);
+}
+
+
+void StochasticGradientDescentTest::test_destructor(void)
+{
+   message += "test_destructor\n"; 
+}
+
+
+void StochasticGradientDescentTest::test_write_update_method(void)
+{
+   message += "test_write_update_method\n";
+
+   StochasticGradientDescent sgd;
+
+   sgd.set_update_method(StochasticGradientDescent::Momentum);
+   assert_true(sgd.write_update_method() == "Momentum", LOG);
+
+   sgd.set_update_method(StochasticGradientDescent::Nesterov);
+   assert_true(sgd.write_update_method() == "Nesterov", LOG);
+
+   sgd.set_update_method(StochasticGradientDescent::Adam);
+   assert_true(sgd.write_update_method() == "Adam", LOG);
+}
+
+
+void StochasticGradientDescentTest::test_set_update_method(void)
+{
+   message += "test_set_update_method\n";
+
+   StochasticGradientDescent sgd;
+
+   sgd.set_update_method("Nesterov");
+   assert_true(sgd.get_update_method() == StochasticGradientDescent::Nesterov, LOG);
+
+   sgd.set_update_method("Momentum");
+   assert_true(sgd.get_update_method() == StochasticGradientDescent::Momentum, LOG);
+}
+
+
+void StochasticGradientDescentTest::test_set_reserve_parameters_history(void)
+{
+   message += "test_set_reserve_parameters_history\n";
+
+   StochasticGradientDescent sgd;
+
+   assert_true(sgd.get_reserve_parameters_history() == false, LOG);
+
+   sgd.set_reserve_parameters_history(true);
+
+   assert_true(sgd.get_reserve_parameters_history() == true, LOG);
+}
+
+
+void StochasticGradientDescentTest::test_arrange_mini_batches(void)
+{
+   message += "test_arrange_mini_batches\n";
+
+   StochasticGradientDescent sgd;
+
+   Vector<size_t> instances_indices(0, 1, 9);
+
+   Vector< Vector<size_t> > mini_batches;
+
+   // Test
+
+   sgd.set_batch_size(4);
+
+   mini_batches = sgd.arrange_mini_batches(instances_indices);
+
+   assert_true(mini_batches.size() == 3, LOG);
+   assert_true(mini_batches[0].size() == 4, LOG);
+   assert_true(mini_batches[1].size() == 4, LOG);
+   assert_true(mini_batches[2].size() == 2, LOG);
+   assert_true(mini_batches[1][0] == 4, LOG);
+   assert_true(mini_batches[2][1] == 9, LOG);
+
+   // Test
+
+   sgd.set_batch_size(20);
+
+   mini_batches = sgd.arrange_mini_batches(instances_indices);
+
+   assert_true(mini_batches.size() == 1, LOG);
+   assert_true(mini_batches[0] == instances_indices, LOG);
+}
+
+
+void StochasticGradientDescentTest::test_calculate_mini_batch_performance_and_gradient(void)
+{
+   message += "test_calculate_mini_batch_performance_and_gradient\n";
+
+   DataSet ds(10, 2, 1);
+   ds.randomize_data_normal();
+   ds.get_instances_pointer()->set_training();
+
+   NeuralNetwork nn(2, 3, 1);
+   nn.randomize_parameters_normal();
+
+   PerformanceFunctional pf(&nn, &ds);
+
+   pf.destruct_all_terms();
+   pf.set_objective_type(PerformanceFunctional::MEAN_SQUARED_ERROR_OBJECTIVE);
+
+   StochasticGradientDescent sgd(&pf);
+
+   const Vector<size_t> training_indices = ds.get_instances().arrange_training_indices();
+
+   PerformanceFunctional::FirstOrderperformance first_order_performance;
+
+   // Test
+
+   first_order_performance = sgd.calculate_mini_batch_performance_and_gradient(training_indices, 1.0/10.0);
+
+   assert_true(fabs(first_order_performance.performance - pf.calculate_performance()) < 1.0e-9, LOG);
+   assert_true((first_order_performance.gradient - pf.calculate_gradient()).calculate_absolute_value() < 1.0e-9, LOG);
+}
+
+
+void StochasticGradientDescentTest::test_calculate_momentum_parameters_increment(void)
+{
+   message += "test_calculate_momentum_parameters_increment\n";
+
+   StochasticGradientDescent sgd;
+
+   Vector<double> gradient(2);
+   gradient[0] = 1.0;
+   gradient[1] = -2.0;
+
+   Vector<double> velocity(2, 0.0);
+
+   Vector<double> parameters_increment;
+
+   sgd.set_learning_rate(0.1);
+   sgd.set_momentum(0.5);
+
+   // Test
+
+   parameters_increment = sgd.calculate_momentum_parameters_increment(gradient, velocity);
+
+   assert_true(fabs(parameters_increment[0] + 0.1) < 1.0e-12, LOG);
+   assert_true(fabs(parameters_increment[1] - 0.2) < 1.0e-12, LOG);
+   assert_true(velocity == parameters_increment, LOG);
+
+   // Test
+
+   parameters_increment = sgd.calculate_momentum_parameters_increment(gradient, velocity);
+
+   assert_true(fabs(parameters_increment[0] + 0.15) < 1.0e-12, LOG);
+   assert_true(fabs(parameters_increment[1] - 0.3) < 1.0e-12, LOG);
+}
+
+
+void StochasticGradientDescentTest::test_calculate_Nesterov_parameters_increment(void)
+{
+   message += "test_calculate_Nesterov_parameters_increment\n";
+
+   StochasticGradientDescent sgd;
+
+   Vector<double> gradient(2);
+   gradient[0] = 1.0;
+   gradient[1] = -2.0;
+
+   Vector<double> velocity(2, 0.0);
+
+   Vector<double> parameters_increment;
+
+   sgd.set_learning_rate(0.1);
+   sgd.set_momentum(0.5);
+
+   // Test
+
+   parameters_increment = sgd.calculate_Nesterov_parameters_increment(gradient, velocity);
+
+   assert_true(fabs(parameters_increment[0] + 0.15) < 1.0e-12, LOG);
+   assert_true(fabs(parameters_increment[1] - 0.3) < 1.0e-12, LOG);
+   assert_true(fabs(velocity[0] + 0.1) < 1.0e-12, LOG);
+   assert_true(fabs(velocity[1] - 0.2) < 1.0e-12, LOG);
+
+   // Test
+
+   parameters_increment = sgd.calculate_Nesterov_parameters_increment(gradient, velocity);
+
+   assert_true(fabs(parameters_increment[0] + 0.175) < 1.0e-12, LOG);
+   assert_true(fabs(parameters_increment[1] - 0.35) < 1.0e-12, LOG);
+}
+
+
+void StochasticGradientDescentTest::test_calculate_Adam_parameters_increment(void)
+{
+   message += "test_calculate_Adam_parameters_increment\n";
+
+   StochasticGradientDescent sgd;
+
+   Vector<double> gradient(2);
+   gradient[0] = 1.0;
+   gradient[1] = -2.0;
+
+   Vector<double> first_moment(2, 0.0);
+   Vector<double> second_moment(2, 0.0);
+
+   Vector<double> parameters_increment;
+
+   sgd.set_learning_rate(0.1);
+
+   // Test
+
+   parameters_increment = sgd.calculate_Adam_parameters_increment(gradient, first_moment, second_moment, 1);
+
+   assert_true(fabs(parameters_increment[0] + 0.1) < 1.0e-6, LOG);
+   assert_true(fabs(parameters_increment[1] - 0.1) < 1.0e-6, LOG);
+   assert_true(fabs(first_moment[1] + 0.2) < 1.0e-12, LOG);
+   assert_true(fabs(second_moment[1] - 0.004) < 1.0e-12, LOG);
+
+   // Test
+
+   parameters_increment = sgd.calculate_Adam_parameters_increment(gradient, first_moment, second_moment, 2);
+
+   assert_true(fabs(parameters_increment[0] + 0.1) < 1.0e-6, LOG);
+   assert_true(fabs(parameters_increment[1] - 0.1) < 1.0e-6, LOG);
+}
+
+
+void StochasticGradientDescentTest::test_perform_training(void)
+{
+   message += "test_perform_training\n";
+
+   DataSet ds(20, 1, 1);
+
+   Matrix<double> data(20, 2);
+
+   for(size_t i = 0; i < 20; i++)
+   {
+      data(i,0) = -1.0 + 2.0*(double)i/19.0;
+      data(i,1) = 0.5*data(i,0) - 0.25;
+   }
+
+   ds.set_data(data);
+   ds.get_instances_pointer()->set_training();
+
+   NeuralNetwork nn(1, 1);
+
+   PerformanceFunctional pf(&nn, &ds);
+
+   pf.destruct_all_terms();
+   pf.set_objective_type(PerformanceFunctional::SUM_SQUARED_ERROR_OBJECTIVE);
+
+   StochasticGradientDescent sgd(&pf);
+
+   StochasticGradientDescent::StochasticGradientDescentResults* results_pointer;
+
+   double old_performance;
+   double performance;
+
+   Vector<double> parameters;
+
+   sgd.set_display(false);
+   sgd.set_batch_size(5);
+   sgd.set_random_seed(3);
+   sgd.set_learning_rate(0.01);
+   sgd.set_maximum_epochs_number(10);
+
+   // Test
+
+   nn.initialize_parameters(1.0);
+
+   old_performance = pf.calculate_performance();
+
+   sgd.set_update_method(StochasticGradientDescent::Momentum);
+
+   results_pointer = sgd.perform_training();
+
+   performance = pf.calculate_performance();
+
+   assert_true(performance < old_performance, LOG);
+   assert_true(results_pointer->epochs_number == 10, LOG);
+   assert_true(results_pointer->performance_history.size() == 11, LOG);
+
+   delete results_pointer;
+
+   // Test
+
+   parameters = nn.arrange_parameters();
+
+   nn.initialize_parameters(1.0);
+
+   results_pointer = sgd.perform_training();
+
+   assert_true(nn.arrange_parameters() == parameters, LOG);
+   assert_true(pf.calculate_performance() == performance, LOG);
+
+   delete results_pointer;
+
+   // Test
+
+   nn.initialize_parameters(1.0);
+
+   sgd.set_random_seed(4);
+
+   results_pointer = sgd.perform_training();
+
+   assert_true(nn.arrange_parameters() != parameters, LOG);
+
+   delete results_pointer;
+
+   sgd.set_random_seed(3);
+
+   // Test
+
+   nn.initialize_parameters(1.0);
+
+   old_performance = pf.calculate_performance();
+
+   sgd.set_update_method(StochasticGradientDescent::Nesterov);
+
+   results_pointer = sgd.perform_training();
+
+   performance = pf.calculate_performance();
+
+   assert_true(performance < old_performance, LOG);
+
+   delete results_pointer;
+
+   // Test
+
+   nn.initialize_parameters(1.0);
+
+   old_performance = pf.calculate_performance();
+
+   sgd.set_update_method(StochasticGradientDescent::Adam);
+
+   results_pointer = sgd.perform_training();
+
+   performance = pf.calculate_performance();
+
+   assert_true(performance < old_performance, LOG);
+
+   delete results_pointer;
+
+   // Minkowski error
+
+   nn.initialize_parameters(1.0);
+
+   pf.set_objective_type(PerformanceFunctional::MINKOWSKI_ERROR_OBJECTIVE);
+
+   old_performance = pf.calculate_performance();
+
+   results_pointer = sgd.perform_training();
+
+   performance = pf.calculate_performance();
+
+   assert_true(performance < old_performance, LOG);
+
+   delete results_pointer;
+
+   // Cross-entropy error
+
+   for(size_t i = 0; i < 20; i++)
+   {
+      data(i,1) = data(i,0) > 0.0 ? 1.0 : 0.0;
+   }
+
+   ds.set_data(data);
+
+   nn.get_multilayer_perceptron_pointer()->get_layer_pointer(0)->set_activation_function(Perceptron::Logistic);
+   nn.initialize_parameters(0.0);
+
+   pf.set_objective_type(PerformanceFunctional::CROSS_ENTROPY_ERROR_OBJECTIVE);
+
+   old_performance = pf.calculate_performance();
+
+   results_pointer = sgd.perform_training();
+
+   performance = pf.calculate_performance();
+
+   assert_true(performance < old_performance, LOG);
+   assert_true(results_pointer->epochs_number == 10, LOG);
+
+   delete results_pointer;
+
+   // Root mean squared error
+
+   pf.set_objective_type(PerformanceFunctional::ROOT_MEAN_SQUARED_ERROR_OBJECTIVE);
+
+   bool rejected = false;
+
+   try
+   {
+      results_pointer = sgd.perform_training();
+
+      delete results_pointer;
+   }
+   catch(const std::logic_error&)
+   {
+      rejected = true;
+   }
+
+   assert_true(rejected, LOG);
+
+   pf.set_objective_type(PerformanceFunctional::SUM_SQUARED_ERROR_OBJECTIVE);
+
+   // Performance goal
+
+   nn.initialize_parameters(1.0);
+
+   sgd.set_performance_goal(1.0e99);
+
+   results_pointer = sgd.perform_training();
+
+   assert_true(results_pointer->epochs_number == 0, LOG);
+   assert_true(results_pointer->stopping_criterion == "Performance goal", LOG);
+
+   delete results_pointer;
+}
+
+
+void StochasticGradientDescentTest::test_resize_training_history(void)
+{
+   message += "test_resize_training_history\n";
+
+   StochasticGradientDescent sgd;
+
+   StochasticGradientDescent::StochasticGradientDescentResults sgdtr(&sgd);
+
+   // Test
+
+   sgdtr.resize_training_history(1);
+
+   assert_true(sgdtr.parameters_history.size() == 0, LOG);
+   assert_true(sgdtr.performance_history.size() == 1, LOG);
+
+   // Test
+
+   sgd.set_reserve_parameters_history(true);
+
+   sgdtr.resize_training_history(1);
+
+   assert_true(sgdtr.parameters_history.size() == 1, LOG);
+   assert_true(sgdtr.parameters_norm_history.size() == 1, LOG);
+
+   assert_true(sgdtr.performance_history.size() == 1, LOG);
+   assert_true(sgdtr.gradient_norm_history.size() == 1, LOG);
+   assert_true(sgdtr.generalization_performance_history.size() == 1, LOG);
+
+   assert_true(sgdtr.elapsed_time_history.size() == 1, LOG);
+}
+
+
+void StochasticGradientDescentTest::test_to_XML(void)
+{
+   message += "test_to_XML\n";
+
+   StochasticGradientDescent sgd;
+
+   tinyxml2::XMLDocument* document;
+
+   // Test
+
+   document = sgd.to_XML();
+   assert_true(document != NULL, LOG);
+
+   delete document;
+}
+
+
+void StochasticGradientDescentTest::test_from_XML(void)
+{
+   message += "test_from_XML\n";
+
+   StochasticGradientDescent sgd1;
+   StochasticGradientDescent sgd2;
+
+   tinyxml2::XMLDocument* document;
+
+   // Test
+
+   sgd1.set_update_method(StochasticGradientDescent::Nesterov);
+   sgd1.set_batch_size(7);
+   sgd1.set_random_seed(11);
+   sgd1.set_learning_rate(0.05);
+   sgd1.set_momentum(0.8);
+   sgd1.set_maximum_epochs_number(3);
+   sgd1.set_reserve_parameters_history(true);
+   sgd1.set_display(false);
+
+   document = sgd1.to_XML();
+
+   sgd2.from_XML(*document);
+
+   delete document;
+
+   assert_true(sgd2.get_update_method() == StochasticGradientDescent::Nesterov, LOG);
+   assert_true(sgd2.get_batch_size() == 7, LOG);
+   assert_true(sgd2.get_random_seed() == 11, LOG);
+   assert_true(sgd2.get_learning_rate() == 0.05, LOG);
+   assert_true(sgd2.get_momentum() == 0.8, LOG);
+   assert_true(sgd2.get_maximum_epochs_number() == 3, LOG);
+   assert_true(sgd2.get_reserve_parameters_history() == true, LOG);
+   assert_true(sgd2.get_display() == false, LOG);
+}
+
+
+void StochasticGradientDescentTest::run_test_case(void)
+{
+   message += "Running stochastic gradient descent test case...\n";
+
+   // Constructor and destructor methods
+
+   test_constructor();
+   test_destructor();
+
+   // Get methods
+
+   test_write_update_method();
+
+   // Set methods
+
+   test_set_update_method();
+   test_set_reserve_parameters_history();
+
+   // Training methods
+
+   test_arrange_mini_batches();
+
+   test_calculate_mini_batch_performance_and_gradient();
+
+   test_calculate_momentum_parameters_increment();
+   test_calculate_Nesterov_parameters_increment();
+   test_calculate_Adam_parameters_increment();
+
+   test_perform_training();
+
+   // Training history methods
+
+   test_resize_training_history();
+
+   // Serialization methods
+
+   test_to_XML();
+   test_from_XML();
+
+   message += "End of stochastic gradient descent test case.\n";
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (C) 2005-2015 Roberto Lopez.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
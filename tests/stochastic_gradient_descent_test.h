@@ -0,0 +1,105 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.artelnics.com/opennn                                                                                   */
+/*                                                                                                              */
+/*   S T O C H A S T I C   G R A D I E N T   D E S C E N T   T E S T   C L A S S   H E A D E R                  */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   Artelnics - Making intelligent use of data                                                                 */
+/*   robertolopez@artelnics.com                                                                                 */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __STOCHASTICGRADIENTDESCENTTEST_H__
+#define __STOCHASTICGRADIENTDESCENTTEST_H__
+
+// Unit testing includes
+
+#include "unit_testing.h"
+
+namespace OpenNN
+{
+
+class StochasticGradientDescentTest : public UnitTesting 
+{
+
+#define	STRING(x) #x
+#define TOSTRING(x) STRING(x)
+#define LOG __FILE__ ":" TOSTRING(__LINE__)"\n"
+
+public:
+
+   // GENERAL CONSTRUCTOR
+
+   explicit StochasticGradientDescentTest(void);
+
+   // DESTRUCTOR
+
+   virtual ~StochasticGradientDescentTest(void);
+
+
+   // METHODS
+
+   // Constructor and destructor methods
+
+   void test_constructor(void);
+   void test_destructor(void);
+
+   // Get methods
+
+   void test_write_update_method(void);
+
+   // Set methods
+
+   void test_set_update_method(void);
+   void test_set_reserve_parameters_history(void);
+
+   // Training methods
+
+   void test_arrange_mini_batches(void);
+
+   void test_calculate_mini_batch_performance_and_gradient(void);
+
+   void test_calculate_momentum_parameters_increment(void);
+   void test_calculate_Nesterov_parameters_increment(void);
+   void test_calculate_Adam_parameters_increment(void);
+
+   void test_perform_training(void);
+
+   // Training history methods
+
+   void test_resize_training_history(void);
+
+   // Serialization methods
+
+   void test_to_XML(void);
+   void test_from_XML(void);
+
+   // Unit testing methods
+
+   void run_test_case(void);
+
+};
+
+}
+
+#endif
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (C) 2005-2015 Roberto Lopez.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
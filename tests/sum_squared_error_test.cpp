@@ -283,6 +283,49 @@ void SumSquaredErrorTest::test_calculate_gradient(void)
    gradient = sse.calculate_gradient();
    numerical_gradient = nd.calculate_gradient(sse, &SumSquaredError::calculate_performance, parameters);
    assert_true((gradient - numerical_gradient).calculate_absolute_value() < 1.0e-3, LOG);
+
+   // Test
+
+   nn.set(3, 4, 2);
+   nn.randomize_parameters_normal();
+   parameters = nn.arrange_parameters();
+
+   ds.set(10, 3, 2);
+   ds.randomize_data_normal();
+
+   sse.set_batch_instances_number(3);
+
+   gradient = sse.calculate_gradient();
+   numerical_gradient = nd.calculate_gradient(sse, &SumSquaredError::calculate_performance, parameters);
+   assert_true((gradient - numerical_gradient).calculate_absolute_value() < 1.0e-3, LOG);
+
+   sse.set_batch_instances_number(1000);
+
+   assert_true((sse.calculate_gradient() - gradient).calculate_absolute_value() < 1.0e-9, LOG);
+
+   // Test
+
+#ifdef __APPLE__
+   ds.set_data_file_name("../../../../data/data.bin");
+#else
+   ds.set_data_file_name("../data/data.bin");
+#endif
+
+   ds.save_data_binary();
+
+   DataBlocks data_blocks(ds.get_data_file_name());
+   data_blocks.set_block_instances_number(4);
+
+   DataSet blocks_data_set;
+   blocks_data_set.set_data_blocks_pointer(&data_blocks);
+
+   *blocks_data_set.get_instances_pointer() = ds.get_instances();
+
+   SumSquaredError blocks_sse(&nn, &blocks_data_set);
+   blocks_sse.set_batch_instances_number(3);
+
+   assert_true(fabs(blocks_sse.calculate_performance() - sse.calculate_performance()) < 1.0e-9, LOG);
+   assert_true((blocks_sse.calculate_gradient() - gradient).calculate_absolute_value() < 1.0e-9, LOG);
 }
 
 
@@ -382,6 +425,52 @@ void SumSquaredErrorTest::test_calculate_Hessian(void)
 }
 
 
+void SumSquaredErrorTest::test_calculate_vector_dot_Hessian(void)
+{
+   message += "test_calculate_vector_dot_Hessian\n";
+
+   Vector<size_t> architecture(4);
+   architecture[0] = 3;
+   architecture[1] = 4;
+   architecture[2] = 3;
+   architecture[3] = 2;
+
+   NeuralNetwork nn(architecture);
+   nn.randomize_parameters_normal();
+
+   const size_t parameters_number = nn.count_parameters_number();
+
+   const Vector<double> parameters = nn.arrange_parameters();
+
+   DataSet ds(7, 3, 2);
+   ds.randomize_data_normal();
+
+   SumSquaredError sse(&nn, &ds);
+
+   sse.set_batch_instances_number(2);
+
+   Vector<double> vector(parameters_number);
+   vector.randomize_normal();
+
+   // The Hessian vector product is the directional derivative of the gradient
+
+   const double step = 1.0e-5;
+
+   nn.set_parameters(parameters + vector*step);
+   const Vector<double> forward_gradient = sse.calculate_gradient();
+
+   nn.set_parameters(parameters - vector*step);
+   const Vector<double> backward_gradient = sse.calculate_gradient();
+
+   nn.set_parameters(parameters);
+
+   const Vector<double> vector_Hessian_product = sse.calculate_vector_dot_Hessian(vector);
+
+   assert_true(vector_Hessian_product.size() == parameters_number, LOG);
+   assert_true((vector_Hessian_product - (forward_gradient - backward_gradient)/(2.0*step)).calculate_absolute_value() < 1.0e-4, LOG);
+}
+
+
 void SumSquaredErrorTest::test_calculate_terms(void)
 {
    message += "test_calculate_terms\n";
@@ -501,6 +590,77 @@ void SumSquaredErrorTest::test_calculate_terms_Jacobian(void)
    terms_Jacobian = sse.calculate_terms_Jacobian();
 
    assert_true(((terms_Jacobian.calculate_transpose()).dot(terms)*2.0 - gradient).calculate_absolute_value() < 1.0e-3, LOG);
+
+   // Test
+
+   nn.set(2, 3, 2);
+   nn.randomize_parameters_normal();
+   parameters = nn.arrange_parameters();
+
+   ds.set(7, 2, 2);
+   ds.randomize_data_normal();
+
+   sse.set_batch_instances_number(2);
+
+   terms_Jacobian = sse.calculate_terms_Jacobian();
+   numerical_Jacobian_terms = nd.calculate_Jacobian(sse, &SumSquaredError::calculate_terms, parameters);
+
+   assert_true((terms_Jacobian-numerical_Jacobian_terms).calculate_absolute_value() < 1.0e-3, LOG);
+}
+
+
+void SumSquaredErrorTest::test_calculate_second_order_terms(void)
+{
+   message += "test_calculate_second_order_terms\n";
+
+   NeuralNetwork nn(3, 4, 2);
+   nn.randomize_parameters_normal();
+
+   DataSet ds(11, 3, 2);
+   ds.randomize_data_normal();
+
+   SumSquaredError sse(&nn, &ds);
+
+   Vector<double> terms;
+   Matrix<double> terms_Jacobian;
+
+   PerformanceTerm::SecondOrderTerms second_order_terms;
+
+   // Test
+
+   sse.set_batch_instances_number(4);
+
+   terms = sse.calculate_terms();
+   terms_Jacobian = sse.calculate_terms_Jacobian();
+
+   second_order_terms = sse.calculate_second_order_terms();
+
+   assert_true(fabs(second_order_terms.performance - sse.calculate_performance()) < 1.0e-9, LOG);
+   assert_true((second_order_terms.JacobianT_dot_terms - terms_Jacobian.calculate_transpose().dot(terms)).calculate_absolute_value() < 1.0e-9, LOG);
+   assert_true((second_order_terms.JacobianT_dot_terms*2.0 - sse.calculate_gradient()).calculate_absolute_value() < 1.0e-9, LOG);
+   assert_true((second_order_terms.JacobianT_dot_Jacobian - terms_Jacobian.calculate_transpose().dot(terms_Jacobian)).calculate_absolute_value() < 1.0e-9, LOG);
+   assert_true(second_order_terms.JacobianT_dot_Jacobian.is_symmetric(), LOG);
+
+   // Test with several blocks of columns of the product of the Jacobian with itself
+
+   nn.set(5, 20, 3);
+   nn.randomize_parameters_normal();
+
+   ds.set(37, 5, 3);
+   ds.randomize_data_normal();
+
+   sse.set_batch_instances_number(5);
+
+   terms = sse.calculate_terms();
+   terms_Jacobian = sse.calculate_terms_Jacobian();
+
+   second_order_terms = sse.calculate_second_order_terms();
+
+   assert_true(fabs(second_order_terms.performance - sse.calculate_performance()) < 1.0e-9, LOG);
+   assert_true((second_order_terms.JacobianT_dot_terms - terms_Jacobian.calculate_transpose().dot(terms)).calculate_absolute_value() < 1.0e-9, LOG);
+   assert_true((second_order_terms.JacobianT_dot_terms*2.0 - sse.calculate_gradient()).calculate_absolute_value() < 1.0e-9, LOG);
+   assert_true((second_order_terms.JacobianT_dot_Jacobian - terms_Jacobian.calculate_transpose().dot(terms_Jacobian)).calculate_absolute_value() < 1.0e-9, LOG);
+   assert_true(second_order_terms.JacobianT_dot_Jacobian.is_symmetric(), LOG);
 }
 
 
@@ -640,12 +800,16 @@ void SumSquaredErrorTest::run_test_case(void)
 
    test_calculate_Hessian();
 
+   test_calculate_vector_dot_Hessian();
+
    // Objective terms methods
 
    test_calculate_terms();
 
    test_calculate_terms_Jacobian();
 
+   test_calculate_second_order_terms();
+
    // Serialization methods
 
    test_to_XML();   
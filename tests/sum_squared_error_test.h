@@ -60,12 +60,16 @@ public:
 
    void test_calculate_Hessian(void);
 
+   void test_calculate_vector_dot_Hessian(void);
+
    // Objective terms methods 
 
    void test_calculate_terms(void);
 
    void test_calculate_terms_Jacobian(void);
 
+   void test_calculate_second_order_terms(void);
+
    // Other methods
 
    void test_calculate_squared_errors(void);
@@ -143,6 +143,43 @@ void TestingAnalysisTest::test_calculate_target_output_data(void)
    assert_true(target_output_data[0].get_rows_number() == 1, LOG);
    assert_true(target_output_data[0].get_columns_number() == 2, LOG);
    assert_true(target_output_data[0] == 0.0, LOG);
+
+   // Test
+
+#ifdef __APPLE__
+   const std::string data_file_name = "../../../../data/data.bin";
+#else
+   const std::string data_file_name = "../data/data.bin";
+#endif
+
+   nn.set(3, 4, 2);
+   nn.randomize_parameters_normal();
+
+   ds.set(25, 3, 2);
+   ds.set_data_file_name(data_file_name);
+   ds.randomize_data_normal();
+   ds.get_instances_pointer()->split_random_indices();
+
+   ds.save_data_binary();
+
+   DataBlocks data_blocks(data_file_name);
+   data_blocks.set_block_instances_number(4);
+
+   DataSet blocks_ds;
+   blocks_ds.set_data_blocks_pointer(&data_blocks);
+   *blocks_ds.get_instances_pointer() = ds.get_instances();
+
+   TestingAnalysis blocks_ta(&nn, &blocks_ds);
+
+   target_output_data = ta.calculate_target_output_data();
+
+   const Vector< Matrix<double> > blocks_target_output_data = blocks_ta.calculate_target_output_data();
+
+   assert_true(blocks_target_output_data.size() == 2, LOG);
+
+   assert_true(blocks_target_output_data[0].get_rows_number() == ds.get_instances().count_testing_instances_number(), LOG);
+   assert_true((blocks_target_output_data[0] - target_output_data[0]).calculate_absolute_value() < 1.0e-12, LOG);
+   assert_true((blocks_target_output_data[1] - target_output_data[1]).calculate_absolute_value() < 1.0e-12, LOG);
 }
 
 
@@ -14,6 +14,7 @@
 QT = # Do not use Qt
 
 CONFIG += console
+CONFIG += c++11
 
 TARGET = opennntests
 
@@ -26,6 +27,7 @@ SOURCES += \
     variables_test.cpp \
     instances_test.cpp \
     missing_values_test.cpp \
+    spatial_index_test.cpp \
     data_set_test.cpp \
     plug_in_test.cpp \
     ordinary_differential_equations_test.cpp \
@@ -66,6 +68,7 @@ SOURCES += \
     newton_method_test.cpp \
     levenberg_marquardt_algorithm_test.cpp \
     gradient_descent_test.cpp \
+    stochastic_gradient_descent_test.cpp \
     evolutionary_algorithm_test.cpp \
     conjugate_gradient_test.cpp \
     model_selection_test.cpp \
@@ -89,6 +92,7 @@ HEADERS += \
     variables_test.h \
     instances_test.h \
     missing_values_test.h \
+    spatial_index_test.h \
     data_set_test.h \
     plug_in_test.h \
     ordinary_differential_equations_test.h \
@@ -129,6 +133,7 @@ HEADERS += \
     newton_method_test.h \
     levenberg_marquardt_algorithm_test.h \
     gradient_descent_test.h \
+    stochastic_gradient_descent_test.h \
     evolutionary_algorithm_test.h \
     conjugate_gradient_test.h \
     model_selection_test.h \
@@ -167,6 +167,48 @@ void VariablesTest::test_arrange_used_indices(void)
 }
 
 
+void VariablesTest::test_get_modifications_number(void)
+{
+   message += "test_get_modifications_number\n";
+
+   Variables v(3, 2);
+
+   size_t modifications_number;
+
+   // Test
+
+   assert_true(v.arrange_inputs_indices().size() == 3, LOG);
+   assert_true(v.count_targets_number() == 2, LOG);
+
+   modifications_number = v.get_modifications_number();
+
+   v.set_name(0, "x");
+
+   assert_true(v.get_modifications_number() == modifications_number, LOG);
+
+   // Test
+
+   v.set_use(1, Variables::Unused);
+
+   assert_true(v.get_modifications_number() != modifications_number, LOG);
+
+   assert_true(v.arrange_inputs_indices().size() == 2, LOG);
+   assert_true(v.arrange_inputs_indices()[1] == 2, LOG);
+   assert_true(v.arrange_unused_indices().size() == 1, LOG);
+   assert_true(v.arrange_used_indices().size() == 4, LOG);
+
+   // Test
+
+   modifications_number = v.get_modifications_number();
+
+   v.set_target();
+
+   assert_true(v.get_modifications_number() != modifications_number, LOG);
+   assert_true(v.count_inputs_number() == 0, LOG);
+   assert_true(v.arrange_targets_indices().size() == 5, LOG);
+}
+
+
 
 void VariablesTest::test_arrange_names(void)
 {
@@ -470,6 +512,8 @@ void VariablesTest::run_test_case(void)
    test_arrange_targets_indices();
    test_arrange_used_indices();
 
+   test_get_modifications_number();
+
    // Information methods
 
    test_arrange_names();
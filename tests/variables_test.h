@@ -61,6 +61,8 @@ public:
    void test_arrange_targets_indices(void);
    void test_arrange_used_indices(void);
 
+   void test_get_modifications_number(void);
+
    // Information methods 
 
    void test_arrange_names(void);
@@ -107,6 +107,37 @@ void VectorTest::test_destructor(void)
 }
 
 
+void VectorTest::test_assignment_operator(void)
+{
+   message += "test_assignment_operator\n";
+
+   Vector<double> a(3, 1.0);
+   Vector<double> b;
+
+   // Copy
+
+   b = a;
+
+   assert_true(a.size() == 3, LOG);
+   assert_true(b.size() == 3, LOG);
+   assert_true(b == 1.0, LOG);
+
+   // Move
+
+   Vector<double> c(std::move(b));
+
+   assert_true(c.size() == 3, LOG);
+   assert_true(c == 1.0, LOG);
+   assert_true(b.empty(), LOG);
+
+   b = std::move(c);
+
+   assert_true(b.size() == 3, LOG);
+   assert_true(b == 1.0, LOG);
+   assert_true(c.empty(), LOG);
+}
+
+
 void VectorTest::test_sum_operator(void)
 {
    message += "test_sum_operator\n";
@@ -160,7 +191,39 @@ void VectorTest::test_rest_operator(void)
    d.set(1, 0.0);
 
    assert_true(c == d, LOG);
-}
+
+   // Expiring operands
+
+   a.set(2, 3.0);
+   b.set(2, 1.0);
+
+   c = (a*2.0) - b;
+
+   d.set(2, 5.0);
+
+   assert_true(c == d, LOG);
+
+   c = a - (b*2.0);
+
+   d.set(2, 1.0);
+
+   assert_true(c == d, LOG);
+
+   c = (a*2.0) - (b*2.0);
+
+   d.set(2, 4.0);
+
+   assert_true(c == d, LOG);
+
+   c = (a - b) - 1.0;
+
+   d.set(2, 1.0);
+
+   assert_true(c == d, LOG);
+
+   assert_true(a == 3.0, LOG);
+   assert_true(b == 1.0, LOG);
+}
 
 
 void VectorTest::test_multiplication_operator(void)
@@ -239,7 +302,31 @@ void VectorTest::test_division_operator(void)
    d.set(1, 1.0);
 
    assert_true(c == d, LOG);
-}
+
+   // Expiring operands
+
+   a.set(2, 6.0);
+   b.set(2, 2.0);
+
+   c = a/(b + 1.0);
+
+   d.set(2, 2.0);
+
+   assert_true(c == d, LOG);
+
+   c = (a + 2.0)/(b*2.0);
+
+   assert_true(c == d, LOG);
+
+   c = (a/b)/3.0;
+
+   d.set(2, 1.0);
+
+   assert_true(c == d, LOG);
+
+   assert_true(a == 6.0, LOG);
+   assert_true(b == 2.0, LOG);
+}
 
 
 void VectorTest::test_sum_assignment_operator(void)
@@ -342,6 +429,78 @@ void VectorTest::test_division_assignment_operator(void)
 }
 
 
+void VectorTest::test_lazy(void)
+{
+   message += "test_lazy\n";
+
+   Vector<double> a(3, 2.0);
+   Vector<double> b(3, 3.0);
+   Vector<double> c;
+
+   // Test
+
+   c = a.lazy() + b.lazy();
+
+   assert_true(c.size() == 3, LOG);
+   assert_true(c == 5.0, LOG);
+
+   // Test
+
+   c = (a.lazy() - b.lazy())*2.0 + 1.0;
+
+   assert_true(c.size() == 3, LOG);
+   assert_true(c == -1.0, LOG);
+
+   // Test
+
+   Vector<double> d = 3.0*a.lazy()*b.lazy()/2.0;
+
+   assert_true(d.size() == 3, LOG);
+   assert_true(d == 9.0, LOG);
+
+   // Test
+
+   a[1] = 4.0;
+
+   c = a.lazy()/b.lazy() - 1.0;
+
+   assert_true(c == (a/b - 1.0), LOG);
+
+   // Test
+
+   c = a;
+
+   c = c.lazy() + a.lazy()*0.5;
+
+   assert_true(c == a*1.5, LOG);
+
+   // Test
+
+   c.set(3, 1.0);
+
+   c += a.lazy()*b.lazy();
+
+   assert_true(c == a*b + 1.0, LOG);
+
+   c -= a.lazy()*b.lazy();
+
+   assert_true(c == 1.0, LOG);
+
+   // Test
+
+   a.set(1000);
+   a.randomize_normal();
+
+   b.set(1000);
+   b.randomize_normal();
+
+   c = (a.lazy() + b.lazy()*0.5 - a.lazy()*b.lazy())*2.0;
+
+   assert_true(c.size() == 1000, LOG);
+   assert_true((c - (a + b*0.5 - a*b)*2.0).calculate_absolute_value() < 1.0e-12, LOG);
+}
+
+
 void VectorTest::test_equal_to_operator(void)
 {
    message += "test_equal_to_operator\n";
@@ -721,6 +880,27 @@ void VectorTest::test_calculate_sum(void)
    v.initialize(1);
 
    assert_true(v.calculate_sum() == 2, LOG);
+
+   // Test
+
+   Vector<double> w(1001);
+   w.randomize_normal();
+
+   double sum = 0.0;
+
+   for(size_t i = 0; i < w.size(); i++)
+   {
+      sum += w[i];
+   }
+
+   assert_true(fabs(w.calculate_sum() - sum) < 1.0e-9, LOG);
+
+   // Test
+
+   w.set(3000001, 0.5);
+
+   assert_true(w.calculate_sum() == 1500000.5, LOG);
+
 }
 
 
@@ -1350,6 +1530,43 @@ void VectorTest::test_calculate_closest_index(void)
 void VectorTest::test_calculate_sum_squared_error(void)
 {
    message += "test_calculate_sum_squared_error\n";
+
+   Vector<double> a;
+   Vector<double> b;
+
+   double sum_squared_error;
+
+   // Test
+
+   a.set(3, 1.0);
+   b.set(3, 3.0);
+
+   assert_true(a.calculate_sum_squared_error(b) == 12.0, LOG);
+
+   // Test
+
+   a.set(1001);
+   a.randomize_normal();
+
+   b.set(1001);
+   b.randomize_normal();
+
+   sum_squared_error = 0.0;
+
+   for(size_t i = 0; i < a.size(); i++)
+   {
+      sum_squared_error += (a[i] - b[i])*(a[i] - b[i]);
+   }
+
+   assert_true(fabs(a.calculate_sum_squared_error(b) - sum_squared_error) < 1.0e-9, LOG);
+   assert_true(fabs(a.calculate_distance(b) - sqrt(sum_squared_error)) < 1.0e-9, LOG);
+
+   // Test
+
+   a.set(2000003, 2.0);
+   b.set(2000003, 1.0);
+
+   assert_true(a.calculate_sum_squared_error(b) == 2000003.0, LOG);
 }
 
 
@@ -1365,6 +1582,127 @@ void VectorTest::test_calculate_root_mean_squared_error(void)
 }
 
 
+void VectorTest::test_calculate_Minkowski_error(void)
+{
+   message += "test_calculate_Minkowski_error\n";
+
+   Vector<double> a;
+   Vector<double> b;
+
+   double Minkowski_sum;
+
+   // Test
+
+   a.set(3, 2.0);
+   b.set(3, 0.0);
+
+   assert_true(fabs(a.calculate_Minkowski_error(b, 1.0) - 6.0) < 1.0e-12, LOG);
+   assert_true(fabs(a.calculate_Minkowski_error(b, 2.0) - sqrt(12.0)) < 1.0e-12, LOG);
+
+   // Test
+
+   a.set(1001);
+   a.randomize_normal();
+
+   b.set(1001);
+   b.randomize_normal();
+
+   Minkowski_sum = 0.0;
+
+   for(size_t i = 0; i < a.size(); i++)
+   {
+      Minkowski_sum += fabs(a[i] - b[i]);
+   }
+
+   assert_true(fabs(a.calculate_Minkowski_error(b, 1.0) - Minkowski_sum) < 1.0e-9, LOG);
+
+   // Test
+
+   Minkowski_sum = 0.0;
+
+   for(size_t i = 0; i < a.size(); i++)
+   {
+      Minkowski_sum += pow(fabs(a[i] - b[i]), 1.5);
+   }
+
+   assert_true(fabs(a.calculate_Minkowski_error(b, 1.5) - pow(Minkowski_sum, 1.0/1.5)) < 1.0e-9, LOG);
+}
+
+
+void VectorTest::test_vector_kernels(void)
+{
+   message += "test_vector_kernels\n";
+
+   // Block kernels for each instruction set
+
+   test_block_kernels(baseline_kernels::calculate_block_sum,
+                      baseline_kernels::calculate_block_dot,
+                      baseline_kernels::calculate_block_squared_distance,
+                      baseline_kernels::calculate_block_Minkowski_distance);
+
+#ifdef __OPENNN_RUNTIME_DISPATCH__
+
+   __builtin_cpu_init();
+
+   if(__builtin_cpu_supports("avx") && __builtin_cpu_supports("fma"))
+   {
+      test_block_kernels(avx_kernels::calculate_block_sum,
+                         avx_kernels::calculate_block_dot,
+                         avx_kernels::calculate_block_squared_distance,
+                         avx_kernels::calculate_block_Minkowski_distance);
+   }
+
+   if(__builtin_cpu_supports("avx512f"))
+   {
+      test_block_kernels(avx512_kernels::calculate_block_sum,
+                         avx512_kernels::calculate_block_dot,
+                         avx512_kernels::calculate_block_squared_distance,
+                         avx512_kernels::calculate_block_Minkowski_distance);
+   }
+
+#endif
+
+   test_block_kernels(OpenNN::calculate_block_sum,
+                      OpenNN::calculate_block_dot,
+                      OpenNN::calculate_block_squared_distance,
+                      OpenNN::calculate_block_Minkowski_distance);
+
+   // Parallel reductions
+
+   const size_t size = parallel_reduction_size + 3;
+
+   Vector<double> a(size);
+   a.randomize_normal();
+
+   Vector<double> b(size);
+   b.randomize_normal();
+
+   double sum = 0.0;
+   double dot = 0.0;
+   double squared_sum = 0.0;
+   double squared_distance = 0.0;
+   double Minkowski_1 = 0.0;
+   double Minkowski_3 = 0.0;
+
+   for(size_t i = 0; i < size; i++)
+   {
+      sum += a[i];
+      dot += a[i]*b[i];
+      squared_sum += a[i]*a[i];
+      squared_distance += (a[i] - b[i])*(a[i] - b[i]);
+      Minkowski_1 += fabs(a[i] - b[i]);
+      Minkowski_3 += pow(fabs(a[i] - b[i]), 3.0);
+   }
+
+   assert_true(fabs(calculate_sum_kernel(a.data(), size) - sum) <= 1.0e-9*(1.0 + fabs(sum)), LOG);
+   assert_true(fabs(calculate_dot_kernel(a.data(), b.data(), size) - dot) <= 1.0e-9*(1.0 + fabs(dot)), LOG);
+   assert_true(fabs(calculate_squared_sum_kernel(a.data(), size) - squared_sum) <= 1.0e-9*squared_sum, LOG);
+   assert_true(fabs(calculate_squared_distance_kernel(a.data(), b.data(), size) - squared_distance) <= 1.0e-9*squared_distance, LOG);
+   assert_true(fabs(calculate_Minkowski_kernel(a.data(), b.data(), size, 1.0) - Minkowski_1) <= 1.0e-9*Minkowski_1, LOG);
+   assert_true(fabs(calculate_Minkowski_kernel(a.data(), b.data(), size, 3.0) - Minkowski_3) <= 1.0e-9*Minkowski_3, LOG);
+}
+
+
 void VectorTest::test_calculate_norm(void)
 {
    message += "test_calculate_norm\n";
@@ -1377,6 +1715,13 @@ void VectorTest::test_calculate_norm(void)
    v.initialize(1);
 
    assert_true(fabs(v.calculate_norm() - sqrt(2.0)) < 1.0e-6, LOG);
+
+   // Test
+
+   v.set(1000003, 2.0);
+
+   assert_true(fabs(v.calculate_norm() - 2.0*sqrt(1000003.0)) < 1.0e-6, LOG);
+
 }
 
 
@@ -1464,6 +1809,24 @@ void VectorTest::test_dot_vector(void)
    c = a.dot(b);
 
    assert_true(c == dot(a, b), LOG);
+
+   // Test
+
+   a.set(1001);
+   a.randomize_normal();
+
+   b.set(1001);
+   b.randomize_normal();
+
+   c = 0.0;
+
+   for(size_t i = 0; i < a.size(); i++)
+   {
+      c += a[i]*b[i];
+   }
+
+   assert_true(fabs(a.dot(b) - c) < 1.0e-9, LOG);
+
 }
 
 
@@ -1715,6 +2078,34 @@ void VectorTest::test_calculate_less_rank(void)
     assert_true(rank[3] == 3, LOG);
     assert_true(rank[4] == 4, LOG);
     assert_true(rank[5] == 5, LOG);
+
+    // Test
+
+    v.set(200);
+    v.randomize_uniform(0.0, 10.0);
+
+    for(size_t i = 0; i < 200; i++)
+    {
+        v[i] = floor(v[i]);
+    }
+
+    rank = v.calculate_less_rank();
+
+    for(size_t i = 0; i < 200; i++)
+    {
+        for(size_t j = i+1; j < 200; j++)
+        {
+            if(v[i] <= v[j])
+            {
+                assert_true(rank[i] < rank[j], LOG);
+            }
+            else
+            {
+                assert_true(rank[i] > rank[j], LOG);
+            }
+        }
+    }
+
 }
 
 
@@ -1773,6 +2164,92 @@ void VectorTest::test_calculate_greater_rank(void)
 }
 
 
+void VectorTest::test_sort_less_indices(void)
+{
+   message += "test_sort_less_indices\n";
+
+   Vector<double> v;
+
+   Vector<size_t> sorted_indices;
+
+   // Test
+
+   v.set();
+
+   sorted_indices = v.sort_less_indices();
+
+   assert_true(sorted_indices.empty(), LOG);
+
+   // Test
+
+   v.set(5);
+   v[0] =  2.0;
+   v[1] = -1.0;
+   v[2] =  2.0;
+   v[3] =  0.0;
+   v[4] = -1.0;
+
+   sorted_indices = v.sort_less_indices();
+
+   assert_true(sorted_indices.size() == 5, LOG);
+
+   assert_true(sorted_indices[0] == 1, LOG);
+   assert_true(sorted_indices[1] == 4, LOG);
+   assert_true(sorted_indices[2] == 3, LOG);
+   assert_true(sorted_indices[3] == 0, LOG);
+   assert_true(sorted_indices[4] == 2, LOG);
+
+   // Test
+
+   v.set(100);
+   v.randomize_normal();
+
+   sorted_indices = v.sort_less_indices();
+
+   assert_true(v.arrange_subvector(sorted_indices).is_crescent(), LOG);
+   assert_true(sorted_indices == v.calculate_minimal_indices(100), LOG);
+}
+
+
+void VectorTest::test_sort_greater_indices(void)
+{
+   message += "test_sort_greater_indices\n";
+
+   Vector<double> v;
+
+   Vector<size_t> sorted_indices;
+
+   // Test
+
+   v.set(5);
+   v[0] =  2.0;
+   v[1] = -1.0;
+   v[2] =  2.0;
+   v[3] =  0.0;
+   v[4] = -1.0;
+
+   sorted_indices = v.sort_greater_indices();
+
+   assert_true(sorted_indices.size() == 5, LOG);
+
+   assert_true(sorted_indices[0] == 0, LOG);
+   assert_true(sorted_indices[1] == 2, LOG);
+   assert_true(sorted_indices[2] == 3, LOG);
+   assert_true(sorted_indices[3] == 1, LOG);
+   assert_true(sorted_indices[4] == 4, LOG);
+
+   // Test
+
+   v.set(100);
+   v.randomize_normal();
+
+   sorted_indices = v.sort_greater_indices();
+
+   assert_true(v.arrange_subvector(sorted_indices).is_decrescent(), LOG);
+   assert_true(sorted_indices == v.calculate_maximal_indices(100), LOG);
+}
+
+
 void VectorTest::test_calculate_linear_correlation(void)
 {
     message += "test_calculate_linear_correlation\n";
@@ -2037,6 +2514,10 @@ void VectorTest::run_test_case(void)
    test_constructor();
    test_destructor();
 
+   // Assignment operators
+
+   test_assignment_operator();
+
    // Arithmetic operators
 
    test_sum_operator();
@@ -2051,6 +2532,10 @@ void VectorTest::run_test_case(void)
    test_multiplication_assignment_operator();
    test_division_assignment_operator();
 
+   // Lazy expressions
+
+   test_lazy();
+
    // Equality and relational operators
 
    test_equal_to_operator();
@@ -2148,6 +2633,11 @@ void VectorTest::run_test_case(void)
    test_calculate_sum_squared_error();
    test_calculate_mean_squared_error();
    test_calculate_root_mean_squared_error();
+   test_calculate_Minkowski_error();
+
+   // Kernel methods
+
+   test_vector_kernels();
 
    test_apply_absolute_value();
 
@@ -2163,6 +2653,9 @@ void VectorTest::run_test_case(void)
    test_calculate_less_rank();
    test_calculate_greater_rank();
 
+   test_sort_less_indices();
+   test_sort_greater_indices();
+
    test_calculate_linear_correlation();
    test_calculate_linear_correlation_missing_values();
    test_calculate_linear_regression_parameters();
@@ -2187,6 +2680,56 @@ void VectorTest::run_test_case(void)
 }
 
 
+void VectorTest::test_block_kernels(double (*block_sum)(const double*, const size_t&),
+                                    double (*block_dot)(const double*, const double*, const size_t&),
+                                    double (*block_squared_distance)(const double*, const double*, const size_t&),
+                                    double (*block_Minkowski_distance)(const double*, const double*, const size_t&, const size_t&))
+{
+   // Sizes which are not multiples of the packet sizes, so that the remainders are also checked
+
+   const size_t sizes[] = {1, 3, 7, 13, 31, 1001, 65537};
+
+   Vector<double> a;
+   Vector<double> b;
+
+   double sum;
+   double dot;
+   double squared_distance;
+   double Minkowski_1;
+   double Minkowski_3;
+
+   for(size_t k = 0; k < sizeof(sizes)/sizeof(sizes[0]); k++)
+   {
+      a.set(sizes[k]);
+      a.randomize_normal();
+
+      b.set(sizes[k]);
+      b.randomize_normal();
+
+      sum = 0.0;
+      dot = 0.0;
+      squared_distance = 0.0;
+      Minkowski_1 = 0.0;
+      Minkowski_3 = 0.0;
+
+      for(size_t i = 0; i < sizes[k]; i++)
+      {
+         sum += a[i];
+         dot += a[i]*b[i];
+         squared_distance += (a[i] - b[i])*(a[i] - b[i]);
+         Minkowski_1 += fabs(a[i] - b[i]);
+         Minkowski_3 += pow(fabs(a[i] - b[i]), 3.0);
+      }
+
+      assert_true(fabs(block_sum(a.data(), sizes[k]) - sum) <= 1.0e-9*(1.0 + fabs(sum)), LOG);
+      assert_true(fabs(block_dot(a.data(), b.data(), sizes[k]) - dot) <= 1.0e-9*(1.0 + fabs(dot)), LOG);
+      assert_true(fabs(block_squared_distance(a.data(), b.data(), sizes[k]) - squared_distance) <= 1.0e-9*squared_distance, LOG);
+      assert_true(fabs(block_Minkowski_distance(a.data(), b.data(), sizes[k], 1) - Minkowski_1) <= 1.0e-9*Minkowski_1, LOG);
+      assert_true(fabs(block_Minkowski_distance(a.data(), b.data(), sizes[k], 3) - Minkowski_3) <= 1.0e-9*Minkowski_3, LOG);
+   }
+}
+
+
 double VectorTest::dot(const Vector<double>& vector, const Vector<double>& other_vector)
 {
     double dot_product = 0.0;
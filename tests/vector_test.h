@@ -66,6 +66,10 @@ public:
    void test_multiplication_assignment_operator(void);
    void test_division_assignment_operator(void);
 
+   // Lazy expressions
+
+   void test_lazy(void);
+
    // Equality and relational operators
 
    void test_equal_to_operator(void);
@@ -166,6 +170,11 @@ public:
    void test_calculate_sum_squared_error(void);
    void test_calculate_mean_squared_error(void);
    void test_calculate_root_mean_squared_error(void);
+   void test_calculate_Minkowski_error(void);
+
+   // Kernel methods
+
+   void test_vector_kernels(void);
    
    void test_apply_absolute_value(void);
 
@@ -181,6 +190,9 @@ public:
    void test_calculate_less_rank(void);
    void test_calculate_greater_rank(void);
 
+   void test_sort_less_indices(void);
+   void test_sort_greater_indices(void);
+
    void test_calculate_linear_correlation(void);
    void test_calculate_linear_correlation_missing_values(void);
 
@@ -210,6 +222,11 @@ private:
 
     static double dot(const Vector<double>&, const Vector<double>&);
 
+    void test_block_kernels(double (*)(const double*, const size_t&),
+                            double (*)(const double*, const double*, const size_t&),
+                            double (*)(const double*, const double*, const size_t&),
+                            double (*)(const double*, const double*, const size_t&, const size_t&));
+
 };
 
 